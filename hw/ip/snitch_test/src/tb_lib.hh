@@ -125,6 +125,8 @@ struct BootData {
     uint64_t tcdm_offset;
     uint64_t global_mem_start;
     uint64_t global_mem_end;
+    uint64_t cluster_num;
+    uint64_t dm_core_mask;
 };
 extern const BootData BOOTDATA;
 
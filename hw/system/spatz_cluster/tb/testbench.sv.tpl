@@ -151,6 +151,7 @@ module testharness (
    );
 % endif
 
+% if cfg['nr_clusters'] == 1:
   /*********
    *  DUT  *
    *********/
@@ -215,6 +216,96 @@ module testharness (
 % endif
     .cluster_probe_o (cluster_probe        )
   );
+% else:
+  /**************
+   *  Clusters  *
+   **************/
+
+  // The clusters share the simulation memory through a multiplexer, so their
+  // atomics on DRAM stay atomic. Cluster i is the same cluster with its hart
+  // IDs and address map shifted by i clusters. Clusters cannot reach each
+  // other's TCDM.
+  localparam int unsigned NumClusters        = ${cfg['nr_clusters']};
+  localparam int unsigned ClusterOffset      = ${to_sv_hex(cfg['cluster_base_offset'], cfg['addr_width'])};
+  localparam int unsigned SpatzAxiIdMemWidth = SpatzAxiIdOutWidth + $clog2(NumClusters);
+
+  typedef logic [SpatzAxiIdMemWidth-1:0] axi_id_mem_t;
+  `AXI_TYPEDEF_ALL(spatz_axi_mem, axi_addr_t, axi_id_mem_t, axi_data_t, axi_strb_t, axi_user_t)
+
+  spatz_axi_out_req_t  [NumClusters-1:0] axi_cluster_out_req;
+  spatz_axi_out_resp_t [NumClusters-1:0] axi_cluster_out_resp;
+  spatz_axi_in_req_t   [NumClusters-1:0] axi_cluster_in_req;
+  spatz_axi_in_resp_t  [NumClusters-1:0] axi_cluster_in_resp;
+  spatz_axi_mem_req_t                    axi_mem_req;
+  spatz_axi_mem_resp_t                   axi_mem_resp;
+
+  logic [NumClusters-1:0] cluster_probes;
+  logic                   cluster_probe;
+  logic [NumCores-1:0]    debug_req;
+
+  assign cluster_probe = |cluster_probes;
+
+  for (genvar i = 0; i < NumClusters; i++) begin: gen_clusters
+    spatz_cluster_wrapper i_cluster_wrapper (
+      .clk_i                   (clk_i                  ),
+      .rst_ni                  (rst_ni                 ),
+      .meip_i                  ('0                     ),
+      .msip_i                  ('0                     ),
+      .mtip_i                  ('0                     ),
+  % if cfg['enable_debug']:
+      .debug_req_i             (debug_req              ),
+  % endif
+      .hart_base_id_i          (10'(${cfg['cluster_base_hartid']} + i * NumCores)),
+      .cluster_base_addr_i     (SpatzAxiAddrWidth'(TCDMStartAddr + i * ClusterOffset)),
+      .axi_core_default_user_i (${to_sv_hex(cfg['cluster_default_axi_user'], cfg['user_width'])}),
+      .axi_out_req_o           (axi_cluster_out_req[i] ),
+      .axi_out_resp_i          (axi_cluster_out_resp[i]),
+      .axi_in_req_i            (axi_cluster_in_req[i]  ),
+      .axi_in_resp_o           (axi_cluster_in_resp[i] ),
+  % if cfg['axi_isolate_enable']:
+      //AXI Isolate
+      .axi_isolate_i           (1'b0                   ),
+      .axi_isolated_o          (                       ),
+  % endif
+      .cluster_probe_o         (cluster_probes[i]      )
+    );
+  end: gen_clusters
+
+  axi_mux #(
+    .SlvAxiIDWidth (SpatzAxiIdOutWidth      ),
+    .slv_aw_chan_t (spatz_axi_out_aw_chan_t ),
+    .mst_aw_chan_t (spatz_axi_mem_aw_chan_t ),
+    .w_chan_t      (spatz_axi_out_w_chan_t  ),
+    .slv_b_chan_t  (spatz_axi_out_b_chan_t  ),
+    .mst_b_chan_t  (spatz_axi_mem_b_chan_t  ),
+    .slv_ar_chan_t (spatz_axi_out_ar_chan_t ),
+    .mst_ar_chan_t (spatz_axi_mem_ar_chan_t ),
+    .slv_r_chan_t  (spatz_axi_out_r_chan_t  ),
+    .mst_r_chan_t  (spatz_axi_mem_r_chan_t  ),
+    .slv_req_t     (spatz_axi_out_req_t     ),
+    .slv_resp_t    (spatz_axi_out_resp_t    ),
+    .mst_req_t     (spatz_axi_mem_req_t     ),
+    .mst_resp_t    (spatz_axi_mem_resp_t    ),
+    .NoSlvPorts    (NumClusters             ),
+    .MaxWTrans     (${cfg['trans']}         ),
+    .FallThrough   (1'b0                    ),
+    .SpillAw       (1'b1                    ),
+    .SpillW        (1'b0                    ),
+    .SpillB        (1'b0                    ),
+    .SpillAr       (1'b1                    ),
+    .SpillR        (1'b0                    )
+  ) i_mem_mux (
+    .clk_i      (clk_i                 ),
+    .rst_ni     (rst_ni                ),
+    .test_i     (1'b0                  ),
+    .slv_reqs_i (axi_cluster_out_req ),
+    .slv_resps_o(axi_cluster_out_resp),
+    .mst_req_o  (axi_mem_req         ),
+    .mst_resp_i (axi_mem_resp        )
+  );
+
+% endif
+<% vcd_scope = 'i_cluster_wrapper' if cfg['nr_clusters'] == 1 else 'gen_clusters[0].i_cluster_wrapper' %>\
 /**************
  *  VCD Dump  *
  **************/
@@ -230,7 +321,7 @@ module testharness (
 
     // Dump signals of group 0
     $dumpfile(`VCD_DUMP_FILE);
-    $dumpvars(0, i_cluster_wrapper);
+    $dumpvars(0, ${vcd_scope});
     $dumpon;
 
     // Wait until the probe is low
@@ -244,6 +335,7 @@ module testharness (
   end: vcd_dump
 `endif
 
+% if cfg['nr_clusters'] == 1:
   /************************
    *  Simulation control  *
    ************************/
@@ -340,4 +432,105 @@ module testharness (
     .rsp_o (axi_from_cluster_resp)
   );
 
+% else:
+  /************************
+   *  Simulation control  *
+   ************************/
+
+  `REQRSP_TYPEDEF_ALL(reqrsp_cluster_in, axi_addr_t, narrow_axi_data_t, narrow_axi_strb_t)
+  reqrsp_cluster_in_req_t [NumClusters-1:0] to_cluster_req;
+  reqrsp_cluster_in_rsp_t [NumClusters-1:0] to_cluster_rsp;
+
+  for (genvar i = 0; i < NumClusters; i++) begin: gen_boot
+    reqrsp_to_axi #(
+      .DataWidth   (SpatzNarrowAxiDataWidth),
+      .UserWidth   (SpatzAxiUserWidth      ),
+      .axi_req_t   (spatz_axi_in_req_t     ),
+      .axi_rsp_t   (spatz_axi_in_resp_t    ),
+      .reqrsp_req_t(reqrsp_cluster_in_req_t),
+      .reqrsp_rsp_t(reqrsp_cluster_in_rsp_t)
+    ) i_axi_to_reqrsp (
+      .clk_i       (clk_i                 ),
+      .rst_ni      (rst_ni                ),
+      .user_i      ('0                    ),
+      .axi_req_o   (axi_cluster_in_req[i] ),
+      .axi_rsp_i   (axi_cluster_in_resp[i]),
+      .reqrsp_req_i(to_cluster_req[i]     ),
+      .reqrsp_rsp_o(to_cluster_rsp[i]     )
+    );
+  end: gen_boot
+
+  logic [31:0] entry_point;
+  initial begin
+    // Idle
+    to_cluster_req = '0;
+    debug_req      = '0;
+
+    // Wait for a while
+    repeat (10)
+      @(negedge clk_i);
+
+    // Load the entry point
+    entry_point = get_entry_point();
+    $display("Loading entry point: %0x", entry_point);
+
+    // Wait for a while
+    repeat (1000)
+      @(negedge clk_i);
+
+    // Store the entry point in every cluster
+    for (int i = 0; i < NumClusters; i++) begin
+      to_cluster_req[i] = '{
+        q: '{
+          addr   : PeriStartAddr + i * ClusterOffset + SPATZ_CLUSTER_PERIPHERAL_CLUSTER_BOOT_CONTROL_OFFSET,
+          data   : {32'b0, entry_point},
+          write  : 1'b1,
+          strb   : '1,
+          amo    : reqrsp_pkg::AMONone,
+          default: '0
+        },
+        q_valid: 1'b1,
+        p_ready: 1'b0
+      };
+      `wait_for(to_cluster_rsp[i].q_ready);
+      to_cluster_req[i] = '0;
+      `wait_for(to_cluster_rsp[i].p_valid);
+      to_cluster_req[i] = '{
+        p_ready: 1'b1,
+        q      : '{
+          amo    : reqrsp_pkg::AMONone,
+          default: '0
+        },
+        default: '0
+      };
+      @(negedge clk_i);
+      to_cluster_req[i] = '0;
+    end
+
+    // Wake up cores
+    debug_req = '1;
+    @(negedge clk_i);
+    debug_req = '0;
+  end
+
+  /********
+   *  L2  *
+   ********/
+
+  // Wide port into simulation memory, shared by all clusters.
+  tb_memory_axi #(
+    .AxiAddrWidth ( SpatzAxiAddrWidth    ),
+    .AxiDataWidth ( SpatzAxiDataWidth    ),
+    .AxiIdWidth   ( SpatzAxiIdMemWidth   ),
+    .AxiUserWidth ( SpatzAxiUserWidth    ),
+    .req_t        ( spatz_axi_mem_req_t  ),
+    .rsp_t        ( spatz_axi_mem_resp_t )
+  ) i_dma (
+    .clk_i (clk_i       ),
+    .rst_ni(rst_ni      ),
+    .req_i (axi_mem_req ),
+    .rsp_o (axi_mem_resp)
+  );
+
+% endif
 endmodule : testharness
@@ -13,6 +13,8 @@ const BootData BOOTDATA = {.boot_addr = ${hex(cfg['cluster']['boot_addr'])},
                            .tcdm_size = ${hex(cfg['cluster']['tcdm']['size'] * 1024)},
                            .tcdm_offset = ${hex(cfg['cluster']['cluster_base_offset'])},
                            .global_mem_start = ${hex(cfg['dram']['address'])},
-                           .global_mem_end = ${hex(cfg['dram']['address'] + cfg['dram']['length'])}};
+                           .global_mem_end = ${hex(cfg['dram']['address'] + cfg['dram']['length'])},
+                           .cluster_num = ${cfg['cluster']['nr_clusters']},
+                           .dm_core_mask = ${hex(sum(1 << i for i, core in enumerate(cfg['cluster']['cores']) if core.get('xdma', False)))}};
 
 }  // namespace sim
@@ -14,6 +14,8 @@ struct BootData {
     uint64_t tcdm_offset;
     uint64_t global_mem_start;
     uint64_t global_mem_end;
+    uint64_t cluster_num;
+    uint64_t dm_core_mask;
 };
 
 extern "C" const BootData BOOTDATA = {.boot_addr = ${hex(cfg['cluster']['boot_addr'])},
@@ -23,4 +25,6 @@ extern "C" const BootData BOOTDATA = {.boot_addr = ${hex(cfg['cluster']['boot_ad
                            .tcdm_size = ${hex(cfg['cluster']['tcdm']['size'] * 1024)},
                            .tcdm_offset = ${hex(cfg['cluster']['cluster_base_offset'])},
                            .global_mem_start = ${hex(cfg['dram']['address'])},
-                           .global_mem_end = ${hex(cfg['dram']['address'] + cfg['dram']['length'])}};
\ No newline at end of file
+                           .global_mem_end = ${hex(cfg['dram']['address'] + cfg['dram']['length'])},
+                           .cluster_num = ${cfg['cluster']['nr_clusters']},
+                           .dm_core_mask = ${hex(sum(1 << i for i, core in enumerate(cfg['cluster']['cores']) if core.get('xdma', False)))}};
\ No newline at end of file
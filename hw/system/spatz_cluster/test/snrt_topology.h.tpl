@@ -0,0 +1,41 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+${disclaimer}
+
+// Topology of the cluster for the software, fixed by the configuration. The
+// runtime includes it if it is on the include path (see `SNRT_TOPOLOGY_DIR`)
+// and turns the topology queries into constants.
+<%
+  cl = cfg['cluster']
+  cores = cl['cores']
+  dm_mask = sum(1 << i for i, core in enumerate(cores) if core.get('xdma', False))
+  dm_idx = min([i for i, core in enumerate(cores) if core.get('xdma', False)] or [0])
+%>
+#pragma once
+
+#define SNRT_TOPOLOGY 1
+
+/// Cores per cluster, including the DM cores
+#define SNRT_TOPO_CLUSTER_CORE_NUM ${len(cores)}
+/// Cores with a DMA, one bit per cluster-local core index
+#define SNRT_TOPO_CLUSTER_DM_CORE_MASK ${hex(dm_mask)}
+#define SNRT_TOPO_CLUSTER_DM_CORE_NUM ${bin(dm_mask).count('1')}
+/// First DM core
+#define SNRT_TOPO_CLUSTER_DM_CORE_IDX ${dm_idx}
+#define SNRT_TOPO_CLUSTER_COMPUTE_CORE_NUM ${len(cores) - bin(dm_mask).count('1')}
+#define SNRT_TOPO_CLUSTER_NUM ${cl.get('nr_clusters', 1)}
+
+/// TCDM of the first cluster, the others follow every `SNRT_TOPO_CLUSTER_OFFSET`
+#define SNRT_TOPO_TCDM_BASE ${hex(cl['cluster_base_addr'])}
+#define SNRT_TOPO_TCDM_SIZE ${hex(cl['tcdm']['size'] * 1024)}
+#define SNRT_TOPO_TCDM_BANKS ${cl['tcdm']['banks']}
+#define SNRT_TOPO_TCDM_BANK_WIDTH ${cl['data_width'] // 8}
+#define SNRT_TOPO_CLUSTER_OFFSET ${hex(cl['cluster_base_offset'])}
+
+/// Spatz vector unit of each core: FPUs and vector length in bits
+#define SNRT_TOPO_N_FPU ${cl['n_fpu']}
+#define SNRT_TOPO_VLEN ${cl['vlen']}
+/// Spatz with twice the TCDM bandwidth
+#define SNRT_TOPO_DOUBLE_BW ${int(cl.get('double_bw', 0))}
@@ -10,6 +10,8 @@ set(LLVM_PATH "/home/spatz" CACH PATH "Path to the LLVM RISCV installation")
 set(GCC_PATH "/home/spatz" CACHE PATH "Path to the GCC RISCV installation")
 set(RUNTIME_TRACE OFF CACHE BOOL "Enable runtime trace output")
 set(RUNTIME_PRINT OFF CACHE BOOL "Enable runtime debug output with printfs")
+set(RUNTIME_LOG_RING OFF CACHE BOOL "Buffer printf output in DRAM and print it at exit")
+set(RUNTIME_DM_WAIT_WFI OFF CACHE BOOL "Let harts waiting for the DM core sleep in wfi")
 set(SNITCH_TEST_PREFIX "")
 if (SNITCH_SIMULATOR)
     message(STATUS "Using RTL simulator: ${SNITCH_SIMULATOR}")
@@ -6,6 +6,25 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+/**
+ * @brief Identifies a queued transfer of the calling hart, see dm_wait_task
+ */
+typedef uint32_t dm_handle_t;
+
+/**
+ * @brief Descriptor of one transfer for dm_memcpy_batch_async. Set `nreps` to
+ * 0 for a 1D transfer of `size` bytes, the strides are ignored then.
+ */
+typedef struct {
+    uint64_t src;
+    uint64_t dst;
+    uint32_t size;
+    uint32_t sstrd;
+    uint32_t dstrd;
+    uint32_t nreps;
+    uint32_t cfg;
+} dm_desc_t;
+
 /**
  * @brief Init the data mover and load a pointer to the DM struct in to TLS.
  * Needs to be called by the DM itself and all harts that want to use the dm
@@ -34,9 +53,9 @@ void dm_exit(void);
  * @param dest destination pointer
  * @param src source pointer
  * @param n number of bytes to copy
- * @return transfer ID
+ * @return handle to wait for the transfer with dm_wait_task
  */
-void dm_memcpy_async(void *dest, const void *src, size_t n);
+dm_handle_t dm_memcpy_async(void *dest, const void *src, size_t n);
 
 /**
  * @brief Queue an asynchronus memory copy. The transfer is not started unless
@@ -50,10 +69,71 @@ void dm_memcpy_async(void *dest, const void *src, size_t n);
  * @param dstrd outer destination stride
  * @param nreps number of repetitions in outer dimension
  * @param cfg DMA configuration
+ * @return handle to wait for the transfer with dm_wait_task
+ */
+dm_handle_t dm_memcpy2d_async(uint64_t src, uint64_t dst, uint32_t size,
+                              uint32_t sstrd, uint32_t dstrd, uint32_t nreps,
+                              uint32_t cfg);
+
+/**
+ * @brief Queue an asynchronus N-D memory copy. The transfer is not started
+ * unless dm_start or dm_wait is issued
+ * @details block only if DM queue is full. The DM core issues it with
+ * `snrt_dma_start_nd`, see there for the layout of the arrays. They are copied
+ * into the queue and can be reused once the call returns.
+ *
+ * @param dest destination pointer
+ * @param src source pointer
+ * @param size size in inner dimension
+ * @param ndim number of strided dimensions
+ * @param dst_strides destination stride per dimension, innermost first
+ * @param src_strides source stride per dimension, innermost first
+ * @param repeats number of repetitions per dimension, innermost first
+ * @return handle to wait for the transfer with dm_wait_task
+ */
+dm_handle_t dm_memcpy_nd_async(void *dest, const void *src, size_t size,
+                               uint32_t ndim, const size_t *dst_strides,
+                               const size_t *src_strides,
+                               const size_t *repeats);
+
+/**
+ * @brief Queue several asynchronus memory copies at once. The transfers are
+ * not started unless dm_start or dm_wait is issued
+ * @details The entries are reserved with a single atomic operation and appear
+ * back to back in the queue. Blocks only while the queue is full.
+ *
+ * @param descs transfer descriptors
+ * @param n number of descriptors
+ * @return handle of the last transfer of the batch
+ */
+dm_handle_t dm_memcpy_batch_async(const dm_desc_t *descs, uint32_t n);
+
+/**
+ * @brief Number of transfers queued by the calling hart that completed
+ * @details Counts from dm_init on and wraps around
+ *
+ * @return uint32_t completion count
+ */
+uint32_t dm_completed(void);
+
+/**
+ * @brief Start the queued transfers and wait for those queued by the calling
+ * hart to complete. Unlike dm_wait, this does not wait for transfers of other
+ * harts.
+ */
+void dm_wait_own(void);
+
+/**
+ * @brief Start the queued transfers and wait for one transfer of the calling
+ * hart to complete
+ * @details Transfers complete in the order they were queued, so this also
+ * waits for all transfers the hart queued before. With DM_WAIT_WFI the hart
+ * sleeps in wfi until the DM core signals a completion through the
+ * cluster-local CLINT.
+ *
+ * @param handle handle returned when queueing the transfer
  */
-void dm_memcpy2d_async(uint64_t src, uint64_t dst, uint32_t size,
-                       uint32_t sstrd, uint32_t dstrd, uint32_t nreps,
-                       uint32_t cfg);
+void dm_wait_task(dm_handle_t handle);
 
 /**
  * @brief Trigger the start of queued transfers and exit immediately
@@ -0,0 +1,91 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "snrt.h"
+
+/**
+ * @brief Maximum number of input and of output operands of a pipeline
+ */
+#define SNRT_DMA_PIPELINE_MAX_OPERANDS 4
+
+/**
+ * @brief Describes how one operand is cut into tiles in DRAM
+ * @details Tile `i` starts at `base + i * tile_stride` and consists of
+ * `repeat` rows of `size` bytes, `stride` bytes apart. Use `repeat = 1` for 1D
+ * tiles. In L1, a tile is stored densely (`size * repeat` bytes).
+ */
+typedef struct {
+    void *base;
+    uint32_t size;
+    uint32_t repeat;
+    uint32_t stride;
+    uint32_t tile_stride;
+} snrt_dma_tile_desc_t;
+
+/**
+ * @brief Shared pipeline state, located in TCDM
+ */
+typedef struct {
+    uint32_t num_tiles;
+    uint32_t n_in;
+    uint32_t n_out;
+    snrt_dma_tile_desc_t in[SNRT_DMA_PIPELINE_MAX_OPERANDS];
+    snrt_dma_tile_desc_t out[SNRT_DMA_PIPELINE_MAX_OPERANDS];
+    void *buf_in[SNRT_DMA_PIPELINE_MAX_OPERANDS][2];
+    void *buf_out[SNRT_DMA_PIPELINE_MAX_OPERANDS][2];
+} snrt_dma_pipeline_t;
+
+/**
+ * @brief Per-core iterator over the tiles of a pipeline. Must be
+ * zero-initialized before the first call to `snrt_dma_pipeline_next_tile`.
+ */
+typedef struct {
+    /// Index of the current tile
+    uint32_t idx;
+    /// L1 buffers holding the inputs of the current tile
+    void *in[SNRT_DMA_PIPELINE_MAX_OPERANDS];
+    /// L1 buffers the outputs of the current tile have to be written to
+    void *out[SNRT_DMA_PIPELINE_MAX_OPERANDS];
+    uint32_t next;
+} snrt_dma_tile_t;
+
+/**
+ * @brief Set up a double-buffered DMA pipeline
+ * @details Must be called by all cores of the cluster. The DM core allocates
+ * the pipeline and two L1 buffers per operand; the allocation is not freed.
+ *
+ * @param in descriptors of the input operands
+ * @param n_in number of input operands
+ * @param out descriptors of the output operands
+ * @param n_out number of output operands
+ * @param num_tiles number of tiles every operand is cut into
+ * @return pointer to the pipeline, the same on all cores; 0 on all cores if
+ * `n_in` or `n_out` exceeds `SNRT_DMA_PIPELINE_MAX_OPERANDS` or L1 is full
+ */
+snrt_dma_pipeline_t *snrt_dma_pipeline_init(const snrt_dma_tile_desc_t *in,
+                                            uint32_t n_in,
+                                            const snrt_dma_tile_desc_t *out,
+                                            uint32_t n_out,
+                                            uint32_t num_tiles);
+
+/**
+ * @brief Advance to the next tile
+ * @details Must be called by all cores of the cluster, it synchronizes them
+ * with the hardware barrier. The DM core waits for the inputs of the next tile,
+ * starts writing back the outputs of the previous one and prefetches the
+ * inputs of the tile after, so the DMA runs while the compute cores work on
+ * `tile`. Once all tiles are consumed, the last outputs are written back and
+ * the call returns 0.
+ *
+ * Usage:
+ *   snrt_dma_tile_t t = {0};
+ *   while (snrt_dma_pipeline_next_tile(p, &t))
+ *       if (snrt_is_compute_core()) kernel(t.out[0], t.in[0], ...);
+ *
+ * @param p pipeline returned by `snrt_dma_pipeline_init`
+ * @param tile per-core iterator
+ * @return 1 if `tile` holds a tile to work on, 0 if the pipeline is drained
+ */
+int snrt_dma_pipeline_next_tile(snrt_dma_pipeline_t *p, snrt_dma_tile_t *tile);
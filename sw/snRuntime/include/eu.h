@@ -44,6 +44,13 @@ int eu_dispatch_push(void (*fn)(void *, uint32_t), uint32_t argc, void *data,
  */
 void eu_run_empty(uint32_t core_idx);
 
+/**
+ * @brief Set how long idle workers poll for the next parallel region before
+ * they sleep in `wfi`
+ * @param cycles number of cycles to poll, 0 to sleep right away
+ */
+void eu_set_spin_cycles(uint32_t cycles);
+
 /**
  * @brief Debugging info to printf
  * @details
@@ -66,6 +73,17 @@ void eu_mutex_release();
 uint32_t eu_get_workers_in_loop();
 uint32_t eu_get_workers_in_wfi();
 
+/**
+ * @brief Number of cores in the OpenMP team
+ * @details All cores of the cluster but the DM core, which is parked in the
+ * data mover. If the DM core is core 0 it is the main thread instead and takes
+ * part, the data mover is not available then.
+ */
+static inline uint32_t eu_num_threads(void) {
+    return snrt_cluster_dm_core_idx() == 0 ? snrt_cluster_core_num()
+                                           : snrt_cluster_compute_core_num();
+}
+
 //================================================================================
 // debug
 //================================================================================
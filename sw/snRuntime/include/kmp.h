@@ -9,6 +9,9 @@
 
 typedef void (*kmpc_micro)(kmp_int32 *global_tid, kmp_int32 *bound_tid, ...);
 
+/// Lock of a critical section or reduction, unused
+typedef kmp_int32 kmp_critical_name[8];
+
 extern _kmp_ptr32 *kmpc_args;
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -29,3 +32,17 @@ extern _kmp_ptr32 *kmpc_args;
 #else
 #define KMP_PRINTF(d, ...)
 #endif
+
+////////////////////////////////////////////////////////////////////////////////
+// tasking
+////////////////////////////////////////////////////////////////////////////////
+
+typedef kmp_int32 (*kmp_routine_entry_t)(kmp_int32, void *);
+
+/// Task as laid out by the compiler, followed by its privates. Identical to
+/// the one in the kmp.h file of the LLVM OpenMP runtime.
+typedef struct kmp_task {
+    void *shareds;
+    kmp_routine_entry_t routine;
+    kmp_int32 part_id;
+} kmp_task_t;
@@ -0,0 +1,83 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "snrt.h"
+
+/**
+ * @brief Deferred printf
+ * @details Stores the format string pointer and up to six arguments in the
+ * log ring of the calling hart instead of formatting them, which costs a few
+ * stores. The record is formatted with printf semantics when the ring is
+ * drained: at exit, or when the ring is full. The format string and the
+ * strings passed for `%s` must therefore stay valid until then, string
+ * literals are the typical case. Arguments are `float`, `double`, integers up
+ * to 64 bit, `char *` and `void *`; other pointers must be cast.
+ *
+ * Example: `snrt_log("tile %d took %u cycles\n", i, t1 - t0);`
+ */
+#define snrt_log(...) \
+    _SNRT_LOG_CAT(_SNRT_LOG_, _SNRT_LOG_NARGS(__VA_ARGS__))(__VA_ARGS__)
+
+/**
+ * @brief Write out and consume the records in the log ring of the calling
+ * hart now, through `write`, or the platform's output if it is NULL. Lets a
+ * program flush its records early, or capture them.
+ */
+void snrt_log_drain(void (*write)(const char *data, size_t len));
+
+/// Append `len` bytes of text to the log ring of the calling hart.
+void _snrt_log_text(const char *data, size_t len);
+/// Append a deferred record of `n` arguments to the log ring.
+void _snrt_log(const char *fmt, uint32_t n, const uint64_t *args);
+
+static inline uint64_t _snrt_log_int(uint64_t x) { return x; }
+static inline uint64_t _snrt_log_dbl(double x) {
+    union {
+        double d;
+        uint64_t u;
+    } v = {.d = x};
+    return v.u;
+}
+static inline uint64_t _snrt_log_ptr(const void *p) { return (uintptr_t)p; }
+
+#define _SNRT_LOG_ARG(x)                                    \
+    _Generic((x),                                           \
+        float: _snrt_log_dbl,                               \
+        double: _snrt_log_dbl,                              \
+        char *: _snrt_log_ptr,                              \
+        const char *: _snrt_log_ptr,                        \
+        void *: _snrt_log_ptr,                              \
+        const void *: _snrt_log_ptr,                        \
+        default: _snrt_log_int)(x)
+
+#define _SNRT_LOG_CAT(a, b) _SNRT_LOG_CAT_(a, b)
+#define _SNRT_LOG_CAT_(a, b) a##b
+#define _SNRT_LOG_NARGS(...) \
+    _SNRT_LOG_NARGS_(__VA_ARGS__, 6, 5, 4, 3, 2, 1, 0, _)
+#define _SNRT_LOG_NARGS_(f, a1, a2, a3, a4, a5, a6, n, ...) n
+
+#define _SNRT_LOG_0(f) _snrt_log(f, 0, 0)
+#define _SNRT_LOG_N(f, n, ...)                         \
+    do {                                               \
+        const uint64_t _snrt_log_args[] = __VA_ARGS__; \
+        _snrt_log(f, n, _snrt_log_args);               \
+    } while (0)
+#define _SNRT_LOG_1(f, a) _SNRT_LOG_N(f, 1, {_SNRT_LOG_ARG(a)})
+#define _SNRT_LOG_2(f, a, b) \
+    _SNRT_LOG_N(f, 2, {_SNRT_LOG_ARG(a), _SNRT_LOG_ARG(b)})
+#define _SNRT_LOG_3(f, a, b, c)                               \
+    _SNRT_LOG_N(f, 3, {_SNRT_LOG_ARG(a), _SNRT_LOG_ARG(b), \
+                       _SNRT_LOG_ARG(c)})
+#define _SNRT_LOG_4(f, a, b, c, d)                            \
+    _SNRT_LOG_N(f, 4, {_SNRT_LOG_ARG(a), _SNRT_LOG_ARG(b), \
+                       _SNRT_LOG_ARG(c), _SNRT_LOG_ARG(d)})
+#define _SNRT_LOG_5(f, a, b, c, d, e)                         \
+    _SNRT_LOG_N(f, 5, {_SNRT_LOG_ARG(a), _SNRT_LOG_ARG(b), \
+                       _SNRT_LOG_ARG(c), _SNRT_LOG_ARG(d), \
+                       _SNRT_LOG_ARG(e)})
+#define _SNRT_LOG_6(f, a, b, c, d, e, g)                      \
+    _SNRT_LOG_N(f, 6, {_SNRT_LOG_ARG(a), _SNRT_LOG_ARG(b), \
+                       _SNRT_LOG_ARG(c), _SNRT_LOG_ARG(d), \
+                       _SNRT_LOG_ARG(e), _SNRT_LOG_ARG(g)})
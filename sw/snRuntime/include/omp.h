@@ -56,19 +56,64 @@
 // types
 //================================================================================
 
+#ifndef OMPSTATIC_NUMTHREADS
+/**
+ * @brief Number of dynamically scheduled loops of a parallel region that can
+ * be in flight at once, e.g. with `nowait`. A thread that is this many loops
+ * ahead of the slowest one waits for it.
+ */
+#define OMP_DISPATCH_BUFS 2
+
+/**
+ * @brief Shared state of a dynamically scheduled loop. Iterations are counted
+ * from 0 and handed out with a fetch-add on `next`.
+ */
+typedef struct {
+    /// Number of the loop within the parallel region the buffer was claimed
+    /// for, and the one it is set up for
+    volatile uint32_t claimed;
+    volatile uint32_t epoch;
+    /// Next iteration to hand out
+    volatile uint32_t next;
+    /// Number of threads that ran out of iterations
+    volatile uint32_t done;
+    uint32_t nthreads;
+    uint32_t count;
+    int32_t start;
+    int32_t incr;
+    uint32_t chunk;
+    /// Non-zero for guided scheduling, `chunk` is the minimum then
+    uint32_t guided;
+} omp_dispatch_t;
+#endif
+
 typedef struct {
     char nbThreads;
 #ifndef OMPSTATIC_NUMTHREADS
-    int loop_epoch;
-    int loop_start;
-    int loop_end;
-    int loop_incr;
-    int loop_chunk;
-    int loop_is_setup;
-    int core_epoch[16];  // for dynamic scheduling
+    /// Number of the current parallel region, dynamic loops are numbered
+    /// within it
+    volatile uint32_t region;
+    omp_dispatch_t dispatch[OMP_DISPATCH_BUFS];
+    /// Number of `single` constructs of the region a thread has claimed
+    volatile uint32_t single;
 #endif
 } omp_team_t;
 
+/// Slot of a thread in the combining tree of `__kmpc_reduce`
+typedef struct {
+    /// Partial of the thread, valid while `ready` is set
+    void *volatile data;
+    /// Set by the thread, cleared by its parent once it combined the partial
+    volatile uint32_t ready;
+} omp_reduce_slot_t;
+
+typedef struct {
+    /// Incremented by the main thread when the result of a blocking reduction
+    /// is stored
+    volatile uint32_t release;
+    omp_reduce_slot_t slot[];
+} omp_reduce_t;
+
 typedef struct {
 #ifndef OMPSTATIC_NUMTHREADS
     omp_team_t plainTeam;
@@ -85,6 +130,11 @@ typedef struct {
      *
      */
     struct snrt_barrier *kmpc_barrier;
+    /**
+     * @brief Combining tree of the reduction clause, one slot per thread
+     *
+     */
+    omp_reduce_t *kmpc_reduce;
     /**
      * @brief Usually the arguments passed to __kmpc_fork_call would do a malloc
      * with the amount of arguments passed. This is too slow for our case and
@@ -130,17 +180,30 @@ static inline omp_t *omp_getData() { return omp_p; }
 static inline omp_team_t *omp_get_team(omp_t *_this) {
     return &_this->plainTeam;
 }
+static inline unsigned omp_team_threads(const omp_team_t *team) {
+    return team->nbThreads;
+}
 #else
 static inline const omp_t *omp_getData() { return &omp_p; }
 static inline const omp_team_t *omp_get_team(const omp_t *_this) {
     return &_this->plainTeam;
 }
+/// The team size is a compile-time constant in the static runtime, so loop
+/// partitioning, barriers and reductions fold it
+static inline unsigned omp_team_threads(const omp_team_t *team) {
+    (void)team;
+    return OMPSTATIC_NUMTHREADS;
+}
 #endif
 
 static inline unsigned omp_get_thread_num(void) {
     return snrt_cluster_core_idx();
 }
 
+static inline unsigned omp_get_num_threads(void) {
+    return omp_team_threads(omp_get_team(omp_getData()));
+}
+
 static inline void __attribute__((always_inline))
 parallelRegionExec(int32_t argc, void *data, void (*fn)(void *, uint32_t),
                    int num_threads) {
@@ -79,3 +79,22 @@ void snrt_start_perf_counter(enum snrt_perf_cnt perf_cnt,
 void snrt_stop_perf_counter(enum snrt_perf_cnt perf_cnt);
 void snrt_reset_perf_counter(enum snrt_perf_cnt);
 uint32_t snrt_get_perf_counter(enum snrt_perf_cnt perf_cnt);
+
+/// Maximum number of distinct regions per hart
+#define SNRT_PERF_MAX_REGIONS 16
+/// Maximum nesting depth of regions
+#define SNRT_PERF_MAX_DEPTH 8
+/// Maximum number of events selected with `snrt_perf_region_select`
+#define SNRT_PERF_MAX_EVENTS 8
+
+/// Select the counter events recorded by the regions of the calling hart,
+/// in addition to cycles. The cluster has fewer hardware counters than events
+/// can be selected, so each outermost region run counts the next group of
+/// events; repeated runs cover all of them.
+void snrt_perf_region_select(const enum snrt_perf_cnt_type *types, uint32_t n);
+/// Enter the region `name` on the calling hart. Regions nest and are
+/// identified by their name.
+void snrt_perf_region_begin(const char *name);
+/// Leave the innermost open region of the calling hart. All regions are
+/// printed as JSON lines when the program exits.
+void snrt_perf_region_end();
@@ -0,0 +1,19 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "snrt.h"
+
+/// Start sampling the program counter of the calling hart every `period`
+/// ticks of the machine timer (`mtime`). Each sample records `mepc` and the
+/// interrupted `ra`, which gives one level of call context. Samples are
+/// buffered in L1 and moved to DRAM; when the DRAM buffer is full, every other
+/// sample is dropped and the sampling period doubled. All samples are printed
+/// as JSON lines when the program exits, see `util/pc_profile.py`.
+/// Interrupts are globally enabled while sampling, and the timer interrupts
+/// wake the hart from `wfi`; code that sleeps must tolerate early wake-ups.
+/// On platforms without a CLINT (`SNRT_CLINT_BASE`), this does nothing.
+void snrt_profile_start(uint32_t period);
+/// Stop sampling on the calling hart.
+void snrt_profile_stop();
@@ -0,0 +1,40 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+#pragma once
+
+#include "snrt.h"
+
+/**
+ * @brief Element-wise reductions across the cores of a cluster
+ * @details Called by all cores of the cluster, each with its own array of `n`
+ * partials in TCDM. The partials are combined in a binomial tree with the
+ * vector unit; a core waits only for its children and is released as soon as
+ * its parent consumed its array, no cluster barrier is involved.
+ *
+ * `snrt_cluster_reduce_*` leaves the result in the array of cluster core 0;
+ * the arrays of the other cores are clobbered. `snrt_cluster_allreduce_*`
+ * leaves the result in the arrays of all cores.
+ *
+ * @param data partials of the calling core, overwritten
+ * @param n number of elements, the same on all cores
+ */
+void snrt_cluster_reduce_sum_f64(double *data, uint32_t n);
+void snrt_cluster_reduce_max_f64(double *data, uint32_t n);
+void snrt_cluster_reduce_min_f64(double *data, uint32_t n);
+void snrt_cluster_reduce_sum_f32(float *data, uint32_t n);
+void snrt_cluster_reduce_max_f32(float *data, uint32_t n);
+void snrt_cluster_reduce_min_f32(float *data, uint32_t n);
+void snrt_cluster_reduce_sum_f16(__fp16 *data, uint32_t n);
+void snrt_cluster_reduce_max_f16(__fp16 *data, uint32_t n);
+void snrt_cluster_reduce_min_f16(__fp16 *data, uint32_t n);
+
+void snrt_cluster_allreduce_sum_f64(double *data, uint32_t n);
+void snrt_cluster_allreduce_max_f64(double *data, uint32_t n);
+void snrt_cluster_allreduce_min_f64(double *data, uint32_t n);
+void snrt_cluster_allreduce_sum_f32(float *data, uint32_t n);
+void snrt_cluster_allreduce_max_f32(float *data, uint32_t n);
+void snrt_cluster_allreduce_min_f32(float *data, uint32_t n);
+void snrt_cluster_allreduce_sum_f16(__fp16 *data, uint32_t n);
+void snrt_cluster_allreduce_max_f16(__fp16 *data, uint32_t n);
+void snrt_cluster_allreduce_min_f16(__fp16 *data, uint32_t n);
@@ -8,6 +8,13 @@
 
 #include "encoding.h"
 
+// Cluster topology rendered by clustergen, if the build provides it
+#if defined(__has_include)
+#if __has_include(<snrt_topology.h>)
+#include <snrt_topology.h>
+#endif
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -31,12 +38,6 @@ extern "C" {
 #define snrt_max(a, b) ((a) > (b) ? (a) : (b))
 #endif
 
-inline static void *snrt_memset(void *ptr, int value, size_t num) {
-    for (uint32_t i = 0; i < num; ++i)
-        *((uint8_t *)ptr + i) = (unsigned char)value;
-    return ptr;
-}
-
 /// A slice of memory.
 typedef struct snrt_slice {
     uint64_t start;
@@ -78,16 +79,47 @@ extern uint32_t snrt_global_compute_core_num();
 extern uint32_t snrt_global_dm_core_idx();
 extern uint32_t snrt_global_dm_core_num();
 extern uint32_t snrt_cluster_core_base_hartid();
+extern uint32_t snrt_cluster_idx();
+#if defined(SNRT_TOPOLOGY) && !defined(SNRT_TOPOLOGY_OUTLINE)
+// The topology is known at compile time, the queries fold to constants or a
+// load of the TLS core index instead of chasing the team root
+extern __thread uint32_t _snrt_core_idx;
+static inline uint32_t snrt_cluster_core_idx() { return _snrt_core_idx; }
+static inline uint32_t snrt_cluster_core_num() {
+    return SNRT_TOPO_CLUSTER_CORE_NUM;
+}
+static inline uint32_t snrt_cluster_compute_core_idx() {
+    return _snrt_core_idx -
+           __builtin_popcount(SNRT_TOPO_CLUSTER_DM_CORE_MASK &
+                              ((1u << _snrt_core_idx) - 1));
+}
+static inline uint32_t snrt_cluster_compute_core_num() {
+    return SNRT_TOPO_CLUSTER_COMPUTE_CORE_NUM;
+}
+static inline uint32_t snrt_cluster_dm_core_idx() {
+    return SNRT_TOPO_CLUSTER_DM_CORE_IDX;
+}
+static inline uint32_t snrt_cluster_dm_core_num() {
+    return SNRT_TOPO_CLUSTER_DM_CORE_NUM;
+}
+static inline uint32_t snrt_cluster_num() { return SNRT_TOPO_CLUSTER_NUM; }
+static inline int snrt_is_dm_core() {
+    return (SNRT_TOPO_CLUSTER_DM_CORE_MASK >> _snrt_core_idx) & 1;
+}
+static inline int snrt_is_compute_core() {
+    return _snrt_core_idx < SNRT_TOPO_CLUSTER_CORE_NUM - 1;
+}
+#else
 extern uint32_t snrt_cluster_core_idx();
 extern uint32_t snrt_cluster_core_num();
 extern uint32_t snrt_cluster_compute_core_idx();
 extern uint32_t snrt_cluster_compute_core_num();
 extern uint32_t snrt_cluster_dm_core_idx();
 extern uint32_t snrt_cluster_dm_core_num();
-extern uint32_t snrt_cluster_idx();
 extern uint32_t snrt_cluster_num();
 extern int snrt_is_compute_core();
 extern int snrt_is_dm_core();
+#endif
 extern void snrt_wakeup(uint32_t mask);
 
 /// get pointer to barrier register
@@ -100,10 +132,17 @@ extern snrt_slice_t snrt_cluster_memory();
 /// set eoc bit and return code
 extern void snrt_set_eoc_and_return_code(int eoc_and_return_code);
 
+/// Broadcast `len` bytes from DRAM or the own cluster's TCDM to all clusters.
+/// Called by one core while all others call `snrt_bcast_recv`.
 extern void snrt_bcast_send(void *data, size_t len);
+/// Receive a broadcast into `data`, the same buffer on all cores of a cluster.
 extern void snrt_bcast_recv(void *data, size_t len);
 
 extern void *snrt_memcpy(void *dst, const void *src, size_t n);
+/// Fill memory with a byte value, using the vector unit or the DMA.
+extern void *snrt_memset(void *ptr, int value, size_t num);
+/// Zero memory, see `snrt_memset`.
+extern void snrt_bzero(void *ptr, size_t num);
 
 /// DMA runtime functions.
 /// A DMA transfer identifier.
@@ -123,10 +162,38 @@ extern snrt_dma_txid_t snrt_dma_start_2d_wideptr(uint64_t dst, uint64_t src,
 extern snrt_dma_txid_t snrt_dma_start_2d(void *dst, const void *src,
                                          size_t size, size_t dst_stride,
                                          size_t src_stride, size_t repeat);
+/// Number of strided dimensions `snrt_dma_start_nd` handles at once, more are
+/// split into one transfer per outermost index.
+#define SNRT_DMA_MAX_DIMS 8
+/// Initiate an asynchronous 3D DMA transfer. `repeat2` blocks of the 2D
+/// transfer described by the first six arguments, `dst_stride2` and
+/// `src_stride2` bytes apart.
+extern snrt_dma_txid_t snrt_dma_start_3d(void *dst, const void *src,
+                                         size_t size, size_t dst_stride1,
+                                         size_t src_stride1, size_t repeat1,
+                                         size_t dst_stride2, size_t src_stride2,
+                                         size_t repeat2);
+/// Initiate an asynchronous N-D DMA transfer. Dimension 0 of the stride and
+/// repeat arrays is the innermost one (the 2D one of `snrt_dma_start_2d`),
+/// `size` is the contiguous row. Contiguous dimensions are merged and the
+/// rest is issued as a series of 2D transfers; the returned ID is the one of
+/// the last, waiting for it waits for the whole transfer. Repeats must be
+/// non-zero.
+extern snrt_dma_txid_t snrt_dma_start_nd(void *dst, const void *src,
+                                         size_t size, uint32_t ndim,
+                                         const size_t *dst_strides,
+                                         const size_t *src_strides,
+                                         const size_t *repeats);
 /// Block until a transfer finishes.
 extern void snrt_dma_wait(snrt_dma_txid_t tid);
 /// Block until all operation on the DMA ceases.
 extern void snrt_dma_wait_all();
+/// Return non-zero if a transfer finished, does not block.
+extern int snrt_dma_test(snrt_dma_txid_t tid);
+/// Block until any of the `n` transfers in `tids` finishes and return the
+/// index in `tids` of the oldest finished one, whatever their order in `tids`.
+/// Use it to service several independent streams from one core.
+extern uint32_t snrt_dma_wait_any(const snrt_dma_txid_t *tids, uint32_t n);
 
 /**
  * @brief Use as replacement of the stdlib exit() call
@@ -216,6 +283,8 @@ extern void snrt_int_clint_set(uint32_t reg_off, uint32_t mask);
 extern void snrt_int_sw_poll(void);
 extern void snrt_int_cluster_clr(uint32_t mask);
 extern void snrt_int_cluster_set(uint32_t mask);
+/// Cluster interrupts taken by the ISR on this hart, for code that polls mip
+extern __thread volatile uint32_t _snrt_int_cluster_taken;
 
 /**
  * @brief Put the hart into wait for interrupt state
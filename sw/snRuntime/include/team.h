@@ -26,6 +26,31 @@ struct snrt_allocator {
     struct snrt_allocator_inst l3;
 };
 
+/// Cluster-local state of `snrt_bcast_send` and `snrt_bcast_recv`
+struct snrt_bcast_local {
+    /// Sequence number of the last broadcast that arrived in this cluster
+    volatile uint32_t seq;
+    /// Destination of the receivers of this cluster and the sequence number
+    /// of the broadcast it is posted for, needed when the copying core is the
+    /// sender itself
+    void *volatile dst;
+    volatile uint32_t posted;
+};
+
+/// Maximum number of cores of a cluster, core masks are 32 bit wide
+#define SNRT_CLUSTER_MAX_CORES 32
+
+/// Cluster-local state of the `snrt_cluster_reduce_*` combining tree
+struct snrt_reduce_local {
+    /// Partials of each core
+    void *volatile data[SNRT_CLUSTER_MAX_CORES];
+    /// Sequence number of the last reduction each core has combined its
+    /// subtree for
+    volatile uint32_t ready[SNRT_CLUSTER_MAX_CORES];
+    /// Number of cores that copied an allreduce result, cumulative
+    volatile uint32_t copied;
+};
+
 // This struct is placed at the end of each clusters TCDM
 struct snrt_team_root {
     struct snrt_team base;
@@ -36,10 +61,61 @@ struct snrt_team_root {
     uint32_t cluster_num;
     uint32_t cluster_core_base_hartid;
     uint32_t cluster_core_num;
+    /// Cluster-local core indices of the cores with a DMA (Xdma), the same in
+    /// every cluster. All other cores are compute cores.
+    uint32_t cluster_dm_core_mask;
     snrt_slice_t global_mem;
     snrt_slice_t cluster_mem;
     struct snrt_allocator allocator;
     struct snrt_barrier cluster_barrier;
     uint32_t barrier_reg_ptr;
     struct snrt_peripherals peripherals;
+    struct snrt_bcast_local bcast;
+    struct snrt_reduce_local reduce;
+    /// Cluster core index + 1 of the hart whose performance regions own the
+    /// cluster's performance counters, 0 if they are free
+    volatile uint32_t perf_cnt_owner;
+    /// Used by core 0 to hand the team created by `snrt_team_split` to the
+    /// other cores of the cluster
+    struct snrt_subteam *volatile subteam;
+    /// Used by the DM core to hand the pipeline created by
+    /// `snrt_dma_pipeline_init` to the other cores of the cluster
+    void *volatile dma_pipeline;
 };
+
+/// A subset of the cores of a cluster, created with `snrt_team_split`
+struct snrt_subteam {
+    /// Cluster-local core indices of the members
+    uint32_t mask;
+    /// Number of members
+    uint32_t size;
+    /// Non-zero if all cores of the cluster are members, the cluster hardware
+    /// barrier can be used then
+    uint32_t hw;
+    /// Software barrier state
+    volatile uint32_t count;
+    volatile uint32_t sense;
+};
+
+/**
+ * @brief Create a team of the cluster cores in `mask`
+ * @details Must be called by all cores of the cluster with the same mask. The
+ * team is allocated in L1 and never freed.
+ *
+ * @param mask bit i set if cluster core i is a member
+ * @return the team on members, NULL on all other cores
+ */
+struct snrt_subteam *snrt_team_split(uint32_t mask);
+
+/**
+ * @brief Synchronize the members of a team
+ * @details Uses the cluster hardware barrier if the team spans the whole
+ * cluster, a sense-reversing barrier in L1 otherwise.
+ */
+void snrt_team_barrier(struct snrt_subteam *team);
+
+/**
+ * @brief Index of the calling core within a team, counting members in
+ * cluster core order
+ */
+uint32_t snrt_team_rank(const struct snrt_subteam *team);
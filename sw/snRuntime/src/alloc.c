@@ -45,7 +45,14 @@ void *snrt_l1alloc(size_t size) {
 void *snrt_l3alloc(size_t size) {
     struct snrt_allocator_inst *alloc = &snrt_current_team()->allocator.l3;
 
-    // TODO: L3 alloc size check
+    // The region may end at the top of the address space, compare sizes
+    if (size > alloc->size - (alloc->next - alloc->base)) {
+        snrt_trace(
+            SNRT_TRACE_ALLOC,
+            "Not enough memory to allocate: base %#x size %#x next %#x\n",
+            alloc->base, alloc->size, alloc->next);
+        return 0;
+    }
 
     void *ret = (void *)alloc->next;
     alloc->next += size;
@@ -54,7 +61,8 @@ void *snrt_l3alloc(size_t size) {
 
 /**
  * @brief Init the allocator
- * @details
+ * @details The L3 memory behind `_edram` is split evenly among the clusters,
+ * so their allocations do not overlap.
  *
  * @param snrt_team_root pointer to the team structure
  * @param l3off Number of bytes to skip on _edram before starting allocator
@@ -68,9 +76,12 @@ void snrt_alloc_init(struct snrt_team_root *team, uint32_t l3off) {
     team->allocator.l1.next = team->allocator.l1.base;
     // Allocator in L3 shared memory
     extern uint32_t _edram;
-    team->allocator.l3.base =
-        ALIGN_UP((uint32_t)_edram + l3off, MIN_CHUNK_SIZE);
-    ;
-    team->allocator.l3.size = 0;
+    uint32_t l3_start = ALIGN_UP((uint32_t)&_edram + l3off, MIN_CHUNK_SIZE);
+    uint32_t l3_size =
+        ALIGN_DOWN((uint32_t)((team->global_mem.end - l3_start) /
+                              team->cluster_num),
+                   MIN_CHUNK_SIZE);
+    team->allocator.l3.base = l3_start + team->cluster_idx * l3_size;
+    team->allocator.l3.size = l3_size;
     team->allocator.l3.next = team->allocator.l3.base;
 }
@@ -33,24 +33,35 @@ void snrt_cluster_sw_barrier() {
 static volatile struct snrt_barrier global_barrier
     __attribute__((section(".dram")));
 
-/// Synchronize clusters globally with a global software barrier
+/// Sense of the last global barrier the cluster's representative took part in
+static __thread uint32_t global_barrier_sense;
+
+/// Synchronize clusters globally with a hierarchical barrier
 void snrt_global_barrier() {
-    // Remember previous iteration
-    volatile struct snrt_barrier *barrier_ptr = &global_barrier;
-    uint32_t prev_barrier_iteration = barrier_ptr->barrier_iteration;
-    uint32_t barrier =
-        __atomic_add_fetch(&barrier_ptr->barrier, 1, __ATOMIC_RELAXED);
+    // Gather the cluster in hardware first, so only one core per cluster
+    // touches DRAM
+    snrt_cluster_hw_barrier();
 
-    // Increment the barrier counter
-    if (barrier == snrt_global_core_num()) {
-        barrier_ptr->barrier = 0;
-        __atomic_add_fetch(&barrier_ptr->barrier_iteration, 1,
-                           __ATOMIC_RELAXED);
-    } else {
-        // Some threads have not reached the barrier --> Let's wait
-        while (prev_barrier_iteration == barrier_ptr->barrier_iteration)
-            ;
+    if (snrt_cluster_num() > 1 && snrt_cluster_core_idx() == 0) {
+        // Sense-reversing barrier among the cluster representatives: the last
+        // one to arrive flips the shared sense, the others spin on it
+        uint32_t sense = !global_barrier_sense;
+        global_barrier_sense = sense;
+        volatile struct snrt_barrier *barrier_ptr = &global_barrier;
+        uint32_t arrived =
+            __atomic_add_fetch(&barrier_ptr->barrier, 1, __ATOMIC_RELAXED);
+        if (arrived == snrt_cluster_num()) {
+            barrier_ptr->barrier = 0;
+            __atomic_store_n(&barrier_ptr->barrier_iteration, sense,
+                             __ATOMIC_RELEASE);
+        } else {
+            while (barrier_ptr->barrier_iteration != sense)
+                ;
+        }
     }
+
+    // Local release
+    snrt_cluster_hw_barrier();
 }
 
 /**
@@ -0,0 +1,177 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "snrt.h"
+#include "team.h"
+
+//================================================================================
+// Settings
+//================================================================================
+
+/**
+ * @brief Maximum number of clusters a broadcast can reach.
+ *
+ */
+#define BCAST_MAX_CLUSTERS 64
+
+//================================================================================
+// Types
+//================================================================================
+
+typedef struct {
+    // data and size of the current broadcast, as passed to snrt_bcast_send
+    const void *volatile src;
+    volatile uint32_t len;
+    // cluster of the sender
+    volatile uint32_t root;
+    // sequence number of the last published broadcast
+    volatile uint32_t seq;
+    // DRAM copy of the data the other clusters copy from, published by the
+    // sender's cluster
+    const void *volatile pub;
+    // per cluster: sequence number of the last broadcast that arrived there
+    volatile uint32_t ready[BCAST_MAX_CLUSTERS];
+    // DRAM bounce buffer for TCDM sources
+    void *stage;
+    uint32_t stage_size;
+} bcast_t;
+
+//================================================================================
+// Data
+//================================================================================
+
+/**
+ * @brief Broadcast state shared by all clusters
+ */
+static bcast_t bcast;
+
+/**
+ * @brief Number of broadcasts the calling core took part in. All cores take
+ * part in every broadcast, so this is the sequence number of the next one.
+ */
+static __thread uint32_t bcast_epoch;
+
+//================================================================================
+// Private
+//================================================================================
+
+static inline int bcast_is_copier() {
+    return snrt_cluster_core_idx() == snrt_cluster_dm_core_idx();
+}
+
+static inline int bcast_in_dram(const void *p) {
+    snrt_slice_t dram = snrt_global_memory();
+    return (uintptr_t)p >= dram.start && (uintptr_t)p < dram.end;
+}
+
+static void bcast_wait_ready(uint32_t cluster, uint32_t seq) {
+    while (__atomic_load_n(&bcast.ready[cluster], __ATOMIC_ACQUIRE) != seq)
+        ;
+}
+
+/**
+ * @brief Copy broadcast `seq` into the buffer `dst` of the own cluster
+ * @details Run by one DMA core per cluster. The sender's cluster copies from
+ * the source and publishes a DRAM copy, staging a TCDM source through DRAM;
+ * the clusters cannot reach each other's TCDM. All other clusters copy from
+ * the published DRAM copy. Releases the cores of the cluster once the data
+ * arrived.
+ */
+static void bcast_copy(void *dst, uint32_t seq) {
+    struct snrt_bcast_local *local = &snrt_current_team()->bcast;
+    uint32_t cluster = snrt_cluster_idx();
+
+    while (__atomic_load_n(&bcast.seq, __ATOMIC_ACQUIRE) != seq)
+        ;
+    const void *src = bcast.src;
+    uint32_t len = bcast.len;
+    uint32_t root = bcast.root;
+
+    if (cluster != root) {
+        bcast_wait_ready(root, seq);
+        src = bcast.pub;
+    }
+    if (dst != src) snrt_dma_wait(snrt_dma_start_1d(dst, src, len));
+
+    if (cluster == root) {
+        const void *pub = src;
+        if (!bcast_in_dram(src)) {
+            if (bcast.stage_size < len) {
+                bcast.stage = snrt_l3alloc(len);
+                bcast.stage_size = len;
+            }
+            snrt_dma_wait(snrt_dma_start_1d(bcast.stage, dst, len));
+            pub = bcast.stage;
+        }
+        bcast.pub = pub;
+    }
+    __atomic_store_n(&bcast.ready[cluster], seq, __ATOMIC_RELEASE);
+    __atomic_store_n(&local->seq, seq, __ATOMIC_RELEASE);
+}
+
+//================================================================================
+// Public
+//================================================================================
+
+/**
+ * @brief Broadcast `len` bytes at `data` to all clusters
+ * @details Called by exactly one core of the system while all others call
+ * `snrt_bcast_recv`. `data` can be in DRAM or in the TCDM of the own cluster.
+ * The DMA core of the sender's cluster fetches the data, the other clusters
+ * copy it from DRAM. Returns once every cluster has its copy, `data` can be
+ * reused then.
+ *
+ * @param data source of the broadcast
+ * @param len number of bytes
+ */
+void snrt_bcast_send(void *data, size_t len) {
+    uint32_t seq = ++bcast_epoch;
+    uint32_t n = snrt_cluster_num();
+
+    // The previous broadcast must have arrived everywhere before its
+    // descriptor is overwritten
+    for (uint32_t c = 0; c < n; c++) bcast_wait_ready(c, seq - 1);
+    bcast.src = data;
+    bcast.len = len;
+    bcast.root = snrt_cluster_idx();
+    __atomic_store_n(&bcast.seq, seq, __ATOMIC_RELEASE);
+
+    if (bcast_is_copier()) {
+        // Copy into the buffer the receivers of this cluster posted
+        struct snrt_bcast_local *local = &snrt_current_team()->bcast;
+        while (__atomic_load_n(&local->posted, __ATOMIC_ACQUIRE) != seq)
+            ;
+        bcast_copy(local->dst, seq);
+    }
+
+    for (uint32_t c = 0; c < n; c++) bcast_wait_ready(c, seq);
+}
+
+/**
+ * @brief Receive the data of `snrt_bcast_send`
+ * @details Called by all cores but the sender. `data` is the cluster-shared
+ * destination, all cores of a cluster must pass the same buffer. It may be
+ * the source itself in the sender's cluster, nothing is copied there then.
+ * The DMA core of each cluster copies, the others wait on a flag in TCDM.
+ * Must not be used while the DMA core runs the DM task queue.
+ *
+ * @param data destination of the broadcast, usually in TCDM
+ * @param len number of bytes, the same as passed to the sender
+ */
+void snrt_bcast_recv(void *data, size_t len) {
+    (void)len;
+    uint32_t seq = ++bcast_epoch;
+    struct snrt_bcast_local *local = &snrt_current_team()->bcast;
+
+    if (bcast_is_copier()) {
+        bcast_copy(data, seq);
+        return;
+    }
+
+    // All receivers post the same buffer, in case the copier is the sender
+    local->dst = data;
+    __atomic_store_n(&local->posted, seq, __ATOMIC_RELEASE);
+    while (__atomic_load_n(&local->seq, __ATOMIC_ACQUIRE) != seq)
+        ;
+}
@@ -22,10 +22,34 @@
 
 /**
  * @brief Number of outstanding transactions to buffer. Each requires
- * sizeof(dm_task_t) bytes
+ * sizeof(dm_task_t) bytes. Must be a power of two, can be overridden at
+ * compile time.
  *
  */
-#define DM_TASK_QUEUE_SIZE 4
+#ifndef DM_TASK_QUEUE_SIZE
+#define DM_TASK_QUEUE_SIZE 16
+#endif
+_Static_assert(DM_TASK_QUEUE_SIZE > 0 &&
+                   (DM_TASK_QUEUE_SIZE & (DM_TASK_QUEUE_SIZE - 1)) == 0,
+               "DM_TASK_QUEUE_SIZE must be a power of two");
+
+/**
+ * @brief Number of strided dimensions a queued N-D transfer can have. Each
+ * costs 3 words in every queue entry. Transfers with more dimensions are split
+ * into several tasks by the producer.
+ *
+ */
+#define DM_TASK_MAX_DIMS 3
+
+/**
+ * @brief Define DM_WAIT_WFI to let harts waiting in dm_wait and dm_wait_ready
+ * sleep in wfi until the DM core wakes them through the cluster-local CLINT,
+ * instead of polling the DM struct in TCDM. The cluster has no DMA completion
+ * interrupt, so the DM core itself still polls the DMA status, but keeps
+ * servicing the task queue while doing so. Enabled with RUNTIME_DM_WAIT_WFI.
+ *
+ */
+// #define DM_WAIT_WFI
 
 //================================================================================
 // Macros
@@ -46,6 +70,11 @@
 // Types
 //================================================================================
 typedef struct {
+    // position in the queue + 1 once the entry is published, position + queue
+    // size once the DM core consumed it and the slot is free again
+    volatile uint32_t seq;
+    // cluster core index of the hart that queued the entry
+    uint32_t producer;
     uint64_t src;
     uint64_t dst;
     uint32_t size;
@@ -54,6 +83,10 @@ typedef struct {
     uint32_t nreps;
     uint32_t cfg;
     uint32_t twod;
+    uint32_t ndim;
+    size_t nd_dstrd[DM_TASK_MAX_DIMS];
+    size_t nd_sstrd[DM_TASK_MAX_DIMS];
+    size_t nd_nreps[DM_TASK_MAX_DIMS];
 } dm_task_t;
 
 // used for ultra-fine grained communication
@@ -70,14 +103,21 @@ typedef enum en_stat {
 
 typedef struct {
     dm_task_t queue[DM_TASK_QUEUE_SIZE];
-    uint32_t queue_back;
-    uint32_t queue_front;
-    volatile uint32_t queue_fill;
+    // next position the DM core consumes, only written by the DM core
+    volatile uint32_t queue_back;
+    // next free position, producers reserve entries with one atomic add
+    volatile uint32_t queue_front;
+    // number of completed transfers per producer, indexed by cluster core
+    volatile uint32_t *completed;
+    // mask of cluster cores sleeping in dm_wait_task
+    volatile uint32_t task_waiters;
     volatile uint32_t mutex;
     volatile en_stat_t stat_q;
     volatile uint32_t stat_p;
     volatile uint32_t stat_pvalid;
     volatile uint32_t dm_wfi;
+    // cluster core index + 1 of the hart sleeping on stat_pvalid, 0 if none
+    volatile uint32_t stat_waiter;
 } dm_t;
 
 //================================================================================
@@ -101,11 +141,26 @@ static volatile dm_t *volatile dm_p_global;
  */
 __thread uint32_t cluster_dm_core_idx;
 
+/**
+ * @brief Cluster core index and number of queued transfers of this hart, to
+ * match against dm_t.completed
+ *
+ */
+__thread uint32_t dm_core_idx;
+__thread uint32_t dm_submitted;
+
 //================================================================================
 // Declarations
 //================================================================================
 static void wfi_dm(uint32_t cluster_core_idx);
 static void wake_dm(void);
+static inline int dm_idle(void);
+static inline volatile dm_task_t *queue_wait_slot(uint32_t pos);
+static inline void queue_publish(volatile dm_task_t *t, uint32_t pos);
+static void stat_respond(void);
+static void stat_wait_response(void);
+static void task_complete(uint32_t producer);
+static void consume_wakeup(uint32_t cluster_core_idx, uint32_t taken);
 
 //================================================================================
 // Debug
@@ -131,6 +186,8 @@ static void wake_dm(void);
 //================================================================================
 void dm_init(void) {
     cluster_dm_core_idx = snrt_cluster_dm_core_idx();
+    dm_core_idx = snrt_cluster_core_idx();
+    dm_submitted = 0;
     // create a data mover instance
     if (snrt_is_dm_core()) {
 #ifdef DM_USE_GLOBAL_CLINT
@@ -140,8 +197,15 @@ void dm_init(void) {
 #endif
         dm_p = (dm_t *)snrt_l1alloc(sizeof(dm_t));
         snrt_memset((void *)dm_p, 0, sizeof(dm_t));
+        for (uint32_t i = 0; i < DM_TASK_QUEUE_SIZE; i++) dm_p->queue[i].seq = i;
+        uint32_t num = snrt_cluster_core_num() * sizeof(uint32_t);
+        dm_p->completed = (uint32_t *)snrt_l1alloc(num);
+        snrt_memset((void *)dm_p->completed, 0, num);
         dm_p_global = dm_p;
     } else {
+#if defined(DM_WAIT_WFI) && !defined(DM_USE_GLOBAL_CLINT)
+        snrt_interrupt_enable(IRQ_M_CLUSTER);
+#endif
         while (!dm_p_global)
             ;
         dm_p = dm_p_global;
@@ -152,30 +216,65 @@ void dm_main(void) {
     volatile dm_task_t *t;
     uint32_t do_exit = 0;
     uint32_t cluster_core_idx = snrt_cluster_core_idx();
+    // transfers issued but not yet accounted to their producer, in issue
+    // order, which is also the order they complete in
+    snrt_dma_txid_t inflight_tid[DM_TASK_QUEUE_SIZE];
+    uint32_t inflight_producer[DM_TASK_QUEUE_SIZE];
+    uint32_t inflight_head = 0, inflight_tail = 0;
 
     DM_PRINTF(10, "enter main\n");
 
     while (!do_exit) {
         /// New transaction to issue?
-        if (dm_p->queue_fill) {
+        uint32_t pos = dm_p->queue_back;
+        t = &dm_p->queue[pos % DM_TASK_QUEUE_SIZE];
+        if (t->seq == pos + 1) {
+            __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+            // make room to track it
+            if (inflight_tail - inflight_head == DM_TASK_QUEUE_SIZE) {
+                snrt_dma_wait(
+                    inflight_tid[inflight_head % DM_TASK_QUEUE_SIZE]);
+            }
+
             // wait until DMA is ready
             while (__builtin_sdma_stat(DM_STATUS_WOULD_BLOCK))
                 ;
 
-            t = &dm_p->queue[dm_p->queue_back];
-
-            if (t->twod) {
+            snrt_dma_txid_t tid;
+            if (t->ndim) {
+                DM_PRINTF(10, "start nd\n");
+                tid = snrt_dma_start_nd((void *)(uintptr_t)t->dst,
+                                        (const void *)(uintptr_t)t->src,
+                                        t->size, t->ndim,
+                                        (const size_t *)t->nd_dstrd,
+                                        (const size_t *)t->nd_sstrd,
+                                        (const size_t *)t->nd_nreps);
+            } else if (t->twod) {
                 DM_PRINTF(10, "start twod\n");
-                __builtin_sdma_start_twod(t->src, t->dst, t->size, t->sstrd,
-                                          t->dstrd, t->nreps, t->cfg);
+                tid = __builtin_sdma_start_twod(t->src, t->dst, t->size,
+                                                t->sstrd, t->dstrd, t->nreps,
+                                                t->cfg);
             } else {
                 DM_PRINTF(10, "start oned\n");
-                __builtin_sdma_start_oned(t->src, t->dst, t->size, t->cfg);
+                tid = __builtin_sdma_start_oned(t->src, t->dst, t->size,
+                                                t->cfg);
             }
+            inflight_tid[inflight_tail % DM_TASK_QUEUE_SIZE] = tid;
+            inflight_producer[inflight_tail % DM_TASK_QUEUE_SIZE] = t->producer;
+            inflight_tail++;
 
-            // bump
-            dm_p->queue_back = (dm_p->queue_back + 1) % DM_TASK_QUEUE_SIZE;
-            __atomic_add_fetch(&dm_p->queue_fill, -1, __ATOMIC_RELAXED);
+            // bump: hand the slot back to the producers of the next lap
+            t->seq = pos + DM_TASK_QUEUE_SIZE;
+            dm_p->queue_back = pos + 1;
+        }
+
+        /// account completed transfers to their producers
+        while (inflight_head != inflight_tail &&
+               snrt_dma_test(inflight_tid[inflight_head % DM_TASK_QUEUE_SIZE])) {
+            task_complete(
+                inflight_producer[inflight_head % DM_TASK_QUEUE_SIZE]);
+            inflight_head++;
         }
 
         /// any STAT request pending?
@@ -186,8 +285,7 @@ void dm_main(void) {
                     // request
                     if (__builtin_sdma_stat(DM_STATUS_BUSY) == 0) {
                         DM_PRINTF(50, "idle\n");
-                        dm_p->stat_pvalid = 1;
-                        dm_p->stat_q = 0;
+                        stat_respond();
                     }
                     break;
                 case STAT_EXIT:
@@ -195,14 +293,14 @@ void dm_main(void) {
                     break;
                 case STAT_READY:
                     DM_PRINTF(50, "ready\n");
-                    dm_p->stat_pvalid = 1;
-                    dm_p->stat_q = 0;
+                    stat_respond();
                     break;
             }
         }
 
-        // sleep if queue is empty and no stats pending
-        if (!dm_p->queue_fill && !dm_p->stat_q) {
+        // sleep if queue is empty, no stats are pending and no producer is
+        // waiting for the completion of a transfer
+        if (inflight_head == inflight_tail && dm_idle()) {
             wfi_dm(cluster_core_idx);
         }
     }
@@ -215,51 +313,34 @@ void dm_main(void) {
     return;
 }
 
-void dm_memcpy_async(void *dest, const void *src, size_t n) {
-    uint32_t s;
+dm_handle_t dm_memcpy_async(void *dest, const void *src, size_t n) {
     volatile dm_task_t *t;
 
     DM_PRINTF(10, "dm_memcpy_async %#x -> %#x size %d\n", src, dest,
               (uint32_t)n);
 
-    // poll queue size
-    do {
-        s = __atomic_load_n(&dm_p->queue_fill, __ATOMIC_RELAXED);
-    } while (s >= DM_TASK_QUEUE_SIZE);
-    _dm_mtx_lock();
-
-    // insert
-    t = &dm_p->queue[dm_p->queue_front];
+    uint32_t pos = __atomic_fetch_add(&dm_p->queue_front, 1, __ATOMIC_RELAXED);
+    t = queue_wait_slot(pos);
     t->src = (uint64_t)src;
     t->dst = (uint64_t)dest;
     t->size = (uint32_t)n;
     t->twod = 0;
+    t->ndim = 0;
     t->cfg = 0;
-
-    // bump
-    __atomic_add_fetch(&dm_p->queue_fill, 1, __ATOMIC_RELAXED);
-    dm_p->queue_front = (dm_p->queue_front + 1) % DM_TASK_QUEUE_SIZE;
-
-    _dm_mtx_release();
+    queue_publish(t, pos);
+    return ++dm_submitted;
 }
 
-void dm_memcpy2d_async(uint64_t src, uint64_t dst, uint32_t size,
-                       uint32_t sstrd, uint32_t dstrd, uint32_t nreps,
-                       uint32_t cfg) {
-    uint32_t s;
+dm_handle_t dm_memcpy2d_async(uint64_t src, uint64_t dst, uint32_t size,
+                              uint32_t sstrd, uint32_t dstrd, uint32_t nreps,
+                              uint32_t cfg) {
     volatile dm_task_t *t;
 
     DM_PRINTF(10, "dm_memcpy2d_async %#x -> %#x size %d\n", src, dst,
               (uint32_t)size);
 
-    // poll queue size
-    do {
-        s = __atomic_load_n(&dm_p->queue_fill, __ATOMIC_RELAXED);
-    } while (s >= DM_TASK_QUEUE_SIZE);
-    _dm_mtx_lock();
-
-    // insert
-    t = &dm_p->queue[dm_p->queue_front];
+    uint32_t pos = __atomic_fetch_add(&dm_p->queue_front, 1, __ATOMIC_RELAXED);
+    t = queue_wait_slot(pos);
     t->src = src;
     t->dst = dst;
     t->size = size;
@@ -267,27 +348,115 @@ void dm_memcpy2d_async(uint64_t src, uint64_t dst, uint32_t size,
     t->dstrd = dstrd;
     t->nreps = nreps;
     t->twod = 1;
+    t->ndim = 0;
     t->cfg = cfg;
+    queue_publish(t, pos);
+    return ++dm_submitted;
+}
 
-    // bump
-    __atomic_add_fetch(&dm_p->queue_fill, 1, __ATOMIC_RELAXED);
-    dm_p->queue_front = (dm_p->queue_front + 1) % DM_TASK_QUEUE_SIZE;
+dm_handle_t dm_memcpy_nd_async(void *dest, const void *src, size_t size,
+                               uint32_t ndim, const size_t *dst_strides,
+                               const size_t *src_strides,
+                               const size_t *repeats) {
+    volatile dm_task_t *t;
 
-    _dm_mtx_release();
+    DM_PRINTF(10, "dm_memcpy_nd_async %#x -> %#x size %d ndim %d\n", src,
+              dest, (uint32_t)size, ndim);
+
+    // too many dimensions for a queue entry: one task per outermost index
+    if (ndim > DM_TASK_MAX_DIMS) {
+        for (size_t i = 0; i < repeats[ndim - 1]; i++)
+            dm_memcpy_nd_async((uint8_t *)dest + i * dst_strides[ndim - 1],
+                               (const uint8_t *)src + i * src_strides[ndim - 1],
+                               size, ndim - 1, dst_strides, src_strides,
+                               repeats);
+        return dm_submitted;
+    }
+
+    uint32_t pos = __atomic_fetch_add(&dm_p->queue_front, 1, __ATOMIC_RELAXED);
+    t = queue_wait_slot(pos);
+    t->src = (uint64_t)src;
+    t->dst = (uint64_t)dest;
+    t->size = (uint32_t)size;
+    t->twod = 0;
+    t->ndim = ndim;
+    t->cfg = 0;
+    for (uint32_t k = 0; k < ndim; k++) {
+        t->nd_dstrd[k] = dst_strides[k];
+        t->nd_sstrd[k] = src_strides[k];
+        t->nd_nreps[k] = repeats[k];
+    }
+    queue_publish(t, pos);
+    return ++dm_submitted;
+}
+
+dm_handle_t dm_memcpy_batch_async(const dm_desc_t *descs, uint32_t n) {
+    volatile dm_task_t *t;
+
+    DM_PRINTF(10, "dm_memcpy_batch_async %d tasks\n", n);
+
+    // reserve all entries at once, then fill them in order. Entries beyond
+    // the queue size become free as the DM core consumes the first ones.
+    uint32_t pos = __atomic_fetch_add(&dm_p->queue_front, n, __ATOMIC_RELAXED);
+    for (uint32_t i = 0; i < n; i++, pos++) {
+        const dm_desc_t *d = &descs[i];
+        t = queue_wait_slot(pos);
+        t->src = d->src;
+        t->dst = d->dst;
+        t->size = d->size;
+        t->sstrd = d->sstrd;
+        t->dstrd = d->dstrd;
+        t->nreps = d->nreps;
+        t->twod = d->nreps != 0;
+        t->ndim = 0;
+        t->cfg = d->cfg;
+        queue_publish(t, pos);
+    }
+    dm_submitted += n;
+    return dm_submitted;
+}
+
+uint32_t dm_completed(void) { return dm_p->completed[dm_core_idx]; }
+
+void dm_wait_task(dm_handle_t handle) {
+    wake_dm();
+#if defined(DM_WAIT_WFI) && !defined(DM_USE_GLOBAL_CLINT)
+    uint32_t mask = 1 << dm_core_idx;
+    uint32_t taken;
+    while (1) {
+        // register before checking, so the DM core either sees us or we see
+        // the completion
+        taken = _snrt_int_cluster_taken;
+        __atomic_fetch_or(&dm_p->task_waiters, mask, __ATOMIC_SEQ_CST);
+        if ((int32_t)(dm_p->completed[dm_core_idx] - handle) >= 0) break;
+        snrt_wfi();
+        // the DM core wakes us on any completion of ours, which may not be the
+        // one we wait for: drop the registration and check again
+        if (!(__atomic_fetch_and(&dm_p->task_waiters, ~mask,
+                                 __ATOMIC_SEQ_CST) &
+              mask))
+            consume_wakeup(dm_core_idx, taken);
+    }
+    if (!(__atomic_fetch_and(&dm_p->task_waiters, ~mask, __ATOMIC_SEQ_CST) &
+          mask))
+        consume_wakeup(dm_core_idx, taken);
+#else
+    while ((int32_t)(dm_p->completed[dm_core_idx] - handle) < 0)
+        ;
+#endif
 }
 
+void dm_wait_own(void) { dm_wait_task(dm_submitted); }
+
 void dm_start(void) { wake_dm(); }
 
 void dm_wait(void) {
-    uint32_t s;
-
     // signal data mover
     wake_dm();
 
     // first, wait for the dm queue to be empty and no request be pending
-    do {
-        s = __atomic_load_n(&dm_p->queue_fill, __ATOMIC_RELAXED);
-    } while (s != 0);
+    while (dm_p->queue_back != dm_p->queue_front)
+        ;
     while (dm_p->stat_q)
         ;
 
@@ -300,8 +469,7 @@ void dm_wait(void) {
     // signal data mover
     wake_dm();
     // whenever stat_pvalid is non-zero, the DMA has completed all transfers
-    while (!dm_p->stat_pvalid)
-        ;
+    stat_wait_response();
     _dm_mtx_release();
 }
 
@@ -316,8 +484,7 @@ void dm_wait_ready(void) {
     dm_p->stat_pvalid = 0;
     dm_p->stat_q = STAT_READY;
     wake_dm();
-    while (!dm_p->stat_pvalid)
-        ;
+    stat_wait_response();
     _dm_mtx_release();
 }
 
@@ -325,6 +492,105 @@ void dm_wait_ready(void) {
 // private
 //================================================================================
 
+/**
+ * @brief Nothing for the DM core to do: no queued entries and no stat request
+ */
+static inline int dm_idle(void) {
+    return __atomic_load_n(&dm_p->queue_front, __ATOMIC_SEQ_CST) ==
+               dm_p->queue_back &&
+           !dm_p->stat_q;
+}
+
+/**
+ * @brief Wait until the queue slot of the reserved position `pos` is free,
+ * i.e. the DM core consumed the entry of the previous lap. The entries of that
+ * lap may not have been started yet, so wake the DM core while waiting.
+ */
+static inline volatile dm_task_t *queue_wait_slot(uint32_t pos) {
+    volatile dm_task_t *t = &dm_p->queue[pos % DM_TASK_QUEUE_SIZE];
+    if (t->seq != pos) {
+        // the DM core does not sleep while reserved entries are pending, so
+        // one wakeup is enough
+        wake_dm();
+        while (t->seq != pos)
+            ;
+    }
+    return t;
+}
+
+/**
+ * @brief Hand a filled queue entry to the DM core
+ */
+static inline void queue_publish(volatile dm_task_t *t, uint32_t pos) {
+    t->producer = dm_core_idx;
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    t->seq = pos + 1;
+}
+
+/**
+ * @brief Called by the DM core to answer the pending stat request and wake
+ * the hart waiting for the answer, if it sleeps
+ */
+static void stat_respond(void) {
+    dm_p->stat_pvalid = 1;
+    dm_p->stat_q = 0;
+#if defined(DM_WAIT_WFI) && !defined(DM_USE_GLOBAL_CLINT)
+    uint32_t waiter =
+        __atomic_exchange_n(&dm_p->stat_waiter, 0, __ATOMIC_SEQ_CST);
+    if (waiter) snrt_int_cluster_set(1 << (waiter - 1));
+#endif
+}
+
+/**
+ * @brief Block until the DM core answered the pending stat request
+ */
+static void stat_wait_response(void) {
+#if defined(DM_WAIT_WFI) && !defined(DM_USE_GLOBAL_CLINT)
+    uint32_t cluster_core_idx = snrt_cluster_core_idx();
+    uint32_t taken = _snrt_int_cluster_taken;
+    // register before checking, so the DM core either sees us or we see the
+    // answer. The interrupt is only cleared once the answer is there, a
+    // pending one just makes wfi fall through.
+    __atomic_store_n(&dm_p->stat_waiter, cluster_core_idx + 1,
+                     __ATOMIC_SEQ_CST);
+    while (!dm_p->stat_pvalid) snrt_wfi();
+    // if the DM core took the registration, its wakeup is sent or in flight:
+    // consume it so it does not end a later wfi early
+    if (!__atomic_exchange_n(&dm_p->stat_waiter, 0, __ATOMIC_SEQ_CST))
+        consume_wakeup(cluster_core_idx, taken);
+#else
+    while (!dm_p->stat_pvalid)
+        ;
+#endif
+}
+
+/**
+ * @brief Called by the DM core when a transfer of `producer` completed. Wakes
+ * the producer if it sleeps in dm_wait_task.
+ */
+static void task_complete(uint32_t producer) {
+    dm_p->completed[producer]++;
+#if defined(DM_WAIT_WFI) && !defined(DM_USE_GLOBAL_CLINT)
+    uint32_t mask = 1 << producer;
+    if ((__atomic_load_n(&dm_p->task_waiters, __ATOMIC_SEQ_CST) & mask) &&
+        (__atomic_fetch_and(&dm_p->task_waiters, ~mask, __ATOMIC_SEQ_CST) &
+         mask))
+        snrt_int_cluster_set(mask);
+#endif
+}
+
+/**
+ * @brief Wait for a wakeup the DM core sent or is about to send and clear it,
+ * so it does not end a later wfi early. With interrupts globally enabled, e.g.
+ * while profiling, the ISR may have taken and cleared it already: `taken` is
+ * the count of cluster interrupts taken before the wait.
+ */
+static void consume_wakeup(uint32_t cluster_core_idx, uint32_t taken) {
+    while (!(read_csr(mip) & (1 << IRQ_M_CLUSTER)))
+        if (_snrt_int_cluster_taken != taken) return;
+    snrt_int_cluster_clr(1 << cluster_core_idx);
+}
+
 #ifdef DM_USE_GLOBAL_CLINT
 static void wfi_dm(uint32_t cluster_core_idx) {
     (void)cluster_core_idx;
@@ -336,15 +602,16 @@ static void wake_dm(void) {
 }
 #else
 static void wfi_dm(uint32_t cluster_core_idx) {
-    __atomic_add_fetch(&dm_p->dm_wfi, 1, __ATOMIC_RELAXED);
-    snrt_wfi();
+    // announce the sleep before checking for work a last time, so a producer
+    // either sees the announcement and sends a wakeup or we see its entry
+    __atomic_add_fetch(&dm_p->dm_wfi, 1, __ATOMIC_SEQ_CST);
+    if (dm_idle()) snrt_wfi();
     snrt_int_cluster_clr(1 << cluster_core_idx);
     __atomic_add_fetch(&dm_p->dm_wfi, -1, __ATOMIC_RELAXED);
 }
 static void wake_dm(void) {
-    // wait for DM to sleep before sending wakeup
-    while (!__atomic_load_n(&dm_p->dm_wfi, __ATOMIC_RELAXED))
-        ;
-    snrt_int_cluster_set(1 << snrt_cluster_dm_core_idx());
+    // only a sleeping DM needs a wakeup, an awake one finds the work itself
+    if (__atomic_load_n(&dm_p->dm_wfi, __ATOMIC_SEQ_CST))
+        snrt_int_cluster_set(1 << cluster_dm_core_idx);
 }
 #endif  // #ifdef DM_USE_GLOBAL_CLINT
@@ -123,6 +123,83 @@ snrt_dma_txid_t snrt_dma_start_2d(void *dst, const void *src, size_t size,
                                      src_stride, repeat);
 }
 
+/// Initiate an asynchronous 3D DMA transfer.
+snrt_dma_txid_t snrt_dma_start_3d(void *dst, const void *src, size_t size,
+                                  size_t dst_stride1, size_t src_stride1,
+                                  size_t repeat1, size_t dst_stride2,
+                                  size_t src_stride2, size_t repeat2) {
+    size_t dst_strides[] = {dst_stride1, dst_stride2};
+    size_t src_strides[] = {src_stride1, src_stride2};
+    size_t repeats[] = {repeat1, repeat2};
+    return snrt_dma_start_nd(dst, src, size, 2, dst_strides, src_strides,
+                             repeats);
+}
+
+/// Initiate an asynchronous N-D DMA transfer as a series of 2D transfers.
+snrt_dma_txid_t snrt_dma_start_nd(void *dst, const void *src, size_t size,
+                                  uint32_t ndim, const size_t *dst_strides,
+                                  const size_t *src_strides,
+                                  const size_t *repeats) {
+    // Too many dimensions for the buffers below: one transfer per outermost
+    // index
+    if (ndim > SNRT_DMA_MAX_DIMS) {
+        snrt_dma_txid_t txid = 0;
+        for (size_t i = 0; i < repeats[ndim - 1]; i++)
+            txid = snrt_dma_start_nd(
+                (uint8_t *)dst + i * dst_strides[ndim - 1],
+                (const uint8_t *)src + i * src_strides[ndim - 1], size,
+                ndim - 1, dst_strides, src_strides, repeats);
+        return txid;
+    }
+
+    size_t dstrd[SNRT_DMA_MAX_DIMS], sstrd[SNRT_DMA_MAX_DIMS];
+    size_t reps[SNRT_DMA_MAX_DIMS], idx[SNRT_DMA_MAX_DIMS];
+    uint32_t n = 0;
+
+    // Normalize: drop trivial dimensions and merge a dimension into the one
+    // below if both pointers step through it contiguously, so the 2D engine
+    // covers as much of the transfer as possible.
+    for (uint32_t k = 0; k < ndim; k++) {
+        if (repeats[k] == 1) continue;
+        if (n == 0 && dst_strides[k] == size && src_strides[k] == size) {
+            size *= repeats[k];
+        } else if (n > 0 && dst_strides[k] == dstrd[n - 1] * reps[n - 1] &&
+                   src_strides[k] == sstrd[n - 1] * reps[n - 1]) {
+            reps[n - 1] *= repeats[k];
+        } else {
+            dstrd[n] = dst_strides[k];
+            sstrd[n] = src_strides[k];
+            reps[n] = repeats[k];
+            idx[n] = 0;
+            n++;
+        }
+    }
+
+    if (n == 0) return snrt_dma_start_1d(dst, src, size);
+    if (n == 1)
+        return snrt_dma_start_2d(dst, src, size, dstrd[0], sstrd[0], reps[0]);
+
+    // Walk the outer dimensions like an odometer, issuing one 2D transfer for
+    // the innermost one each step. Transfers complete in order, so the ID of
+    // the last one covers the whole N-D transfer.
+    snrt_dma_txid_t txid;
+    uint8_t *d = (uint8_t *)dst;
+    const uint8_t *s = (const uint8_t *)src;
+    while (1) {
+        txid = snrt_dma_start_2d(d, s, size, dstrd[0], sstrd[0], reps[0]);
+        uint32_t k = 1;
+        for (; k < n; k++) {
+            d += dstrd[k];
+            s += sstrd[k];
+            if (++idx[k] < reps[k]) break;
+            d -= dstrd[k] * reps[k];
+            s -= sstrd[k] * reps[k];
+            idx[k] = 0;
+        }
+        if (k == n) return txid;
+    }
+}
+
 /// Block until a transfer finishes.
 void snrt_dma_wait(snrt_dma_txid_t tid) {
     // dmstati t0, 0  # 2=status.completed_id
@@ -138,6 +215,40 @@ void snrt_dma_wait(snrt_dma_txid_t tid) {
         : "t0");
 }
 
+/// Read the ID of the last completed transfer plus one.
+static inline uint32_t dma_completed_id() {
+    // dmstati t0, 0  # 0=status.completed_id
+    register uint32_t reg_completed asm("t0");  // 5
+    asm volatile(
+        ".word (0b0000100 << 25) | \
+               (  0b00000 << 20) | \
+               (    0b000 << 12) | \
+               (      (5) <<  7) | \
+               (0b0101011 <<  0)   \n"
+        : "=r"(reg_completed));
+    return reg_completed;
+}
+
+/// Check whether a transfer finished, without blocking.
+int snrt_dma_test(snrt_dma_txid_t tid) {
+    return (int32_t)(dma_completed_id() - tid) > 0;
+}
+
+/// Block until one of `n` transfers finishes and return the index of the
+/// oldest finished one.
+uint32_t snrt_dma_wait_any(const snrt_dma_txid_t *tids, uint32_t n) {
+    while (1) {
+        uint32_t completed = dma_completed_id();
+        uint32_t oldest = n;
+        for (uint32_t i = 0; i < n; i++) {
+            if ((int32_t)(completed - tids[i]) <= 0) continue;
+            if (oldest == n || (int32_t)(tids[i] - tids[oldest]) < 0)
+                oldest = i;
+        }
+        if (oldest < n) return oldest;
+    }
+}
+
 /// Block until all operation on the DMA ceases.
 void snrt_dma_wait_all() {
     // dmstati t0, 2  # 2=status.busy
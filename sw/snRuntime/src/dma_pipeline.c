@@ -0,0 +1,130 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+#include "dma_pipeline.h"
+
+#include "debug.h"
+#include "snrt.h"
+#include "team.h"
+
+//================================================================================
+// Private
+//================================================================================
+
+static inline uint32_t tile_bytes(const snrt_dma_tile_desc_t *d) {
+    return d->size * d->repeat;
+}
+
+static inline void *tile_dram(const snrt_dma_tile_desc_t *d, uint32_t i) {
+    return (uint8_t *)d->base + i * d->tile_stride;
+}
+
+static void load_tile(snrt_dma_pipeline_t *p, uint32_t i) {
+    for (uint32_t k = 0; k < p->n_in; k++) {
+        const snrt_dma_tile_desc_t *d = &p->in[k];
+        snrt_dma_start_2d(p->buf_in[k][i & 1], tile_dram(d, i), d->size,
+                          d->size, d->stride, d->repeat);
+    }
+}
+
+static void store_tile(snrt_dma_pipeline_t *p, uint32_t i) {
+    for (uint32_t k = 0; k < p->n_out; k++) {
+        const snrt_dma_tile_desc_t *d = &p->out[k];
+        snrt_dma_start_2d(tile_dram(d, i), p->buf_out[k][i & 1], d->size,
+                          d->stride, d->size, d->repeat);
+    }
+}
+
+/**
+ * @brief Allocate the pipeline and its buffers in L1
+ * @return 0 if there are too many operands or L1 is full
+ */
+static snrt_dma_pipeline_t *pipeline_alloc(const snrt_dma_tile_desc_t *in,
+                                           uint32_t n_in,
+                                           const snrt_dma_tile_desc_t *out,
+                                           uint32_t n_out, uint32_t num_tiles) {
+    if (n_in > SNRT_DMA_PIPELINE_MAX_OPERANDS ||
+        n_out > SNRT_DMA_PIPELINE_MAX_OPERANDS) {
+        snrt_trace(SNRT_TRACE_ALLOC,
+                   "dma pipeline: %d in, %d out, at most %d supported\n", n_in,
+                   n_out, SNRT_DMA_PIPELINE_MAX_OPERANDS);
+        return 0;
+    }
+    snrt_dma_pipeline_t *p = snrt_l1alloc(sizeof(snrt_dma_pipeline_t));
+    if (!p) return 0;
+    p->num_tiles = num_tiles;
+    p->n_in = n_in;
+    p->n_out = n_out;
+    for (uint32_t k = 0; k < n_in; k++) {
+        p->in[k] = in[k];
+        p->buf_in[k][0] = snrt_l1alloc(tile_bytes(&in[k]));
+        p->buf_in[k][1] = snrt_l1alloc(tile_bytes(&in[k]));
+        if (!p->buf_in[k][0] || !p->buf_in[k][1]) return 0;
+    }
+    for (uint32_t k = 0; k < n_out; k++) {
+        p->out[k] = out[k];
+        p->buf_out[k][0] = snrt_l1alloc(tile_bytes(&out[k]));
+        p->buf_out[k][1] = snrt_l1alloc(tile_bytes(&out[k]));
+        if (!p->buf_out[k][0] || !p->buf_out[k][1]) return 0;
+    }
+    snrt_trace(SNRT_TRACE_ALLOC, "dma pipeline: %d tiles, %d in, %d out\n",
+               num_tiles, n_in, n_out);
+    return p;
+}
+
+//================================================================================
+// Public
+//================================================================================
+
+snrt_dma_pipeline_t *snrt_dma_pipeline_init(const snrt_dma_tile_desc_t *in,
+                                            uint32_t n_in,
+                                            const snrt_dma_tile_desc_t *out,
+                                            uint32_t n_out,
+                                            uint32_t num_tiles) {
+    if (snrt_is_dm_core())
+        snrt_current_team()->dma_pipeline =
+            pipeline_alloc(in, n_in, out, n_out, num_tiles);
+    snrt_cluster_hw_barrier();
+    snrt_dma_pipeline_t *p = snrt_current_team()->dma_pipeline;
+    // Keep the DM core from publishing the next pipeline before everyone read
+    // this one
+    snrt_cluster_hw_barrier();
+    return p;
+}
+
+int snrt_dma_pipeline_next_tile(snrt_dma_pipeline_t *p, snrt_dma_tile_t *tile) {
+    uint32_t i = tile->next;
+
+    // Without tiles there is nothing to load, and nothing to synchronize on
+    if (!p->num_tiles || i > p->num_tiles) return 0;
+
+    // Inputs of tile i and the write-back of tile i - 2, which used the output
+    // buffers tile i is going to use, are complete after this.
+    if (snrt_is_dm_core()) {
+        if (i == 0) load_tile(p, 0);
+        snrt_dma_wait_all();
+    }
+
+    // Compute cores are done with tile i - 1 once they pass the barrier, so
+    // its outputs can be written back and its input buffers refilled.
+    snrt_cluster_hw_barrier();
+
+    if (snrt_is_dm_core()) {
+        if (i > 0) store_tile(p, i - 1);
+        if (i + 1 < p->num_tiles) load_tile(p, i + 1);
+    }
+
+    tile->next = i + 1;
+    if (i == p->num_tiles) {
+        // Drain: make the outputs visible in DRAM before anyone returns
+        if (snrt_is_dm_core()) snrt_dma_wait_all();
+        snrt_cluster_hw_barrier();
+        return 0;
+    }
+
+    tile->idx = i;
+    for (uint32_t k = 0; k < p->n_in; k++) tile->in[k] = p->buf_in[k][i & 1];
+    for (uint32_t k = 0; k < p->n_out; k++)
+        tile->out[k] = p->buf_out[k][i & 1];
+    return 1;
+}
@@ -20,6 +20,10 @@
 //================================================================================
 static volatile uint32_t clint_mutex = 0;
 static __thread volatile uint32_t *clint_p;
+/// Return address register of the interrupted code, passed by start.S
+static __thread uint32_t isr_ra;
+/// Cluster interrupts taken by the ISR on this hart
+__thread volatile uint32_t _snrt_int_cluster_taken;
 
 //================================================================================
 // ISR definitions
@@ -30,6 +34,10 @@ void irq_m_timer(uint32_t core_idx);
 void irq_m_ext(uint32_t core_idx);
 void irq_m_cluster(uint32_t core_idx);
 
+// PC sampling, a weak reference so it is only linked in if the program uses it
+extern void _snrt_profile_sample(uint32_t pc, uint32_t ra)
+    __attribute__((weak));
+
 //================================================================================
 // Public functions
 //================================================================================
@@ -44,9 +52,10 @@ void snrt_int_init(struct snrt_team_root *team) {
  * exceptions
  * @details
  *
- * @param hartid hart ID of the interrupted core
+ * @param ra return address register of the interrupted code
  */
-void __snrt_isr(void) {
+void __snrt_isr(uint32_t ra) {
+    isr_ra = ra;
     uint32_t core_idx = snrt_global_core_idx();
     uint32_t cause = read_csr(mcause);
     // dispatch interrupt
@@ -63,6 +72,7 @@ void __snrt_isr(void) {
                 break;
             case IRQ_M_CLUSTER:
                 core_idx = snrt_cluster_core_idx();
+                _snrt_int_cluster_taken++;
                 irq_m_cluster(core_idx);
                 break;
         }
@@ -161,7 +171,10 @@ void __attribute__((weak)) irq_m_soft(uint32_t core_idx) {
     snrt_int_sw_clear(core_idx);
 }
 
-void __attribute__((weak)) irq_m_timer(uint32_t core_idx) { (void)core_idx; }
+void __attribute__((weak)) irq_m_timer(uint32_t core_idx) {
+    (void)core_idx;
+    if (_snrt_profile_sample) _snrt_profile_sample(read_csr(mepc), isr_ra);
+}
 
 void __attribute__((weak)) irq_m_ext(uint32_t core_idx) { (void)core_idx; }
 
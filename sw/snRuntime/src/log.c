@@ -0,0 +1,296 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "log.h"
+
+#include "printf.h"
+#include "snrt.h"
+
+//================================================================================
+// Settings
+//================================================================================
+
+/**
+ * @brief Maximum number of harts with a log ring, indexed by the global core
+ * index. Harts beyond write through immediately.
+ *
+ */
+#define LOG_MAX_HARTS 32
+
+/**
+ * @brief Size of the log ring of each hart in 32-bit words. Must be a power
+ * of two.
+ *
+ */
+#define LOG_RING_WORDS 512
+
+/**
+ * @brief Size of the line buffer used to format deferred records
+ *
+ */
+#define LOG_LINE_LEN 256
+
+/**
+ * @brief Size of the line buffer on the stack of harts without a ring
+ *
+ */
+#define LOG_STACK_LINE_LEN 128
+
+/**
+ * @brief Maximum number of arguments of a deferred record, see `snrt_log`
+ *
+ */
+#define LOG_MAX_ARGS 6
+
+//================================================================================
+// Macros
+//================================================================================
+
+// Record header: type in the upper byte, text length in bytes or number of
+// arguments in the lower bits
+#define LOG_TEXT 1
+#define LOG_FMT 2
+#define LOG_HEADER(type, len) (((type) << 24) | (len))
+#define LOG_TYPE(header) ((header) >> 24)
+#define LOG_LEN(header) ((header)&0xffffff)
+
+//================================================================================
+// Types
+//================================================================================
+
+/**
+ * @brief Single-producer ring of log records. The owning hart appends at
+ * `head`, the drain consumes from `tail`; both count words and wrap around.
+ */
+typedef struct {
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    uint32_t data[LOG_RING_WORDS];
+} log_ring_t;
+
+//================================================================================
+// Declarations
+//================================================================================
+
+// Unbuffered output of the platform
+extern void _snrt_write(const char *data, size_t len);
+
+typedef void (*log_write_t)(const char *data, size_t len);
+
+//================================================================================
+// Data
+//================================================================================
+
+/**
+ * @brief Rings of all harts
+ */
+static log_ring_t log_rings[LOG_MAX_HARTS];
+
+/**
+ * @brief Per-hart line buffer to format deferred records in
+ */
+static char log_lines[LOG_MAX_HARTS][LOG_LINE_LEN];
+
+/**
+ * @brief Global core index of the hart draining its ring at exit
+ */
+static volatile uint32_t log_drain_turn;
+
+//================================================================================
+// Private
+//================================================================================
+
+static inline log_ring_t *log_ring() {
+    uint32_t idx = snrt_global_core_idx();
+    return idx < LOG_MAX_HARTS ? &log_rings[idx] : 0;
+}
+
+static inline uint32_t log_words(size_t bytes) { return (bytes + 3) / 4; }
+
+static inline uint32_t log_get(log_ring_t *r, uint32_t pos) {
+    return r->data[pos & (LOG_RING_WORDS - 1)];
+}
+
+static inline int log_in(char c, const char *set) {
+    while (*set && *set != c) set++;
+    return c && *set == c;
+}
+
+/**
+ * @brief Format a deferred record with printf semantics and write it out
+ * through `write`
+ * @details Walks the format string and formats one conversion at a time with
+ * `snprintf`, taking its argument type from the conversion: floating point
+ * conversions take a double, `ll` a 64-bit integer, all others a word. The
+ * line is assembled in DRAM, the stacks are too small for it; harts without
+ * a ring use a shorter line on the stack.
+ */
+static void log_format(const char *fmt, uint32_t n, const uint64_t *args,
+                       log_write_t write) {
+    uint32_t idx = snrt_global_core_idx();
+    char stack_line[LOG_STACK_LINE_LEN];
+    char *line = idx < LOG_MAX_HARTS ? log_lines[idx] : stack_line;
+    uint32_t line_len = idx < LOG_MAX_HARTS ? LOG_LINE_LEN : LOG_STACK_LINE_LEN;
+    char spec[16];
+    uint32_t pos = 0, arg = 0;
+
+    while (*fmt) {
+        if (pos > line_len - 64) {
+            write(line, pos);
+            pos = 0;
+        }
+        if (*fmt != '%') {
+            line[pos++] = *fmt++;
+            continue;
+        }
+
+        // Copy the conversion specification
+        uint32_t len = 0, wide = 0;
+        spec[len++] = *fmt++;
+        while (*fmt && len < sizeof(spec) - 2 &&
+               !log_in(*fmt, "diouxXcspfFeEgGaA%")) {
+            wide += *fmt == 'l';
+            spec[len++] = *fmt++;
+        }
+        char conv = *fmt;
+        if (conv) spec[len++] = *fmt++;
+        spec[len] = 0;
+
+        uint32_t room = line_len - pos;
+        uint64_t v = arg < n ? args[arg] : 0;
+        int w;
+        if (conv == '%') {
+            w = snprintf(line + pos, room, "%%");
+        } else if (log_in(conv, "fFeEgGaA")) {
+            union {
+                uint64_t u;
+                double d;
+            } f = {.u = v};
+            w = snprintf(line + pos, room, spec, f.d);
+            arg++;
+        } else if (wide >= 2) {
+            w = snprintf(line + pos, room, spec, v);
+            arg++;
+        } else if (conv == 's' || conv == 'p') {
+            w = snprintf(line + pos, room, spec, (void *)(uintptr_t)v);
+            arg++;
+        } else {
+            w = snprintf(line + pos, room, spec, (uint32_t)v);
+            arg++;
+        }
+        pos = snrt_min(pos + (w > 0 ? w : 0), line_len - 1);
+    }
+    if (pos) write(line, pos);
+}
+
+/**
+ * @brief Write out and consume all records of a ring through `write`
+ */
+static void log_drain(log_ring_t *r, log_write_t write) {
+    uint64_t args[LOG_MAX_ARGS];
+    uint32_t tail = r->tail;
+
+    while (tail != r->head) {
+        uint32_t header = log_get(r, tail++);
+        uint32_t len = LOG_LEN(header);
+        if (LOG_TYPE(header) == LOG_TEXT) {
+            // Write straight from the ring, in two parts if it wraps around
+            uint32_t start = tail & (LOG_RING_WORDS - 1);
+            uint32_t first = snrt_min(len, (LOG_RING_WORDS - start) * 4);
+            write((const char *)&r->data[start], first);
+            if (len > first) write((const char *)r->data, len - first);
+            tail += log_words(len);
+        } else {
+            const char *fmt = (const char *)(uintptr_t)log_get(r, tail++);
+            for (uint32_t i = 0; i < len; i++) {
+                uint32_t lo = log_get(r, tail++);
+                uint32_t hi = log_get(r, tail++);
+                args[i] = ((uint64_t)hi << 32) | lo;
+            }
+            log_format(fmt, len, args, write);
+        }
+    }
+    r->tail = tail;
+}
+
+/**
+ * @brief Make room for `words` words in the ring, draining it if full
+ * @return 0 if the record can never fit
+ */
+static int log_reserve(log_ring_t *r, uint32_t words) {
+    if (words > LOG_RING_WORDS) return 0;
+    if (r->head - r->tail + words > LOG_RING_WORDS) log_drain(r, _snrt_write);
+    return 1;
+}
+
+static inline void log_put(log_ring_t *r, uint32_t *head, uint32_t word) {
+    r->data[(*head)++ & (LOG_RING_WORDS - 1)] = word;
+}
+
+//================================================================================
+// Public
+//================================================================================
+
+/**
+ * @brief Append `len` bytes of text to the ring of the calling hart
+ * @details Used by the platform's putchar in log ring mode for every buffered
+ * line. Text that does not fit into a ring is written through.
+ */
+void _snrt_log_text(const char *data, size_t len) {
+    log_ring_t *r = log_ring();
+    if (!r || !log_reserve(r, 1 + log_words(len))) {
+        _snrt_write(data, len);
+        return;
+    }
+
+    uint32_t head = r->head;
+    log_put(r, &head, LOG_HEADER(LOG_TEXT, len));
+    for (uint32_t i = 0; i < len; i += 4) {
+        uint32_t word = 0;
+        for (uint32_t j = 0; j < 4 && i + j < len; j++)
+            word |= (uint32_t)(uint8_t)data[i + j] << (8 * j);
+        log_put(r, &head, word);
+    }
+    __atomic_store_n(&r->head, head, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Append a deferred record, see `snrt_log`
+ */
+void _snrt_log(const char *fmt, uint32_t n, const uint64_t *args) {
+    log_ring_t *r = log_ring();
+    n = snrt_min(n, LOG_MAX_ARGS);
+    if (!r) {
+        log_format(fmt, n, args, _snrt_write);
+        return;
+    }
+    log_reserve(r, 2 + 2 * n);
+
+    uint32_t head = r->head;
+    log_put(r, &head, LOG_HEADER(LOG_FMT, n));
+    log_put(r, &head, (uintptr_t)fmt);
+    for (uint32_t i = 0; i < n; i++) {
+        log_put(r, &head, (uint32_t)args[i]);
+        log_put(r, &head, (uint32_t)(args[i] >> 32));
+    }
+    __atomic_store_n(&r->head, head, __ATOMIC_RELEASE);
+}
+
+void snrt_log_drain(void (*write)(const char *data, size_t len)) {
+    log_ring_t *r = log_ring();
+    if (r) log_drain(r, write ? write : _snrt_write);
+}
+
+/**
+ * @brief Drain the rings of all harts, one after the other in global core
+ * order, called by every core at exit
+ */
+void _snrt_log_fini() {
+    uint32_t idx = snrt_global_core_idx();
+    while (log_drain_turn != idx)
+        ;
+    log_ring_t *r = log_ring();
+    if (r) log_drain(r, _snrt_write);
+    log_drain_turn = idx + 1;
+}
@@ -0,0 +1,126 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "snrt.h"
+
+//================================================================================
+// Settings
+//================================================================================
+
+/**
+ * @brief Below this many bytes, a plain scalar loop is cheaper than setting
+ * up the vector unit
+ */
+#define MEMSET_VEC_THRESHOLD 32
+
+/**
+ * @brief From this many bytes on, the DM core fills DRAM destinations by
+ * replicating an L1 line with the DMA instead of storing through the core
+ */
+#define MEMSET_DMA_THRESHOLD 2048
+
+/**
+ * @brief Size of the L1 line replicated by the DMA. It lives on the stack of
+ * the DM core, which is in TCDM.
+ */
+#define MEMSET_DMA_LINE 256
+
+//================================================================================
+// Private
+//================================================================================
+
+static inline void memset_bytes(uint8_t *p, uint8_t value, size_t num) {
+    for (size_t i = 0; i < num; ++i) p[i] = value;
+}
+
+static inline int memset_in_l1(const void *ptr) {
+    snrt_slice_t l1 = snrt_cluster_memory();
+    return (uintptr_t)ptr >= l1.start && (uintptr_t)ptr < l1.end;
+}
+
+//================================================================================
+// Public
+//================================================================================
+
+/**
+ * @brief Fill memory with the vector unit only
+ * @details Does not touch the team structure and can therefore be used by the
+ * startup code before `_snrt_init_team` ran. Unaligned head and tail bytes are
+ * handled with scalar stores, the word-aligned body with `vse32`.
+ *
+ * @param ptr destination
+ * @param value byte value to fill
+ * @param num number of bytes
+ * @return ptr
+ */
+void *_snrt_memset_vec(void *ptr, int value, size_t num) {
+    uint8_t *p = (uint8_t *)ptr;
+    uint8_t byte = (uint8_t)value;
+
+    if (num < MEMSET_VEC_THRESHOLD) {
+        memset_bytes(p, byte, num);
+        return ptr;
+    }
+
+    // Align the head to a word
+    size_t head = (-(uintptr_t)p) & 0x3;
+    memset_bytes(p, byte, head);
+    p += head;
+    num -= head;
+
+    // Word-aligned body
+    size_t words = num >> 2;
+    uint32_t pattern = byte * 0x01010101u;
+    size_t vl;
+    asm volatile("vsetvli %0, %1, e32, m8, ta, ma" : "=r"(vl) : "r"(words));
+    asm volatile("vmv.v.x v0, %0" ::"r"(pattern));
+    while (words) {
+        asm volatile("vsetvli %0, %1, e32, m8, ta, ma"
+                     : "=r"(vl)
+                     : "r"(words));
+        asm volatile("vse32.v v0, (%0)" ::"r"(p) : "memory");
+        p += vl << 2;
+        words -= vl;
+    }
+
+    // Tail
+    memset_bytes(p, byte, num & 0x3);
+    return ptr;
+}
+
+/**
+ * @brief Fill `num` bytes at `ptr` with `value`
+ * @details Dispatches on size and location like a libc would: short fills use
+ * scalar stores, L1 and medium-sized fills use the vector unit. Large fills of
+ * DRAM issued from the DM core replicate a filled L1 line with a single 2D DMA
+ * transfer (source stride 0). The call is synchronous in all cases.
+ *
+ * @param ptr destination
+ * @param value byte value to fill
+ * @param num number of bytes
+ * @return ptr
+ */
+void *snrt_memset(void *ptr, int value, size_t num) {
+    if (num < MEMSET_DMA_THRESHOLD || memset_in_l1(ptr) || !snrt_is_dm_core())
+        return _snrt_memset_vec(ptr, value, num);
+
+    uint8_t line[MEMSET_DMA_LINE] __attribute__((aligned(8)));
+    _snrt_memset_vec(line, value, MEMSET_DMA_LINE);
+
+    size_t reps = num / MEMSET_DMA_LINE;
+    size_t rest = num - reps * MEMSET_DMA_LINE;
+    snrt_dma_txid_t tid = snrt_dma_start_2d(ptr, line, MEMSET_DMA_LINE,
+                                            MEMSET_DMA_LINE, 0, reps);
+    if (rest)
+        tid = snrt_dma_start_1d((uint8_t *)ptr + reps * MEMSET_DMA_LINE, line,
+                                rest);
+    // The line lives on our stack, so we cannot return before the DMA is done
+    snrt_dma_wait(tid);
+    return ptr;
+}
+
+/**
+ * @brief Zero `num` bytes at `ptr`
+ */
+void snrt_bzero(void *ptr, size_t num) { snrt_memset(ptr, 0, num); }
@@ -22,6 +22,17 @@
  */
 // #define EU_USE_GLOBAL_CLINT
 
+/**
+ * @brief Number of cycles a worker polls the epoch word for the next region
+ * before it goes to sleep in `wfi`. Spinning cuts the wake-up latency of
+ * back-to-back parallel regions at the cost of TCDM traffic and power. 0
+ * sends the workers to sleep right away. Adjustable at run time with
+ * `eu_set_spin_cycles`.
+ */
+#ifndef EU_SPIN_CYCLES
+#define EU_SPIN_CYCLES 0
+#endif
+
 //================================================================================
 // Types
 //================================================================================
@@ -31,6 +42,9 @@ typedef struct {
     uint32_t exit_flag;
     uint32_t workers_mutex;
     uint32_t workers_wfi;
+    // Incremented by the main thread to publish the event below or the exit
+    uint32_t epoch;
+    uint32_t spin_cycles;
     struct {
         void (*fn)(void *, uint32_t);  // points to microtask wrapper
         void *data;
@@ -61,7 +75,8 @@ static volatile eu_t *volatile eu_p_global;
 //================================================================================
 static void wake_workers(void);
 static void worker_wfi(uint32_t cluster_core_idx);
-static void wait_worker_wfi(void);
+static void publish(void);
+static void worker_wait(uint32_t cluster_core_idx, uint32_t seen);
 
 //================================================================================
 // public
@@ -71,6 +86,7 @@ void eu_init(void) {
         // Allocate the eu struct in L1 for fast access
         eu_p = snrt_l1alloc(sizeof(eu_t));
         snrt_memset((void *)eu_p, 0, sizeof(eu_t));
+        eu_p->spin_cycles = EU_SPIN_CYCLES;
         // store copy of eu_p on shared memory
         eu_p_global = eu_p;
     } else {
@@ -88,16 +104,21 @@ void eu_exit(uint32_t core_idx) {
     // make sure queue is empty
     if (!eu_p->e.nthreads) eu_run_empty(core_idx);
     // set exit flag and wake cores
-    wait_worker_wfi();
     eu_p->exit_flag = 1;
-    wake_workers();
+    publish();
 }
 
+/**
+ * @brief Set the number of cycles workers poll for the next parallel region
+ * before going to sleep, see `EU_SPIN_CYCLES`
+ */
+void eu_set_spin_cycles(uint32_t cycles) { eu_p->spin_cycles = cycles; }
+
 /**
  * @brief Return the number of workers currently present in the event loop
  */
 uint32_t eu_get_workers_in_loop() {
-    return __atomic_load_n(&eu_p->workers_in_loop, __ATOMIC_RELAXED);
+    return __atomic_load_n(&eu_p->workers_in_loop, __ATOMIC_ACQUIRE);
 }
 
 /**
@@ -122,11 +143,12 @@ void eu_print_status() {
  * @param cluster_core_idx local core index of the entering thread
  */
 void eu_event_loop(uint32_t cluster_core_idx) {
-    uint32_t scratch;
     uint32_t nthds;
+    // The main thread publishes only after all workers are in the loop
+    uint32_t seen = __atomic_load_n(&eu_p->epoch, __ATOMIC_RELAXED);
 
     // count number of workers in loop
-    __atomic_add_fetch(&eu_p->workers_in_loop, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&eu_p->workers_in_loop, 1, __ATOMIC_RELEASE);
 
     // enable software interrupts
 #ifdef EU_USE_GLOBAL_CLINT
@@ -138,12 +160,14 @@ void eu_event_loop(uint32_t cluster_core_idx) {
     EU_PRINTF(0, "#%d entered event loop\n", cluster_core_idx);
 
     while (1) {
+        worker_wait(cluster_core_idx, seen++);
+
         // check for exit
         if (eu_p->exit_flag) {
 #ifdef EU_USE_GLOBAL_CLINT
             snrt_interrupt_disable(IRQ_M_SOFT);
 #else
-            snrt_interrupt_enable(IRQ_M_CLUSTER);
+            snrt_interrupt_disable(IRQ_M_CLUSTER);
 #endif
             return;
         }
@@ -159,9 +183,8 @@ void eu_event_loop(uint32_t cluster_core_idx) {
             eu_p->e.fn(eu_p->e.data, eu_p->e.argc);
         }
 
-        // enter wait for interrupt
-        __atomic_add_fetch(&eu_p->e.fini_count, 1, __ATOMIC_RELAXED);
-        worker_wfi(cluster_core_idx);
+        // the results of the region must be visible to the main thread
+        __atomic_add_fetch(&eu_p->e.fini_count, 1, __ATOMIC_RELEASE);
     }
 }
 
@@ -176,10 +199,10 @@ void eu_event_loop(uint32_t cluster_core_idx) {
  */
 int eu_dispatch_push(void (*fn)(void *, uint32_t), uint32_t argc, void *data,
                      uint32_t nthreads) {
-    // wait for workers to be in wfi before manipulating the event struct
-    wait_worker_wfi();
+    // All workers are done with the previous event once `eu_run_empty`
+    // returned, and they read the event only after the next epoch is
+    // published, so it can be filled in place
 
-    // fill queue
     eu_p->e.fn = fn;
     eu_p->e.data = data;
     eu_p->e.argc = argc;
@@ -202,7 +225,7 @@ void eu_run_empty(uint32_t core_idx) {
     EU_PRINTF(10, "eu_run_empty enter: q size %d\n", eu_p->e.nthreads);
 
     eu_p->e.fini_count = 0;
-    if (scratch > 1) wake_workers();
+    if (scratch > 1) publish();
 
     // Am i also part of the team?
     if (core_idx < eu_p->e.nthreads) {
@@ -215,7 +238,7 @@ void eu_run_empty(uint32_t core_idx) {
     // wait for queue to be empty
     if (scratch > 1) {
         scratch = eu_get_workers_in_loop();
-        while (__atomic_load_n(&eu_p->e.fini_count, __ATOMIC_RELAXED) !=
+        while (__atomic_load_n(&eu_p->e.fini_count, __ATOMIC_ACQUIRE) !=
                scratch)
             ;
     }
@@ -240,10 +263,39 @@ inline void eu_mutex_release() { snrt_mutex_release(&eu_p->workers_mutex); }
 // private
 //================================================================================
 
-static void wait_worker_wfi(void) {
-    uint32_t scratch = eu_p->workers_in_loop;
-    while (__atomic_load_n(&eu_p->workers_wfi, __ATOMIC_RELAXED) != scratch)
-        ;
+/**
+ * @brief Publish the event or exit flag by advancing the epoch and wake the
+ * workers that went to sleep
+ * @details The sequentially consistent epoch store and `workers_wfi` load
+ * pair with the ones in `worker_wait`: either the main thread sees a worker
+ * announced its sleep and wakes it, or the worker sees the new epoch and does
+ * not sleep. A worker that was woken needlessly finds its wake-up pending at
+ * the next `wfi` and goes back to sleep.
+ */
+static void publish(void) {
+    __atomic_add_fetch(&eu_p->epoch, 1, __ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&eu_p->workers_wfi, __ATOMIC_SEQ_CST)) wake_workers();
+}
+
+/**
+ * @brief Wait for the epoch to move on from `seen`: poll it for
+ * `spin_cycles`, then sleep
+ * @details Any interrupt ends `wfi`, e.g. the timer of the PC sampling
+ * profiler, so the epoch is checked after every wake-up.
+ */
+static void worker_wait(uint32_t cluster_core_idx, uint32_t seen) {
+    uint32_t spin = eu_p->spin_cycles;
+    if (spin) {
+        uint32_t start = read_csr(mcycle);
+        while (__atomic_load_n(&eu_p->epoch, __ATOMIC_ACQUIRE) == seen)
+            if (read_csr(mcycle) - start >= spin) break;
+    }
+    if (__atomic_load_n(&eu_p->epoch, __ATOMIC_ACQUIRE) != seen) return;
+
+    __atomic_add_fetch(&eu_p->workers_wfi, 1, __ATOMIC_SEQ_CST);
+    while (__atomic_load_n(&eu_p->epoch, __ATOMIC_SEQ_CST) == seen)
+        worker_wfi(cluster_core_idx);
+    __atomic_add_fetch(&eu_p->workers_wfi, -1, __ATOMIC_RELAXED);
 }
 
 /**
@@ -269,7 +321,7 @@ static void wake_workers(void) {
 #else
 
     // wake all worker cores except the main thread
-    uint32_t numcores = snrt_cluster_compute_core_num(),
+    uint32_t numcores = eu_num_threads(),
              basehart = snrt_cluster_core_base_hartid();
     uint32_t mask = 0, hart = 1;
     for (; hart < numcores; ++hart) {
@@ -283,11 +335,7 @@ static void wake_workers(void) {
 #endif
 }
 
-static void worker_wfi(uint32_t cluster_core_idx) {
-    __atomic_add_fetch(&eu_p->workers_wfi, 1, __ATOMIC_RELAXED);
-    snrt_int_sw_poll();
-    __atomic_add_fetch(&eu_p->workers_wfi, -1, __ATOMIC_RELAXED);
-}
+static void worker_wfi(uint32_t cluster_core_idx) { snrt_int_sw_poll(); }
 
 /**
  * @brief If we use the wake-up register to wake the worker cores
@@ -296,18 +344,14 @@ static void worker_wfi(uint32_t cluster_core_idx) {
 #else  // #ifdef EU_USE_GLOBAL_CLINT
 
 static void wake_workers(void) {
-    // Guard to wake only if all workers are wfi
-    wait_worker_wfi();
     // Wake the cluster cores. We do this with cluster relative hart IDs and do
     // not wake hart 0 since this is the main thread
-    uint32_t numcores = snrt_cluster_compute_core_num();
+    uint32_t numcores = eu_num_threads();
     snrt_int_cluster_set(~0x1 & ((1 << numcores) - 1));
 }
 static void worker_wfi(uint32_t cluster_core_idx) {
-    __atomic_add_fetch(&eu_p->workers_wfi, 1, __ATOMIC_RELAXED);
     snrt_wfi();
     snrt_int_cluster_clr(1 << cluster_core_idx);
-    __atomic_add_fetch(&eu_p->workers_wfi, -1, __ATOMIC_RELAXED);
 }
 
 #endif  // #ifdef EU_USE_GLOBAL_CLINT
@@ -23,6 +23,9 @@ typedef void (*__task_type64)(_kmp_ptr64, _kmp_ptr64, _kmp_ptr64);
  */
 _kmp_ptr32 *kmpc_args;
 
+// Tasking, a weak reference so it is only linked in if the program uses tasks
+extern void omp_task_drain(void) __attribute__((weak));
+
 static void __microtask_wrapper(void *arg, uint32_t argc) {
     kmp_int32 id = omp_get_thread_num();
     kmp_int32 *id_addr = (kmp_int32 *)(&id);
@@ -37,6 +40,18 @@ static void __microtask_wrapper(void *arg, uint32_t argc) {
     OMP_PROF(if (snrt_hartid() == 1) omp_prof->fork_oh =
                  cycle - omp_prof->fork_oh);
 
+#ifdef OMPSTATIC_NUMTHREADS
+    // The outlined regions only take pointers, which the RV32 calling
+    // convention passes in a2-a7 for named and variadic arguments alike. The
+    // callee ignores the registers it does not declare, so passing all six
+    // skips the jump table for the common small regions. kmpc_args always
+    // holds KMP_FORK_MAX_NARGS entries, reading past argc is safe. The saving
+    // has not been measured yet, tests/omp_small_loops times it.
+    if (argc <= 6)
+        fn(&gtid, id_addr, p_argv[0], p_argv[1], p_argv[2], p_argv[3],
+           p_argv[4], p_argv[5]);
+    else
+#endif
     switch (argc) {
         default:
             // printf("Too many args to __microtask_wrapper: %d!\n", argc);
@@ -71,23 +86,29 @@ static void __microtask_wrapper(void *arg, uint32_t argc) {
         case 8:
             fn(&gtid, id_addr, p_argv[0], p_argv[1], p_argv[2], p_argv[3],
                p_argv[4], p_argv[5], p_argv[6], p_argv[7]);
+            break;
         case 9:
             fn(&gtid, id_addr, p_argv[0], p_argv[1], p_argv[2], p_argv[3],
                p_argv[4], p_argv[5], p_argv[6], p_argv[7], p_argv[8]);
+            break;
         case 10:
             fn(&gtid, id_addr, p_argv[0], p_argv[1], p_argv[2], p_argv[3],
                p_argv[4], p_argv[5], p_argv[6], p_argv[7], p_argv[8],
                p_argv[9]);
+            break;
         case 11:
             fn(&gtid, id_addr, p_argv[0], p_argv[1], p_argv[2], p_argv[3],
                p_argv[4], p_argv[5], p_argv[6], p_argv[7], p_argv[8], p_argv[9],
                p_argv[10]);
+            break;
         case 12:
             fn(&gtid, id_addr, p_argv[0], p_argv[1], p_argv[2], p_argv[3],
                p_argv[4], p_argv[5], p_argv[6], p_argv[7], p_argv[8], p_argv[9],
                p_argv[10], p_argv[11]);
             break;
     }
+    // The region ends once all of its tasks are done
+    if (omp_task_drain) omp_task_drain();
     // for performance tracking in traces
     cycle = read_csr(mcycle);
 }
@@ -124,7 +145,34 @@ void __kmpc_barrier(ident_t *loc, kmp_int32 tid) {
     _OMP_T *_this = omp_getData();
     uint32_t ret;
     KMP_PRINTF(50, "barrier numThreads: %d\n", (uint32_t)_this->numThreads);
-    snrt_barrier(_this->kmpc_barrier, (uint32_t)_this->numThreads);
+    // A barrier completes all tasks of the team
+    if (omp_task_drain) omp_task_drain();
+    snrt_barrier(_this->kmpc_barrier, omp_team_threads(omp_get_team(_this)));
+}
+
+/*!
+@ingroup WORK_SHARING
+@param loc  source location information.
+@param global_tid  global thread number .
+@return 1 if this thread should execute the <tt>master</tt> block, 0 otherwise.
+*/
+kmp_int32 __kmpc_master(ident_t *loc, kmp_int32 global_tid) {
+    (void)loc;
+    (void)global_tid;
+    return omp_get_thread_num() == 0;
+}
+
+/*!
+@ingroup WORK_SHARING
+@param loc  source location information.
+@param global_tid  global thread number .
+
+Mark the end of a <tt>master</tt> region. This should only be called by the
+thread that executes the <tt>master</tt> region.
+*/
+void __kmpc_end_master(ident_t *loc, kmp_int32 global_tid) {
+    (void)loc;
+    (void)global_tid;
 }
 
 /*!
@@ -202,7 +250,12 @@ void __kmpc_fork_call(ident_t *loc, kmp_int32 argc, kmpc_micro microtask, ...) {
         (void)eu_dispatch_push(__microtask_wrapper, argc, kmpc_args,
                                omp->numThreads);
     } else {
+#ifdef OMPSTATIC_NUMTHREADS
+        parallelRegion(argc, kmpc_args, __microtask_wrapper,
+                       OMPSTATIC_NUMTHREADS);
+#else
         parallelRegion(argc, kmpc_args, __microtask_wrapper, omp->numThreads);
+#endif
     }
 
     // rt_free(args);
@@ -239,7 +292,10 @@ void __kmpc_for_static_init_4(ident_t *loc, kmp_int32 gtid,
     _OMP_T *omp = omp_getData();
     _OMP_TEAM_T *team = omp_get_team(omp);
     unsigned threadNum = omp_get_thread_num();
-    kmp_uint32 loopSize = (*pupper - *plower) / incr + 1;
+    unsigned nthreads = omp_team_threads(team);
+    // most loops count up by one, skip the division for them
+    kmp_uint32 loopSize =
+        (incr == 1 ? *pupper - *plower : (*pupper - *plower) / incr) + 1;
     kmp_int32 globalUpper = *pupper;
 
     KMP_PRINTF(50,
@@ -255,7 +311,7 @@ void __kmpc_for_static_init_4(ident_t *loc, kmp_int32 gtid,
     if (sched == kmp_sch_static_chunked) {
         KMP_PRINTF(50, "    sched: static_chunked\n");
         int span = incr * chunk;
-        *pstride = span * team->nbThreads;
+        *pstride = span * nthreads;
         *plower = *plower + span * threadNum;
         *pupper = *plower + span - incr;
         int beginLastChunk = globalUpper - (globalUpper % span);
@@ -265,8 +321,8 @@ void __kmpc_for_static_init_4(ident_t *loc, kmp_int32 gtid,
     // no specified chunk size
     else if (sched == kmp_sch_static) {
         KMP_PRINTF(50, "    sched: static\n");
-        chunk = loopSize / team->nbThreads;
-        int leftOver = loopSize - chunk * team->nbThreads;
+        chunk = loopSize / nthreads;
+        int leftOver = loopSize - chunk * nthreads;
 
         // calculate precise chunk size and lower and upper bound
         if ((int)threadNum < leftOver) {
@@ -281,7 +337,7 @@ void __kmpc_for_static_init_4(ident_t *loc, kmp_int32 gtid,
         *pstride = loopSize;
 
         KMP_PRINTF(50, "    team thds: %d chunk: %d leftOver: %d\n",
-                   team->nbThreads, chunk, leftOver);
+                   nthreads, chunk, leftOver);
     }
 
     KMP_PRINTF(10,
@@ -324,7 +380,9 @@ void __kmpc_for_static_init_8u(ident_t *loc, kmp_int32 gtid, kmp_int32 sched,
     _OMP_T *omp = omp_getData();
     _OMP_TEAM_T *team = omp_get_team(omp);
     unsigned threadNum = omp_get_thread_num();
-    kmp_uint64 loopSize = (*pupper - *plower) / incr + 1;
+    unsigned nthreads = omp_team_threads(team);
+    kmp_uint64 loopSize =
+        (incr == 1 ? *pupper - *plower : (*pupper - *plower) / incr) + 1;
     kmp_uint64 globalUpper = *pupper;
 
     KMP_PRINTF(50,
@@ -341,7 +399,7 @@ void __kmpc_for_static_init_8u(ident_t *loc, kmp_int32 gtid, kmp_int32 sched,
     if (sched == kmp_sch_static_chunked) {
         KMP_PRINTF(50, "    sched: static_chunked\n");
         kmp_int64 span = incr * chunk;
-        *pstride = span * team->nbThreads;
+        *pstride = span * nthreads;
         *plower = *plower + span * threadNum;
         *pupper = *plower + span - incr;
         kmp_int64 beginLastChunk = globalUpper - (globalUpper % span);
@@ -351,8 +409,8 @@ void __kmpc_for_static_init_8u(ident_t *loc, kmp_int32 gtid, kmp_int32 sched,
     // no specified chunk size
     else if (sched == kmp_sch_static) {
         KMP_PRINTF(50, "    sched: static\n");
-        chunk = loopSize / team->nbThreads;
-        kmp_int64 leftOver = loopSize - chunk * team->nbThreads;
+        chunk = loopSize / nthreads;
+        kmp_int64 leftOver = loopSize - chunk * nthreads;
 
         // calculate precise chunk size and lower and upper bound
         if (threadNum < leftOver) {
@@ -368,7 +426,7 @@ void __kmpc_for_static_init_8u(ident_t *loc, kmp_int32 gtid, kmp_int32 sched,
 
         KMP_PRINTF(
             50, "    team thds: %d chunk: %" PRId64 " leftOver: %" PRId64 "\n",
-            team->nbThreads, chunk, leftOver);
+            nthreads, chunk, leftOver);
     }
 
     KMP_PRINTF(10,
@@ -378,12 +436,166 @@ void __kmpc_for_static_init_8u(ident_t *loc, kmp_int32 gtid, kmp_int32 sched,
                *plastiter, *plower, *pupper, incr, *pstride, chunk);
 }
 
+//================================================================================
+// Reductions
+//================================================================================
+
+/**
+ * @brief Combine the partials of all threads into the main thread's
+ * @details Binomial tree: in round `s` (1, 2, 4, ...), the threads with bit
+ * `s` set hand their subtree's partial to the thread `s` below, which
+ * combines it into its own. A thread waits until its partial was combined,
+ * as it lives on the thread's stack.
+ */
+static void kmp_reduce_tree(omp_reduce_t *r, uint32_t idx, uint32_t n,
+                            void *data, void (*reduce_func)(void *, void *)) {
+    for (uint32_t s = 1; s < n && !(idx & s); s <<= 1) {
+        if (idx + s >= n) continue;
+        omp_reduce_slot_t *child = &r->slot[idx + s];
+        while (!__atomic_load_n(&child->ready, __ATOMIC_ACQUIRE))
+            ;
+        reduce_func(data, child->data);
+        __atomic_store_n(&child->ready, 0, __ATOMIC_RELEASE);
+    }
+    if (idx) {
+        omp_reduce_slot_t *self = &r->slot[idx];
+        self->data = data;
+        __atomic_store_n(&self->ready, 1, __ATOMIC_RELEASE);
+        while (__atomic_load_n(&self->ready, __ATOMIC_ACQUIRE))
+            ;
+    }
+}
+
+/*!
+@ingroup SYNCHRONIZATION
+@param loc source location information.
+@param global_tid global thread number.
+@param num_vars number of items (variables) to be reduced
+@param reduce_size size of data in bytes to be reduced
+@param reduce_data pointer to data to be reduced
+@param reduce_func callback function providing reduction operation on two
+operands and returning result of reduction in lhs_data
+@param lck pointer to the unique lock data structure
+@result 1 for the main thread, 0 for others. The atomic method (2) is never
+chosen: `reduce_size` does not tell the type apart, and a double or 64-bit
+atomic update needs libcalls or `__kmpc_critical`, neither of which is
+available.
+
+The nowait version is used for a reduce clause with the nowait argument.
+*/
+kmp_int32 __kmpc_reduce_nowait(ident_t *loc, kmp_int32 global_tid,
+                               kmp_int32 num_vars, size_t reduce_size,
+                               void *reduce_data,
+                               void (*reduce_func)(void *lhs_data,
+                                                   void *rhs_data),
+                               kmp_critical_name *lck) {
+    (void)loc;
+    (void)global_tid;
+    (void)num_vars;
+    (void)reduce_size;
+    (void)lck;
+    _OMP_T *omp = omp_getData();
+    uint32_t n = omp_team_threads(omp_get_team(omp));
+    uint32_t idx = omp_get_thread_num();
+
+    if (n == 1) return 1;
+    kmp_reduce_tree(omp->kmpc_reduce, idx, n, reduce_data, reduce_func);
+    return idx == 0;
+}
+
+/*!
+@ingroup SYNCHRONIZATION
+@param loc source location information
+@param global_tid global thread id.
+@param lck pointer to the unique lock data structure
+
+Finish the execution of a reduce nowait.
+*/
+void __kmpc_end_reduce_nowait(ident_t *loc, kmp_int32 global_tid,
+                              kmp_critical_name *lck) {
+    (void)loc;
+    (void)global_tid;
+    (void)lck;
+}
+
+/*!
+@ingroup SYNCHRONIZATION
+@param loc source location information
+@param global_tid global thread number
+@param num_vars number of items (variables) to be reduced
+@param reduce_size size of data in bytes to be reduced
+@param reduce_data pointer to data to be reduced
+@param reduce_func callback function providing reduction operation on two
+operands and returning result of reduction in lhs_data
+@param lck pointer to the unique lock data structure
+@result 1 for the main thread, 0 for others, see `__kmpc_reduce_nowait`
+
+A blocking reduce that includes an implicit barrier: the other threads return
+once the main thread stored the result in `__kmpc_end_reduce`.
+*/
+kmp_int32 __kmpc_reduce(ident_t *loc, kmp_int32 global_tid, kmp_int32 num_vars,
+                        size_t reduce_size, void *reduce_data,
+                        void (*reduce_func)(void *lhs_data, void *rhs_data),
+                        kmp_critical_name *lck) {
+    (void)loc;
+    (void)global_tid;
+    (void)num_vars;
+    (void)reduce_size;
+    (void)lck;
+    _OMP_T *omp = omp_getData();
+    omp_reduce_t *r = omp->kmpc_reduce;
+    uint32_t n = omp_team_threads(omp_get_team(omp));
+    uint32_t idx = omp_get_thread_num();
+
+    if (n == 1) return 1;
+
+    // The main thread cannot release before all partials are in, so this is
+    // the count before this reduction
+    uint32_t release = r->release;
+    kmp_reduce_tree(r, idx, n, reduce_data, reduce_func);
+    if (idx)
+        while (__atomic_load_n(&r->release, __ATOMIC_ACQUIRE) == release)
+            ;
+    return idx == 0;
+}
+
+/*!
+@ingroup SYNCHRONIZATION
+@param loc source location information
+@param global_tid global thread ID
+@param lck pointer to the unique lock data structure
+
+Finish the execution of a blocking reduce. Called by the main thread after
+storing the tree's result, releases the other threads.
+*/
+void __kmpc_end_reduce(ident_t *loc, kmp_int32 global_tid,
+                       kmp_critical_name *lck) {
+    (void)loc;
+    (void)global_tid;
+    (void)lck;
+    if (omp_team_threads(omp_get_team(omp_getData())) > 1)
+        __atomic_add_fetch(&omp_getData()->kmpc_reduce->release, 1,
+                           __ATOMIC_RELEASE);
+}
+
 //================================================================================
 // Dynamic scheduling
 // Only available if not OMPSTATIC_NUMTHREADS
 //================================================================================
 #ifndef OMPSTATIC_NUMTHREADS
 
+/**
+ * @brief Loops of the current parallel region the calling thread entered, and
+ * the region they were counted in
+ */
+static __thread uint32_t kmp_loop;
+static __thread uint32_t kmp_loop_region;
+
+/**
+ * @brief Dispatch buffer of the loop the calling thread is in
+ */
+static __thread omp_dispatch_t *kmp_dispatch;
+
 /*!
 @ingroup WORK_SHARING
 @{
@@ -398,38 +610,74 @@ void __kmpc_for_static_init_8u(ident_t *loc, kmp_int32 gtid, kmp_int32 sched,
 This function prepares the runtime to start a dynamically scheduled for loop,
 saving the loop arguments.
 These functions are all identical apart from the types of the arguments.
+
+The first thread to reach the loop sets up a dispatch buffer for it, the
+others wait until it is ready. Static schedules are handed out like dynamic
+ones with chunks of one share per thread; runtime and auto map to guided.
 */
 void __kmpc_dispatch_init_4(ident_t *loc, kmp_int32 gtid,
                             enum sched_type schedule, kmp_int32 lb,
                             kmp_int32 ub, kmp_int32 st, kmp_int32 chunk) {
     (void)loc;
     (void)gtid;
-    (void)schedule;
     omp_team_t *team = omp_get_team(omp_getData());
-    // dynLoopInitNoIter(team, lb, ub, st, chunk);
-    // int core_id = omp_get_thread_num();
-    eu_mutex_lock();
-    // if (team->loop_epoch - team->core_epoch[core_id] != 0)
-    // {
-    //   eu_mutex_release();
-    //   team->core_epoch[core_id]++;
-    //   KMP_PRINTF(10, "__kmpc_dispatch_init_4 core_epoch[%d] =
-    //   %d\n",core_id,team->core_epoch[core_id]); return;
-    // }
-
-    if (!team->loop_is_setup) {
-        team->loop_is_setup = 1;
-        team->loop_start = lb;
-        team->loop_end = ub;
-        team->loop_incr = st;
-        team->loop_chunk = chunk;
-        KMP_PRINTF(
-            10,
-            "__kmpc_dispatch_init_4 setup: start %d end %d incr %d chunk %d\n",
-            team->loop_start, team->loop_end, team->loop_incr,
-            team->loop_chunk);
+
+    if (kmp_loop_region != team->region) {
+        kmp_loop_region = team->region;
+        kmp_loop = 0;
+    }
+    uint32_t loop = ++kmp_loop;
+    omp_dispatch_t *d = &team->dispatch[loop % OMP_DISPATCH_BUFS];
+    kmp_dispatch = d;
+
+    uint32_t prev = loop > OMP_DISPATCH_BUFS ? loop - OMP_DISPATCH_BUFS : 0;
+    if (!__atomic_compare_exchange_n(&d->claimed, &prev, loop, 0,
+                                     __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+        while (__atomic_load_n(&d->epoch, __ATOMIC_ACQUIRE) != loop)
+            ;
+        return;
+    }
+
+    // All threads must be done with the loop that used the buffer before
+    if (loop > OMP_DISPATCH_BUFS)
+        while (__atomic_load_n(&d->done, __ATOMIC_ACQUIRE) != d->nthreads)
+            ;
+
+    uint32_t nthreads = team->nbThreads;
+    uint32_t count = 0;
+    if (st > 0 && ub >= lb)
+        count = (uint32_t)(ub - lb) / st + 1;
+    else if (st < 0 && lb >= ub)
+        count = (uint32_t)(lb - ub) / -st + 1;
+    if (chunk < 1) chunk = 1;
+
+    d->guided = 0;
+    switch (SCHEDULE_WITHOUT_MODIFIERS(schedule)) {
+        case kmp_sch_static:
+        case kmp_sch_static_greedy:
+        case kmp_sch_static_balanced:
+            chunk = (count + nthreads - 1) / nthreads;
+            break;
+        case kmp_sch_static_chunked:
+        case kmp_sch_dynamic_chunked:
+            break;
+        default:
+            d->guided = 1;
+            break;
     }
-    eu_mutex_release();
+
+    d->nthreads = nthreads;
+    d->count = count;
+    d->start = lb;
+    d->incr = st;
+    d->chunk = chunk ? chunk : 1;
+    d->next = 0;
+    d->done = 0;
+    KMP_PRINTF(10,
+               "__kmpc_dispatch_init_4 setup: loop %d start %d count %d incr "
+               "%d chunk %d guided %d\n",
+               loop, d->start, d->count, d->incr, d->chunk, d->guided);
+    __atomic_store_n(&d->epoch, loop, __ATOMIC_RELEASE);
 }
 
 /*!
@@ -455,43 +703,39 @@ otherwise
 
 Get the next dynamically allocated chunk of work for this thread.
 If there is no more work, then the lb,ub and stride need not be modified.
+
+A chunk is claimed with a single fetch-add on the shared iteration counter.
+Guided chunks are a share of the remaining iterations, computed from the
+counter read just before; if other threads claim chunks in between, the chunk
+is a bit larger than ideal but still disjoint from theirs.
 */
 int __kmpc_dispatch_next_4(ident_t *loc, kmp_int32 gtid, kmp_int32 *p_last,
                            kmp_int32 *p_lb, kmp_int32 *p_ub, kmp_int32 *p_st) {
     (void)loc;
     (void)gtid;
+    omp_dispatch_t *d = kmp_dispatch;
 
-    omp_team_t *team = omp_get_team(omp_getData());
-
-    // The stride is actually always 1
-    *p_st = 1;
-
-    // int result = dynLoopIter(team, (int*) p_lb, (int*) p_ub, (int*) p_last);
-    eu_mutex_lock();
-
-    // have already iterated over all the iterations(no more work), return 0
-    if (team->loop_start > team->loop_end) {
-        team->loop_is_setup = 0;
-        KMP_PRINTF(
-            10, "__kmpc_dispatch_next_4 start > end: team->loop_is_setup %d\n",
-            team->loop_is_setup);
-        eu_mutex_release();
-        return 0;
+    uint32_t size = d->chunk;
+    if (d->guided) {
+        uint32_t next = __atomic_load_n(&d->next, __ATOMIC_RELAXED);
+        if (next < d->count)
+            size = snrt_max(size, (d->count - next) / (2 * d->nthreads));
     }
 
-    *p_lb = team->loop_start;
-    *p_ub = *p_lb + team->loop_chunk - 1;
-    if (*p_ub >= team->loop_end) {
-        *p_ub = team->loop_end;
-        *p_last = 1;
+    uint32_t first = __atomic_fetch_add(&d->next, size, __ATOMIC_RELAXED);
+    if (first >= d->count) {
+        __atomic_add_fetch(&d->done, 1, __ATOMIC_RELEASE);
+        KMP_PRINTF(10, "__kmpc_dispatch_next_4 done\n");
+        return 0;
     }
 
-    team->loop_start += team->loop_chunk;
-    KMP_PRINTF(10,
-               "__kmpc_dispatch_next_4 : last: %d [l %4d u %4d s %4d] "
-               "team->loop_start %d\n",
-               *p_last, *p_lb, *p_ub, *p_st, team->loop_start);
-    eu_mutex_release();
+    uint32_t last = snrt_min(d->count - first, size) + first - 1;
+    *p_lb = d->start + (kmp_int32)first * d->incr;
+    *p_ub = d->start + (kmp_int32)last * d->incr;
+    *p_st = d->incr;
+    *p_last = last == d->count - 1;
+    KMP_PRINTF(10, "__kmpc_dispatch_next_4 : last: %d [l %4d u %4d s %4d]\n",
+               *p_last, *p_lb, *p_ub, *p_st);
     return 1;
 }
 
@@ -509,4 +753,49 @@ int __kmpc_dispatch_next_4u(ident_t *loc, kmp_int32 gtid, kmp_int32 *p_last,
     return ret;
 }
 
+/**
+ * @brief Number of `single` constructs of the current parallel region the
+ * calling thread encountered, and the region they were counted in
+ */
+static __thread uint32_t kmp_single;
+static __thread uint32_t kmp_single_region;
+
+/*!
+@ingroup WORK_SHARING
+@param loc  source location information
+@param global_tid  global thread number
+@return One if this thread should execute the single construct, zero otherwise.
+
+Test whether to execute a <tt>single</tt> construct. The first thread to
+encounter the n-th construct of the region claims it by moving the team's count
+from n - 1 to n. A thread that comes late finds the count at n or beyond, even
+if faster threads went on past further constructs with `nowait`.
+*/
+kmp_int32 __kmpc_single(ident_t *loc, kmp_int32 global_tid) {
+    (void)loc;
+    (void)global_tid;
+    omp_team_t *team = omp_get_team(omp_getData());
+    if (kmp_single_region != team->region) {
+        kmp_single_region = team->region;
+        kmp_single = 0;
+    }
+    uint32_t prev = kmp_single++;
+    return __atomic_compare_exchange_n(&team->single, &prev, kmp_single, 0,
+                                       __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+}
+
+/*!
+@ingroup WORK_SHARING
+@param loc  source location information
+@param global_tid  global thread number
+
+Mark the end of a <tt>single</tt> construct. This function should
+only be called by the thread that executed the block of code protected
+by the `single` construct.
+*/
+void __kmpc_end_single(ident_t *loc, kmp_int32 global_tid) {
+    (void)loc;
+    (void)global_tid;
+}
+
 #endif  // #ifndef OMPSTATIC_NUMTHREADS
@@ -39,6 +39,9 @@ omp_t omp_p = {
 omp_prof_t *omp_prof;
 #endif
 
+// Tasking, a weak reference so it is only linked in if the program uses tasks
+extern void omp_task_init(void) __attribute__((weak));
+
 //================================================================================
 // public
 //================================================================================
@@ -52,31 +55,39 @@ void omp_init(void) {
         // allocate space for kmp arguments
         kmpc_args =
             (_kmp_ptr32 *)snrt_l1alloc(sizeof(_kmp_ptr32) * KMP_FORK_MAX_NARGS);
+        if (omp_task_init) omp_task_init();
 #ifndef OMPSTATIC_NUMTHREADS
         omp_p = (omp_t *)snrt_l1alloc(sizeof(omp_t));
-        unsigned int nbCores = snrt_cluster_compute_core_num();
+        unsigned int nbCores = eu_num_threads();
         omp_p->numThreads = nbCores;
         omp_p->maxThreads = nbCores;
 
         omp_p->plainTeam.nbThreads = nbCores;
-        omp_p->plainTeam.loop_epoch = 0;
-        omp_p->plainTeam.loop_is_setup = 0;
-
-        for (int i = 0; i < sizeof(omp_p->plainTeam.core_epoch) /
-                                sizeof(omp_p->plainTeam.core_epoch[0]);
-             i++)
-            omp_p->plainTeam.core_epoch[i] = 0;
+        omp_p->plainTeam.region = 0;
+        omp_p->plainTeam.single = 0;
+        snrt_memset(omp_p->plainTeam.dispatch, 0,
+                    sizeof(omp_p->plainTeam.dispatch));
 
         initTeam(omp_p, &omp_p->plainTeam);
         omp_p->kmpc_barrier =
             (struct snrt_barrier *)snrt_l1alloc(sizeof(struct snrt_barrier));
         snrt_memset(omp_p->kmpc_barrier, 0, sizeof(struct snrt_barrier));
+        omp_p->kmpc_reduce = (omp_reduce_t *)snrt_l1alloc(
+            sizeof(omp_reduce_t) + nbCores * sizeof(omp_reduce_slot_t));
+        snrt_memset(omp_p->kmpc_reduce, 0,
+                    sizeof(omp_reduce_t) + nbCores * sizeof(omp_reduce_slot_t));
         // Exchange omp pointer with other cluster cores
         omp_p_global = omp_p;
 #else
         omp_p.kmpc_barrier =
             (struct snrt_barrier *)snrt_l1alloc(sizeof(struct snrt_barrier));
         snrt_memset(omp_p.kmpc_barrier, 0, sizeof(struct snrt_barrier));
+        omp_p.kmpc_reduce = (omp_reduce_t *)snrt_l1alloc(
+            sizeof(omp_reduce_t) +
+            OMPSTATIC_NUMTHREADS * sizeof(omp_reduce_slot_t));
+        snrt_memset(omp_p.kmpc_reduce, 0,
+                    sizeof(omp_reduce_t) +
+                        OMPSTATIC_NUMTHREADS * sizeof(omp_reduce_slot_t));
         // Exchange omp pointer with other cluster cores
         omp_p_global = &omp_p;
 #endif
@@ -114,7 +125,7 @@ unsigned __attribute__((noinline)) snrt_omp_bootstrap(uint32_t core_idx) {
     if (core_idx == 0) {
         // master hart initializes event unit and runtime
         snrt_cluster_hw_barrier();
-        while (eu_get_workers_in_wfi() != (snrt_cluster_compute_core_num() - 1))
+        while (eu_get_workers_in_loop() != (eu_num_threads() - 1))
             ;
         return 0;
     } else if (snrt_is_dm_core()) {
@@ -134,6 +145,14 @@ void partialParallelRegion(int32_t argc, void *data,
                            void (*fn)(void *, uint32_t), int num_threads) {
 #ifndef OMPSTATIC_NUMTHREADS
     omp_p->plainTeam.nbThreads = num_threads;
+    // All dynamic loops of the previous region are done, start numbering
+    // them anew
+    omp_p->plainTeam.region++;
+    omp_p->plainTeam.single = 0;
+    for (int i = 0; i < OMP_DISPATCH_BUFS; i++) {
+        omp_p->plainTeam.dispatch[i].claimed = 0;
+        omp_p->plainTeam.dispatch[i].epoch = 0;
+    }
 #endif
 
     OMP_PRINTF(10, "num_threads=%d nbThreads=%d omp_p->numThreads=%d\n",
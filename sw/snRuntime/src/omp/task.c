@@ -0,0 +1,387 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "kmp.h"
+#include "omp.h"
+
+//================================================================================
+// Settings
+//================================================================================
+
+/**
+ * @brief Size of a task descriptor in bytes, including the runtime's header,
+ * the compiler's task with its privates, and the shareds
+ *
+ */
+#define OMP_TASK_BLOCK 128
+
+/**
+ * @brief Number of task descriptors in the pool of the cluster
+ *
+ */
+#define OMP_TASK_POOL 64
+
+/**
+ * @brief Number of entries of each thread's deque, a power of two. A task
+ * that does not fit is run right away.
+ *
+ */
+#define OMP_TASK_DEQUE 32
+
+/**
+ * @brief Largest number of descriptors a thread takes from or returns to the
+ * shared pool at once. Fewer with many threads, see omp_task_init.
+ *
+ */
+#define OMP_TASK_BATCH 8
+
+//================================================================================
+// Types
+//================================================================================
+
+/**
+ * @brief Runtime header of a task, followed by the compiler's task
+ * @details A task holds a reference on itself until it finished, and each of
+ * its children holds one on it until the child finished; the descriptor is
+ * freed when the last reference is dropped. The implicit task of a thread
+ * never drops its own reference.
+ */
+typedef struct omp_task_node {
+    struct omp_task_node *parent;
+    // task the thread ran before this one, for undeferred tasks
+    struct omp_task_node *prev;
+    // unfinished children, for taskwait
+    volatile uint32_t children;
+    volatile uint32_t refs;
+    kmp_task_t task;
+} omp_task_node_t;
+
+typedef union omp_task_block {
+    union omp_task_block *next;
+    uint8_t data[OMP_TASK_BLOCK];
+} omp_task_block_t;
+
+/**
+ * @brief Chase-Lev work-stealing deque of fixed size. The owner pushes and
+ * pops at the bottom, thieves take from the top.
+ */
+typedef struct {
+    volatile int32_t top;
+    volatile int32_t bottom;
+    omp_task_node_t *volatile buf[OMP_TASK_DEQUE];
+} omp_deque_t;
+
+typedef struct {
+    // tasks created and not finished, team-wide
+    volatile uint32_t pending;
+    volatile uint32_t pool_lock;
+    omp_task_block_t *pool;
+    // descriptors moved between the pool and a thread at once
+    uint32_t batch;
+    uint32_t nthreads;
+    omp_deque_t deques[];
+} omp_tasks_t;
+
+//================================================================================
+// Data
+//================================================================================
+
+static omp_tasks_t *omp_tasks;
+
+// Free descriptors of the calling thread
+static __thread omp_task_block_t *task_free;
+static __thread uint32_t task_nfree;
+// Task the thread runs, NULL in its implicit task
+static __thread omp_task_node_t *task_current;
+static __thread omp_task_node_t task_implicit = {.refs = 1};
+// Next thread to steal from
+static __thread uint32_t task_victim;
+
+//================================================================================
+// Private
+//================================================================================
+
+static inline omp_task_node_t *task_node(kmp_task_t *task) {
+    return (omp_task_node_t *)((uint8_t *)task -
+                               __builtin_offsetof(omp_task_node_t, task));
+}
+
+static inline omp_task_node_t *task_self() {
+    return task_current ? task_current : &task_implicit;
+}
+
+static omp_task_block_t *block_alloc() {
+    if (!task_free) {
+        snrt_mutex_lock(&omp_tasks->pool_lock);
+        for (uint32_t i = 0; i < omp_tasks->batch && omp_tasks->pool; i++) {
+            omp_task_block_t *b = omp_tasks->pool;
+            omp_tasks->pool = b->next;
+            b->next = task_free;
+            task_free = b;
+            task_nfree++;
+        }
+        snrt_mutex_release(&omp_tasks->pool_lock);
+        if (!task_free) return 0;
+    }
+    omp_task_block_t *b = task_free;
+    task_free = b->next;
+    task_nfree--;
+    return b;
+}
+
+static void block_free(omp_task_block_t *b) {
+    b->next = task_free;
+    task_free = b;
+    if (++task_nfree < 2 * omp_tasks->batch) return;
+
+    // Give some back for threads that create more tasks than they run
+    snrt_mutex_lock(&omp_tasks->pool_lock);
+    for (uint32_t i = 0; i < omp_tasks->batch; i++) {
+        b = task_free;
+        task_free = b->next;
+        b->next = omp_tasks->pool;
+        omp_tasks->pool = b;
+    }
+    task_nfree -= omp_tasks->batch;
+    snrt_mutex_release(&omp_tasks->pool_lock);
+}
+
+static int deque_push(omp_deque_t *d, omp_task_node_t *t) {
+    int32_t b = d->bottom;
+    int32_t top = __atomic_load_n(&d->top, __ATOMIC_ACQUIRE);
+    if (b - top >= OMP_TASK_DEQUE) return 0;
+    d->buf[b & (OMP_TASK_DEQUE - 1)] = t;
+    __atomic_store_n(&d->bottom, b + 1, __ATOMIC_RELEASE);
+    return 1;
+}
+
+static omp_task_node_t *deque_pop(omp_deque_t *d) {
+    int32_t b = d->bottom - 1;
+    d->bottom = b;
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int32_t top = d->top;
+    if (top > b) {
+        d->bottom = b + 1;
+        return 0;
+    }
+    omp_task_node_t *t = d->buf[b & (OMP_TASK_DEQUE - 1)];
+    if (top == b) {
+        // Last entry, race the thieves for it
+        if (!__atomic_compare_exchange_n(&d->top, &top, top + 1, 0,
+                                         __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+            t = 0;
+        d->bottom = b + 1;
+    }
+    return t;
+}
+
+static omp_task_node_t *deque_steal(omp_deque_t *d) {
+    int32_t top = __atomic_load_n(&d->top, __ATOMIC_ACQUIRE);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    int32_t b = __atomic_load_n(&d->bottom, __ATOMIC_ACQUIRE);
+    if (top >= b) return 0;
+    omp_task_node_t *t = d->buf[top & (OMP_TASK_DEQUE - 1)];
+    if (!__atomic_compare_exchange_n(&d->top, &top, top + 1, 0,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+        return 0;
+    return t;
+}
+
+/**
+ * @brief Next task to run: the newest one of the own deque, else the oldest
+ * one of another thread's deque
+ */
+static omp_task_node_t *task_next() {
+    uint32_t me = snrt_cluster_core_idx();
+    uint32_t n = omp_tasks->nthreads;
+    omp_task_node_t *t = deque_pop(&omp_tasks->deques[me]);
+    for (uint32_t i = 1; !t && i < n; i++) {
+        task_victim = (task_victim + 1) % n;
+        if (task_victim != me) t = deque_steal(&omp_tasks->deques[task_victim]);
+    }
+    return t;
+}
+
+static void task_release(omp_task_node_t *t) {
+    if (!__atomic_sub_fetch(&t->refs, 1, __ATOMIC_ACQ_REL))
+        block_free((omp_task_block_t *)t);
+}
+
+static void task_finish(omp_task_node_t *t) {
+    omp_task_node_t *parent = t->parent;
+    __atomic_sub_fetch(&parent->children, 1, __ATOMIC_RELEASE);
+    task_release(parent);
+    task_release(t);
+    __atomic_sub_fetch(&omp_tasks->pending, 1, __ATOMIC_RELEASE);
+}
+
+static void task_run(omp_task_node_t *t) {
+    omp_task_node_t *prev = task_current;
+    task_current = t;
+    t->task.routine(snrt_cluster_core_idx(), &t->task);
+    task_current = prev;
+    task_finish(t);
+}
+
+//================================================================================
+// Public
+//================================================================================
+
+void omp_task_init(void) {
+    uint32_t n = eu_num_threads();
+    omp_tasks = (omp_tasks_t *)snrt_l1alloc(sizeof(omp_tasks_t) +
+                                            n * sizeof(omp_deque_t));
+    snrt_memset(omp_tasks, 0, sizeof(omp_tasks_t) + n * sizeof(omp_deque_t));
+    omp_tasks->nthreads = n;
+    // A thread keeps up to 2 * batch - 1 descriptors. Together the threads
+    // keep less than the pool, so a thread that found it empty gets one once
+    // the running tasks finished.
+    omp_tasks->batch = OMP_TASK_POOL / (2 * n);
+    if (omp_tasks->batch > OMP_TASK_BATCH) omp_tasks->batch = OMP_TASK_BATCH;
+    if (!omp_tasks->batch) omp_tasks->batch = 1;
+
+    omp_task_block_t *pool = (omp_task_block_t *)snrt_l1alloc(
+        OMP_TASK_POOL * sizeof(omp_task_block_t));
+    for (uint32_t i = 0; i < OMP_TASK_POOL; i++) {
+        pool[i].next = omp_tasks->pool;
+        omp_tasks->pool = &pool[i];
+    }
+}
+
+void omp_task_drain(void) {
+    while (__atomic_load_n(&omp_tasks->pending, __ATOMIC_ACQUIRE)) {
+        omp_task_node_t *t = task_next();
+        if (t) task_run(t);
+    }
+}
+
+/*!
+@ingroup TASKING
+@param loc_ref source location information
+@param gtid global thread number
+@param flags task flags, tied, final, etc.
+@param sizeof_kmp_task_t size of the compiler's task including privates
+@param sizeof_shareds size of the shareds
+@param task_entry entry point of the task
+@return the task, filled in by the compiler before it is queued
+
+Take a descriptor from the pool of the calling thread. If the pool of the
+cluster is empty, the thread runs queued tasks until one is freed.
+*/
+kmp_task_t *__kmpc_omp_task_alloc(ident_t *loc_ref, kmp_int32 gtid,
+                                  kmp_int32 flags, size_t sizeof_kmp_task_t,
+                                  size_t sizeof_shareds,
+                                  kmp_routine_entry_t task_entry) {
+    (void)loc_ref;
+    (void)gtid;
+    (void)flags;
+    size_t task_size = (sizeof_kmp_task_t + 7) & ~7;
+    if (__builtin_offsetof(omp_task_node_t, task) + task_size +
+            sizeof_shareds >
+        OMP_TASK_BLOCK) {
+        KMP_PRINTF(0, "error: task of %d bytes too large\n",
+                   sizeof_kmp_task_t + sizeof_shareds);
+        snrt_exit(-1);
+    }
+
+    omp_task_block_t *b;
+    while (!(b = block_alloc())) {
+        omp_task_node_t *t = task_next();
+        if (t) task_run(t);
+    }
+
+    omp_task_node_t *t = (omp_task_node_t *)b;
+    omp_task_node_t *parent = task_self();
+    t->parent = parent;
+    t->children = 0;
+    t->refs = 1;
+    t->task.shareds = sizeof_shareds ? (uint8_t *)&t->task + task_size : 0;
+    t->task.routine = task_entry;
+    t->task.part_id = 0;
+    __atomic_add_fetch(&parent->children, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&parent->refs, 1, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&omp_tasks->pending, 1, __ATOMIC_RELAXED);
+    KMP_PRINTF(50, "__kmpc_omp_task_alloc %#x parent %#x\n", (uint32_t)t,
+               (uint32_t)parent);
+    return &t->task;
+}
+
+/*!
+@ingroup TASKING
+@param loc_ref source location information
+@param gtid global thread number
+@param new_task task allocated with `__kmpc_omp_task_alloc`
+@return 0
+
+Queue the task on the calling thread's deque, or run it right away if the
+deque is full.
+*/
+kmp_int32 __kmpc_omp_task(ident_t *loc_ref, kmp_int32 gtid,
+                          kmp_task_t *new_task) {
+    (void)loc_ref;
+    (void)gtid;
+    omp_task_node_t *t = task_node(new_task);
+    if (!deque_push(&omp_tasks->deques[snrt_cluster_core_idx()], t))
+        task_run(t);
+    return 0;
+}
+
+/*!
+@ingroup TASKING
+Start an undeferred task, e.g. with an `if(0)` clause, which the compiler then
+runs itself.
+*/
+void __kmpc_omp_task_begin_if0(ident_t *loc_ref, kmp_int32 gtid,
+                               kmp_task_t *task) {
+    (void)loc_ref;
+    (void)gtid;
+    omp_task_node_t *t = task_node(task);
+    t->prev = task_current;
+    task_current = t;
+}
+
+/*!
+@ingroup TASKING
+Finish an undeferred task, see `__kmpc_omp_task_begin_if0`.
+*/
+void __kmpc_omp_task_complete_if0(ident_t *loc_ref, kmp_int32 gtid,
+                                  kmp_task_t *task) {
+    (void)loc_ref;
+    (void)gtid;
+    omp_task_node_t *t = task_node(task);
+    task_current = t->prev;
+    task_finish(t);
+}
+
+/*!
+@ingroup TASKING
+@param loc_ref source location information
+@param gtid global thread number
+@return 0
+
+Wait for the children of the current task, running queued tasks meanwhile.
+*/
+kmp_int32 __kmpc_omp_taskwait(ident_t *loc_ref, kmp_int32 gtid) {
+    (void)loc_ref;
+    (void)gtid;
+    omp_task_node_t *self = task_self();
+    while (__atomic_load_n(&self->children, __ATOMIC_ACQUIRE)) {
+        omp_task_node_t *t = task_next();
+        if (t) task_run(t);
+    }
+    return 0;
+}
+
+/*!
+@ingroup TASKING
+Task scheduling point of `taskyield`; tasks are not suspended, so there is
+nothing to do.
+*/
+kmp_int32 __kmpc_omp_taskyield(ident_t *loc_ref, kmp_int32 gtid,
+                               int end_part) {
+    (void)loc_ref;
+    (void)gtid;
+    (void)end_part;
+    return 0;
+}
@@ -0,0 +1,250 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "perf_cnt.h"
+#include "printf.h"
+#include "snrt.h"
+#include "spatz_cluster_peripheral.h"
+#include "team.h"
+
+//================================================================================
+// Settings
+//================================================================================
+
+/**
+ * @brief Maximum number of harts in the system that can record regions. The
+ * region tables are kept in DRAM, indexed by the global core index.
+ *
+ */
+#define PERF_MAX_HARTS 64
+
+/**
+ * @brief Number of hardware counters per cluster
+ *
+ */
+#define PERF_HW_CNT SPATZ_CLUSTER_PERIPHERAL_PARAM_NUM_PERF_COUNTERS
+
+//================================================================================
+// Types
+//================================================================================
+
+typedef struct {
+    const char *name;
+    // completed runs
+    uint32_t runs;
+    uint64_t cycles;
+    // per selected event: sum over the runs that counted it, and their number
+    uint64_t events[SNRT_PERF_MAX_EVENTS];
+    uint32_t samples[SNRT_PERF_MAX_EVENTS];
+} perf_region_t;
+
+typedef struct {
+    // index into the region table, SNRT_PERF_MAX_REGIONS if the table was full
+    uint32_t region;
+    uint32_t cycles;
+    uint32_t cnt[PERF_HW_CNT];
+} perf_open_t;
+
+typedef struct {
+    enum snrt_perf_cnt_type types[SNRT_PERF_MAX_EVENTS];
+    uint32_t n_types;
+    perf_region_t regions[SNRT_PERF_MAX_REGIONS];
+    uint32_t n_regions;
+    // open regions, depth may exceed SNRT_PERF_MAX_DEPTH; deeper ones are
+    // not recorded
+    perf_open_t open[SNRT_PERF_MAX_DEPTH];
+    uint32_t depth;
+    // non-zero while the hart owns the cluster's counters, which then count
+    // the events of `group`
+    uint32_t owner;
+    uint32_t group;
+    // number of outermost runs that counted events
+    uint32_t counted;
+} perf_hart_t;
+
+//================================================================================
+// Data
+//================================================================================
+
+/**
+ * @brief Region tables of all harts
+ */
+static perf_hart_t perf_harts[PERF_MAX_HARTS];
+
+/**
+ * @brief Global core index of the hart printing its regions at exit
+ */
+static volatile uint32_t perf_dump_turn;
+
+/**
+ * @brief JSON names of `enum snrt_perf_cnt_type`
+ */
+static const char *const perf_type_names[] = {
+    "cycles",          "tcdm_accessed",     "tcdm_congested",
+    "issue_fpu",       "issue_fpu_seq",     "issue_core_to_fpu",
+    "retired_instr",   "retired_load",      "retired_i",
+    "retired_acc",     "dma_aw_stall",      "dma_ar_stall",
+    "dma_r_stall",     "dma_w_stall",       "dma_buf_w_stall",
+    "dma_buf_r_stall", "dma_aw_done",       "dma_aw_bw",
+    "dma_ar_done",     "dma_ar_bw",         "dma_r_done",
+    "dma_r_bw",        "dma_w_done",        "dma_w_bw",
+    "dma_b_done",      "dma_busy",          "icache_miss",
+    "icache_hit",      "icache_prefetch",   "icache_double_hit",
+    "icache_stall",
+};
+
+//================================================================================
+// Private
+//================================================================================
+
+static inline perf_hart_t *perf_hart() {
+    uint32_t idx = snrt_global_core_idx();
+    return idx < PERF_MAX_HARTS ? &perf_harts[idx] : 0;
+}
+
+static int perf_name_eq(const char *a, const char *b) {
+    if (a == b) return 1;
+    while (*a && *a == *b) a++, b++;
+    return *a == *b;
+}
+
+static uint32_t perf_lookup(perf_hart_t *h, const char *name) {
+    for (uint32_t i = 0; i < h->n_regions; i++)
+        if (perf_name_eq(h->regions[i].name, name)) return i;
+    if (h->n_regions == SNRT_PERF_MAX_REGIONS) return SNRT_PERF_MAX_REGIONS;
+    h->regions[h->n_regions].name = name;
+    return h->n_regions++;
+}
+
+/**
+ * @brief Event counted by hardware counter `k` in the current group, or
+ * `n_types` if the counter is unused
+ */
+static inline uint32_t perf_event(perf_hart_t *h, uint32_t k) {
+    uint32_t ev = h->group * PERF_HW_CNT + k;
+    return ev < h->n_types ? ev : h->n_types;
+}
+
+/**
+ * @brief Claim the cluster's counters for an outermost region and program
+ * them with the next group of events
+ */
+static void perf_claim(perf_hart_t *h) {
+    uint32_t free = 0;
+    uint32_t me = snrt_cluster_core_idx() + 1;
+    if (!h->n_types ||
+        !__atomic_compare_exchange_n(&snrt_current_team()->perf_cnt_owner,
+                                     &free, me, 0, __ATOMIC_ACQUIRE,
+                                     __ATOMIC_RELAXED))
+        return;
+
+    uint32_t n_groups = (h->n_types + PERF_HW_CNT - 1) / PERF_HW_CNT;
+    h->owner = 1;
+    h->group = h->counted % n_groups;
+    for (uint32_t k = 0; k < PERF_HW_CNT; k++) {
+        uint32_t ev = perf_event(h, k);
+        snrt_reset_perf_counter(k);
+        if (ev < h->n_types)
+            snrt_start_perf_counter(k, h->types[ev], 1 << (me - 1));
+    }
+}
+
+static void perf_release(perf_hart_t *h) {
+    for (uint32_t k = 0; k < PERF_HW_CNT; k++) snrt_stop_perf_counter(k);
+    h->owner = 0;
+    h->counted++;
+    __atomic_store_n(&snrt_current_team()->perf_cnt_owner, 0,
+                     __ATOMIC_RELEASE);
+}
+
+static void perf_print(perf_hart_t *h) {
+    for (uint32_t i = 0; i < h->n_regions; i++) {
+        perf_region_t *r = &h->regions[i];
+        printf("{\"perf_region\": \"%s\", \"hart\": %d, \"cluster\": %d, "
+               "\"runs\": %d, \"cycles\": %llu, \"events\": {",
+               r->name, snrt_global_core_idx(), snrt_cluster_idx(), r->runs,
+               r->cycles);
+        const char *sep = "";
+        for (uint32_t ev = 0; ev < h->n_types; ev++) {
+            if (!r->samples[ev]) continue;
+            printf("%s\"%s\": [%llu, %d]", sep,
+                   perf_type_names[h->types[ev]], r->events[ev],
+                   r->samples[ev]);
+            sep = ", ";
+        }
+        printf("}}\n");
+    }
+}
+
+//================================================================================
+// Public
+//================================================================================
+
+void snrt_perf_region_select(const enum snrt_perf_cnt_type *types,
+                             uint32_t n) {
+    perf_hart_t *h = perf_hart();
+    if (!h) return;
+    h->n_types = snrt_min(n, SNRT_PERF_MAX_EVENTS);
+    for (uint32_t i = 0; i < h->n_types; i++) h->types[i] = types[i];
+    h->counted = 0;
+}
+
+/**
+ * @brief Enter the region `name`
+ * @details Cycles come from `mcycle` and are recorded for every run. The
+ * selected events are read from the cluster's counters, which the outermost
+ * region claims for the hart; nested regions take deltas of the same
+ * counters. If another hart of the cluster holds the counters, the run only
+ * records cycles.
+ */
+void snrt_perf_region_begin(const char *name) {
+    perf_hart_t *h = perf_hart();
+    if (!h) return;
+    if (h->depth >= SNRT_PERF_MAX_DEPTH) {
+        h->depth++;
+        return;
+    }
+    if (h->depth == 0) perf_claim(h);
+
+    perf_open_t *o = &h->open[h->depth++];
+    o->region = perf_lookup(h, name);
+    if (h->owner)
+        for (uint32_t k = 0; k < PERF_HW_CNT; k++)
+            o->cnt[k] = snrt_get_perf_counter(k);
+    o->cycles = read_csr(mcycle);
+}
+
+void snrt_perf_region_end() {
+    uint32_t now = read_csr(mcycle);
+    perf_hart_t *h = perf_hart();
+    if (!h || !h->depth) return;
+    if (h->depth-- > SNRT_PERF_MAX_DEPTH) return;
+
+    perf_open_t *o = &h->open[h->depth];
+    if (o->region < SNRT_PERF_MAX_REGIONS) {
+        perf_region_t *r = &h->regions[o->region];
+        r->runs++;
+        r->cycles += now - o->cycles;
+        for (uint32_t k = 0; h->owner && k < PERF_HW_CNT; k++) {
+            uint32_t ev = perf_event(h, k);
+            if (ev == h->n_types) continue;
+            r->events[ev] += snrt_get_perf_counter(k) - o->cnt[k];
+            r->samples[ev]++;
+        }
+    }
+    if (h->depth == 0 && h->owner) perf_release(h);
+}
+
+/**
+ * @brief Print the regions of all harts, one after the other in global core
+ * order, called by every core at exit
+ */
+void _snrt_perf_fini() {
+    uint32_t idx = snrt_global_core_idx();
+    while (perf_dump_turn != idx)
+        ;
+    perf_hart_t *h = perf_hart();
+    if (h) perf_print(h);
+    perf_dump_turn = idx + 1;
+}
@@ -38,6 +38,11 @@ void chs_uart_write(void *uart_base, uint8_t byte) {
     *reg8(CHS_UART_BASE, CHS_UART_THR_REG_OFFSET) = byte;
 }
 
+// Unbuffered output
+void _snrt_write(const char *data, size_t len) {
+    for (size_t i = 0; i < len; i++) chs_uart_write(CHS_UART_BASE, data[i]);
+}
+
 // Provide an implementation for putchar.
 void snrt_putchar(char character) {
     chs_uart_write(CHS_UART_BASE, character);
@@ -22,11 +22,34 @@ struct snrt_cluster_bootdata {
     uint64_t tcdm_offset;
     uint64_t global_mem_start;
     uint64_t global_mem_end;
+    uint64_t cluster_num;
+    uint64_t dm_core_mask;
 };
 
+// Size of the boot data of the platform. Older layouts, e.g. of Cheshire and
+// Carfield, end before the cluster count and the DM core mask.
+#ifndef SNRT_BOOTDATA_SIZE
+#define SNRT_BOOTDATA_SIZE sizeof(struct snrt_cluster_bootdata)
+#endif
+#define BOOTDATA_HAS(field)                                              \
+    (offsetof(struct snrt_cluster_bootdata, field) + sizeof(uint64_t) <= \
+     SNRT_BOOTDATA_SIZE)
+
+// Topology of the configuration, used if the boot data does not carry it
+#ifdef SNRT_TOPOLOGY
+#define BOOTDATA_CLUSTER_NUM SNRT_TOPO_CLUSTER_NUM
+#define BOOTDATA_DM_CORE_MASK SNRT_TOPO_CLUSTER_DM_CORE_MASK
+#else
+// A single cluster with the DMA on core 0, as in all shipped configurations
+#define BOOTDATA_CLUSTER_NUM 1
+#define BOOTDATA_DM_CORE_MASK 0x1
+#endif
+
 // Rudimentary string buffer for putc calls.
 extern uint32_t _edram;
 #define PUTC_BUFFER_LEN (1024 - sizeof(size_t))
+// Staging area for unbuffered output, see _snrt_write
+#define PUTC_STAGE_LEN 256
 struct putc_buffer_header {
     size_t size;
     uint64_t syscall_mem[8];
@@ -34,6 +57,7 @@ struct putc_buffer_header {
 static volatile struct putc_buffer {
     struct putc_buffer_header hdr;
     char data[PUTC_BUFFER_LEN];
+    char stage[PUTC_STAGE_LEN];
 } *const putc_buffer = (void *)&_edram;
 
 void _snrt_init_team(uint32_t cluster_core_id, uint32_t cluster_core_num,
@@ -41,15 +65,21 @@ void _snrt_init_team(uint32_t cluster_core_id, uint32_t cluster_core_num,
                      const struct snrt_cluster_bootdata *bootdata,
                      struct snrt_team_root *team) {
     (void)cluster_core_id;
+    uint32_t cluster_num = BOOTDATA_HAS(cluster_num) ? bootdata->cluster_num
+                                                     : BOOTDATA_CLUSTER_NUM;
+    uint32_t dm_core_mask = BOOTDATA_HAS(dm_core_mask) ? bootdata->dm_core_mask
+                                                       : BOOTDATA_DM_CORE_MASK;
     team->base.root = team;
     team->bootdata = (void *)bootdata;
     team->global_core_base_hartid = bootdata->hartid_base;
-    team->global_core_num = bootdata->core_count;
+    team->global_core_num = bootdata->core_count * cluster_num;
     team->cluster_idx =
         (snrt_hartid() - bootdata->hartid_base) / bootdata->core_count;
-    team->cluster_num = 0;
-    team->cluster_core_base_hartid = bootdata->hartid_base;
+    team->cluster_num = cluster_num;
+    team->cluster_core_base_hartid =
+        bootdata->hartid_base + team->cluster_idx * bootdata->core_count;
     team->cluster_core_num = cluster_core_num;
+    team->cluster_dm_core_mask = dm_core_mask;
     team->global_mem.start = (uint64_t)bootdata->global_mem_start;
     team->global_mem.end = (uint64_t)bootdata->global_mem_end;
     team->cluster_mem.start = (uint64_t)spm_start;
@@ -61,6 +91,17 @@ void _snrt_init_team(uint32_t cluster_core_id, uint32_t cluster_core_num,
     team->cluster_barrier.barrier = 0;
     team->cluster_barrier.barrier_iteration = 0;
 
+    // Initialize the broadcast flags
+    team->bcast.seq = 0;
+    team->bcast.dst = 0;
+    team->bcast.posted = 0;
+
+    // Initialize the reduction tree
+    for (uint32_t i = 0; i < SNRT_CLUSTER_MAX_CORES; i++)
+        team->reduce.ready[i] = 0;
+    team->reduce.copied = 0;
+    team->perf_cnt_owner = 0;
+
     // TLS caches of frequently used data
     _snrt_team_current = &team->base;
     _snrt_core_idx =
@@ -82,7 +123,24 @@ void _snrt_init_team(uint32_t cluster_core_id, uint32_t cluster_core_num,
         (uint32_t *)(spm_start + bootdata->tcdm_size +
                      SPATZ_CLUSTER_PERIPHERAL_CL_CLINT_SET_REG_OFFSET);
 
-    // Init allocator
-    snrt_alloc_init(team, sizeof(struct putc_buffer));
+    // Init allocator, behind the string buffers of all harts
+    snrt_alloc_init(team, (team->global_core_base_hartid +
+                           team->global_core_num) *
+                              sizeof(struct putc_buffer));
     snrt_int_init(team);
 }
+
+// Exit hooks of runtime parts that buffer data during the run. They are weak
+// references, so a part is only linked in if the program uses it.
+extern void _snrt_perf_fini() __attribute__((weak));
+extern void _snrt_profile_fini() __attribute__((weak));
+extern void _snrt_log_fini() __attribute__((weak));
+
+// Called by all cores once every cluster returned from main, before the exit
+// code is reported.
+void _snrt_fini() {
+    if (_snrt_perf_fini) _snrt_perf_fini();
+    if (_snrt_profile_fini) _snrt_profile_fini();
+    // Last, the hooks before may print into the log
+    if (_snrt_log_fini) _snrt_log_fini();
+}
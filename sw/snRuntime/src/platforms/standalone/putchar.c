@@ -1,6 +1,7 @@
 // Copyright 2020 ETH Zurich and University of Bologna.
 // Licensed under the Apache License, Version 2.0, see LICENSE for details.
 // SPDX-License-Identifier: Apache-2.0
+#include "log.h"
 #include "snrt.h"
 
 extern uintptr_t volatile tohost, fromhost;
@@ -8,6 +9,8 @@ extern uintptr_t volatile tohost, fromhost;
 // Rudimentary string buffer for putc calls.
 extern uint32_t _edram;
 #define PUTC_BUFFER_LEN (1024 - sizeof(size_t))
+// Staging area for unbuffered output, see _snrt_write
+#define PUTC_STAGE_LEN 256
 struct putc_buffer_header {
     size_t size;
     uint64_t syscall_mem[8];
@@ -15,23 +18,49 @@ struct putc_buffer_header {
 static volatile struct putc_buffer {
     struct putc_buffer_header hdr;
     char data[PUTC_BUFFER_LEN];
+    char stage[PUTC_STAGE_LEN];
 } *const putc_buffer = (void *)&_edram;
 
-// Provide an implementation for putchar.
+// Write `len` bytes at `data` in DRAM to stdout with a blocking HTIF syscall.
+static void htif_write(volatile struct putc_buffer *buf,
+                       const volatile char *data, size_t len) {
+    buf->hdr.syscall_mem[0] = 64;               // sys_write
+    buf->hdr.syscall_mem[1] = 1;                // file descriptor (1 = stdout)
+    buf->hdr.syscall_mem[2] = (uintptr_t)data;  // buffer
+    buf->hdr.syscall_mem[3] = len;              // length
+
+    tohost = (uintptr_t)buf->hdr.syscall_mem;
+    while (fromhost == 0)
+        ;
+    fromhost = 0;
+}
+
+// Unbuffered output. The host only sees DRAM, so the data is staged in DRAM,
+// apart from the line buffer: it may be full with a line that is being
+// appended to the log ring while the ring drains.
+void _snrt_write(const char *data, size_t len) {
+    volatile struct putc_buffer *buf = &putc_buffer[snrt_hartid()];
+    while (len) {
+        size_t chunk = len < PUTC_STAGE_LEN ? len : PUTC_STAGE_LEN;
+        for (size_t i = 0; i < chunk; i++) buf->stage[i] = data[i];
+        htif_write(buf, buf->stage, chunk);
+        data += chunk;
+        len -= chunk;
+    }
+}
+
+// Provide an implementation for putchar. With SNRT_LOG_RING, complete lines
+// are appended to the log ring of the hart instead of being written out,
+// which is drained at exit.
 void snrt_putchar(char character) {
     volatile struct putc_buffer *buf = &putc_buffer[snrt_hartid()];
     buf->data[buf->hdr.size++] = character;
     if (buf->hdr.size == PUTC_BUFFER_LEN || character == '\n') {
-        buf->hdr.syscall_mem[0] = 64;  // sys_write
-        buf->hdr.syscall_mem[1] = 1;   // file descriptor (1 = stdout)
-        buf->hdr.syscall_mem[2] = (uintptr_t)&buf->data;  // buffer
-        buf->hdr.syscall_mem[3] = buf->hdr.size;          // length
-
-        tohost = (uintptr_t)buf->hdr.syscall_mem;
-        while (fromhost == 0)
-            ;
-        fromhost = 0;
-
+#ifdef SNRT_LOG_RING
+        _snrt_log_text((const char *)buf->data, buf->hdr.size);
+#else
+        htif_write(buf, buf->data, buf->hdr.size);
+#endif
         buf->hdr.size = 0;
     }
 }
@@ -0,0 +1,246 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "profile.h"
+
+#include "encoding.h"
+#include "printf.h"
+#include "snrt.h"
+
+//================================================================================
+// Settings
+//================================================================================
+
+/**
+ * @brief Register offsets in the RISC-V CLINT whose machine timer drives the
+ * timer interrupt (mtip) of the cores. The cluster has no timer of its own;
+ * the platform provides the CLINT base in `SNRT_CLINT_BASE`. Without one,
+ * sampling is compiled out and `snrt_profile_start` does nothing.
+ *
+ */
+#define PROFILE_CLINT_MTIMECMP 0x4000
+#define PROFILE_CLINT_MTIME 0xbff8
+
+/**
+ * @brief Maximum number of harts that can sample, indexed by the global core
+ * index
+ *
+ */
+#define PROFILE_MAX_HARTS 32
+
+/**
+ * @brief Number of samples buffered in L1 before they are moved to DRAM
+ *
+ */
+#define PROFILE_L1_SAMPLES 8
+
+/**
+ * @brief Number of samples kept in DRAM per hart, a multiple of
+ * `PROFILE_L1_SAMPLES`
+ *
+ */
+#define PROFILE_DRAM_SAMPLES 1024
+
+/**
+ * @brief Number of samples printed per line at exit
+ *
+ */
+#define PROFILE_LINE_SAMPLES 16
+
+//================================================================================
+// Macros
+//================================================================================
+
+#ifndef MIE_MTIE
+#define MIE_MTIE (1 << IRQ_M_TIMER)
+#endif
+
+#ifdef SNRT_CLINT_BASE
+
+//================================================================================
+// Types
+//================================================================================
+
+typedef struct {
+    uint32_t pc;
+    uint32_t ra;
+} profile_sample_t;
+
+typedef struct {
+    // mtime ticks between two timer interrupts
+    uint32_t period;
+    // timer interrupts per recorded sample, doubles whenever the samples
+    // are thinned out
+    uint32_t stride;
+    uint32_t n;
+    profile_sample_t samples[PROFILE_DRAM_SAMPLES];
+} profile_hart_t;
+
+//================================================================================
+// Data
+//================================================================================
+
+/**
+ * @brief Samples of all harts
+ */
+static profile_hart_t profile_harts[PROFILE_MAX_HARTS];
+
+/**
+ * @brief Global core index of the hart printing its samples at exit
+ */
+static volatile uint32_t profile_dump_turn;
+
+// State used on every timer interrupt, kept in the hart's TLS in L1
+static __thread profile_sample_t profile_l1[PROFILE_L1_SAMPLES];
+static __thread uint32_t profile_l1_n;
+static __thread uint32_t profile_skip;
+static __thread uint64_t profile_next;
+// Whether interrupts were globally enabled before sampling started
+static __thread uint32_t profile_mie;
+
+//================================================================================
+// Private
+//================================================================================
+
+static inline profile_hart_t *profile_hart() {
+    uint32_t idx = snrt_global_core_idx();
+    return idx < PROFILE_MAX_HARTS ? &profile_harts[idx] : 0;
+}
+
+static uint64_t profile_mtime() {
+    volatile uint32_t *t =
+        (volatile uint32_t *)(SNRT_CLINT_BASE + PROFILE_CLINT_MTIME);
+    uint32_t hi, lo;
+    do {
+        hi = t[1];
+        lo = t[0];
+    } while (hi != t[1]);
+    return ((uint64_t)hi << 32) | lo;
+}
+
+static void profile_arm(uint64_t when) {
+    volatile uint32_t *cmp =
+        (volatile uint32_t *)(SNRT_CLINT_BASE + PROFILE_CLINT_MTIMECMP +
+                              8 * snrt_hartid());
+    // Never let the compare value drop below `when` halfway through
+    cmp[1] = -1;
+    cmp[0] = (uint32_t)when;
+    cmp[1] = (uint32_t)(when >> 32);
+}
+
+/**
+ * @brief Move the L1 samples to DRAM
+ * @details If they do not fit, every other sample of the DRAM and L1 samples
+ * together is dropped and the stride doubled, so the samples stay evenly
+ * spread over the whole run.
+ */
+static void profile_flush(profile_hart_t *h) {
+    uint32_t n = h->n;
+    if (n + profile_l1_n > PROFILE_DRAM_SAMPLES) {
+        for (uint32_t i = 0; 2 * i < n; i++) h->samples[i] = h->samples[2 * i];
+        uint32_t k = (n + 1) / 2;
+        for (uint32_t i = n & 1; i < profile_l1_n; i += 2)
+            h->samples[k++] = profile_l1[i];
+        h->n = k;
+        h->stride *= 2;
+    } else {
+        for (uint32_t i = 0; i < profile_l1_n; i++)
+            h->samples[n + i] = profile_l1[i];
+        h->n = n + profile_l1_n;
+    }
+    profile_l1_n = 0;
+}
+
+static void profile_print(profile_hart_t *h) {
+    for (uint32_t i = 0; i < h->n; i += PROFILE_LINE_SAMPLES) {
+        printf("{\"pc_samples\": [");
+        uint32_t end = snrt_min(i + PROFILE_LINE_SAMPLES, h->n);
+        for (uint32_t j = i; j < end; j++)
+            printf("%s[%u, %u]", j == i ? "" : ", ", h->samples[j].pc,
+                   h->samples[j].ra);
+        printf("], \"hart\": %d, \"cluster\": %d, \"period\": %u}\n",
+               snrt_global_core_idx(), snrt_cluster_idx(),
+               h->period * h->stride);
+    }
+}
+
+//================================================================================
+// Public
+//================================================================================
+
+/**
+ * @brief Record a sample and re-arm the timer, called by the default
+ * `irq_m_timer`
+ *
+ * @param pc `mepc` of the interrupted code
+ * @param ra return address register of the interrupted code
+ */
+void _snrt_profile_sample(uint32_t pc, uint32_t ra) {
+    profile_hart_t *h = profile_hart();
+    if (!h || !h->period) return;
+
+    // Skip missed periods instead of raising the interrupt again right away
+    uint64_t now = profile_mtime();
+    profile_next += h->period;
+    if (profile_next <= now) profile_next = now + h->period;
+    profile_arm(profile_next);
+
+    if (--profile_skip) return;
+    profile_skip = h->stride;
+    profile_l1[profile_l1_n].pc = pc;
+    profile_l1[profile_l1_n].ra = ra;
+    if (++profile_l1_n == PROFILE_L1_SAMPLES) profile_flush(h);
+}
+
+/**
+ * @brief Start sampling on the calling hart
+ * @details Samples of earlier runs of the hart are kept, the period applies
+ * to all of them.
+ */
+void snrt_profile_start(uint32_t period) {
+    profile_hart_t *h = profile_hart();
+    if (!h || !period) return;
+    if (!h->stride) h->stride = 1;
+    h->period = period;
+    profile_skip = 1;
+
+    profile_next = profile_mtime() + period;
+    profile_arm(profile_next);
+    profile_mie = read_csr(mstatus) & MSTATUS_MIE;
+    snrt_interrupt_enable(IRQ_M_TIMER);
+    snrt_interrupt_global_enable();
+}
+
+void snrt_profile_stop() {
+    profile_hart_t *h = profile_hart();
+    if (!h || !h->period) return;
+    snrt_interrupt_disable(IRQ_M_TIMER);
+    if (!profile_mie) snrt_interrupt_global_disable();
+    profile_arm(-1);
+    profile_flush(h);
+}
+
+/**
+ * @brief Print the samples of all harts, one after the other in global core
+ * order, called by every core at exit
+ */
+void _snrt_profile_fini() {
+    uint32_t idx = snrt_global_core_idx();
+    while (profile_dump_turn != idx)
+        ;
+    profile_hart_t *h = profile_hart();
+    if (h) {
+        if (read_csr(mie) & MIE_MTIE) snrt_profile_stop();
+        profile_print(h);
+    }
+    profile_dump_turn = idx + 1;
+}
+
+#else
+
+void snrt_profile_start(uint32_t period) { (void)period; }
+
+void snrt_profile_stop() {}
+
+#endif
@@ -0,0 +1,170 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include "reduce.h"
+
+#include "snrt.h"
+#include "team.h"
+
+//================================================================================
+// Types
+//================================================================================
+
+typedef void (*reduce_op_t)(void *dst, const void *src, uint32_t n);
+
+//================================================================================
+// Data
+//================================================================================
+
+/**
+ * @brief Number of reductions the calling core took part in. All cores of
+ * the cluster take part in every reduction, so this is the sequence number of
+ * the next one.
+ */
+static __thread uint32_t reduce_epoch;
+
+/**
+ * @brief Number of copies of allreduce results core 0 expects in total
+ */
+static __thread uint32_t reduce_copies;
+
+//================================================================================
+// Macros
+//================================================================================
+
+/**
+ * @brief Define the vector kernel `reduce_<name>`, combining `src` into `dst`
+ * element-wise with the vector instruction `op` at element width `sew`
+ */
+#define REDUCE_OP(name, sew, op)                                         \
+    static void reduce_##name(void *dst, const void *src, uint32_t n) { \
+        uint8_t *d = (uint8_t *)dst;                                    \
+        const uint8_t *s = (const uint8_t *)src;                        \
+        size_t vl;                                                      \
+        while (n) {                                                     \
+            asm volatile("vsetvli %0, %1, e" #sew ", m8, ta, ma"        \
+                         : "=r"(vl)                                     \
+                         : "r"(n));                                     \
+            asm volatile("vle" #sew ".v v0, (%0)" ::"r"(d));            \
+            asm volatile("vle" #sew ".v v8, (%0)" ::"r"(s));            \
+            asm volatile(#op ".vv v0, v0, v8");                         \
+            asm volatile("vse" #sew ".v v0, (%0)" ::"r"(d) : "memory"); \
+            d += vl * (sew / 8);                                        \
+            s += vl * (sew / 8);                                        \
+            n -= vl;                                                    \
+        }                                                               \
+    }
+
+/**
+ * @brief Define `reduce_copy_<sew>`, copying `n` elements of `sew` bits
+ */
+#define REDUCE_COPY(sew)                                                 \
+    static void reduce_copy_##sew(void *dst, const void *src,            \
+                                  uint32_t n) {                          \
+        uint8_t *d = (uint8_t *)dst;                                     \
+        const uint8_t *s = (const uint8_t *)src;                         \
+        size_t vl;                                                       \
+        while (n) {                                                      \
+            asm volatile("vsetvli %0, %1, e" #sew ", m8, ta, ma"         \
+                         : "=r"(vl)                                      \
+                         : "r"(n));                                      \
+            asm volatile("vle" #sew ".v v0, (%0)" ::"r"(s));             \
+            asm volatile("vse" #sew ".v v0, (%0)" ::"r"(d) : "memory");  \
+            d += vl * (sew / 8);                                         \
+            s += vl * (sew / 8);                                         \
+            n -= vl;                                                     \
+        }                                                                \
+    }
+
+/**
+ * @brief Define the public reduce and allreduce functions of one operation
+ */
+#define REDUCE_PUBLIC(op, type, sew)                                      \
+    void snrt_cluster_reduce_##op##_f##sew(type *data, uint32_t n) {      \
+        reduce_tree(data, n, reduce_##op##_##sew, 0);                     \
+    }                                                                     \
+    void snrt_cluster_allreduce_##op##_f##sew(type *data, uint32_t n) {   \
+        reduce_tree(data, n, reduce_##op##_##sew, reduce_copy_##sew);     \
+    }
+
+//================================================================================
+// Private
+//================================================================================
+
+REDUCE_OP(sum_64, 64, vfadd)
+REDUCE_OP(max_64, 64, vfmax)
+REDUCE_OP(min_64, 64, vfmin)
+REDUCE_OP(sum_32, 32, vfadd)
+REDUCE_OP(max_32, 32, vfmax)
+REDUCE_OP(min_32, 32, vfmin)
+REDUCE_OP(sum_16, 16, vfadd)
+REDUCE_OP(max_16, 16, vfmax)
+REDUCE_OP(min_16, 16, vfmin)
+
+REDUCE_COPY(64)
+REDUCE_COPY(32)
+REDUCE_COPY(16)
+
+static inline void reduce_wait(volatile uint32_t *flag, uint32_t seq) {
+    while (__atomic_load_n(flag, __ATOMIC_ACQUIRE) != seq)
+        ;
+}
+
+/**
+ * @brief Binomial combining tree over all cores of the cluster
+ * @details In round `s` (1, 2, 4, ...), the cores with bit `s` set hand their
+ * subtree's result to the core `s` below and leave; the others combine the
+ * array of the core `s` above into their own. A core's parent is thus the
+ * core index with its lowest set bit cleared. Each core flags the completion
+ * of its subtree, so the tree is log2(cores) deep and needs no barrier. If
+ * `copy` is given, the result is copied back to all cores (allreduce).
+ */
+static void reduce_tree(void *data, uint32_t n, reduce_op_t op,
+                        reduce_op_t copy) {
+    struct snrt_reduce_local *r = &snrt_current_team()->reduce;
+    uint32_t idx = snrt_cluster_core_idx();
+    uint32_t num = snrt_cluster_core_num();
+    uint32_t seq = ++reduce_epoch;
+
+    r->data[idx] = data;
+    for (uint32_t s = 1; s < num && !(idx & s); s <<= 1) {
+        if (idx + s < num) {
+            reduce_wait(&r->ready[idx + s], seq);
+            op(data, r->data[idx + s], n);
+        }
+    }
+    __atomic_store_n(&r->ready[idx], seq, __ATOMIC_RELEASE);
+
+    if (!copy) {
+        // The array must stay valid until the parent combined it
+        if (idx) reduce_wait(&r->ready[idx & (idx - 1)], seq);
+        return;
+    }
+
+    if (idx) {
+        reduce_wait(&r->ready[0], seq);
+        copy(data, r->data[0], n);
+        __atomic_add_fetch(&r->copied, 1, __ATOMIC_RELEASE);
+    } else {
+        // Keep the result valid until everybody copied it
+        reduce_copies += num - 1;
+        uint32_t expect = reduce_copies;
+        while (__atomic_load_n(&r->copied, __ATOMIC_ACQUIRE) != expect)
+            ;
+    }
+}
+
+//================================================================================
+// Public
+//================================================================================
+
+REDUCE_PUBLIC(sum, double, 64)
+REDUCE_PUBLIC(max, double, 64)
+REDUCE_PUBLIC(min, double, 64)
+REDUCE_PUBLIC(sum, float, 32)
+REDUCE_PUBLIC(max, float, 32)
+REDUCE_PUBLIC(min, float, 32)
+REDUCE_PUBLIC(sum, __fp16, 16)
+REDUCE_PUBLIC(max, __fp16, 16)
+REDUCE_PUBLIC(min, __fp16, 16)
@@ -1,6 +1,9 @@
 // Copyright 2020 ETH Zurich and University of Bologna.
 // Licensed under the Apache License, Version 2.0, see LICENSE for details.
 // SPDX-License-Identifier: Apache-2.0
+// The out-of-line topology queries are always built, for code compiled without
+// the generated topology header
+#define SNRT_TOPOLOGY_OUTLINE
 #include "team.h"
 
 #include "snrt.h"
@@ -47,34 +50,53 @@ uint32_t snrt_cluster_core_num() {
     return _snrt_team_current->root->cluster_core_num;
 }
 
+uint32_t snrt_global_compute_core_idx() {
+    return snrt_cluster_idx() * snrt_cluster_compute_core_num() +
+           snrt_cluster_compute_core_idx();
+}
+
+uint32_t snrt_global_compute_core_num() {
+    return snrt_cluster_num() * snrt_cluster_compute_core_num();
+}
+
+uint32_t snrt_global_dm_core_idx() {
+    uint32_t mask = _snrt_team_current->root->cluster_dm_core_mask;
+    return snrt_cluster_idx() * snrt_cluster_dm_core_num() +
+           __builtin_popcount(mask & ((1u << _snrt_core_idx) - 1));
+}
+
+uint32_t snrt_global_dm_core_num() {
+    return snrt_cluster_num() * snrt_cluster_dm_core_num();
+}
+
 uint32_t snrt_cluster_compute_core_idx() {
-    // TODO: Actually derive this from the device tree!
-    return snrt_cluster_core_idx();
+    // Compute cores are numbered in core order, skipping the DM cores
+    uint32_t mask = _snrt_team_current->root->cluster_dm_core_mask;
+    return _snrt_core_idx -
+           __builtin_popcount(mask & ((1u << _snrt_core_idx) - 1));
 }
 
 uint32_t snrt_cluster_compute_core_num() {
-    // TODO: Actually derive this from the device tree!
-    return snrt_cluster_core_num() - 1;
+    return snrt_cluster_core_num() - snrt_cluster_dm_core_num();
 }
 
 uint32_t snrt_cluster_dm_core_idx() {
-    // TODO: Actually derive this from the device tree!
-    return snrt_cluster_core_num() - 1;
+    // The first DM core if there are several
+    return __builtin_ctz(_snrt_team_current->root->cluster_dm_core_mask);
 }
 
 uint32_t snrt_cluster_dm_core_num() {
-    // TODO: Actually derive this from the device tree!
-    return 1;
+    return __builtin_popcount(_snrt_team_current->root->cluster_dm_core_mask);
 }
 
 int snrt_is_compute_core() {
-    // TODO: Actually derive this from the device tree!
+    // All cores but the last, independent of the DM core mask
     return snrt_cluster_core_idx() < snrt_cluster_core_num() - 1;
 }
 
 int snrt_is_dm_core() {
-    // TODO: Actually derive this from the device tree!
-    return !snrt_is_compute_core();
+    return (_snrt_team_current->root->cluster_dm_core_mask >> _snrt_core_idx) &
+           1;
 }
 
 uint32_t _snrt_barrier_reg_ptr() {
@@ -89,6 +111,49 @@ snrt_slice_t snrt_cluster_memory() {
     return _snrt_team_current->root->cluster_mem;
 }
 
+struct snrt_subteam *snrt_team_split(uint32_t mask) {
+    uint32_t all = (snrt_cluster_core_num() < 32)
+                       ? (1u << snrt_cluster_core_num()) - 1
+                       : ~0u;
+    mask &= all;
+    if (snrt_cluster_core_idx() == 0) {
+        struct snrt_subteam *team = snrt_l1alloc(sizeof(*team));
+        team->mask = mask;
+        team->size = __builtin_popcount(mask);
+        team->hw = mask == all;
+        team->count = 0;
+        team->sense = 0;
+        _snrt_team_current->root->subteam = team;
+    }
+    snrt_cluster_hw_barrier();
+    struct snrt_subteam *team = _snrt_team_current->root->subteam;
+    // Keep core 0 from publishing the next team before everyone read this one
+    snrt_cluster_hw_barrier();
+    return (mask >> snrt_cluster_core_idx()) & 1 ? team : 0;
+}
+
+void snrt_team_barrier(struct snrt_subteam *team) {
+    if (team->hw) {
+        snrt_cluster_hw_barrier();
+        return;
+    }
+    // The shared sense cannot flip before we arrived, so the sense to wait
+    // for is the opposite of the one we see now
+    uint32_t sense = !team->sense;
+    if (__atomic_add_fetch(&team->count, 1, __ATOMIC_RELAXED) == team->size) {
+        team->count = 0;
+        __atomic_store_n(&team->sense, sense, __ATOMIC_RELEASE);
+    } else {
+        while (team->sense != sense)
+            ;
+    }
+}
+
+uint32_t snrt_team_rank(const struct snrt_subteam *team) {
+    return __builtin_popcount(team->mask &
+                              ((1u << snrt_cluster_core_idx()) - 1));
+}
+
 void snrt_wakeup(uint32_t mask) { *snrt_peripherals()->wakeup = mask; }
 
 void snrt_set_eoc_and_return_code (int eoc_and_return_code) {
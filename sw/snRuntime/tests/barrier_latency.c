@@ -0,0 +1,43 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// Average latency of the barrier flavours of the runtime over ITERATIONS
+// back-to-back barriers, printed by the first member of the first cluster.
+// Team barriers are compared against the cluster hardware barrier.
+
+#include <snrt.h>
+
+#include "printf.h"
+#include "team.h"
+
+#define ITERATIONS 32
+
+// `first` is the cluster core index of the first member
+#define MEASURE(name, barrier, first)                                    \
+    do {                                                                 \
+        barrier;                                                         \
+        uint32_t t0 = read_csr(mcycle);                                  \
+        for (uint32_t i = 0; i < ITERATIONS; i++) barrier;               \
+        uint32_t t1 = read_csr(mcycle);                                  \
+        if (snrt_cluster_idx() == 0 && snrt_cluster_core_idx() == first) \
+            printf("%-20s %d cycles\n", name, (t1 - t0) / ITERATIONS);   \
+    } while (0)
+
+int main() {
+    MEASURE("cluster_hw_barrier", snrt_cluster_hw_barrier(), 0);
+    MEASURE("cluster_sw_barrier", snrt_cluster_sw_barrier(), 0);
+    MEASURE("global_barrier", snrt_global_barrier(), 0);
+
+    // Sub-teams: the compute cores only (software barrier) and the whole
+    // cluster (mapped to the hardware barrier)
+    uint32_t all = (1u << snrt_cluster_core_num()) - 1;
+    uint32_t dm = 1u << snrt_cluster_dm_core_idx();
+    struct snrt_subteam *compute = snrt_team_split(all & ~dm);
+    struct snrt_subteam *cluster = snrt_team_split(all);
+    if (compute)
+        MEASURE("team_barrier_sw", snrt_team_barrier(compute),
+                __builtin_ctz(all & ~dm));
+    MEASURE("team_barrier_hw", snrt_team_barrier(cluster), 0);
+    return 0;
+}
@@ -0,0 +1,91 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// Broadcasts a table from DRAM and from the TCDM of cluster 0 to all clusters
+// and checks every core's view of it. Compares the cycles until every core
+// has consumed the table when all cores read it from DRAM against the
+// broadcast into TCDM followed by local reads.
+
+#include <snrt.h>
+
+#include "printf.h"
+
+#define N 1024
+#define MAX_CLUSTERS 16
+
+uint32_t table[N];
+
+static volatile uint32_t errors;
+static volatile uint32_t cycles[2];
+static uint32_t *volatile buf_shared[MAX_CLUSTERS];
+
+static void record(uint32_t phase, uint32_t c) {
+    uint32_t prev = cycles[phase];
+    while (c > prev && !__atomic_compare_exchange_n(&cycles[phase], &prev, c,
+                                                    0, __ATOMIC_RELAXED,
+                                                    __ATOMIC_RELAXED))
+        ;
+}
+
+static uint32_t sum(const volatile uint32_t *p) {
+    uint32_t s = 0;
+    for (uint32_t i = 0; i < N; i++) s += p[i];
+    return s;
+}
+
+int main() {
+    uint32_t cluster_idx = snrt_cluster_idx();
+    uint32_t core_idx = snrt_cluster_core_idx();
+    uint32_t global_idx = snrt_global_core_idx();
+    uint32_t err = 0;
+
+    if (global_idx == 0)
+        for (uint32_t i = 0; i < N; i++) table[i] = i * 13 + 5;
+    if (core_idx == 0) buf_shared[cluster_idx] = snrt_l1alloc(N * 4);
+    snrt_global_barrier();
+    uint32_t *buf = buf_shared[cluster_idx];
+    uint32_t expect = 0;
+    for (uint32_t i = 0; i < N; i++) expect += i * 13 + 5;
+
+    // Every core reads the table from DRAM
+    snrt_global_barrier();
+    uint32_t t0 = read_csr(mcycle);
+    err += sum(table) != expect;
+    snrt_global_barrier();
+    record(0, read_csr(mcycle) - t0);
+
+    // Broadcast into TCDM, every core reads its cluster's copy
+    snrt_global_barrier();
+    t0 = read_csr(mcycle);
+    if (global_idx == 0)
+        snrt_bcast_send(table, sizeof(table));
+    else
+        snrt_bcast_recv(buf, sizeof(table));
+    err += sum(buf) != expect;
+    snrt_global_barrier();
+    record(1, read_csr(mcycle) - t0);
+
+    // Broadcast from the TCDM of cluster 0 after changing it there. Its
+    // receivers pass the source, which is not copied.
+    if (core_idx == 0)
+        for (uint32_t i = 0; i < N; i++) buf[i] = cluster_idx == 0 ? i : 0;
+    snrt_global_barrier();
+    if (global_idx == 0)
+        snrt_bcast_send(buf, sizeof(table));
+    else
+        snrt_bcast_recv(buf, sizeof(table));
+    err += sum(buf) != N * (N - 1) / 2;
+
+    __atomic_add_fetch(&errors, err, __ATOMIC_RELAXED);
+    snrt_global_barrier();
+
+    if (global_idx == 0) {
+        printf("bcast: %d B to %d clusters x %d cores\n", sizeof(table),
+               snrt_cluster_num(), snrt_cluster_core_num());
+        printf("dram:  %d cycles\n", cycles[0]);
+        printf("bcast: %d cycles\n", cycles[1]);
+        return errors;
+    }
+    return 0;
+}
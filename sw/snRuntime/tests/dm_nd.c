@@ -0,0 +1,58 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// N-D copies through the DM task queue with more dimensions than a queue
+// entry and than snrt_dma_start_nd take at once, so both split them. Each
+// dimension has 2 repetitions; dimension k is dense in the destination and
+// steps through every other word of the source in reverse order of
+// significance, so no two dimensions merge. Compares the result.
+
+#include <dm.h>
+#include <snrt.h>
+
+#define ND (SNRT_DMA_MAX_DIMS + 2)
+
+uint32_t src[2 << ND];
+uint32_t dst[1 << ND];
+
+static volatile uint32_t errors;
+
+static uint32_t bitrev(uint32_t j) {
+    uint32_t r = 0;
+    for (uint32_t k = 0; k < ND; k++) r |= ((j >> k) & 1) << (ND - 1 - k);
+    return r;
+}
+
+int main() {
+    uint32_t core_idx = snrt_cluster_core_idx();
+
+    dm_init();
+    snrt_cluster_hw_barrier();
+    if (snrt_is_dm_core()) {
+        dm_main();
+        // The DM core may be core 0, which reports the result
+        return core_idx == 0 ? errors : 0;
+    }
+    if (snrt_cluster_compute_core_idx() != 0) return 0;
+
+    size_t dst_strides[ND], src_strides[ND], repeats[ND];
+    for (uint32_t k = 0; k < ND; k++) {
+        dst_strides[k] = sizeof(uint32_t) << k;
+        src_strides[k] = 2 * sizeof(uint32_t) << (ND - 1 - k);
+        repeats[k] = 2;
+    }
+    for (uint32_t i = 0; i < (2 << ND); i++) src[i] = i;
+
+    dm_handle_t h = dm_memcpy_nd_async(dst, src, sizeof(uint32_t), ND,
+                                       dst_strides, src_strides, repeats);
+    dm_start();
+    dm_wait_task(h);
+
+    uint32_t err = 0;
+    for (uint32_t j = 0; j < (1 << ND); j++) err += dst[j] != 2 * bitrev(j);
+    errors = err;
+
+    dm_exit();
+    return core_idx == 0 ? errors : 0;
+}
@@ -0,0 +1,127 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// Multi-producer microbenchmark of the DM task queue: every compute core
+// queues NTASKS small copies, first one call per copy, then as one batch, and
+// waits for its own transfers. A third phase waits for the copies one by one
+// through their handles. The last phase queues one call per copy under a
+// mutex shared by all producers, as the locked queue this one replaced did,
+// for comparison with the first. Prints the slowest core's cycles per phase.
+
+#include <dm.h>
+#include <snrt.h>
+
+#include "printf.h"
+
+#define NTASKS 16
+#define CHUNK 128
+
+uint8_t src[NTASKS * CHUNK];
+
+static struct snrt_barrier barr;
+static volatile uint32_t errors;
+static volatile uint32_t cycles[4];
+static volatile uint32_t queue_mutex;
+static uint8_t *volatile dst_all;
+
+static void record(uint32_t phase, uint32_t c) {
+    uint32_t prev = cycles[phase];
+    while (c > prev && !__atomic_compare_exchange_n(&cycles[phase], &prev, c,
+                                                    0, __ATOMIC_RELAXED,
+                                                    __ATOMIC_RELAXED))
+        ;
+}
+
+static uint32_t check(const uint8_t *dst, uint32_t offset, uint32_t num) {
+    uint32_t err = 0;
+    for (uint32_t i = offset; i < offset + num; i++) err += dst[i] != src[i];
+    return err;
+}
+
+int main() {
+    uint32_t core_idx = snrt_cluster_core_idx();
+    uint32_t prod_idx = snrt_cluster_compute_core_idx();
+    uint32_t nprod = snrt_cluster_compute_core_num();
+
+    if (core_idx == 0)
+        for (uint32_t i = 0; i < sizeof(src); i++) src[i] = i * 7 + 3;
+
+    dm_init();
+    snrt_cluster_hw_barrier();
+    if (snrt_is_dm_core()) {
+        dm_main();
+        // The DM core may be core 0, which reports the result
+        return core_idx == 0 ? errors : 0;
+    }
+
+    // the allocator is not thread-safe, one core allocates for all
+    if (prod_idx == 0) dst_all = snrt_l1alloc(nprod * NTASKS * CHUNK);
+    snrt_barrier(&barr, nprod);
+    uint8_t *dst = dst_all + prod_idx * NTASKS * CHUNK;
+    dm_desc_t descs[NTASKS];
+    for (uint32_t i = 0; i < NTASKS; i++) {
+        descs[i] = (dm_desc_t){.src = (uintptr_t)(src + i * CHUNK),
+                               .dst = (uintptr_t)(dst + i * CHUNK),
+                               .size = CHUNK};
+    }
+
+    // One call per copy
+    snrt_barrier(&barr, nprod);
+    uint32_t t0 = read_csr(mcycle);
+    for (uint32_t i = 0; i < NTASKS; i++)
+        dm_memcpy_async(dst + i * CHUNK, src + i * CHUNK, CHUNK);
+    dm_wait_own();
+    record(0, read_csr(mcycle) - t0);
+    uint32_t err = check(dst, 0, NTASKS * CHUNK);
+
+    // One batch
+    snrt_memset(dst, 0, NTASKS * CHUNK);
+    snrt_barrier(&barr, nprod);
+    t0 = read_csr(mcycle);
+    dm_memcpy_batch_async(descs, NTASKS);
+    dm_wait_own();
+    record(1, read_csr(mcycle) - t0);
+    err += check(dst, 0, NTASKS * CHUNK);
+
+    // One handle per copy, consumed as soon as it arrived
+    dm_handle_t handles[NTASKS];
+    snrt_memset(dst, 0, NTASKS * CHUNK);
+    snrt_barrier(&barr, nprod);
+    t0 = read_csr(mcycle);
+    for (uint32_t i = 0; i < NTASKS; i++)
+        handles[i] = dm_memcpy_async(dst + i * CHUNK, src + i * CHUNK, CHUNK);
+    dm_start();
+    for (uint32_t i = 0; i < NTASKS; i++) {
+        dm_wait_task(handles[i]);
+        err += check(dst, i * CHUNK, CHUNK);
+    }
+    record(2, read_csr(mcycle) - t0);
+
+    // One call per copy, producers serialized on a mutex
+    snrt_memset(dst, 0, NTASKS * CHUNK);
+    snrt_barrier(&barr, nprod);
+    t0 = read_csr(mcycle);
+    for (uint32_t i = 0; i < NTASKS; i++) {
+        snrt_mutex_lock(&queue_mutex);
+        dm_memcpy_async(dst + i * CHUNK, src + i * CHUNK, CHUNK);
+        snrt_mutex_release(&queue_mutex);
+    }
+    dm_wait_own();
+    record(3, read_csr(mcycle) - t0);
+    err += check(dst, 0, NTASKS * CHUNK);
+
+    __atomic_add_fetch(&errors, err, __ATOMIC_RELAXED);
+    snrt_barrier(&barr, nprod);
+
+    if (prod_idx == 0) {
+        printf("dm_producers: %d producers x %d tasks of %d B\n", nprod,
+               NTASKS, CHUNK);
+        printf("single: %d cycles\n", cycles[0]);
+        printf("batch:  %d cycles\n", cycles[1]);
+        printf("handle: %d cycles\n", cycles[2]);
+        printf("locked: %d cycles\n", cycles[3]);
+        dm_exit();
+    }
+    return core_idx == 0 ? errors : 0;
+}
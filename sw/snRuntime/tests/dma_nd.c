@@ -0,0 +1,93 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <snrt.h>
+
+#define C 4
+#define H 8
+#define W 16
+
+// Tile cut out of the input: channels [1, 4), rows [2, 7), columns [4, 12)
+#define TC 3
+#define TH 5
+#define TW 8
+
+uint32_t input[C][H][W];
+uint32_t output[C][H][W];
+
+// Gather over more dimensions than snrt_dma_start_nd handles at once, each
+// with 2 repetitions. Dimension k is dense in the destination and steps
+// through every other word of the source in reverse order of significance,
+// so no two dimensions merge.
+#define ND (SNRT_DMA_MAX_DIMS + 2)
+uint32_t rev_src[2 << ND];
+uint32_t rev_dst[1 << ND];
+
+static uint32_t bitrev(uint32_t j) {
+    uint32_t r = 0;
+    for (uint32_t k = 0; k < ND; k++) r |= ((j >> k) & 1) << (ND - 1 - k);
+    return r;
+}
+
+static volatile uint32_t errors;
+
+int main() {
+    if (snrt_is_dm_core()) {
+        uint32_t err = 0;
+        for (uint32_t c = 0; c < C; c++)
+            for (uint32_t h = 0; h < H; h++)
+                for (uint32_t w = 0; w < W; w++)
+                    input[c][h][w] = (c << 16) | (h << 8) | w;
+
+        uint32_t(*tile)[TH][TW] = snrt_l1alloc(sizeof(uint32_t[TC][TH][TW]));
+
+        // Strided 3D gather into a dense L1 tile
+        snrt_dma_txid_t tid = snrt_dma_start_3d(
+            tile, &input[1][2][4], TW * sizeof(uint32_t), sizeof(tile[0][0]),
+            sizeof(input[0][0]), TH, sizeof(tile[0]), sizeof(input[0]), TC);
+        snrt_dma_wait(tid);
+        for (uint32_t c = 0; c < TC; c++)
+            for (uint32_t h = 0; h < TH; h++)
+                for (uint32_t w = 0; w < TW; w++)
+                    err += tile[c][h][w] != input[c + 1][h + 2][w + 4];
+
+        // Scatter it back with the column dimension split in two and a
+        // trivial dimension, exercising the merging in snrt_dma_start_nd
+        size_t dst_strides[] = {TW / 2 * sizeof(uint32_t), sizeof(output[0][0]),
+                                0, sizeof(output[0])};
+        size_t src_strides[] = {TW / 2 * sizeof(uint32_t), sizeof(tile[0][0]),
+                                0, sizeof(tile[0])};
+        size_t repeats[] = {2, TH, 1, TC};
+        tid = snrt_dma_start_nd(&output[1][2][4], tile,
+                                TW / 2 * sizeof(uint32_t), 4, dst_strides,
+                                src_strides, repeats);
+        snrt_dma_wait(tid);
+        for (uint32_t c = 0; c < C; c++)
+            for (uint32_t h = 0; h < H; h++)
+                for (uint32_t w = 0; w < W; w++) {
+                    int inside = c >= 1 && h >= 2 && h < 2 + TH && w >= 4 &&
+                                 w < 4 + TW;
+                    err += output[c][h][w] != (inside ? input[c][h][w] : 0);
+                }
+
+
+        size_t rev_dst_strides[ND], rev_src_strides[ND], rev_repeats[ND];
+        for (uint32_t k = 0; k < ND; k++) {
+            rev_dst_strides[k] = sizeof(uint32_t) << k;
+            rev_src_strides[k] = 2 * sizeof(uint32_t) << (ND - 1 - k);
+            rev_repeats[k] = 2;
+        }
+        for (uint32_t i = 0; i < (2 << ND); i++) rev_src[i] = i;
+        tid = snrt_dma_start_nd(rev_dst, rev_src, sizeof(uint32_t), ND,
+                                rev_dst_strides, rev_src_strides, rev_repeats);
+        snrt_dma_wait(tid);
+        for (uint32_t j = 0; j < (1 << ND); j++)
+            err += rev_dst[j] != 2 * bitrev(j);
+
+        errors = err;
+    }
+
+    snrt_cluster_hw_barrier();
+    return snrt_cluster_core_idx() == 0 ? errors : 0;
+}
@@ -0,0 +1,68 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <dma_pipeline.h>
+#include <snrt.h>
+
+#define ROWS 32
+#define COLS 64
+#define TILE_ROWS 4
+
+// Operands in DRAM. The input is read as 2D tiles of TILE_ROWS rows of the
+// left half of each row, the output is written densely.
+uint32_t src[ROWS][2 * COLS];
+uint32_t dst[ROWS][COLS];
+
+int main() {
+    uint32_t core_idx = snrt_cluster_core_idx();
+    uint32_t errors = 0;
+
+    if (core_idx == 0) {
+        for (uint32_t r = 0; r < ROWS; r++)
+            for (uint32_t c = 0; c < 2 * COLS; c++) src[r][c] = r * COLS + c;
+    }
+    snrt_cluster_hw_barrier();
+
+    snrt_dma_tile_desc_t in = {.base = src,
+                               .size = COLS * sizeof(uint32_t),
+                               .repeat = TILE_ROWS,
+                               .stride = sizeof(src[0]),
+                               .tile_stride = TILE_ROWS * sizeof(src[0])};
+    snrt_dma_tile_desc_t out = {.base = dst,
+                                .size = COLS * sizeof(uint32_t),
+                                .repeat = TILE_ROWS,
+                                .stride = sizeof(dst[0]),
+                                .tile_stride = TILE_ROWS * sizeof(dst[0])};
+    snrt_dma_pipeline_t *p =
+        snrt_dma_pipeline_init(&in, 1, &out, 1, ROWS / TILE_ROWS);
+    if (!p) return core_idx == 0;
+
+    // Without tiles, the pipeline is drained right away
+    snrt_dma_tile_t t = {0};
+    errors += snrt_dma_pipeline_next_tile(
+        snrt_dma_pipeline_init(&in, 1, &out, 1, 0), &t);
+
+    // Too many operands: no pipeline on any core
+    snrt_dma_tile_desc_t ops[SNRT_DMA_PIPELINE_MAX_OPERANDS + 1];
+    for (uint32_t k = 0; k <= SNRT_DMA_PIPELINE_MAX_OPERANDS; k++) ops[k] = in;
+    errors += snrt_dma_pipeline_init(ops, SNRT_DMA_PIPELINE_MAX_OPERANDS + 1,
+                                     &out, 1, 1) != 0;
+
+    t = (snrt_dma_tile_t){0};
+    while (snrt_dma_pipeline_next_tile(p, &t)) {
+        if (!snrt_is_compute_core()) continue;
+        uint32_t *x = t.in[0], *y = t.out[0];
+        for (uint32_t i = snrt_cluster_compute_core_idx(); i < TILE_ROWS * COLS;
+             i += snrt_cluster_compute_core_num())
+            y[i] = 2 * x[i] + 1;
+    }
+
+    if (core_idx == 0) {
+        for (uint32_t r = 0; r < ROWS; r++)
+            for (uint32_t c = 0; c < COLS; c++)
+                errors += dst[r][c] != 2 * (r * COLS + c) + 1;
+    }
+
+    return errors;
+}
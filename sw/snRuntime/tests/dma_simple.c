@@ -8,9 +8,10 @@
 // with the DMA.
 uint32_t buffer[32];
 
-int main() {
-    if (snrt_global_core_idx() != 8) return 0;  // only DMA core
-    uint32_t errors = 0;
+static volatile uint32_t errors;
+
+static uint32_t run() {
+    uint32_t err = 0;
 
     // Populate buffers.
     uint32_t buffer_src[32], buffer_dst[32];
@@ -26,7 +27,7 @@ int main() {
 
     // Check that the main memory buffer contains the correct data.
     for (uint32_t i = 0; i < 32; i++) {
-        errors += (buffer[i] != buffer_src[i]);
+        err += (buffer[i] != buffer_src[i]);
     }
 
     // Copy data to L1.
@@ -35,8 +36,15 @@ int main() {
 
     // Check that the L1 buffer contains the correct data.
     for (uint32_t i = 0; i < 32; i++) {
-        errors += (buffer_dst[i] != buffer_src[i]);
+        err += (buffer_dst[i] != buffer_src[i]);
     }
 
-    return errors;
+    return err;
+}
+
+int main() {
+    // only the DMA core of the first cluster, the buffer is shared
+    if (snrt_is_dm_core() && snrt_cluster_idx() == 0) errors = run();
+    snrt_cluster_hw_barrier();
+    return snrt_global_core_idx() == 0 ? errors : 0;
 }
@@ -0,0 +1,54 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <snrt.h>
+
+#define N 1024
+
+// Two independent streams from DRAM into L1
+uint32_t src_a[N];
+uint32_t src_b[N / 16];
+
+static volatile uint32_t errors;
+
+static uint32_t run() {
+    uint32_t err = 0;
+
+    for (uint32_t i = 0; i < N; i++) src_a[i] = i;
+    for (uint32_t i = 0; i < N / 16; i++) src_b[i] = ~i;
+
+    uint32_t *dst_a = snrt_l1alloc(sizeof(src_a));
+    uint32_t *dst_b = snrt_l1alloc(sizeof(src_b));
+
+    snrt_dma_txid_t tids[2];
+    tids[0] = snrt_dma_start_1d(dst_a, src_a, sizeof(src_a));
+    tids[1] = snrt_dma_start_1d(dst_b, src_b, sizeof(src_b));
+
+    // Whichever transfer is reported must be complete, the other one is
+    // picked up after
+    uint32_t first = snrt_dma_wait_any(tids, 2);
+    err += first >= 2;
+    err += !snrt_dma_test(tids[first & 1]);
+    snrt_dma_wait(tids[!first]);
+    err += !snrt_dma_test(tids[0]) + !snrt_dma_test(tids[1]);
+
+    // With both complete, the oldest is reported wherever it is in the array
+    snrt_dma_txid_t rev[2] = {tids[1], tids[0]};
+    err += snrt_dma_wait_any(rev, 2) != 1;
+
+    // A transfer that was never issued is not complete
+    err += snrt_dma_test(tids[1] + 1);
+
+    for (uint32_t i = 0; i < N; i++) err += dst_a[i] != i;
+    for (uint32_t i = 0; i < N / 16; i++) err += dst_b[i] != ~i;
+
+    return err;
+}
+
+int main() {
+    // Only the first cluster, the sources are shared
+    if (snrt_is_dm_core() && snrt_cluster_idx() == 0) errors = run();
+    snrt_cluster_hw_barrier();
+    return snrt_global_core_idx() == 0 ? errors : 0;
+}
@@ -0,0 +1,88 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// Deferred log records of all argument kinds are captured with
+// snrt_log_drain and compared against snprintf. Core 0 then logs enough
+// records to make its ring wrap around and drain while running, and checks
+// that the records left in the ring are the last ones, in order.
+
+#include <log.h>
+#include <snrt.h>
+
+#include "printf.h"
+
+#define RECORDS 200
+
+// Harts whose records are checked, each with its own capture buffer
+#define CHECK_HARTS 8
+#define CAPTURE_LEN 2048
+
+static char captured[CHECK_HARTS][CAPTURE_LEN];
+static uint32_t captured_len[CHECK_HARTS];
+static char expected[CHECK_HARTS][CAPTURE_LEN];
+
+static void capture(const char *data, size_t len) {
+    uint32_t idx = snrt_global_core_idx();
+    for (size_t i = 0; i < len && captured_len[idx] < CAPTURE_LEN; i++)
+        captured[idx][captured_len[idx]++] = data[i];
+}
+
+static int check(uint32_t idx, uint32_t len) {
+    if (captured_len[idx] != len) return 1;
+    for (uint32_t i = 0; i < len; i++)
+        if (captured[idx][i] != expected[idx][i]) return 1;
+    return 0;
+}
+
+int main() {
+    uint32_t core_idx = snrt_global_core_idx();
+    int errors = 0;
+
+    snrt_log("core %d: int %d hex %#x char %c\n", core_idx, -42, 0xbeefu, 'x');
+    snrt_log("core %d: str %s ptr %p\n", core_idx, "literal", (void *)0x1000);
+    snrt_log("core %d: double %.3f float %g\n", core_idx, 3.14159, 2.5f);
+    snrt_log("core %d: 64 bit %llu %%\n", core_idx, 0x123456789ull);
+    snrt_log("no arguments\n");
+
+    if (core_idx >= CHECK_HARTS) return 0;
+
+    snrt_log_drain(capture);
+    char *e = expected[core_idx];
+    uint32_t n = 0;
+    n += snprintf(e + n, CAPTURE_LEN - n, "core %d: int %d hex %#x char %c\n",
+                  core_idx, -42, 0xbeefu, 'x');
+    n += snprintf(e + n, CAPTURE_LEN - n, "core %d: str %s ptr %p\n",
+                  core_idx, "literal", (void *)0x1000);
+    n += snprintf(e + n, CAPTURE_LEN - n, "core %d: double %.3f float %g\n",
+                  core_idx, 3.14159, 2.5);
+    n += snprintf(e + n, CAPTURE_LEN - n, "core %d: 64 bit %llu %%\n",
+                  core_idx, 0x123456789ull);
+    n += snprintf(e + n, CAPTURE_LEN - n, "no arguments\n");
+    if (check(core_idx, n)) {
+        printf("core %d: records do not match\n", core_idx);
+        errors++;
+    }
+
+    if (core_idx == 0) {
+        for (uint32_t i = 0; i < RECORDS; i++)
+            snrt_log("record %d of %d\n", i, RECORDS);
+
+        // The ring wrapped around, so only the last records are left
+        captured_len[0] = 0;
+        snrt_log_drain(capture);
+        uint32_t first = 0;
+        for (uint32_t i = 7; i < captured_len[0] && captured[0][i] != ' ';
+             i++)
+            first = 10 * first + captured[0][i] - '0';
+        n = 0;
+        for (uint32_t i = first; i < RECORDS; i++)
+            n += snprintf(expected[0] + n, CAPTURE_LEN - n, "record %d of %d\n",
+                          i, RECORDS);
+        if (first == 0 || check(0, n)) {
+            printf("core 0: records after wrapping do not match\n");
+            errors++;
+        }
+    }
+    return errors;
+}
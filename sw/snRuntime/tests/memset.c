@@ -0,0 +1,51 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+#include <snrt.h>
+
+// DRAM buffer large enough for the DMA path of the DM core. Lives in .bss, so
+// it must have been zeroed by the startup code.
+uint8_t buffer[4096 + 13];
+
+static volatile uint32_t errors;
+
+static uint32_t check(const volatile uint8_t *p, uint8_t value, size_t num) {
+    uint32_t err = 0;
+    for (size_t i = 0; i < num; i++) err += (p[i] != value);
+    return err;
+}
+
+int main() {
+    uint32_t core_idx = snrt_cluster_core_idx();
+
+    // The buffer is shared by all clusters, the first one tests it
+    if (snrt_is_dm_core() && snrt_cluster_idx() == 0) {
+        uint32_t err = check(buffer, 0, sizeof(buffer));
+
+        // DRAM from the DM core: DMA replication with a partial last line
+        snrt_memset(buffer + 1, 0xa5, sizeof(buffer) - 2);
+        err += check(buffer + 1, 0xa5, sizeof(buffer) - 2);
+        err += (buffer[0] != 0) + (buffer[sizeof(buffer) - 1] != 0);
+
+        // Short fill: scalar path, neighbours untouched
+        snrt_bzero(buffer + 3, 7);
+        err += check(buffer + 3, 0, 7);
+        err += (buffer[2] != 0xa5) + (buffer[10] != 0xa5);
+
+        __atomic_add_fetch(&errors, err, __ATOMIC_RELAXED);
+    }
+
+    // L1 fill from a compute core: vector path with unaligned head and tail
+    if (snrt_is_compute_core() && snrt_cluster_compute_core_idx() == 0) {
+        uint8_t *l1 = snrt_l1alloc(1024);
+        snrt_memset(l1, 0x11, 1024);
+        snrt_memset(l1 + 2, 0x3c, 1001);
+        uint32_t err = check(l1 + 2, 0x3c, 1001);
+        err += (l1[1] != 0x11) + (l1[1003] != 0x11);
+        __atomic_add_fetch(&errors, err, __ATOMIC_RELAXED);
+    }
+
+    snrt_cluster_hw_barrier();
+    return core_idx == 0 ? errors : 0;
+}
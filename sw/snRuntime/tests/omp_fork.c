@@ -0,0 +1,67 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// Fork/join latency of the OpenMP runtime. Runs back-to-back parallel regions
+// whose threads each busy-wait for a given number of cycles, once with the
+// workers sleeping in wfi right away and once with them polling for the next
+// region first (`eu_set_spin_cycles`). Prints the cycles per region and the
+// overhead on top of the work, and checks every thread ran every region.
+
+#include <dm.h>
+#include <eu.h>
+#include <omp.h>
+#include <snrt.h>
+
+#include "printf.h"
+
+#define REPS 16
+#define SPIN 4096
+
+static const uint32_t work[] = {0, 64, 256, 1024, 4096};
+static volatile uint32_t count;
+
+static inline void busy(uint32_t cycles) {
+    uint32_t t0 = read_csr(mcycle);
+    while (read_csr(mcycle) - t0 < cycles)
+        ;
+}
+
+static uint32_t run(uint32_t cycles) {
+    uint32_t t0 = read_csr(mcycle);
+    for (int r = 0; r < REPS; r++) {
+#pragma omp parallel
+        {
+            busy(cycles);
+            __atomic_add_fetch(&count, 1, __ATOMIC_RELAXED);
+        }
+    }
+    return (read_csr(mcycle) - t0) / REPS;
+}
+
+int main() {
+    uint32_t core_idx = snrt_cluster_core_idx();
+    if (snrt_omp_bootstrap(core_idx)) return 0;
+
+    uint32_t errors = 0;
+    uint32_t nthreads = eu_num_threads();
+    printf("omp_fork: %d threads, %d regions per size\n", nthreads, REPS);
+    printf("%8s %6s %8s %8s\n", "work", "spin", "region", "overhead");
+    for (uint32_t spin = 0; spin <= SPIN; spin += SPIN) {
+        eu_set_spin_cycles(spin);
+        for (uint32_t i = 0; i < sizeof(work) / sizeof(work[0]); i++) {
+            count = 0;
+            // The first run warms up the caches
+            run(work[i]);
+            uint32_t cycles = run(work[i]);
+            errors += count != 2 * REPS * nthreads;
+            printf("%8d %6d %8d %8d\n", work[i], spin, cycles,
+                   cycles - work[i]);
+        }
+    }
+    eu_set_spin_cycles(0);
+
+    eu_exit(core_idx);
+    if (snrt_cluster_dm_core_idx() != 0) dm_exit();
+    return errors;
+}
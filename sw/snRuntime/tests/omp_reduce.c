@@ -0,0 +1,77 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// Reductions through `__kmpc_reduce` and `__kmpc_reduce_nowait`: integer and
+// double sums, a max, and a nowait loop reduction followed by a barrier. All
+// of them combine over the tree, the runtime never picks the atomic method.
+// Checks the results and prints the cycles per reduction.
+
+#include <dm.h>
+#include <omp.h>
+#include <snrt.h>
+
+#include "printf.h"
+
+#define N 256
+
+static double *x;
+
+int main() {
+    uint32_t core_idx = snrt_cluster_core_idx();
+
+    if (core_idx == 0) {
+        x = snrt_l1alloc(N * sizeof(double));
+        for (int i = 0; i < N; i++) x[i] = (i * 7) % 13;
+    }
+
+    if (snrt_omp_bootstrap(core_idx)) return 0;
+
+    uint32_t errors = 0;
+    printf("omp_reduce: %d threads, %d elements\n", eu_num_threads(), N);
+
+    int isum = 0;
+    uint32_t t0 = read_csr(mcycle);
+#pragma omp parallel for reduction(+ : isum)
+    for (int i = 0; i < N; i++) isum += i;
+    uint32_t cycles = read_csr(mcycle) - t0;
+    errors += isum != N * (N - 1) / 2;
+    printf("int sum:    %d cycles\n", cycles);
+
+    double dsum = 0, expect = 0;
+    for (int i = 0; i < N; i++) expect += x[i];
+    t0 = read_csr(mcycle);
+#pragma omp parallel for reduction(+ : dsum)
+    for (int i = 0; i < N; i++) dsum += x[i];
+    cycles = read_csr(mcycle) - t0;
+    errors += dsum != expect;
+    printf("double sum: %d cycles\n", cycles);
+
+    double dmax = 0;
+    t0 = read_csr(mcycle);
+#pragma omp parallel for reduction(max : dmax)
+    for (int i = 0; i < N; i++) dmax = x[i] > dmax ? x[i] : dmax;
+    cycles = read_csr(mcycle) - t0;
+    errors += dmax != 12;
+    printf("double max: %d cycles\n", cycles);
+
+    double nsum = 0;
+    int count = 0;
+    t0 = read_csr(mcycle);
+#pragma omp parallel
+    {
+#pragma omp for nowait reduction(+ : nsum, count)
+        for (int i = 0; i < N; i++) {
+            nsum += x[i];
+            count++;
+        }
+#pragma omp barrier
+    }
+    cycles = read_csr(mcycle) - t0;
+    errors += nsum != expect || count != N;
+    printf("nowait sum: %d cycles\n", cycles);
+
+    eu_exit(core_idx);
+    if (snrt_cluster_dm_core_idx() != 0) dm_exit();
+    return errors;
+}
@@ -0,0 +1,95 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// Imbalanced-work benchmark of the OpenMP loop schedules: C = L * B with a
+// lower triangular L, so row i costs i + 1 multiply-adds per column of B. The
+// row loop runs with schedule(static), schedule(dynamic, 1) and
+// schedule(guided). Checks every result and prints the cycles per schedule.
+
+#include <dm.h>
+#include <omp.h>
+#include <snrt.h>
+
+#include "printf.h"
+
+#define N 64
+#define P 8
+#define ROUNDS 2
+
+static double *L, *B, *C;
+
+static inline void row(int i) {
+    for (int j = 0; j < P; j++) {
+        double acc = 0;
+        for (int k = 0; k <= i; k++) acc += L[i * N + k] * B[k * P + j];
+        C[i * P + j] = acc;
+    }
+}
+
+static void trmm_static() {
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < N; i++) row(i);
+}
+
+static void trmm_dynamic() {
+#pragma omp parallel for schedule(dynamic, 1)
+    for (int i = 0; i < N; i++) row(i);
+}
+
+static void trmm_guided() {
+#pragma omp parallel for schedule(guided)
+    for (int i = 0; i < N; i++) row(i);
+}
+
+// All values are small integers, the results are exact
+static uint32_t check() {
+    uint32_t err = 0;
+    for (int i = 0; i < N; i++)
+        for (int j = 0; j < P; j++) {
+            double expect = 0;
+            for (int k = 0; k <= i; k++)
+                expect += (double)((i + k) % 5) * (double)((k + j) % 3);
+            err += C[i * P + j] != expect;
+        }
+    return err;
+}
+
+int main() {
+    uint32_t core_idx = snrt_cluster_core_idx();
+
+    // the allocator is not thread-safe, the main thread allocates for all
+    if (core_idx == 0) {
+        L = snrt_l1alloc(N * N * sizeof(double));
+        B = snrt_l1alloc(N * P * sizeof(double));
+        C = snrt_l1alloc(N * P * sizeof(double));
+        for (int i = 0; i < N; i++)
+            for (int k = 0; k < N; k++) L[i * N + k] = k <= i ? (i + k) % 5 : 0;
+        for (int k = 0; k < N; k++)
+            for (int j = 0; j < P; j++) B[k * P + j] = (k + j) % 3;
+    }
+
+    if (snrt_omp_bootstrap(core_idx)) return 0;
+
+    static void (*const runs[])() = {trmm_static, trmm_dynamic, trmm_guided};
+    static const char *const names[] = {"static", "dynamic,1", "guided"};
+    uint32_t errors = 0;
+    printf("omp_schedule: %d threads, %dx%d triangular times %dx%d\n",
+           eu_num_threads(), N, N, N, P);
+    for (uint32_t s = 0; s < 3; s++) {
+        uint32_t cycles = 0;
+        // The first round warms up the caches
+        for (uint32_t r = 0; r < ROUNDS; r++) {
+            snrt_memset(C, 0, N * P * sizeof(double));
+            uint32_t t0 = read_csr(mcycle);
+            runs[s]();
+            cycles = read_csr(mcycle) - t0;
+            errors += check();
+        }
+        printf("%-10s %d cycles\n", names[s], cycles);
+    }
+
+    eu_exit(core_idx);
+    if (snrt_cluster_dm_core_idx() != 0) dm_exit();
+    return errors;
+}
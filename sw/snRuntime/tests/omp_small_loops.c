@@ -0,0 +1,91 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// Runtime overhead on small statically scheduled loops: a vector add of a few
+// elements per thread, once as a `parallel for` (fork, static_init, join) and
+// once as a `for` inside an open region (static_init and barrier only). Build
+// with and without OMPSTATIC_NUMTHREADS to compare the generic and the static
+// runtime. Checks the results and prints the cycles per loop.
+
+#include <dm.h>
+#include <omp.h>
+#include <snrt.h>
+
+#include "printf.h"
+
+#define MAX_N 256
+#define REPS 8
+
+static const int sizes[] = {8, 32, 128, MAX_N};
+static int32_t *a, *b, *c;
+
+static uint32_t parallel_for(int n) {
+    uint32_t t0 = read_csr(mcycle);
+    for (int r = 0; r < REPS; r++) {
+#pragma omp parallel for
+        for (int i = 0; i < n; i++) c[i] = a[i] + b[i];
+    }
+    return (read_csr(mcycle) - t0) / REPS;
+}
+
+static uint32_t inner_for(int n) {
+    uint32_t cycles = 0;
+#pragma omp parallel
+    {
+        uint32_t t0 = read_csr(mcycle);
+        for (int r = 0; r < REPS; r++) {
+#pragma omp for
+            for (int i = 0; i < n; i++) c[i] = a[i] + b[i];
+        }
+        if (omp_get_thread_num() == 0) cycles = (read_csr(mcycle) - t0) / REPS;
+    }
+    return cycles;
+}
+
+static uint32_t check(int n) {
+    uint32_t err = 0;
+    for (int i = 0; i < n; i++) err += c[i] != 3 * i + 1;
+    return err;
+}
+
+int main() {
+    uint32_t core_idx = snrt_cluster_core_idx();
+
+    if (core_idx == 0) {
+        a = snrt_l1alloc(MAX_N * sizeof(int32_t));
+        b = snrt_l1alloc(MAX_N * sizeof(int32_t));
+        c = snrt_l1alloc(MAX_N * sizeof(int32_t));
+        for (int i = 0; i < MAX_N; i++) {
+            a[i] = i;
+            b[i] = 2 * i + 1;
+        }
+    }
+
+    if (snrt_omp_bootstrap(core_idx)) return 0;
+
+    uint32_t errors = 0;
+#ifdef OMPSTATIC_NUMTHREADS
+    printf("omp_small_loops: static runtime, %d threads\n",
+           OMPSTATIC_NUMTHREADS);
+#else
+    printf("omp_small_loops: generic runtime, %d threads\n", eu_num_threads());
+#endif
+    printf("%6s %14s %10s\n", "n", "parallel for", "for");
+    for (uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        int n = sizes[s];
+        // The first runs warm up the caches
+        parallel_for(n);
+        snrt_memset(c, 0, n * sizeof(int32_t));
+        uint32_t pf = parallel_for(n);
+        errors += check(n);
+        snrt_memset(c, 0, n * sizeof(int32_t));
+        uint32_t f = inner_for(n);
+        errors += check(n);
+        printf("%6d %14d %10d\n", n, pf, f);
+    }
+
+    eu_exit(core_idx);
+    if (snrt_cluster_dm_core_idx() != 0) dm_exit();
+    return errors;
+}
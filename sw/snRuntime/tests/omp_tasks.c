@@ -0,0 +1,104 @@
+// Copyright 2021 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// Task-throughput microbenchmark of the OpenMP tasking runtime. One thread
+// spawns NTASKS tiny tasks that the team steals and runs; then every thread
+// spawns its own share. A recursive Fibonacci with a cutoff exercises nested
+// tasks and taskwait; the stacks are small, so the recursion stays shallow.
+// Checks the results and prints the cycles per task.
+
+#include <dm.h>
+#include <omp.h>
+#include <snrt.h>
+
+#include "printf.h"
+
+#define NTASKS 256
+#define FIB_N 12
+#define FIB_CUTOFF 8
+
+static volatile uint32_t count;
+
+static int fib_seq(int n) { return n < 2 ? n : fib_seq(n - 1) + fib_seq(n - 2); }
+
+static int fib(int n) {
+    if (n < FIB_CUTOFF) return fib_seq(n);
+    int a, b;
+#pragma omp task shared(a)
+    a = fib(n - 1);
+#pragma omp task shared(b)
+    b = fib(n - 2);
+#pragma omp taskwait
+    return a + b;
+}
+
+static uint32_t spawn_single() {
+    uint32_t cycles = 0;
+#pragma omp parallel
+    {
+#pragma omp single
+        {
+            uint32_t t0 = read_csr(mcycle);
+            for (int i = 0; i < NTASKS; i++) {
+#pragma omp task
+                __atomic_add_fetch(&count, 1, __ATOMIC_RELAXED);
+            }
+#pragma omp taskwait
+            cycles = read_csr(mcycle) - t0;
+        }
+    }
+    return cycles;
+}
+
+static uint32_t spawn_all() {
+    uint32_t t0 = read_csr(mcycle);
+#pragma omp parallel
+    {
+        int n = omp_get_num_threads();
+        for (int i = omp_get_thread_num(); i < NTASKS; i += n) {
+#pragma omp task
+            __atomic_add_fetch(&count, 1, __ATOMIC_RELAXED);
+        }
+    }
+    return read_csr(mcycle) - t0;
+}
+
+static uint32_t run_fib(int *result) {
+    uint32_t t0 = read_csr(mcycle);
+#pragma omp parallel
+    {
+#pragma omp single
+        *result = fib(FIB_N);
+    }
+    return read_csr(mcycle) - t0;
+}
+
+int main() {
+    uint32_t core_idx = snrt_cluster_core_idx();
+    if (snrt_omp_bootstrap(core_idx)) return 0;
+
+    uint32_t errors = 0;
+    printf("omp_tasks: %d threads\n", eu_num_threads());
+
+    count = 0;
+    uint32_t cycles = spawn_single();
+    errors += count != NTASKS;
+    printf("single producer: %d tasks, %d cycles/task\n", NTASKS,
+           cycles / NTASKS);
+
+    count = 0;
+    cycles = spawn_all();
+    errors += count != NTASKS;
+    printf("all producers:   %d tasks, %d cycles/task\n", NTASKS,
+           cycles / NTASKS);
+
+    int result = 0;
+    cycles = run_fib(&result);
+    errors += result != fib_seq(FIB_N);
+    printf("fib(%d):         %d cycles\n", FIB_N, cycles);
+
+    eu_exit(core_idx);
+    if (snrt_cluster_dm_core_idx() != 0) dm_exit();
+    return errors;
+}
@@ -0,0 +1,48 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// Nested performance regions on all cores, with more events selected than
+// the cluster has counters. The regions are printed as JSON lines at exit.
+
+#include <perf_cnt.h>
+#include <snrt.h>
+
+#define RUNS 4
+#define N 64
+
+static volatile uint32_t sink;
+
+static void work(uint32_t n) {
+    uint32_t acc = 0;
+    for (uint32_t i = 0; i < n; i++) acc += i * i;
+    sink = acc;
+}
+
+int main() {
+    const enum snrt_perf_cnt_type events[] = {
+        SNRT_PERF_CNT_TCDM_ACCESSED,
+        SNRT_PERF_CNT_TCDM_CONGESTED,
+        SNRT_PERF_CNT_RETIRED_INSTR,
+    };
+    snrt_perf_region_select(events, sizeof(events) / sizeof(events[0]));
+
+    for (uint32_t r = 0; r < RUNS; r++) {
+        snrt_perf_region_begin("outer");
+        work(N);
+        for (uint32_t i = 0; i < 2; i++) {
+            snrt_perf_region_begin("inner");
+            work(N / 2);
+            snrt_perf_region_end();
+        }
+        snrt_perf_region_end();
+    }
+
+    // Regions nested deeper than recorded, and an unbalanced end
+    for (uint32_t d = 0; d < SNRT_PERF_MAX_DEPTH + 2; d++)
+        snrt_perf_region_begin("deep");
+    for (uint32_t d = 0; d < SNRT_PERF_MAX_DEPTH + 3; d++)
+        snrt_perf_region_end();
+
+    return 0;
+}
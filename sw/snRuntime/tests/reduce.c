@@ -0,0 +1,65 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// Every core of the cluster contributes N small integers per element type,
+// which are exact in all formats. Core 0 checks the reductions, every core
+// checks the allreductions. Repeats a few times to exercise flag reuse.
+
+#include <reduce.h>
+#include <snrt.h>
+
+#define N 19
+#define ROUNDS 3
+
+static volatile uint32_t errors;
+
+// Partial of core `c` for element `i`
+static inline int value(uint32_t c, uint32_t i) {
+    return (int)((c * 7 + i * 3) % 11) - 5;
+}
+
+#define CHECK(type, fn, init, combine, all)                              \
+    do {                                                                 \
+        type data[N];                                                    \
+        for (uint32_t i = 0; i < N; i++) data[i] = value(idx, i);        \
+        fn(data, N);                                                     \
+        if (all || idx == 0) {                                           \
+            for (uint32_t i = 0; i < N; i++) {                           \
+                int expect = init;                                       \
+                for (uint32_t c = 0; c < num; c++)                       \
+                    expect = combine(expect, value(c, i));               \
+                err += (int)data[i] != expect;                           \
+            }                                                            \
+        }                                                                \
+    } while (0)
+
+#define SUM(a, b) ((a) + (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+#define CHECK_TYPE(type, sew)                                            \
+    do {                                                                 \
+        CHECK(type, snrt_cluster_reduce_sum_f##sew, 0, SUM, 0);          \
+        CHECK(type, snrt_cluster_reduce_max_f##sew, -100, MAX, 0);       \
+        CHECK(type, snrt_cluster_reduce_min_f##sew, 100, MIN, 0);        \
+        CHECK(type, snrt_cluster_allreduce_sum_f##sew, 0, SUM, 1);       \
+        CHECK(type, snrt_cluster_allreduce_max_f##sew, -100, MAX, 1);    \
+        CHECK(type, snrt_cluster_allreduce_min_f##sew, 100, MIN, 1);     \
+    } while (0)
+
+int main() {
+    uint32_t idx = snrt_cluster_core_idx();
+    uint32_t num = snrt_cluster_core_num();
+    uint32_t err = 0;
+
+    for (uint32_t r = 0; r < ROUNDS; r++) {
+        CHECK_TYPE(double, 64);
+        CHECK_TYPE(float, 32);
+        CHECK_TYPE(__fp16, 16);
+    }
+
+    __atomic_add_fetch(&errors, err, __ATOMIC_RELAXED);
+    snrt_global_barrier();
+    return snrt_global_core_idx() == 0 ? errors : 0;
+}
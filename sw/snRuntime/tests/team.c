@@ -0,0 +1,67 @@
+// Copyright 2020 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// Every core checks its team queries against each other and marks its global
+// indices in DRAM. Global core 0 then checks that every global index was
+// taken exactly once. Supports up to 32 cores in the system.
+
+#include <snrt.h>
+
+static volatile uint32_t errors;
+static volatile uint32_t cores_seen, compute_seen, dm_seen;
+
+static void mark(volatile uint32_t *seen, uint32_t idx) {
+    uint32_t bit = 1u << idx;
+    uint32_t prev = __atomic_fetch_or(seen, bit, __ATOMIC_RELAXED);
+    if (prev & bit) __atomic_add_fetch(&errors, 1, __ATOMIC_RELAXED);
+}
+
+int main() {
+    uint32_t err = 0;
+    uint32_t cluster_idx = snrt_cluster_idx();
+    uint32_t core_idx = snrt_cluster_core_idx();
+    uint32_t core_num = snrt_cluster_core_num();
+
+    // Cluster-level queries
+    err += cluster_idx >= snrt_cluster_num();
+    err += snrt_hartid() - snrt_cluster_core_base_hartid() != core_idx;
+    err += snrt_global_core_num() != snrt_cluster_num() * core_num;
+    err += snrt_global_core_idx() != cluster_idx * core_num + core_idx;
+    err += snrt_cluster_dm_core_num() + snrt_cluster_compute_core_num() !=
+           core_num;
+    // snrt_is_compute_core keeps its meaning of all cores but the last, the
+    // compute core indices count the cores without a DMA
+    err += snrt_is_compute_core() != (core_idx < core_num - 1);
+
+    // The stack lives in the TCDM of the own cluster
+    uintptr_t local = (uintptr_t)&err;
+    err += local < snrt_cluster_memory().start ||
+           local >= snrt_cluster_memory().end;
+
+    mark(&cores_seen, snrt_global_core_idx());
+    if (!snrt_is_dm_core()) {
+        err +=
+            snrt_cluster_compute_core_idx() >= snrt_cluster_compute_core_num();
+        err +=
+            snrt_global_compute_core_idx() >= snrt_global_compute_core_num();
+        mark(&compute_seen, snrt_global_compute_core_idx());
+    } else {
+        err += snrt_cluster_dm_core_num() == 1 &&
+               snrt_cluster_dm_core_idx() != core_idx;
+        err += snrt_global_dm_core_idx() >= snrt_global_dm_core_num();
+        mark(&dm_seen, snrt_global_dm_core_idx());
+    }
+    __atomic_add_fetch(&errors, err, __ATOMIC_RELAXED);
+
+    snrt_global_barrier();
+
+    if (snrt_global_core_idx() == 0) {
+        uint32_t all = (1u << snrt_global_core_num()) - 1;
+        uint32_t all_compute = (1u << snrt_global_compute_core_num()) - 1;
+        uint32_t all_dm = (1u << snrt_global_dm_core_num()) - 1;
+        return errors + (cores_seen != all) + (compute_seen != all_compute) +
+               (dm_seen != all_dm);
+    }
+    return 0;
+}
@@ -18,6 +18,7 @@
 
 #include <benchmark.h>
 #include <debug.h>
+#include <reduce.h>
 #include <snrt.h>
 #include <stdio.h>
 
@@ -89,15 +90,8 @@ int main() {
 #endif
   result[cid] = acc;
 
-  // Wait for all cores to finish
-  snrt_cluster_hw_barrier();
-
-  // Final reduction
-  if (cid == 0) {
-    for (unsigned int i = 1; i < num_cores; ++i)
-      acc += result[i];
-    result[0] = acc;
-  }
+  // Final reduction, the sum ends up in result[0]
+  snrt_cluster_reduce_sum_f64(&result[cid], 1);
 
   // Wait for all cores to finish
   snrt_cluster_hw_barrier();
@@ -0,0 +1,16 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// The operands are generated on the cluster, they are too large for a header.
+
+#include "layer.h"
+
+const gemm_layer gemm_l = {.M = 1024,
+                           .N = 1024,
+                           .K = 1024,
+                           .TA = 0,
+                           .TB = 0,
+                           .ALPHA = 0,
+                           .dtype = FP64,
+                           .expand = 0};
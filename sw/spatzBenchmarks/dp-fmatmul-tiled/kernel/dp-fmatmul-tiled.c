@@ -0,0 +1,207 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "dp-fmatmul-tiled.h"
+#include <snrt.h>
+#include <spatz_gemm.h>
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+// Rows of the micro-kernel (4xVL, e64 m4)
+#define TILE_KERNEL_ROWS 4
+// TCDM left to the stacks and the runtime
+#define TILE_L1_RESERVE 16384
+// Bounds of the inner dimension of a tile
+#define TILE_K_MIN 32
+#define TILE_K_MAX 256
+
+static inline unsigned int round_up(unsigned int x, unsigned int a) {
+  return (x + a - 1) / a * a;
+}
+
+static inline size_t tile_footprint(unsigned int tm, unsigned int tk,
+                                    unsigned int tp) {
+  // Two A, B and C tiles each
+  return sizeof(double) * 2 * (tm * tk + tk * tp + tm * tp);
+}
+
+int matmul_tiled_plan(matmul_tiling *t, const unsigned int M,
+                      const unsigned int N, const unsigned int P,
+                      const unsigned int num_cores) {
+  // Elements of one vector register group of the micro-kernel
+  size_t vl;
+  asm volatile("vsetvli %0, zero, e64, m4, ta, ma" : "=r"(vl));
+
+#ifdef SNRT_TOPOLOGY
+  const size_t l1 = SNRT_TOPO_TCDM_SIZE;
+#else
+  const size_t l1 = snrt_slice_len(snrt_cluster_memory());
+#endif
+  const size_t budget = l1 - TILE_L1_RESERVE;
+
+  // Every core gets whole micro-kernel rows of a full tile, and the columns
+  // of a tile are whole vectors
+  const unsigned int m_step = num_cores * TILE_KERNEL_ROWS;
+  const unsigned int m_max = round_up(M, m_step);
+  const unsigned int p_max = round_up(P, vl);
+  const unsigned int k_min = MIN(N & ~1u, TILE_K_MIN);
+
+  unsigned int tm = m_step, tp = vl;
+  if (tile_footprint(tm, k_min, tp) > budget)
+    return -1;
+
+  // Grow the tiles to raise the reuse per transferred byte, keeping them
+  // close to square
+  while (1) {
+    int grow_m = 2 * tm <= m_max && tile_footprint(2 * tm, k_min, tp) <= budget;
+    int grow_p = 2 * tp <= p_max && tile_footprint(tm, k_min, 2 * tp) <= budget;
+    if (grow_p && (tp <= tm || !grow_m))
+      tp *= 2;
+    else if (grow_m)
+      tm *= 2;
+    else
+      break;
+  }
+
+  // The deepest K block that still fits amortizes the reloads of the C tile
+  unsigned int tk = k_min;
+  while (2 * tk <= MIN(N, TILE_K_MAX) &&
+         tile_footprint(tm, 2 * tk, tp) <= budget)
+    tk *= 2;
+
+  t->tm = tm;
+  t->tk = tk;
+  t->tp = tp;
+  for (unsigned int i = 0; i < 2; ++i) {
+    t->a_buf[i] = (double *)snrt_l1alloc(tm * tk * sizeof(double));
+    t->b_buf[i] = (double *)snrt_l1alloc(tk * tp * sizeof(double));
+    t->c_buf[i] = (double *)snrt_l1alloc(tm * tp * sizeof(double));
+  }
+
+  return t->c_buf[1] ? 0 : -1;
+}
+
+// Position of one step, the product of one A and one B tile
+typedef struct {
+  unsigned int tile; // index of the C tile
+  unsigned int i0, k0, p0;
+  unsigned int rows, kk, pp;
+  unsigned int first, last; // first or last K block of the C tile
+} tile_step;
+
+static inline void tile_locate(tile_step *st, unsigned int s,
+                               const unsigned int M, const unsigned int N,
+                               const unsigned int P, const matmul_tiling *t) {
+  const unsigned int tiles_k = (N + t->tk - 1) / t->tk;
+  const unsigned int tiles_p = (P + t->tp - 1) / t->tp;
+  const unsigned int ik = s % tiles_k;
+
+  st->tile = s / tiles_k;
+  st->i0 = st->tile / tiles_p * t->tm;
+  st->p0 = st->tile % tiles_p * t->tp;
+  st->k0 = ik * t->tk;
+  st->rows = MIN(t->tm, M - st->i0);
+  st->pp = MIN(t->tp, P - st->p0);
+  st->kk = MIN(t->tk, N - st->k0);
+  st->first = ik == 0;
+  st->last = ik == tiles_k - 1;
+}
+
+// Fetch the A and B tiles of a step into its buffers. The tiles are dense:
+// A with row stride kk, B with row stride pp.
+static inline void tile_load(const tile_step *st, unsigned int s,
+                             const double *a, const double *b,
+                             const unsigned int N, const unsigned int P,
+                             const matmul_tiling *t) {
+  snrt_dma_start_2d(t->a_buf[s & 1], a + st->i0 * N + st->k0,
+                    st->kk * sizeof(double), st->kk * sizeof(double),
+                    N * sizeof(double), st->rows);
+  snrt_dma_start_2d(t->b_buf[s & 1], b + st->k0 * P + st->p0,
+                    st->pp * sizeof(double), st->pp * sizeof(double),
+                    P * sizeof(double), st->kk);
+}
+
+static inline void tile_store(const tile_step *st, double *c,
+                              const unsigned int P, const matmul_tiling *t) {
+  snrt_dma_start_2d(c + st->i0 * P + st->p0, t->c_buf[st->tile & 1],
+                    st->pp * sizeof(double), P * sizeof(double),
+                    st->pp * sizeof(double), st->rows);
+}
+
+static inline void tile_compute(const tile_step *st, unsigned int s,
+                                const matmul_tiling *t, unsigned int cid,
+                                unsigned int num_cores) {
+  // Whole micro-kernel rows per core, the last busy core takes the rest
+  const unsigned int chunk =
+      round_up((st->rows + num_cores - 1) / num_cores, TILE_KERNEL_ROWS);
+  const unsigned int m_start = MIN(st->rows, cid * chunk);
+  const unsigned int m_end = MIN(st->rows, m_start + chunk);
+  if (m_start >= m_end)
+    return;
+
+  // The first K block initializes the C tile, the others accumulate into it
+  spatz_dgemm_kernel(TILE_KERNEL_ROWS, SPATZ_GEMM_NOTRANS, m_end - m_start,
+                     st->pp, st->kk, 1, t->a_buf[s & 1] + m_start * st->kk,
+                     st->kk, t->b_buf[s & 1], st->pp, st->first ? 0 : 1,
+                     t->c_buf[st->tile & 1] + m_start * st->pp, st->pp);
+}
+
+void matmul_tiled(double *c, const double *a, const double *b,
+                  const unsigned int M, const unsigned int N,
+                  const unsigned int P, const matmul_tiling *t) {
+  const unsigned int num_cores = snrt_cluster_core_num();
+  const unsigned int cid = snrt_cluster_core_idx();
+  const int dm = snrt_is_dm_core();
+
+  const unsigned int steps = ((M + t->tm - 1) / t->tm) *
+                             ((P + t->tp - 1) / t->tp) *
+                             ((N + t->tk - 1) / t->tk);
+
+  tile_step cur, prev;
+  tile_locate(&cur, 0, M, N, P, t);
+  if (dm)
+    tile_load(&cur, 0, a, b, N, P, t);
+
+  // Step s computes on one buffer while the DM core fetches the tiles of step
+  // s + 1 into the other and writes back the C tile that step s - 1 finished
+  for (unsigned int s = 0; s <= steps; ++s) {
+    if (dm)
+      snrt_dma_wait_all();
+    snrt_cluster_hw_barrier();
+
+    if (dm) {
+      if (s + 1 < steps) {
+        tile_step next;
+        tile_locate(&next, s + 1, M, N, P, t);
+        tile_load(&next, s + 1, a, b, N, P, t);
+      }
+      if (s > 0 && prev.last)
+        tile_store(&prev, c, P, t);
+    }
+
+    if (s == steps)
+      break;
+
+    tile_compute(&cur, s, t, cid, num_cores);
+    prev = cur;
+    if (s + 1 < steps)
+      tile_locate(&cur, s + 1, M, N, P, t);
+  }
+
+  if (dm)
+    snrt_dma_wait_all();
+  snrt_cluster_hw_barrier();
+}
@@ -0,0 +1,48 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DPFMATMUL_TILED_H
+#define DPFMATMUL_TILED_H
+
+#include <stddef.h>
+
+// Tiles of a matmul with the operands in DRAM. The A (tm x tk), B (tk x tp)
+// and C (tm x tp) tiles are double-buffered in the TCDM.
+typedef struct matmul_tiling_struct {
+  unsigned int tm;
+  unsigned int tk;
+  unsigned int tp;
+
+  double *a_buf[2];
+  double *b_buf[2];
+  double *c_buf[2];
+} matmul_tiling;
+
+// Choose the tile sizes from the free TCDM and the vector length, and
+// allocate the tile buffers. Call on one core before `matmul_tiled`. Returns
+// non-zero if the buffers do not fit.
+int matmul_tiled_plan(matmul_tiling *t, const unsigned int M,
+                      const unsigned int N, const unsigned int P,
+                      const unsigned int num_cores);
+
+// C = A * B with A (M x N), B (N x P) and C (M x P) row-major in DRAM. Called
+// by all cores of the cluster; the DM core streams the tiles, and every core
+// computes a share of the rows of each tile.
+void matmul_tiled(double *c, const double *a, const double *b,
+                  const unsigned int M, const unsigned int N,
+                  const unsigned int P, const matmul_tiling *t);
+
+#endif
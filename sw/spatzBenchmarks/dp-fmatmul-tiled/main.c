@@ -0,0 +1,159 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+//
+// SPDX-License-Identifier: Apache-2.0
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark.h>
+#include <debug.h>
+#include <snrt.h>
+#include <stdio.h>
+
+#include DATAHEADER
+#include "kernel/dp-fmatmul-tiled.c"
+
+// Number of rows and columns of C that are checked
+#define VERIFY_SAMPLES 8
+
+double *a;
+double *b;
+double *c;
+
+matmul_tiling tiling;
+int plan_error;
+
+// Small integers, so that the products and sums are exact
+static inline double a_value(unsigned int i, unsigned int k) {
+  return (double)((int)((i + k) % 5) - 2);
+}
+
+static inline double b_value(unsigned int k, unsigned int j) {
+  return (double)((int)((k + 2 * j) % 3) - 1);
+}
+
+// Fill the rows [m_start, m_end) of a matrix
+static void init_rows(double *matrix, unsigned int m_start, unsigned int m_end,
+                      unsigned int num_columns,
+                      double (*value)(unsigned int, unsigned int)) {
+  for (unsigned int i = m_start; i < m_end; ++i)
+    for (unsigned int j = 0; j < num_columns; ++j)
+      matrix[i * num_columns + j] = value(i, j);
+}
+
+// Verify a grid of elements of C, including the last row and column. Returns
+// one more than the index of the first wrong element, 0 if all are right.
+int verify_matrix(const double *matrix, const unsigned int M,
+                  const unsigned int N, const unsigned int P) {
+  for (unsigned int si = 0; si <= VERIFY_SAMPLES; ++si) {
+    const unsigned int i = MIN(M - 1, si * (M / VERIFY_SAMPLES));
+    for (unsigned int sj = 0; sj <= VERIFY_SAMPLES; ++sj) {
+      const unsigned int j = MIN(P - 1, sj * (P / VERIFY_SAMPLES));
+      double sum = 0;
+      for (unsigned int k = 0; k < N; ++k)
+        sum += a_value(i, k) * b_value(k, j);
+      if (matrix[i * P + j] != sum)
+        return (int)(i * P + j) + 1;
+    }
+  }
+  return 0;
+}
+
+int main() {
+  const unsigned int num_cores = snrt_cluster_core_num();
+  const unsigned int cid = snrt_cluster_core_idx();
+
+  const unsigned int measure_iterations = 1;
+
+  unsigned int timer_start, timer_end, timer;
+
+  // Allocate the matrices in DRAM and the tiles in the local tile
+  if (cid == 0) {
+    a = (double *)snrt_l3alloc(gemm_l.M * gemm_l.K * sizeof(double));
+    b = (double *)snrt_l3alloc(gemm_l.K * gemm_l.N * sizeof(double));
+    c = (double *)snrt_l3alloc(gemm_l.M * gemm_l.N * sizeof(double));
+    plan_error =
+        matmul_tiled_plan(&tiling, gemm_l.M, gemm_l.K, gemm_l.N, num_cores);
+    if (plan_error)
+      PRINTF("Error: the tiles do not fit in the TCDM\n");
+  }
+
+  // Reset timer
+  timer = (unsigned int)-1;
+
+  // Wait for all cores to finish
+  snrt_cluster_hw_barrier();
+
+  if (plan_error)
+    return -1;
+
+  // Initialize matrices
+  init_rows(a, gemm_l.M * cid / num_cores, gemm_l.M * (cid + 1) / num_cores,
+            gemm_l.K, a_value);
+  init_rows(b, gemm_l.K * cid / num_cores, gemm_l.K * (cid + 1) / num_cores,
+            gemm_l.N, b_value);
+
+  // Wait for all cores to finish
+  snrt_cluster_hw_barrier();
+
+  // Calculate matmul
+  for (unsigned int i = 0; i < measure_iterations; ++i) {
+    // Start timer
+    timer_start = benchmark_get_cycle();
+
+    // Start dump
+    if (cid == 0)
+      start_kernel();
+
+    matmul_tiled(c, a, b, gemm_l.M, gemm_l.K, gemm_l.N, &tiling);
+
+    // End dump
+    if (cid == 0)
+      stop_kernel();
+
+    // End timer and check if new best runtime
+    timer_end = benchmark_get_cycle();
+    unsigned int timer_temp = timer_end - timer_start;
+    if (cid == 0) {
+      if (timer_temp < timer) {
+        timer = timer_temp;
+      }
+    }
+  }
+
+  // Check and display results
+  if (cid == 0) {
+    long unsigned int performance =
+        1000ull * 2 * gemm_l.M * gemm_l.N * gemm_l.K / timer;
+    long unsigned int utilization =
+        performance / (2 * num_cores * SNRT_NFPU_PER_CORE);
+
+    PRINTF("\n----- (%dx%d) dp fmatmul tiled -----\n", gemm_l.M, gemm_l.N);
+    PRINTF("Tiles: %d x %d x %d\n", tiling.tm, tiling.tk, tiling.tp);
+    PRINTF("The execution took %u cycles.\n", timer);
+    PRINTF("The performance is %ld OP/1000cycle (%ld%%o utilization).\n",
+           performance, utilization);
+  }
+
+  int error = 0;
+  if (cid == 0) {
+    error = verify_matrix(c, gemm_l.M, gemm_l.K, gemm_l.N);
+
+    if (error != 0)
+      PRINTF("Error core %d: c[%d]=%d\n", cid, error - 1, (int)c[error - 1]);
+  }
+
+  // Wait for all cores to finish
+  snrt_cluster_hw_barrier();
+
+  return error;
+}
@@ -0,0 +1,3610 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// This file was generated automatically.
+
+#include "layer.h"
+
+const gemm_layer gemm_l = {.M = 256,
+                           .N = 8,
+                           .K = 32,
+                           .TA = 0,
+                           .TB = 0,
+                           .ALPHA = 0,
+                           .dtype = FP64,
+                           .expand = 0};
+
+static double gemm_A_dram[256 * 32] __attribute__((section(".data"))) = {
+    -0.14409032957792836,    -0.1729036003315193,    -0.11131586156766246,
+    0.7019837250988631,      -0.12758828378288709,   -1.4973534143409575,
+    0.33231834406771527,     -0.2673374784971682,    -0.216958684145195,
+    0.11588478670085507,     0.23229773690672087,    1.163558686599143,
+    0.6566365067986689,      0.11050717744383194,    -0.7383216023448206,
+    -1.014662367487717,      0.24634219521120196,    1.3110808272040482,
+    0.04165686390338389,     -0.10632329377078427,   0.5317762204008692,
+    -1.453545298008678,      -0.3122773171445598,    0.49036253259352475,
+    0.8734043853794468,      -0.2406296726551354,    0.3765998586879102,
+    0.24821344932841446,     0.7823268087036421,     -1.1132222142481727,
+    0.5682506875853858,      -1.5145203917251397,    -2.619945422218852,
+    -0.6068907281995026,     -0.9158100463459947,    0.8760122430564063,
+    0.664265899612895,       -1.2190747412956953,    0.8473614233480004,
+    -1.0022028242423497,     -0.08624384633628418,   -0.29389977795653216,
+    0.11441985746092122,     0.8186363115437669,     0.6384137907924435,
+    0.3498851018692087,      0.6499480978062986,     0.4784920376501184,
+    -0.6269854652195999,     -0.7173710938165775,    -0.4699682741360139,
+    0.4993264004767815,      -0.2501155709973842,    2.335754222480548,
+    -0.8192925421864935,     -1.0988745999021583,    0.7684735154696964,
+    1.4218499813434655,      0.5056926908392599,     0.8358173459676733,
+    1.4263449774421624,      -0.0940274760163039,    -1.4229589331389771,
+    -0.5320765483187126,     0.9528957573165765,     -1.4436784060782881,
+    0.03353132078726135,     0.2532373593420619,     -0.3155921648136706,
+    0.7236319863680966,      0.5807797415265663,     2.321408516900731,
+    0.6199677677731354,      -0.6094034586430621,    -0.5617975923340306,
+    -0.8315811012420066,     0.9522735598158206,     -0.566832834813701,
+    -0.07026077370059765,    0.7493026192896751,     -0.7234629906514067,
+    -0.29365796361771856,    -1.841286265603916,     -1.0824786190387132,
+    -0.5677364121918498,     0.41576098851667154,    1.1934932724432972,
+    -0.018466813163711633,   0.2613642791998029,     0.16796936854723213,
+    1.0847411134536038,      0.8933551987382066,     0.27369331540754227,
+    -1.0109443034453118,     0.9033853143445947,     0.3810471279557522,
+    1.2269415497142202,      -0.02990659268121346,   1.953100924483846,
+    -0.3588763403218226,     1.5930604142630431,     0.11511897260723283,
+    -0.5162690092455027,     -1.1284478727923954,    -0.15103055153883657,
+    1.423321026167184,       0.8163744966147283,     0.688883864266003,
+    -2.375872573091198,      0.7109642045700387,     0.5558524109198417,
+    -0.5499262844053271,     -0.6273843661803962,    -0.002310451813581064,
+    1.7248762631487318,      -1.0551006994223244,    -0.42780503473628484,
+    1.361784750350584,       -0.4461507994277505,    -0.36425147586094014,
+    0.0977763472886767,      -1.2412893766356956,    0.21994543015001286,
+    -1.2096175969736347,     0.8851983103581446,     0.0031808227579895546,
+    2.2834314668477504,      0.28084051353103473,    1.3656894904327486,
+    -1.303263971717364,      -0.12213934352186545,   0.32314565401410306,
+    1.7457209183710487,      -1.680915938020964,     0.9906196798088226,
+    0.5913540138159165,      1.53354619573813,       0.7123855180787204,
+    0.05207118510394829,     -0.5216496504181594,    -1.24817971784272,
+    0.19542276490297042,     -0.19169676899531105,   2.0202673380796417,
+    -0.6110248279848474,     0.3203918452051127,     -1.5690014196757296,
+    -0.39546257832617854,    0.26114788009109907,    0.8239600125195051,
+    1.4481016868281007,      -0.04414817632926931,   -1.1172448790608862,
+    0.4578503994915399,      0.5169870984137933,     0.49165834283826976,
+    -0.7002876991747331,     1.1333843975868878,     0.08789591090451496,
+    0.6998246217159857,      1.2740732400944477,     0.6092723205658512,
+    0.28651602798177056,     2.152795235100524,      0.2437030409721501,
+    -0.2959642327720814,     0.11196703758302992,    1.482768668437135,
+    0.11871248688680022,     0.5193776551392121,     1.1957314403321633,
+    -0.5128586102268294,     -1.7265697692536455,    0.29942315221644095,
+    0.229734794523969,       -0.6080101785608144,    0.8710863810424168,
+    0.6075673769845699,      -0.9949924215994163,    0.5182184440212028,
+    -0.1961049589025753,     -1.483025270207281,     0.45295023306596854,
+    -0.04521462667939092,    -0.7452828991898676,    0.5229455868967482,
+    0.4880932721923791,      -0.5775371839442981,    0.4003521905346774,
+    1.015064936192444,       -0.7126666356857019,    0.3808900274015926,
+    0.0027557504813070922,   2.266010310650884,      -1.862302970778187,
+    0.6952839314064626,      -0.3062450197812156,    -0.10019754882983263,
+    1.9015889763832696,      -0.008573151260794101,  2.2409437037755677,
+    -0.44214796541354673,    0.35051204134810954,    -0.49084750167489155,
+    -0.6906880126178839,     0.06248312645153182,    -0.28257152534910235,
+    0.20249158398642758,     -2.105027867724164,     2.0024676886095993,
+    -0.16699690878127882,    1.7429055062339929,     -1.0071121261064784,
+    0.29253570472426854,     3.1649421014768855,     -0.8697291831062892,
+    -1.4952997731082656,     -0.5465095353366406,    0.4724884273226057,
+    0.6933400400612962,      1.2903666880214264,     -0.2570123983933152,
+    -1.602250759500302,      -0.43502980447508566,   1.2402226948017574,
+    0.46566265317129135,     -1.9569387853750035,    -0.0350515116881563,
+    1.39816809132213,        2.126548136950435,      0.5616866387847775,
+    0.3093023127995021,      -1.240205667985729,     -0.8432428739675053,
+    0.046915857506165795,    0.5031977408135291,     0.5801841911197648,
+    -0.47820855513413607,    -1.1519422284235155,    -0.7777818410999131,
+    -1.1569743942597612,     0.6434091827639932,     -2.3122811060456603,
+    -0.3332780256094936,     0.44987833210121114,    1.5220127246649402,
+    0.07129967505097183,     1.00128393951411,       -0.3990040717810922,
+    -0.7444039865320907,     -0.6743930384374659,    1.5273357819018323,
+    0.9942211438977457,      0.4873979264626153,     3.3302688635617717,
+    -0.032341372526149416,   0.6203496510288014,     0.3075915525585113,
+    -0.22188569012415993,    2.316171347771517,      1.5066048030371135,
+    -1.3994796346205545,     -0.3998463222852154,    0.4283365383682873,
+    0.7831832150420476,      -1.3484470698133797,    -2.255561587021803,
+    -1.9063669687617821,     -0.07111146334121905,   -0.10320317903967742,
+    0.34521937611451436,     -0.7696747778790584,    -1.2242376759060625,
+    -2.0230450575793495,     0.32918735874743676,    0.37005395848777656,
+    0.9929936703557113,      0.7907956879792326,     -0.19071558093694238,
+    1.3492609627534853,      -0.13636691152654942,   -0.6608363863180724,
+    -0.5205784433035681,     -0.5848116447053936,    -2.1657367195003414,
+    0.1563260529857667,      0.24988559176216588,    -0.3622658108820982,
+    -0.7138414700864147,     0.37180382435527626,    1.7168705875476908,
+    0.038255152504981314,    -0.5076336072097064,    -0.5914472024229306,
+    -0.06975643814516222,    -1.2647655710414423,    -0.12526068819807962,
+    0.06118226433678073,     1.84467868776619,       0.9434737641133749,
+    1.0340292356498797,      -0.71294854109924,      0.669921543236243,
+    -1.1393824745499168,     0.3119606966908699,     0.4187372604188587,
+    -0.7664094160622363,     1.9993798051614897,     0.567373662750663,
+    -1.9027283028945088,     0.5528598865958085,     -0.4074118188900081,
+    0.0013762158163019207,   0.4657647909141831,     0.3905326673115421,
+    -2.0391513430346153,     -1.1583197436135844,    0.7726241585745918,
+    1.3012042492292906,      1.9031528866625007,     1.8031682386531052,
+    -2.0555366046304795,     0.7694821209364507,     -1.9162902011151035,
+    1.6136007285419953,      0.2533494028220485,     -1.1411687879770391,
+    2.00990094709114,        0.6439708702908716,     -1.8911488889514725,
+    0.29346811746062057,     -0.7311399076653804,    0.11129547997023954,
+    -0.4651946145553634,     1.3734938862686545,     -1.4232863881835744,
+    0.3174051682614164,      1.8141883405999772,     -0.8269602989702713,
+    0.21064867605821866,     0.20200164095007708,    -0.689702188878588,
+    0.6478936227652526,      0.09705028180989633,    -0.9437675047831234,
+    1.762016104898851,       0.7916149965898025,     -0.1671069450225316,
+    -0.6366747674434632,     -0.7843626222105263,    1.2309409725605525,
+    -0.14647823454054879,    0.4594382038647557,     -0.1844567008929351,
+    0.6164094698173579,      -0.11597913012588339,   0.7638538724770693,
+    -0.18321090982152893,    0.8295872971185219,     0.6723841093496378,
+    -0.11660980066118065,    -0.8597772404265872,    -0.9401199905438056,
+    -0.7407368201407702,     -0.9844876432848098,    0.8657964212540513,
+    -0.04660231251040279,    1.5701009775725303,     2.2793298277051397,
+    0.024222471072236084,    -1.5480172023433727,    -0.3814535315402815,
+    -0.07534841691644348,    -1.488442345152801,     -0.2504932773030516,
+    0.2869463091418843,      -0.45942784619737587,   -0.7684259229128562,
+    -0.758756759562809,      1.7866837303594123,     -0.15964608029769015,
+    -0.8299301146835644,     -0.3728983906951256,    0.9543437080453698,
+    -0.6846880440425576,     0.4818473093318288,     0.7278849488997008,
+    0.7491178322009753,      1.3996946711966503,     -0.5504819796364079,
+    1.1327328621819972,      -0.7928535998113694,    -0.3965398769992254,
+    1.1960871730603653,      0.8223754031111766,     0.002097550598407143,
+    -1.1914138260298779,     0.5616598270933244,     -0.6303726994832307,
+    -0.923884828209913,      -0.6481342544285978,    0.24649403990044358,
+    -2.121032105431511,      0.36076315321198915,    0.17390961970994287,
+    -0.584526402437006,      1.036927293450356,      0.6114404236927575,
+    -0.6062841454651516,     -0.6700166217709237,    0.6951514754619285,
+    -1.516073559416074,      -0.332622429754111,     -0.6310465274746756,
+    0.06987748465396224,     0.21112652239076496,    0.0367879149642805,
+    1.1348480762194146,      0.22806303463200753,    -0.3149922512172181,
+    -1.2108549075575812,     0.7218497968577305,     0.5281465458516884,
+    1.450809544896753,       -0.7474548334518082,    0.02641804008568619,
+    -0.05869269759393822,    -0.08761085924956588,   0.010390211327113649,
+    -1.714539490281463,      0.8249855340256519,     0.6532058713319675,
+    1.130473400858816,       2.2495743664943504,     -0.31896719363576814,
+    -0.0361431764313115,     0.009783565123339721,   1.9421854507084564,
+    -1.731219722734932,      0.48576797020739826,    -1.4708313674484383,
+    -2.581570782123187,      -2.0208327914879374,    -1.3817685557083725,
+    1.0690254394207013,      -0.8683604129657693,    -0.22745765928141864,
+    -1.163512760179894,      0.6109504782247451,     -1.1019615245008139,
+    1.317652176005165,       -0.9931054142672816,    -0.764827437978625,
+    0.12274104540243151,     0.024711220827863332,   1.424690088752885,
+    0.12040728809317063,     -1.2078342883608746,    -0.5603352740963154,
+    -0.5727839433678338,     0.7250422211312412,     0.3837930088122099,
+    -0.11939102301213707,    0.8696072200033855,     -0.5284964171782691,
+    -0.13623374831210014,    0.18076040433328708,    1.5281812827647787,
+    -0.09853318032359196,    -0.35079890881473486,   -1.0458370377122912,
+    0.6860521833164603,      -0.5876453742470404,    0.3436850178678997,
+    -1.901609890389712,      1.0431869588150116,     -1.3319377679886037,
+    -0.7773423635754164,     1.0585811348526395,     -1.334470735974386,
+    -0.07945503537323442,    0.07425608108048992,    -0.9985568133328433,
+    1.342933001549973,       1.4987783023244174,     -1.9716175035949517,
+    -1.4489902973985052,     0.808232202493007,      -1.3030241353673144,
+    -0.3886373535670217,     0.12955208833383267,    0.6918500823133606,
+    -0.22325259441131012,    0.09522091980203824,    -0.7767329173504803,
+    1.292361598433893,       -0.49531385690178353,   0.33973288757600323,
+    -0.5116380865832342,     0.10632349073443405,    -0.16816310439996543,
+    -0.16246417156510376,    -1.0137808582104966,    0.7964127942380366,
+    1.4140424167382613,      0.2431480977794328,     0.7323352737477155,
+    0.8380678807185794,      0.9279857809906793,     0.30335675135911666,
+    0.21225727998240002,     0.8640072720207901,     0.06883232560278287,
+    -0.9739183937649534,     0.023848354455931614,   -1.8884153915394422,
+    -0.0059002387550951925,  0.41337233629749925,    1.2359807763139525,
+    0.15127727739709215,     0.9281398211815497,     -0.000537514191408415,
+    -1.02347634604681,       -1.4113797177192944,    -0.9697343781372793,
+    -1.3661477186468038,     0.6337078105192584,     -0.20761468569829772,
+    0.5703148900153162,      0.07343142983148367,    1.044049544722134,
+    1.0601927908888367,      -0.6453380077771519,    -0.27431596094510047,
+    -0.5328285867746178,     -1.621312075740941,     0.6752171454008716,
+    1.188794788193607,       -0.006428391274197309,  -0.4931922184490016,
+    1.0909050288895557,      -2.344962289015491,     0.17747519593537467,
+    0.14328397410029256,     -0.5708570545254728,    1.3915745307593748,
+    0.9707354190544935,      -0.2611572476979568,    -0.08669599005183458,
+    -0.3880239635487064,     -0.5121199086543016,    -1.308199926863865,
+    1.3799484536963857,      1.0280001502907028,     0.7981663311394539,
+    -1.094335919776077,      2.0808451646333332,     1.9801652655572652,
+    0.18805716900128577,     -0.9042206521399764,    -0.8664300835441683,
+    0.4185486310884882,      -0.9130141402775723,    -0.034210884256722016,
+    1.088644709786763,       -1.5068237436831335,    2.005728695595723,
+    1.5667084089962464,      -1.2370858496374595,    -1.4136412942470413,
+    -0.28342185355946525,    -1.0311432003003655,    -0.2637208269105223,
+    -2.581185965408421,      -0.2287020552019795,    1.8028564715788176,
+    -1.1165947007376287,     -0.27306883682938937,   -1.4896092009408795,
+    0.6382375252419706,      -0.22531918924715497,   1.940733059659233,
+    0.20683944343940006,     -0.37217996823866906,   0.5502724957557836,
+    -0.5062279591880949,     -1.339308177819252,     0.30194776978860705,
+    -0.17486879820850382,    0.16631505033886193,    0.3754573325600648,
+    -0.5103196715944552,     0.4215763724924534,     1.737696573143212,
+    -1.1077995297251657,     1.7374255072341147,     -0.24280325098961422,
+    -0.7666266458493499,     2.4272205711517914,     0.15502163312524783,
+    1.3704030045911841,      0.8175942409178665,     -1.6805948250397251,
+    0.12081959865251861,     -0.5253197596706631,    -1.3417925949959038,
+    -1.7717113663197739,     0.10229024372388522,    0.5902530107990708,
+    0.39066818523619623,     -0.3058285551611547,    -0.7985169796081666,
+    -0.9868611816170736,     -0.5551605944594507,    -1.0330552031207325,
+    -0.2032746512998686,     -0.022887083968737617,  -0.8959881649439605,
+    -0.23205013443001374,    -0.7603200384884009,    -0.004472405252050842,
+    0.5070877079547295,      0.17812523394876037,    0.47215087449102583,
+    -1.6520145776078716,     -0.3786964985785043,    0.27673937673079096,
+    0.6411624595913326,      -1.5980033627401076,    0.1591782538180058,
+    1.2064206485316313,      -0.17861069581218178,   -0.09475811147673502,
+    0.450456882026013,       0.24711818395745414,    0.6746373502585463,
+    0.07241386408490774,     0.1524960703527199,     -0.7824444371410331,
+    -0.17043786136210154,    1.2531220372686513,     -0.20416975565930381,
+    -0.16856427948129626,    -0.4915033719195106,    0.7871858824407155,
+    -0.8546790776627818,     0.9105021950520499,     -0.9369733942604651,
+    -1.0577811251432885,     0.2059394620941099,     0.13017946960180968,
+    0.29755730301390676,     1.0625371208893997,     -0.4124959652003135,
+    0.4429935928939486,      -0.9098172653491918,    1.259169029698878,
+    0.6324586664200144,      0.5365187653532374,     0.18787849130978576,
+    -0.7855994441390646,     -0.32737156166738923,   0.5017794618250152,
+    -0.019184119536144097,   0.12374466247159174,    -1.3598195068017078,
+    0.18109397987624676,     -0.6919273901409018,    -1.0833365537522737,
+    -0.1546853895195475,     -1.8565042526126185,    0.6985699904060957,
+    0.852012897691245,       -0.053436099246713865,  -0.9937821745519041,
+    -0.9453688204139012,     -0.15112305346823743,   -2.4237337311695524,
+    0.18047678307435738,     0.6644320239800762,     -0.3118948485158634,
+    -0.4944023694095982,     0.18196725856866128,    0.3506440670398949,
+    1.094151751865899,       0.0183966792131484,     -0.689757651533845,
+    -0.46126504597235024,    0.18194574186008516,    1.5562003749969304,
+    -0.32027330478769567,    -1.0525266594013305,    -0.8701066201327001,
+    -2.096334606223154,      0.32979399768104145,    -1.3613242892821982,
+    -1.2335095276125785,     -1.9760146141547035,    -1.1179883795830254,
+    0.5684144769378178,      -1.3113541166252445,    -1.7496423367360299,
+    0.17826313396986762,     -0.34117128893601334,   0.43219001352027936,
+    0.7405598049078377,      -0.008498930533113933,  -1.2977608263818279,
+    -0.12379996122706427,    0.500259480149979,      -0.5829889570612002,
+    -1.4374612477128943,     1.1026120608754852,     -0.4152476431845003,
+    -0.40923001241477897,    0.015962241731200106,   1.0304723575092511,
+    0.2636197519566236,      -0.33322598635705175,   0.6821333452657441,
+    2.1470244928075615,      1.3877862581055116,     0.6728714206779861,
+    -1.1222804798570638,     3.7520587430653305,     -1.1986571186719208,
+    -0.37180290351912026,    -0.6998891942285705,    1.62689186152306,
+    0.4202400754758032,      -1.427124962853585,     0.2675871772612252,
+    0.5469056678489389,      -0.31848302355871344,   -1.220189789314534,
+    -0.7250334179615152,     -0.43684901912440166,   0.022731528940041008,
+    -0.5199099496967408,     0.7352204042444506,     -0.9499474980528454,
+    -1.73138686850914,       -0.7393934438692396,    1.3488906463814507,
+    -0.5731563071506868,     2.340808887791223,      0.49148423438486033,
+    -1.1644260642443258,     -0.8342861967831583,    0.24337247139381338,
+    -1.17764392228478,       2.3745786530316004,     -0.9908907808932206,
+    0.6809434559506826,      1.4601298902601427,     -0.10920040700467308,
+    -0.9958611253815084,     -0.2730663422746166,    0.36221639746740714,
+    0.8757520928615222,      0.05671693599624948,    -1.4002224259808547,
+    0.042323906609705614,    -0.673358171552496,     -2.1832358374254084,
+    -0.697560188163781,      -1.4324506747879238,    0.5868544072685127,
+    1.9441647540410785,      1.8587536567603968,     -0.5732087444487923,
+    -0.467394370223271,      0.6887819993238358,     1.061285612072863,
+    -0.4187385865596868,     -0.14263593827157645,   2.2069293491528925,
+    -0.1074515188872195,     -0.48532144229114593,   0.11991398387495637,
+    0.5797023621298565,      -1.0216418572185815,    -0.24840280567022194,
+    -1.1663606187184874,     -0.27826355350057475,   1.8769245287801024,
+    0.7417221786678901,      -0.0925432507186592,    -0.9331120255863701,
+    -0.31140795947916294,    1.0507333277452064,     -0.561686810300669,
+    1.4504206575201288,      -1.3736363552618314,    -0.2900462932852064,
+    1.742764333284221,       -2.00783876905368,      1.1884131573498202,
+    -1.8513770746404312,     -0.09007984706598965,   -0.1725347384110806,
+    0.8242934907117544,      -3.1545431461243822,    -1.9178098128512968,
+    -0.5660162936337811,     0.036895040275987105,   -0.8932168544591137,
+    -0.2208669765531758,     -1.18617316681054,      -0.4012729672717883,
+    -0.8467661486901819,     0.24402130101373667,    0.5814198502426856,
+    1.4329300628070527,      -0.6564185452162635,    -0.3179918232523262,
+    0.04774542744237301,     -0.29491926709078753,   -0.051990547101837564,
+    -1.562178729028218,      0.37175482357017836,    -0.9151915603012377,
+    -0.9569615679966009,     -1.5881262039021504,    1.161001630661401,
+    -0.1406091012972051,     1.14949198238,          0.27230168184814785,
+    -1.7033609262959155,     -1.0836964308948651,    0.7579319739406098,
+    -0.7656827141910405,     -1.0903440488749823,    -0.1793791282722899,
+    -0.1769671627562583,     -1.011867399093296,     -0.3261452556134624,
+    -0.4784926733363041,     -2.589989637458934,     0.502663526953067,
+    -0.8113749663534245,     1.3044394247585775,     -1.1501242352594518,
+    -1.5795983797213584,     1.1876239439866794,     -1.5850551157963375,
+    -0.6361742693791664,     0.597336718485879,      -0.32964610005481576,
+    -1.6554719689092348,     0.18803523461163435,    -0.19432291117124376,
+    1.2838550640677127,      0.588647904010331,      3.035714298111556,
+    -1.6458940359794758,     -0.021674753294791394,  -1.066654491033784,
+    1.1547505008320107,      0.8218379777534848,     0.7540378265510653,
+    -0.7773319565853868,     -0.7451515753835625,    -2.029679887663501,
+    1.7095001419088596,      0.508219294296325,      -0.26085995051958866,
+    0.9335153435389998,      0.7509155366343595,     0.9752641947374724,
+    -1.623537444586506,      -0.7138359429967399,    0.19544198106754554,
+    0.35542114521006973,     0.9572348634493512,     -1.0086355502545346,
+    0.12720913577777657,     2.205353791976543,      0.6919219776107886,
+    0.8705628841074635,      -0.01918727026696566,   0.7676270130194687,
+    1.803989786697739,       0.10664198726433499,    1.2239784048273419,
+    -0.8751393783314361,     0.5900987666308313,     0.9042166751969641,
+    -0.7520033792581955,     1.0981241985488952,     -0.6752465960330831,
+    -0.8052392575398221,     -0.0011923511051287392, 1.9319897429765716,
+    0.3091529530728036,      0.9357847820544649,     -0.7317977213101007,
+    0.07749745574279869,     -1.1765563699870865,    -0.571106373339119,
+    0.835640668792203,       -0.03839730591109033,   1.45129634214403,
+    -0.20241644121068042,    -0.19793592747244393,   1.2766815477335414,
+    -0.6486165056131792,     -1.5197646058401793,    1.3012769207885426,
+    0.4141878759428833,      -2.165194947578218,     0.04452932136918665,
+    -0.4037869991833171,     1.7448396601192766,     -0.7289914132183756,
+    -0.5807680557235481,     -0.9104008234735304,    -1.0540560866599389,
+    -0.700495920687974,      -1.4359244744861313,    -1.0311973812721096,
+    -1.6065852366477575,     -1.4972787191167518,    -1.5596750312674383,
+    -0.5211589342606382,     -0.6836885455877433,    -1.2264703976417448,
+    0.47827087501953874,     -0.04807588156959902,   -0.431975952508788,
+    -0.46397327906010694,    1.5928795615958418,     0.23981410787750204,
+    0.47537832699466753,     -2.586039943876386,     -0.6537344894045286,
+    -2.1710067840058747,     -0.426204327182512,     0.3733101463429235,
+    -0.674297767097434,      0.5186088302423606,     -1.0227499750553697,
+    0.5758031475475504,      -1.5536093306337848,    -0.2616882513082929,
+    0.419807198023843,       0.5359207882174326,     -0.12726336289101695,
+    1.9397142696305496,      -0.4144198369822065,    -0.4509957424693251,
+    -2.759507465661304,      1.7689338244500405,     -0.36899829117537003,
+    -1.1760154957169364,     1.3209044470554892,     1.2355061234756644,
+    0.10832562456606155,     -1.4349215686287293,    0.41897605092846396,
+    -0.6213919884429843,     -1.1707717953642571,    1.0433723671435184,
+    -2.1325920863862113,     0.5671632573670581,     0.45935509657016216,
+    2.0510108031226757,      0.3251738318299273,     -2.0584314911637356,
+    -0.8361209875707278,     0.06466692130559458,    0.3555636436097853,
+    0.9808160763437178,      -1.9596757620790584,    -0.32994968720006074,
+    0.969860946102532,       1.5439697955424616,     1.8610238233126282,
+    -0.3902191773644836,     1.09760525660642,       1.7117123424087934,
+    1.1980695233928118,      0.7236852620320248,     0.8277969278090205,
+    -0.7898843116016183,     -1.4472497710144514,    0.9828479286400185,
+    -0.3470668083827981,     -0.028133580718402725,  -0.5787200519143751,
+    -0.39290684184968,       0.2327493946858871,     -1.021859374191638,
+    0.06850001191677457,     0.24605487522907746,    -0.0773554207887332,
+    -0.7436298076544051,     0.7866198535183534,     1.8726369639932994,
+    -0.6012429598064242,     1.2344628506279733,     0.8892640592794231,
+    -2.6532517180506723,     -0.7611940999464197,    -0.6358403045852818,
+    0.7817715507811523,      0.18848788103748826,    0.4743980894695074,
+    0.6362788678712624,      -0.8989167148423329,    -0.7465499515010231,
+    -1.2228889627133084,     -0.1702705994069669,    -0.11910320666188712,
+    0.17120532699964489,     -0.7273076260918008,    0.9065245981430602,
+    0.9171108159418699,      1.5465188086681005,     0.7113078953970193,
+    0.18551123846931586,     0.6724239728526512,     0.6097517892531971,
+    -0.6518148999055419,     1.289385341711685,      1.7185181521648585,
+    1.976953180409848,       0.03522570904641089,    0.32427044329810384,
+    0.41635889052149266,     -0.002545563200592299,  0.6192887662137895,
+    -0.12117985080724364,    -0.19378340374814312,   1.7589821689866296,
+    0.1647154399018857,      0.06701020107735467,    0.8820192770324551,
+    0.1503329624493145,      0.2916222572092636,     -0.063564176479005,
+    -1.2204164921552978,     -0.030971715777287946,  -1.136884761914945,
+    0.2101512256908466,      -1.18143821319941,      0.9167091315499266,
+    0.7492347655988371,      0.2804282522536182,     -0.1001338776894076,
+    0.41630127953499063,     -1.964998337258153,     -1.0968198966983351,
+    -0.14873326311395055,    0.3452594335425641,     -0.07939577220284907,
+    -1.0046101383842825,     0.13344603462109247,    -0.4537004224688771,
+    -1.0685970433971257,     0.32950201508388843,    -0.20997820637102263,
+    1.1964831756964511,      0.6655320669543341,     0.7346713338464687,
+    0.3216666235060605,      -0.8451779772276554,    -0.9356271421283485,
+    -1.471158097691097,      2.8790124975636022,     -1.0794447891526988,
+    -0.20983183445547335,    -0.3603891654367212,    -0.2810976214280731,
+    -0.584050506346426,      -1.868344849270662,     -0.9981937374931927,
+    -1.3906695302272547,     -0.12677959099357683,   -0.6841994053517984,
+    -0.6871802588935974,     0.2158792456483957,     -0.5827850788582554,
+    0.9320941366718141,      -0.3861797863089442,    0.22515672822400776,
+    -1.32529671809268,       0.6568730209019389,     -0.40518339271927395,
+    0.4087580832902805,      0.33000516778113,       -0.17344315574593555,
+    0.2174391162949263,      -0.38529643595278734,   1.3461097503412538,
+    0.9342888546843545,      0.48249426079874763,    -1.1801404150533439,
+    -1.0993056555807936,     -0.6638615693816969,    -0.2450025435542981,
+    0.4480156689893388,      -0.8965378486453056,    1.1770740713435708,
+    0.0035948260408600282,   -2.0127817747014047,    -0.4753171130592551,
+    -2.5851852844817746,     -0.7517287068932562,    -0.5491278494530036,
+    -0.6104101345698859,     -0.32525354225734127,   -0.3941018148821879,
+    -0.5937343536013119,     1.5024969120468332,     1.2149022476324396,
+    -1.141840656789839,      1.2538998985134067,     -1.6213674818805632,
+    -0.8146121697170767,     1.52519274590198,       -2.2395533380839603,
+    0.5747856629329532,      -1.2534941165597333,    -0.14400012480290983,
+    -0.18020321070289202,    1.6972042117047923,     -0.8106034414835802,
+    -0.06901518324670536,    0.6270198155852067,     -0.2517774914632372,
+    -0.8220673267654407,     -0.05919977985202037,   0.09351148585756956,
+    0.884055433909044,       -0.9430523456034778,    -0.4491305134880514,
+    0.3229426895242536,      -0.16716743733737296,   -0.18528023098144103,
+    -0.017003103324145882,   -0.6958394882368929,    -0.7996904016326981,
+    0.44073017860946173,     -1.0951000927916446,    1.1653838512075743,
+    0.21730491319659,        -1.276541091568623,     0.2830269957152605,
+    0.16727859908564113,     0.7621613837839641,     1.1588495718450047,
+    -0.3664191156646492,     -0.707762707706492,     -0.6059815438875954,
+    -0.9810884288009163,     -0.7464415668311316,    0.28450243761134175,
+    0.015265812818831473,    -0.49135700723292003,   -0.738255810782413,
+    0.347886269511483,       -0.5015990127218578,    -1.0401567427730807,
+    -0.15167485760614444,    -0.264493598094959,     -1.0700412930966852,
+    0.8271763562614096,      0.8460124298546868,     0.04089368451052054,
+    0.13104036890904666,     0.5273080997465787,     -0.030922472263587825,
+    0.8912922446426618,      1.656008484699485,      0.0804930425261346,
+    0.44025342397696143,     0.8734516679613615,     -0.3380428067986851,
+    -1.1283045171918837,     0.9060008153461884,     -1.5687643567462615,
+    1.7888366900220696,      0.8704334283821108,     0.1876911695103255,
+    0.0510959339084936,      1.7513579481129395,     -0.9462259567737072,
+    -1.1601934603236257,     -0.5981359247121436,    -0.2617974840702203,
+    -1.006469240395529,      0.15386107357095694,    0.1359449473427494,
+    -0.8138571479878205,     1.603052652443563,      -1.392073939878003,
+    -1.2767228586553112,     0.37612003170845065,    -0.20748288424464334,
+    0.41772685492077233,     -0.6189706209377593,    -1.0333397780175095,
+    -0.6455434737566845,     -0.6835953070360038,    0.5249960083345708,
+    -0.4799583539738183,     0.7614303774911797,     0.5880753458049396,
+    1.040596332300466,       0.90071902882521,       0.7843528239572451,
+    0.7698529690098654,      -0.5166922695242262,    -0.2618841417402872,
+    -1.8301271358594364,     0.2917505618925979,     -0.673765913490036,
+    0.40154546435054106,     0.5274840785806093,     -1.352093704595329,
+    -1.0138393659935512,     -0.3493463357508016,    -0.5176006556319437,
+    0.16702018413550748,     -1.155423766612398,     0.04717833215527393,
+    -1.6884855418139904,     -2.155110359495152,     0.7166636395955764,
+    -1.3053134891160654,     -0.5599177076003232,    -1.417362936850548,
+    -1.4088707900688275,     -0.3988565596959592,    -0.4101283732824781,
+    0.9825871324379862,      0.44951201091392656,    -0.26111853733096213,
+    0.7576835306606204,      1.1165542180070642,     0.411297981876631,
+    -0.40631613782556647,    1.0186033766185785,     1.7685216261060954,
+    0.6605343187117255,      1.770676590400743,      0.9265989166637347,
+    0.8488585831285513,      -1.090186484917704,     -1.1135493459717551,
+    -0.04948348466500732,    -1.6694576939036156,    -0.5929538129904747,
+    0.8673373942012389,      -0.6651554180197803,    0.5331910186557777,
+    -1.3512508965598733,     -0.49364101718611164,   1.0234404294173223,
+    0.20851243688529744,     0.29028252717784747,    1.7047238315946285,
+    1.2968035024879467,      -0.8768569031977257,    1.3178986165036368,
+    -0.6152441226468611,     -0.017589832719863276,  0.015213084468816439,
+    1.0730402468735136,      -1.1292666384327423,    0.45186088404208596,
+    0.5240148795796721,      0.8115132728378954,     -0.21038579732682744,
+    1.0034122333710784,      -0.7115439859527487,    1.1470587467683069,
+    0.35224016801023095,     -1.400082899212773,     0.40792033834150976,
+    0.17930459377802474,     -0.35565634445261957,   -0.7362536060315219,
+    -0.240192956823039,      -1.442157013194299,     1.690719464084124,
+    -1.1282788050680386,     -0.6612831040067043,    1.1448990480585721,
+    0.585030845605586,       0.7202453713222604,     1.5167084512000626,
+    -0.3121427356736696,     -1.0464949240388077,    0.8442679692407903,
+    0.7962782902357136,      -0.3268894213447173,    -1.2655799233356313,
+    1.2391505515789194,      0.575847388165508,      -1.3734739216837852,
+    0.7799538165262154,      -1.440977405082379,     -0.48263044132040345,
+    -1.1233094506905685,     -0.6378305722889597,    -0.8333110049758257,
+    -0.6133108128398762,     0.7242639620470163,     0.2945909670570727,
+    0.6287316020446637,      1.0923421235429414,     -0.37270250458264037,
+    0.07989468325418829,     0.5381529978376386,     1.706738572598845,
+    0.899078253382037,       1.3815511554204174,     1.0189647244587277,
+    1.0572654174733929,      -1.7846701659189486,    0.8808591942234584,
+    0.2129248467187966,      0.054214374395357916,   -0.527255138315271,
+    -0.4252740782806449,     0.41618073882703194,    0.8399757635785043,
+    -1.4977856049331646,     0.21810382065939288,    -0.5606867786472959,
+    -0.9508027663214393,     0.3926222752782189,     -0.32871783189517306,
+    -0.6590366806742368,     -0.7691650364151525,    0.2812988486575179,
+    -0.010038274251463825,   -1.0916403769587453,    -0.8409976297559635,
+    -0.18250647964381972,    0.4051478101302095,     -1.049714506095244,
+    0.48810659292943503,     -0.8240027246128723,    2.7277445986992355,
+    -0.9410028621366266,     -0.7901255402876283,    0.19400337485364944,
+    -0.9023809671624451,     0.8276312306042161,     1.8014163467567794,
+    -0.3876198041095915,     0.1727710412144404,     -0.5177596662834922,
+    -2.8890981522643574e-05, 1.4317344185030516,     0.8942461977066967,
+    -0.9042249335038824,     1.5459043652157056,     1.162061328999815,
+    0.48636831873409325,     -0.659217416319285,     0.06570753973556404,
+    -0.7954659408712335,     0.4676057696719486,     -0.3164710983237507,
+    -2.23496202878047,       0.926203056277368,      0.19145303768298497,
+    1.078483069134095,       -0.1361797331462486,    0.18846661891450603,
+    1.1153261444867018,      0.387797071428739,      0.2880017302178219,
+    3.214390971909234,       -0.16900019082095039,   0.16918574977841397,
+    1.7340287011737314,      -0.805007701528497,     -1.040997301485229,
+    -1.4320658005825042,     0.5336624593453383,     0.6256307447469265,
+    0.7414876465549203,      -1.3535600800467034,    1.0058591594818873,
+    1.1972658813934152,      -0.09731132465768487,   0.0325664659560403,
+    0.6755957782622037,      0.367143500143,         0.6419696650433121,
+    -1.0860860579650238,     -0.1746223857264095,    -1.2124733597387285,
+    0.6312769520562472,      0.5302164622767119,     -0.09881499080804336,
+    0.2967992294103342,      -1.556516358130969,     0.8579252643871412,
+    -0.4672710699218704,     0.1290510134157261,     1.1153697189785832,
+    -0.7565006082748553,     1.1972335181812708,     0.12407530951196799,
+    0.02819015551787851,     0.556045568363087,      -1.2470255824667826,
+    0.594106177561087,       0.06150945870525086,    1.0362769626049344,
+    -0.21680703129531062,    -0.36331744678200245,   0.36963815265672956,
+    -0.05936779252416777,    -1.1739686745612512,    -0.19395772977111753,
+    1.2676300198541905,      -0.09310372586669181,   -0.8704599607677304,
+    0.7159370052169773,      -1.85344367027448,      -2.1202672506254667,
+    -0.004150296173177208,   0.18092523086431334,    0.22039921162634282,
+    -0.8927828911915724,     -0.1504996201351866,    -1.3987332518431757,
+    0.219562310680947,       -1.615318854579781,     -0.1492427416792045,
+    0.2615793111329703,      -1.7566256994238636,    -0.5225029255109357,
+    0.7881462464150731,      1.5489678835906378,     -1.5039602882516212,
+    0.3399184584315507,      -1.2359493747154482,    -1.3452580019083729,
+    1.596073831064355,       0.6681822358497356,     -0.8041942973288516,
+    0.219027668829904,       0.6419463362638245,     0.18129265639183836,
+    2.2472787436994395,      0.605779141138385,      -2.9929816204288446,
+    -0.29019976256709457,    -0.7365762178923174,    -0.2041467778064034,
+    0.013465896299126338,    -0.6511429259683605,    -1.0849176059960057,
+    1.3634054909427085,      0.5973419939485671,     -0.6707393502626668,
+    0.6796496534340393,      0.675180566507227,      1.2673074611463526,
+    -1.055313326575193,      0.7798816293547256,     -0.6077883445070497,
+    1.1550445713591535,      -0.19244915469604434,   -2.2717792326401027,
+    0.03535397368653716,     -1.7841625220166666,    -0.21714942594408118,
+    -0.05819163020514709,    -0.4013050158100976,    -1.4869198852985548,
+    -1.1157289072186787,     -0.8445905993324864,    -0.24810861102245482,
+    1.2884997799132312,      0.7090854303742485,     -0.4721952334895974,
+    1.2738777053993517,      -1.3680624871013929,    0.6850213170639883,
+    -0.17523470020174475,    0.2363247906446195,     0.6384621945457168,
+    -0.6795750166152891,     0.8011581338869036,     -0.009309986232615973,
+    2.4117989020868333,      -0.30426108521026884,   1.26917483653135,
+    0.6470904259956914,      -1.1741264164507175,    1.3606222392346448,
+    -1.060410803627005,      -2.231995170382012,     0.853315686011954,
+    1.0689533852881405,      0.052025631062613036,   -0.2610193119246841,
+    1.5836817994910326,      0.7118680737856397,     -0.6558659237277387,
+    0.7315329796359693,      -1.2432916297202024,    -0.5589679376978514,
+    -1.0511300322009207,     -2.200017380038361,     -1.1772925474554745,
+    1.2223279030800633,      -1.0978218788619438,    -0.5500320300032019,
+    -1.1609736833209554,     0.8656072166240774,     0.0011974481672618685,
+    0.4907452935681658,      -0.10568678053148799,   -1.1710269672218692,
+    -0.973942795593724,      0.8372659403012491,     -0.05740669551710561,
+    0.7744016887233798,      -3.1625958705076944,    1.1101087356885349,
+    -0.49396718934480277,    2.1728572463956386,     -0.5107550832081783,
+    0.028268871679493147,    0.6603776289974964,     -0.8757951603101223,
+    0.8727379309639394,      -0.645215908855314,     1.2891030882261105,
+    0.7932062567348767,      0.49563664662603807,    -0.724194178723068,
+    -0.21057116858873387,    0.2999116083596886,     -2.0333427405438136,
+    -0.5517492964661896,     0.938073503891436,      -1.2681807724163756,
+    1.278978307558204,       -0.6283151880367162,    0.32325734304049125,
+    -1.1476638497082268,     0.4843782644284401,     0.46272803082578123,
+    1.1363739576155818,      1.3540701033107998,     1.2535236917029877,
+    0.20891898377787882,     -1.226164118362896,     1.3237650837810244,
+    -1.3041347358059512,     -0.4387098303357449,    0.7371086090410185,
+    0.44355769183504495,     1.5930653836247564,     -0.0040534266147775125,
+    -1.690068973099096,      -0.2752584046412137,    0.17406048941303162,
+    -0.3506090274352232,     1.4124535516900458,     -0.24761261147971436,
+    -1.4358472999438883,     0.46678946561837587,    -1.1476852168989529,
+    1.699892339660947,       0.270094204767006,      -1.4032843996500628,
+    1.0793918268290181,      2.3692465481582556,     -2.0040560530375524,
+    0.9030735089709537,      0.4840275803395181,     0.17568029694849005,
+    0.3433284201270193,      0.49188566484212837,    -0.6930048353471445,
+    1.4109898381177775,      -1.3495241610180455,    1.958563370279812,
+    1.527687216214651,       -1.1861350466098093,    -0.005400131000477191,
+    1.4198589871443197,      -0.49099443350484123,   -0.16240854473728508,
+    -0.40237739797281896,    1.1674728080056607,     -0.6076827531242488,
+    -0.009825594514960836,   0.5402154018682239,     -0.20760171202737612,
+    -0.8664315256792297,     -1.3415486022819862,    -1.5182564386057238,
+    -1.1798042502785644,     -1.7205495539871147,    -0.7268767879223045,
+    0.3002148052585635,      0.05409536881569749,    -0.8266330811652837,
+    -1.0180189553829169,     -0.9933885629183765,    -1.3878980226910025,
+    -1.2358775777497444,     0.7143615737723078,     -1.4046115068751779,
+    0.01731584864875917,     -0.6180538501501635,    2.4279444867778137,
+    -1.7969280332746063,     0.19330085492571836,    -0.33375059399774476,
+    -0.7711303644799203,     0.3152129542921461,     0.15558461727451872,
+    -1.0689051640762384,     0.4262773588426122,     0.38916857866901455,
+    1.3094697232444557,      -0.6099712132874227,    1.470444438145549,
+    -0.196817358297354,      -1.9760123510226113,    0.523095800724527,
+    -0.08159020676334972,    -0.8823509559363621,    0.9332403438508771,
+    -0.47162828426325093,    1.0168856077002486,     -0.08270112761350111,
+    0.7503217358086836,      0.6794777611506858,     0.4731679155145285,
+    -1.032043429172452,      0.919712977160328,      0.0217617250277118,
+    2.0022607736457996,      0.47866988329506416,    0.7511262340245196,
+    -0.7648929555202142,     -0.40614158559758673,   0.09671799432932998,
+    -1.1704760418537006,     -1.1702773699142448,    -0.1085827579001268,
+    -0.07787119892940478,    0.20207488682861602,    1.1171041340040986,
+    -0.4003373621477374,     0.6808757090562668,     -0.14463533644795523,
+    -0.19401191453756295,    0.25706805218789175,    -2.067728271529583,
+    0.06635686450734092,     -0.6382574745409534,    -0.9298385392262319,
+    -1.8869914173722033,     -0.4428910909670608,    -1.8774360718730723,
+    0.8701231593616141,      -0.2393073192830462,    -1.6820717761241684,
+    -0.6735248747306768,     0.7549537519938414,     -0.5948834668152313,
+    -0.28121780617759695,    -0.3691832141706423,    -0.12827610461057184,
+    -1.6997670434500198,     -0.045459677942810556,  -0.5580926962117219,
+    2.9537792641399316,      -0.21300837995416544,   -0.45562459224058205,
+    0.9884770070036552,      -0.15603216950516802,   0.2533421907477552,
+    -0.8741159665377922,     1.555228070446301,      -0.627674675419191,
+    0.37535028261937037,     1.1323575308822444,     -0.3045049241513605,
+    -0.0001490498648908829,  0.5865133672130857,     0.6826819134624046,
+    -1.0900979849886712,     0.1814832299213445,     -0.945369035582733,
+    -0.7453702060845657,     -0.648391176584059,     1.2159778500722835,
+    1.5965773341210034,      2.605452593879662,      -0.056550418380157286,
+    -0.8414068818360764,     -0.9694817709901686,    1.6074807889844713,
+    -1.538378199155153,      -0.316968558483206,     -0.5660630458678035,
+    1.749995274006127,       -1.0133440989579459,    1.1016633372597648,
+    1.31335307429686,        -0.16677002654309434,   0.4654952947644866,
+    -1.5387143314075462,     -0.08820781182612655,   -0.21502705543829606,
+    -2.579582644851874,      0.4153769684854302,     0.3551664168161738,
+    -1.6933760502015254,     -1.4122758293094115,    -0.7492891453695645,
+    -0.5291817822923829,     -0.30636589590490504,   -0.9581242311464521,
+    -1.0078571307469861,     0.3065132438008009,     -0.4752480390629452,
+    -0.10680060337740549,    -0.22967986894639247,   0.4572003101059361,
+    -0.15427488198311298,    0.8615394691474236,     0.10299852806451576,
+    0.8890342984703947,      1.2470822250051201,     -1.4604754563615618,
+    0.9219951214159728,      1.7828221484006088,     -0.9725291279578072,
+    -0.03187070750064483,    -0.3572040941264915,    0.4408339320696138,
+    0.5199918729810443,      -0.6692956022405149,    1.3125565223689,
+    -0.85668081168761,       -0.13831895369896985,   1.023592283566227,
+    1.9534378919694737,      -0.5126552424803987,    0.7822946119676119,
+    0.22004170471554488,     -1.5824436598466647,    -0.9551882591441155,
+    -1.2047707675356991,     -0.5033170552041598,    -0.4167881641539713,
+    0.02794879375551491,     1.2776939313762004,     0.4224761804725617,
+    2.6530626560608734,      -0.2434279416564429,    0.7892529213620024,
+    0.41441169469434314,     1.5065666925786185,     -0.3787160550962224,
+    0.8452578464582505,      1.6290727571493573,     -0.7208128462835177,
+    -0.07487166161865964,    0.50430630616938,       -0.43477945054773337,
+    -0.875244066355259,      1.8327329958645378,     -0.229650104410584,
+    1.7340930915713035,      -0.5084253162339523,    -0.2070889175460573,
+    0.7971391463071966,      -0.20601914651240552,   -0.8988681434364175,
+    -0.719911183404855,      0.2726723583426293,     -0.666114018184255,
+    0.08806775356544921,     -2.257285851068713,     -0.5581222757399072,
+    -0.18031175679170344,    -0.5126417054614768,    -0.9935866181667308,
+    -0.883504579768057,      0.07052089074637315,    1.4870595256068533,
+    -1.3984263405326625,     -0.27626020994059186,   0.9770496026857499,
+    0.3344578549171757,      -0.09375738175076066,   -0.4507126034465222,
+    0.013261885283804235,    -0.10106411678041247,   -2.1864617615483044,
+    -0.715783231287305,      -1.9495889195944887,    1.2910565269664827,
+    0.8226485065399656,      -0.7882340919654517,    0.8048777645556339,
+    2.448647492101617,       -0.6230764610587125,    1.2992751069068902,
+    0.3625051167411656,      -0.23669921987108264,   -1.1059105499737532,
+    -0.5559250524055706,     -0.3949125162879612,    -2.315775631107071,
+    0.5304618712530338,      -0.3217312948341934,    0.45924421697025325,
+    -0.4192272263185087,     2.998272743459456,      -1.657284635810097,
+    -0.9330594546872397,     0.7052054431518636,     2.3584677409501467,
+    -0.9924186997796605,     1.829214895003395,      -0.9170294093756378,
+    1.2933671239448539,      0.07539454890509299,    2.229998540520781,
+    1.7819852673818741,      -0.6477226709721486,    2.93570146505725,
+    -1.1241588614917153,     -0.313620692582917,     1.8079031374875643,
+    -0.734783105706167,      -0.64135135526143,      0.13063039730524645,
+    0.45248667149970156,     0.3871823101979803,     -0.7456973521885583,
+    0.19689351577592681,     0.6374254086910659,     1.5039905960636601,
+    0.32816048821162896,     -1.25297943824901,      0.02841749723550984,
+    -0.6205935725480949,     1.3190309085105703,     -1.675422496628599,
+    0.5597331386976768,      -1.0653963023523108,    1.2720571237057474,
+    0.7711621237366315,      0.21933114193041292,    0.5049387118143887,
+    -0.3368800787803611,     0.6757772924750197,     -0.04962668226204786,
+    0.7312040068446839,      0.05857627564784104,    -2.4811914853053376,
+    -0.5136576840557472,     1.5174924509227699,     1.4525402156357885,
+    0.10454912052202897,     -0.12603357810633276,   -0.3352481386980251,
+    0.6305609042005433,      0.5790377243486634,     -0.9790918389714247,
+    0.6616501445291856,      1.2328966110014508,     -0.9548648213862446,
+    -0.1868413340423335,     0.46356484022827815,    0.7227529674460641,
+    -0.42053510001203787,    -0.5286775889912143,    -0.4638853479879945,
+    0.38523261923320196,     0.42911911519047446,    -0.019417543876177737,
+    -1.3642239554257414,     -1.0899868119191238,    0.6368240335314885,
+    -1.2210882131087215,     0.22635703799711782,    -0.36079762170112517,
+    -0.6022285061187317,     0.02669846136539646,    1.6763520911914194,
+    0.288816582066866,       -0.2956657266256853,    -1.4733715929359021,
+    0.5122384083312601,      1.136703353702554,      0.6073760467131242,
+    1.1659541072399475,      0.4765981778375144,     -1.3032748090829964,
+    -0.044949760849622884,   0.5248679834358566,     0.7210115254683419,
+    -0.49307644032833137,    -0.06336534569112102,   0.36586964228224156,
+    1.271293016796746,       1.0052388017895395,     0.6463183205729617,
+    0.3962225626846912,      -1.0252813667917564,    -1.1009598156427736,
+    -0.0918546545866658,     1.0415833830758026,     0.39535342348163693,
+    0.5610959353166028,      -1.5015559120508,       -1.4616537565063707,
+    1.1198838265349822,      -0.034638428394259076,  -1.3136878789643385,
+    0.8821674262169477,      0.25803616134093266,    2.9514642745077437,
+    1.2500004473316089,      0.3466973246304833,     -0.15110956038353035,
+    0.23229550813689703,     -0.10265217081063333,   -1.4387967148215497,
+    0.9275221197205532,      0.27485751749402,       -2.754706785130989,
+    -0.6355232251350402,     -0.8287418391076249,    0.9808901826693291,
+    -0.04405519010159131,    1.4874068545664905,     -1.5915195936984605,
+    -1.0757861164901155,     1.0670945267244607,     -0.6552213513174084,
+    -1.0586323916206477,     -0.5266714026610139,    -0.7598242721785887,
+    0.539327847291872,       1.1181676111568415,     -1.5869192311313465,
+    -0.2907764941934657,     0.01424387974271123,    0.08219363457393836,
+    0.8332555696612187,      0.119847106147557,      -0.5798033569867375,
+    -1.1118935209405625,     -1.824709271360341,     -0.3711119224385391,
+    0.01440987496422436,     0.9217248810889792,     -0.37776911154063514,
+    2.3237042742558933,      -0.07647958605993008,   -0.4833437594075619,
+    0.3805952618816213,      -0.9705589546398407,    0.2089080413409449,
+    -2.0640968549849434,     0.6760940759111317,     0.06667865592621124,
+    0.2105707825451485,      0.15480875799999516,    -1.2737560690934626,
+    -0.8986213938188805,     1.5664249130887766,     0.494597580478903,
+    -0.5972632802216176,     0.4210805545678483,     0.4077109007023292,
+    1.9544844633557323,      1.1103508858669717,     0.41116869397762196,
+    -0.4491852420964507,     1.783689915136641,      -0.10154865211136925,
+    -0.8705119223017634,     -1.2202464859202824,    -0.8623965380480931,
+    -0.36408524416704513,    0.7654014831163175,     0.9131854237589454,
+    1.1510697836854031,      0.1529766949851929,     0.8314925300419136,
+    2.259315575836879,       0.910289420520676,      1.6028825745362827,
+    -1.5106385510916758,     -0.7417989506465258,    -0.7511149556782155,
+    -2.6770342430781464,     0.0736782726815642,     1.3924489928118085,
+    -0.535316878876664,      0.1954422308839413,     -0.8540541967696919,
+    -0.49172764486353404,    0.2853098425182686,     -1.195775771879837,
+    1.174033031094316,       -1.918759193167171,     0.32223408808630233,
+    -0.49148177270312765,    1.4891447450457527,     0.7618450919294047,
+    -2.0841591413219676,     -2.4223966069821965,    -1.0013564105870518,
+    -0.5022263776157665,     -0.1890069406592009,    0.03024540836426785,
+    0.6735960181141722,      -1.3659907130774356,    -1.800546652302095,
+    0.2524614630050099,      -0.3609810112184397,    -0.10337333232262819,
+    -0.6418298464426032,     -0.17320876420470538,   1.486506903619689,
+    -1.623270295133161,      -1.2255304483995895,    0.6416016025185526,
+    1.5674077665995356,      -0.20564890732406377,   -1.262715857498158,
+    -2.00111994520767,       0.26054244674376786,    -1.2493542213517603,
+    2.1755789256379185,      2.3416035359052696,     0.22630129321375733,
+    0.4854617015970859,      -0.11791274245121647,   1.141795661244427,
+    -0.0030704777281344614,  0.06335675260431281,    1.360403262304348,
+    0.6261825197612685,      2.130981283917076,      -1.6368295559072694,
+    -0.5555824180790634,     -0.9039060151078754,    0.8417791693258407,
+    -0.4935903527028892,     0.6023319877887804,     -1.1689879541233021,
+    -0.09434109370116912,    2.2969954397531405,     1.638368221459261,
+    -1.8785319339207485,     0.36458646424691954,    0.8263529209141244,
+    -0.4934074057272609,     -1.102380304666846,     0.6619878044822564,
+    0.10082543006853853,     0.5525408685957296,     -0.15805143515754672,
+    2.331165182486843,       -0.9138410809898123,    -0.49599873735205025,
+    0.5148854567040885,      0.7317417636581219,     -1.378713630770589,
+    1.2973127137701748,      -1.4581184448190483,    0.006399600046154475,
+    -0.30702663057136353,    -0.7076248109417969,    1.133250429620587,
+    -2.3470527842730435,     -0.7307828123056779,    -0.9027638509435852,
+    0.8748974068133323,      1.5504213160135774,     0.7754687735448101,
+    1.3952850221761692,      -2.2245542177124547,    0.16360011702392324,
+    -1.3830333961679573,     -0.37496538762347165,   0.24467164863886215,
+    0.09462460132282483,     1.3757537967745386,     -1.9786353403291244,
+    -0.8357364497674116,     -1.4806299853682712,    -1.638790797076638,
+    1.0057794381356229,      0.1824188380472171,     1.556613784443566,
+    1.1852063376633004,      0.06815024693528814,    -0.9696163810925837,
+    0.9917917931011433,      -0.691603065594482,     -1.1994238154262575,
+    -1.1504101096608723,     0.12185711246740445,    1.265529846451242,
+    0.05260881697827562,     1.2244285322908544,     0.09134206751589977,
+    -0.4264487668592376,     2.721173739044832,      1.8210445299157296,
+    0.1969069797714716,      -0.8321947285442037,    -1.609029451692822,
+    0.4013576309743979,      -0.255511727709156,     0.4670008118381855,
+    0.32304122103894983,     0.4362761814423121,     1.1422276144175765,
+    0.3142198753896684,      -0.7234440328459119,    -0.7705485599851617,
+    0.5831268650353936,      -1.071826954371577,     0.7183421955712772,
+    0.7141934107186635,      -0.04388348915623074,   -0.7814232766358062,
+    -1.7763387305154212,     -1.1239649623130736,    -1.6259299915699765,
+    0.02667109233694199,     -0.4422875371588646,    -0.9206615370302526,
+    0.8726054709082737,      0.12932788545356033,    0.0475869285655146,
+    0.5581167804822794,      1.0364524461402245,     -1.602823987514767,
+    0.7066798465574406,      -1.8089367993045458,    -0.7943835410373827,
+    1.01214557856611,        0.6912224994756002,     0.6647408959923149,
+    0.18208490561077104,     1.4129765562660128,     -1.5408007845310363,
+    -0.305155313314902,      0.04734905160179651,    2.0352851581382057,
+    1.0265499061752679,      1.0384276626818627,     -0.7613455151170644,
+    2.2496615540466074,      0.4718083593354464,     -1.00592442912077,
+    2.345359297086998,       -1.426908208722563,     -0.8686997520872302,
+    -0.23400107574901624,    -0.980419737782284,     0.527211196283874,
+    0.276762685967314,       0.11350831680232691,    1.8938068316904375,
+    -1.6339691673702201,     1.3663857682669938,     -0.824651829575122,
+    1.4621639029858144,      1.905213993186392,      2.3015530387572984,
+    -0.19051428322037997,    -1.1632594691967817,    0.3279260980839228,
+    -0.053368568328445165,   -1.7628493853946647,    0.7355449884640639,
+    -0.9226779694002419,     1.442008824241391,      0.9651635963398251,
+    -0.28133739204335284,    0.036164361969480724,   -0.24256723925782622,
+    -0.4573933017078719,     3.0983106569913765,     -0.9361968812479787,
+    0.05533758850272923,     0.9914715704968188,     -0.38433906450452543,
+    -0.6285427878650274,     -1.3291010474101146,    1.1920353327508753,
+    0.7120029949357032,      0.46993361389369576,    -1.5087958752945372,
+    0.5035828386788038,      0.2853044072125119,     -0.3380637758950518,
+    -1.376740795973979,      -0.056682608259968535,  -0.8708420713804792,
+    0.08003477556166226,     0.06334006332975936,    -0.3381582638110928,
+    0.8820234632358825,      -0.06605055615863155,   0.5290869560935834,
+    0.4184023317712546,      1.0081731465237387,     -0.9640596957234715,
+    -0.34530484646468196,    0.92199450763843,       0.15353283567518972,
+    1.1258052528212672,      0.7452427958666733,     -0.4446800773703152,
+    0.8805109402769709,      -0.2574857377902735,    0.9566044952368202,
+    1.8537644298144036,      1.0915945069114532,     2.289500917464586,
+    -1.5515819351090716,     -0.5483748403923906,    -0.26634458762537405,
+    -0.4002905414328943,     0.37244803952713856,    -0.368108542880197,
+    1.106107424765034,       0.9847604849094568,     0.41347341110958546,
+    -1.012213287592923,      0.5473737791257619,     0.6742900156589524,
+    0.35388543026848024,     0.030007091808962966,   1.4003348730343157,
+    -0.5483807806982125,     -0.3666974718827937,    0.6670558611612393,
+    0.5307912980750714,      0.852597525301646,      -0.28401077751565246,
+    -1.3147060769008603,     -1.2375821375347569,    -0.43267271509082084,
+    0.7924251658823569,      0.7922641831578515,     -1.815911224773823,
+    0.5338957718343611,      -0.08722657039841221,   -1.0421058704108108,
+    2.1907750313906424,      0.2639578863553554,     0.8274152256554287,
+    2.5675254359375583,      -0.5811194038804803,    -0.3967901932906783,
+    1.4890156591290105,      -1.3076709746803026,    0.07396569629135018,
+    0.04621508676410812,     0.9701810376804344,     0.40539089281124296,
+    -0.9131798676764139,     0.9722463264132091,     0.8451494124356657,
+    -1.0510040962124318,     -0.6878031941924819,    -0.5258074968078036,
+    -1.149340078072441,      1.0646668027850454,     -0.3238427912437991,
+    -0.2778301838497915,     -1.0377557310307788,    -0.39453885605867073,
+    1.4849516297738241,      0.7482882570363897,     -1.6173972079315573,
+    -0.9897072859524271,     0.6356010152932335,     -0.4981221024798703,
+    -0.5532395591916419,     -0.8604921533184503,    -1.3310691289984613,
+    0.095289372865937,       -0.3802719084945578,    1.1403778702663592,
+    -0.06670794013480881,    -0.9651711380260342,    0.6938055010962784,
+    1.346147316118024,       -0.7357369142984359,    -1.7025759043782354,
+    -0.47896604798920384,    -1.3499098134896834,    1.6416177730920019,
+    -1.387744560587586,      -0.3276948581097786,    1.4735216504512167,
+    0.8712125278212387,      -0.5136613406111515,    -0.783064045176607,
+    -0.18149656923346952,    -0.24015520254893147,   1.4963985538770754,
+    -0.1546653543189482,     -1.349969833075344,     0.985772986611277,
+    1.0365328921808046,      -0.2267960282057418,    0.7721250344909129,
+    0.05124656438664501,     -1.2067983307836017,    -0.08107463852694614,
+    -1.1446779564621028,     -0.6341550753296669,    -0.9388977479580628,
+    0.3328448731734556,      0.18648370088106528,    -1.319679357898455,
+    -0.9198550223813338,     -0.0026920482464905175, 0.4643679239664105,
+    0.0722411574384575,      -2.2067945233703887,    1.2869049513116337,
+    1.7723116893364887,      1.5837926864531295,     0.5441039499176215,
+    0.6719858863417023,      -0.6541923388313116,    0.18857866835902992,
+    -1.130629051300598,      0.12176034671322958,    -1.429692919193387,
+    0.5852017686785785,      -0.3545559707975283,    0.7670688477499573,
+    0.18257375944692528,     -0.4595593462194918,    0.8433259737174407,
+    -1.1734047006751551,     -0.2648523985038314,    -0.5375442589546039,
+    0.7439724211177066,      -0.07551526569496889,   0.27001874618560334,
+    0.5254710258843971,      -2.3461154771154575,    -0.9263181527157239,
+    0.11592996031713133,     1.0124758995708458,     0.5725877615354216,
+    1.3107661680598732,      -0.221623872010695,     0.1006804529856824,
+    -0.49979899960401775,    -0.4356722536299252,    -0.8304368517851731,
+    -0.5432805934319569,     -0.1904682215580429,    -0.6515540595996824,
+    0.02657489683448823,     -1.8186341132448633,    0.4279337998879703,
+    0.1774568412105237,      0.44622878505572994,    -0.4634969334998664,
+    -0.5082197082736116,     0.9823609378503485,     -0.15450372868881837,
+    1.98654938354224,        -1.4061176897476757,    -0.24736482573051818,
+    -1.127373573562985,      -0.7867445825106574,    -0.7899916145469906,
+    -0.4807322777896102,     0.7828421108878142,     -1.1438940480509263,
+    0.6100117416593372,      -1.4408877550502122,    -0.4055256717738244,
+    1.319809368650454,       0.4620427891633347,     0.27228033549216907,
+    0.630105928122933,       0.5759750148379863,     0.628005643302478,
+    1.40366303600116,        -1.0384543624201212,    -0.0707392347503584,
+    0.6372688737983749,      0.7496422852980515,     0.5580579106569885,
+    1.3065365794206547,      -0.5009952454598233,    -1.3497201948887083,
+    1.272386918252629,       -0.0008030414838557247, -0.5486864004053322,
+    0.035759598795011616,    -0.43227620895673813,   1.0062079757863194,
+    0.8901665586471822,      0.31173284682148955,    0.5408695884672243,
+    0.03260762524033265,     1.0265089552451092,     -2.3633195893018804,
+    -1.1681951212278803,     -0.039930531266928235,  -0.41347738842926557,
+    -0.9505155491785762,     0.619968559122598,      -0.9783836826097586,
+    0.21736126979302767,     0.12428970989642983,    0.057696966014573324,
+    -0.8291847976306961,     -0.19316558314823537,   1.2269369409446935,
+    0.5435233447378405,      0.9628387139793324,     -0.08008198185377954,
+    -1.7022831013102921,     -0.46646817538216817,   -0.15067794022659223,
+    1.301508162131204,       1.1359538731928351,     0.42484515444013393,
+    -0.8565276511003889,     0.12844721483935073,    -0.26173149286135133,
+    -0.24350825707543972,    -1.233522100628583,     0.4639046527933113,
+    -0.029842761173669113,   0.8043818191113484,     -1.4616263678929025,
+    -1.1269817427096593,     3.6462723591105863,     -0.8800501288066617,
+    0.2875827811631826,      0.4377551156407507,     -0.9821855380220564,
+    1.727607106829543,       -0.06562011500223983,   0.14948004067102627,
+    1.818386334980022,       -0.7910209232827563,    -0.4876409777936645,
+    -0.34551279853133976,    -1.3726464186558747,    0.2758394684840067,
+    0.47305391760552573,     0.18331995909350843,    0.6558303518022676,
+    0.865654077373947,       0.33870280751079174,    -0.2414410867603152,
+    1.2204166448235072,      -0.6966638711552233,    1.3963575430520505,
+    -0.19295637243760086,    0.7648027670148331,     1.826551977023387,
+    -2.264797629743517,      -0.19226037889365327,   -0.4039483615184071,
+    1.7073865242058321,      -0.40682240351132803,   2.7290195018569747,
+    -1.5279029036062397,     0.3495055479493255,     -0.38630186958968893,
+    0.5050903334063788,      -0.565143695869421,     -0.45103189309874464,
+    -1.8228280374162729,     0.10817367141345895,    -1.497922017285047,
+    -1.3096689509570159,     0.08687007729730782,    -0.12134915963300655,
+    1.0270899332263699,      -1.3531296008020126,    0.4210120285829481,
+    0.322500143639209,       -0.30237118185260453,   -0.8036354538106663,
+    -0.07909241046296576,    0.8839859058325767,     -0.3737557427776634,
+    0.8472950159292573,      -0.27380816834534455,   1.724795567821819,
+    0.026803500773852018,    -0.1755423789338502,    -1.6108279532522898,
+    -1.427151790392062,      0.3812902632740631,     -0.22744983567638466,
+    0.2812766082757891,      -0.6846418980253619,    -0.1504381827194402,
+    -0.6236948005171222,     0.2951986124107851,     -0.21816408319046576,
+    1.864651597657007,       -0.6880771570816544,    1.11880976014106,
+    -1.0544929590114476,     -0.4653321773704069,    -0.8415438703090004,
+    1.259637231862847,       0.43698942638709626,    0.13717316709901906,
+    0.23445496194829551,     -1.084368351664796,     1.4029130031627675,
+    1.3895288823913179,      -0.03429977525862107,   0.013260676106867762,
+    0.6491355508756196,      -0.17525429657991645,   -0.20017650608820767,
+    -0.4928044699425399,     -0.34589072903532786,   -0.4760601289338892,
+    0.7298529681182292,      -0.3282967826986917,    -0.42836452002759823,
+    -0.6268224058773053,     -1.4994967085559583,    1.5601817370926783,
+    0.5085960400447783,      0.8665007596057925,     -0.5298975006331764,
+    1.457200576700915,       0.1452028054382397,     1.4526364883699292,
+    -0.013373475508112846,   -0.04466473382085757,   -0.527954524498501,
+    0.07748692204363035,     0.22498409716055148,    1.4926964719344709,
+    1.539712916648304,       0.08994684204626592,    1.2190384290220666,
+    -2.717651358181704,      -0.4702924181212981,    0.2497114029648015,
+    0.8871216387294311,      0.4231009153278338,     -0.05605316905276165,
+    -0.4614976400807611,     -0.7997656981946477,    1.9019604228189215,
+    1.1222257801376632,      1.3077771471889748,     0.010605824024726667,
+    -0.534469340741795,      0.5546941798955465,     -0.02462144895322172,
+    -0.128077627084407,      -0.024856286369587668,  -0.6329512669598814,
+    -0.8714153945717722,     -0.2424045605163555,    -1.385421682528003,
+    0.5982497666025951,      0.83855075480801,       -0.769538984575906,
+    -1.827429936489406,      0.3935795273051473,     0.23843245888763168,
+    0.020507037263192668,    -1.33442809071426,      -1.9177404614444131,
+    1.7115593639849593,      -0.21640796052680086,   0.5043991507993695,
+    -0.07074978270633413,    0.4135401052282568,     -1.278265976698565,
+    -0.44570942673369196,    -1.3553630887139845,    -1.0871529026066995,
+    -0.709019940363552,      -1.8065494916138836,    -0.4611993194121158,
+    -0.7108888926347918,     -1.186214899347432,     -0.13283910319029893,
+    -0.011340683485682682,   -0.8369735161386705,    2.011971489356334,
+    0.7182074136829244,      1.121656573919517,      -0.3283833210304316,
+    0.8935994230605493,      0.7655751393663242,     -1.0185070207997227,
+    -0.6822099317533046,     2.9152223158608535,     -0.41121768135359393,
+    0.48686120031480806,     -0.21460162008759756,   0.8313971814009989,
+    -0.9945853121559562,     -1.0052923963461624,    1.134340610239355,
+    0.19853242993776873,     -2.477620876439257,     0.023414350590219842,
+    -0.18196770659554123,    0.7106682338791255,     0.3210541064788131,
+    0.3421967162658897,      0.08746449151496341,    0.2904687531589333,
+    -1.1526235457290563,     -0.8148997212980255,    -0.8523104333848104,
+    -1.3411595411169084,     0.788253888107948,      1.0775839283249449,
+    0.613995411968149,       -0.6012319089477326,    -0.5371281027862845,
+    -0.43987459031473214,    1.1128982532234954,     0.5266278326595085,
+    1.7389102567877968,      -0.9695776571266128,    -0.2256360343878611,
+    -1.2606798948133977,     -1.4172417810759343,    -0.1552598388632569,
+    -0.33570598872111135,    -0.512816985743646,     -1.5347237821642539,
+    0.19676979167529196,     -0.283869641994323,     0.9148655091683352,
+    0.5505025211231368,      -1.31174170271937,      0.3956918759066964,
+    -0.5988682318276521,     1.5325057064680434,     -0.02958840588968089,
+    -0.5035134321128524,     -0.40654116424555536,   -1.5008971880876139,
+    1.2744567043516994,      2.119354859032629,      -1.7297968892877658,
+    -0.25179296345517693,    -0.11040466733842463,   -0.5942769888879725,
+    1.2175365846396569,      1.247439105076407,      -0.24534357630852416,
+    2.071282198645538,       0.03277080289936971,    -0.24190413912377645,
+    0.27980361952050375,     -0.7460328990089631,    1.4531329512332039,
+    0.6166362490192825,      -0.354945984261932,     -0.18551870544883436,
+    -0.9077721403129143,     0.26250934748061183,    -1.2936379539857008,
+    0.003169944639415076,    -0.5172054145801547,    0.5670558451907819,
+    1.042568287591463,       0.7869380920960765,     -0.12257057645196298,
+    -0.7096237838522766,     -0.2996621201807654,    -0.016632830776802082,
+    0.487918719669315,       -0.5681747304381429,    -0.9672792597618267,
+    0.17342667395663303,     1.3588022074943762,     1.872324602686571,
+    0.7931997819986738,      -0.9902639006250883,    1.4085930707925551,
+    -0.8456602041156787,     -0.7705719432063498,    0.4276107103151994,
+    -1.3803252772326713,     0.8016801858570082,     -0.05362922040087924,
+    0.39912286959972,        -0.8234291504865576,    0.846427358226088,
+    0.5131236157951996,      -0.3633283991924872,    0.9452812793881263,
+    -2.6602860751466295,     0.3623115116648414,     -0.10753766667097661,
+    -0.7949988756930338,     0.17720943273504358,    0.49980077409784035,
+    -0.7369623833630637,     -0.11952650502194903,   -0.04141990912145558,
+    0.39289158385046086,     1.2267746170514917,     -0.46394990244678835,
+    1.3169178733796865,      -1.3042219504056056,    0.30077709717856665,
+    -1.7196087076014055,     0.07177701662830722,    0.7222542762282802,
+    2.022969253473468,       0.04935669838375325,    -0.7483148368816033,
+    1.0264959693424798,      0.04115723682228777,    0.09833786013320965,
+    0.9170178035099407,      1.092750141981459,      -1.732129061205441,
+    0.05154998891241537,     -0.016395711712792128,  -1.069569983022332,
+    -1.623899703077323,      -0.06684619108957385,   -0.46373217043701576,
+    -0.7246980923449928,     -0.13736830258665825,   -0.35102418380112477,
+    0.017595425266469764,    1.576791021638059,      -0.030128998562307465,
+    1.8803702713941155,      1.2440986693492615,     0.9675829707767721,
+    -0.7285043171366192,     -0.29343513784914554,   -0.9197246627937408,
+    0.41587491263089815,     -0.06706117195840944,   0.44169814270282637,
+    0.3025244765414159,      0.16784696765274312,    -0.3569089402096321,
+    -0.972991604042695,      -0.4416852134069257,    0.7166162029289872,
+    -0.16388247735637274,    -0.060024834240342655,  0.8678109997442384,
+    0.48757632913140797,     -1.4748078406694363,    -0.08041295009333033,
+    -0.8712945951901971,     -0.05418315824336455,   0.39027114673859925,
+    0.5094148386522042,      1.663784596276787,      -0.5008168854177154,
+    -0.2949435637059992,     0.5740279926141961,     0.9619860539592223,
+    -1.0314241710934378,     0.6867171468628693,     0.6654789549406667,
+    -0.15035665456683686,    -0.28110187570445544,   0.7326478451249915,
+    0.4271700552528818,      0.4007029926343052,     -0.7317930836771686,
+    -1.722303247782847,      -0.09400320606811419,   -0.2710988833793442,
+    0.45814820321352767,     -0.764512972167171,     0.6346970011436195,
+    0.4096090798962272,      -0.7401292332115676,    0.9450289441779055,
+    -0.3429164910960217,     -0.6964691720754596,    0.2508671269142992,
+    -0.014712760831985377,   -0.9050533851783099,    0.620139245438828,
+    -0.009154711877947863,   -0.7582132835490957,    -1.7539658490188335,
+    0.4264173789597557,      0.09902380238715182,    0.11938279134079255,
+    1.376824475897778,       -2.490614832223641,     1.2692073153447934,
+    1.3637989611753547,      -0.9800758966533455,    1.0146747268851577,
+    -0.811960110052185,      -1.0425058091183637,    -0.10139554713329421,
+    1.8276512775213283,      0.36166741716219963,    0.049851407405626005,
+    0.8856782882003063,      -0.6224977003701693,    1.4975145658781384,
+    1.570620595630201,       0.4292103788753758,     -0.7882673939716752,
+    1.0720154753847566,      0.29469203327758237,    0.6436642845364944,
+    1.1365670086877253,      0.43643476808828435,    -0.9025375331001769,
+    1.4903212544653002,      0.27927288336798406,    0.32415745772594284,
+    0.6150950323864863,      0.31173299002213195,    0.7479483282893075,
+    0.19745867587461846,     -0.17758946211056764,   -0.5501830842433428,
+    -0.511325336637067,      -0.28816770123170904,   0.9894389971659792,
+    -0.3368930074341903,     -0.11107709022961969,   -0.10106213935840815,
+    0.5338676461567843,      0.6489810333627515,     1.9744457032773453,
+    -1.3930633331594,        -0.22794963621828385,   0.5730227298492143,
+    -1.6851219710847858,     1.7413404722394699,     -0.11610839828171284,
+    -0.7939979349424935,     0.9707546485937223,     -2.1980076082042093,
+    0.21223976403409497,     -0.991498891475379,     -0.01491055849360696,
+    0.3740578220635879,      0.7925321169656073,     0.41132777248914776,
+    2.086389201568732,       0.061977159629830594,   -0.34192762474990074,
+    1.2261183755300331,      -0.06530372651108185,   0.41821438071088257,
+    -3.9372745929484667,     0.4532431593823444,     -0.07476776989435119,
+    -0.4349007930065365,     -0.6563461639510355,    0.9031513713838886,
+    -2.041668271032885,      3.1491642630593284,     1.1541207416445949,
+    0.36980249547513916,     1.900374138065587,      0.27465552733290877,
+    -0.8949684760421813,     1.0270806701892,        -1.636037287846117,
+    0.600065431845032,       1.1981009652707955,     0.5349658627619147,
+    -1.4512051846420955,     0.20511816799995095,    -0.12308765966528928,
+    -0.7422110777829337,     -2.311978744242185,     -1.1854991346102983,
+    -0.5007338495333347,     1.125553478594442,      2.753154910386689,
+    0.8567895485492398,      -0.7882589329114236,    -0.4210375202050225,
+    1.0821869973678317,      0.6137905827502084,     0.3909171263749945,
+    0.23809232553354434,     1.1992920077190243,     2.2359448580140033,
+    0.009602401223141729,    0.15877977675500227,    0.504419295957635,
+    -0.46215720670176097,    -2.192628016071932,     0.4937306698021995,
+    -0.7335790801359362,     1.31660311310601,       0.18242778013310376,
+    1.4974242235626711,      -0.8575588837952521,    1.1311908103964154,
+    -1.63163102797135,       0.9376658315988395,     -0.2372459046795907,
+    0.937431622571106,       -0.35811362129496604,   0.6824649303212347,
+    0.5026342333516453,      0.38315502696855025,    0.4426789850524319,
+    1.680435895492572,       -0.5612984855728218,    1.40341216312086,
+    -0.3541183841038174,     1.206949398020405,      2.339720148480521,
+    -0.7983218437998242,     -2.1560328090043934,    0.16372576723074264,
+    -0.691689535119821,      -0.5264807044674746,    -0.32926352845682194,
+    -0.5337884972152811,     1.4310037397396016,     1.125391924310959,
+    1.159102568442908,       2.31213507848428,       -0.7707714920749512,
+    -2.4967814566751074,     2.0235489125550825,     0.2504729178727587,
+    -0.05568346589416148,    -1.802914764115009,     -1.3516955813766447,
+    0.6919029953839423,      -0.1431425718356058,    -2.152870376856211,
+    -0.9404804131972656,     1.049131649273991,      1.2786715113534515,
+    0.21415714680240683,     2.8339969772372413,     1.0267248540137002,
+    1.8102651102140084,      1.3332936479899247,     0.8312383078578685,
+    -1.3392017148152446,     -1.6003595209168955,    -0.7413496518504449,
+    0.25835712948528516,     0.0010809661253421395,  0.3747044468043356,
+    -0.01999789812703508,    0.47776140444601206,    0.9875487946895086,
+    0.007949692567590873,    -0.28798501486449196,   -2.6212937558917324,
+    0.8722167729005428,      -0.7733368759254712,    -0.9091426503738707,
+    0.8676873805849975,      0.918442159332738,      0.6799657912946181,
+    0.9530074213268969,      -1.0940608541768828,    -0.22919750078721615,
+    -0.550009391307525,      1.7298458587664156,     0.8638034563891801,
+    -0.24394154238483173,    0.8414554303793187,     0.3747045701561642,
+    -0.11743702060351117,    0.46688119551192303,    0.8505850773503782,
+    -0.14215180266527364,    -1.2504892701295836,    0.35458260889555515,
+    -0.2640599994170941,     -1.1453511995901673,    -0.7682229469201971,
+    -0.24945817089277006,    0.027164839087782538,   0.5616883530966866,
+    -0.21247725322076708,    0.4499070629879152,     -0.37337180042570683,
+    0.5456598135228957,      0.4030719828054548,     0.5691707628721746,
+    1.4371459168191554,      -0.2828356133845074,    -1.5932602155476132,
+    -0.07787261023389878,    0.8094314246691454,     0.02493910392882621,
+    0.3181152130160935,      -1.7226579397406612,    -0.8341430855210485,
+    0.5387172191133197,      0.7777853308518885,     -0.7504266633918389,
+    0.3670109323956058,      -0.7110065905557449,    -1.152444802337539,
+    0.07100870472410953,     0.2170324002540959,     0.39638887944737794,
+    0.7300450095267309,      1.6771148004404894,     0.948749752790069,
+    -0.3608486842646083,     0.9396888158007097,     -1.4675175308214006,
+    0.10069242813114829,     1.0534784441368312,     0.6791619415204976,
+    0.8282408220613525,      1.9100393763367407,     -0.7407424013052213,
+    0.7947771682135177,      -0.09333763342344513,   1.114666685882962,
+    0.11761946703880416,     0.7820813778012025,     1.5467695081197574,
+    0.6309154946034399,      -0.20981583985195656,   -0.36767699878370436,
+    -0.6940362973301469,     1.0381142357989852,     1.3123159579313566,
+    -0.2443134918817095,     -1.809367909812941,     -0.6335141520043049,
+    0.43398823010776294,     -0.9467825187328601,    -1.9584953295583045,
+    -0.44442682350523266,    -2.040188876682598,     0.32544219758935583,
+    -0.4010744822297138,     0.0602672029971595,     1.2966566562252024,
+    -0.9079357640620496,     -2.147903107808777,     -0.02836240500828142,
+    0.46896294348040163,     -1.42954342343787,      -0.3684583629245182,
+    -0.34719721323299035,    0.02781979150536265,    -0.6154953767706433,
+    2.6634629951046156,      -0.2624466550503729,    0.18652406488799775,
+    -0.4847517419688619,     -2.643106307467044,     1.3809037523000707,
+    -3.1567997145516626,     1.35681852859784,       -1.321427266292238,
+    -1.3589216387267555,     -0.10889934553391577,   2.1959030012287024,
+    0.31960281738771895,     -0.19125851191034623,   -0.7677326066894203,
+    0.6507231233344869,      -0.37009007730262605,   0.7138038497734573,
+    -1.9634769118783888,     0.5284419417404559,     0.31799160785837577,
+    -1.3602238262437496,     -1.0326347492647752,    -0.14737619898910834,
+    -0.4865092436522922,     0.29002619087255,       -1.434678574106994,
+    -0.8845642073878917,     2.1140059231319484,     -0.842376787144116,
+    -0.42610715425421547,    -0.17707603010442233,   -0.2784888638894993,
+    1.2068994188356792,      -0.5721719599394268,    0.8549292871295895,
+    -0.8554523543752003,     0.7730784917563212,     -0.21407796705188714,
+    -0.17476188630450026,    -0.08861898098205116,   0.5502474752349771,
+    -1.193462636449229,      -0.9704506594628253,    2.037225902523249,
+    0.5064916856952604,      -0.3608816214003283,    0.6420887720513995,
+    -0.060137326136421226,   -2.251405131070228,     0.16132999360306263,
+    -0.12187447281888246,    0.34913454379648723,    -0.774727370521462,
+    -0.22045130754377998,    1.1421253369908302,     -0.15084454359530172,
+    -0.42896330605823857,    0.36505345402582906,    -0.3941665427698562,
+    1.0678600932764142,      -0.17450534111294544,   0.36337092481751687,
+    -0.7041268341144429,     -1.2477976842975838,    0.7193080434028587,
+    0.26199345758510206,     0.6374381973303607,     0.7366814854291448,
+    -1.4692612449267708,     0.11978541784311755,    -2.005818396136074,
+    0.519360398201295,       -1.0856288674899002,    0.46730654061812194,
+    0.7259545129938977,      -0.5394658651406258,    -0.02304702649382177,
+    1.2223161674156855,      -1.653897699574569,     0.643633457585459,
+    0.11837662945795459,     0.9481453545022077,     -1.6518911584141045,
+    0.0035365131491128508,   1.1041964270109381,     1.3591642972140703,
+    -0.7692542295051094,     -0.27953618648633116,   1.8414123983672555,
+    -1.4198132856176007,     -0.0457479563526698,    0.17742498342514695,
+    0.17492955402534782,     -0.9342462417020185,    0.9644702982601213,
+    0.8885333066710396,      1.8161388773651226,     -0.7929678754832142,
+    -0.4816940448830427,     1.0965935358701675,     1.8153286494868248,
+    -0.009974156763514281,   -1.528026278505794,     -0.21608072219938515,
+    0.9647140758588989,      0.6781015313735573,     1.1129459718504733,
+    1.9249263357439317,      -0.4313184129440522,    -0.9044386926865237,
+    -1.2027078331039693,     -0.12278223101485262,   1.019078105362384,
+    1.727181856018015,       0.21877109646985998,    0.014732174050744087,
+    -0.1328855980196604,     1.2263875435019738,     -0.7620067379682912,
+    -0.10492876080106253,    -0.07739154245782204,   -0.027160725013466794,
+    1.8082177858996729,      -0.8919718352147691,    2.455272621400682,
+    -0.6553037364580185,     -0.8204885928470205,    -0.6608698660011176,
+    0.6487288310421995,      -0.014081326327965141,  1.1212210293529394,
+    -0.82366503070868,       -1.673216563922596,     -0.37093433514612256,
+    0.2797737800889335,      -1.4697545114408195,    -0.10651206126632945,
+    0.5355813751932504,      -0.8066576774966107,    -0.8239805764596353,
+    -1.0951747594524912,     -0.14345317188879597,   0.45632649224427824,
+    2.74755565068576,        1.1652122447798114,     -1.2617060544388512,
+    -1.5367974643971205,     -0.11027937733269622,   1.5719875037293523,
+    0.6571375941923049,      -0.5273225609356268,    1.0016399388202555,
+    1.3773519486451749,      1.4617404182738218,     -1.0664144097955608,
+    0.43741955628833157,     -1.2811760644751804,    -0.8054628029972019,
+    -1.2786036390549356,     -0.26195256822609736,   -1.4360104709389976,
+    0.7749247005642236,      -0.012323981581817474,  -0.8644620422446895,
+    0.485437953782753,       1.5307463375645818,     0.3453852685538099,
+    -0.5836602384782551,     -0.28385439780768124,   -0.1041196622170162,
+    -0.7015343784541574,     -1.7117290013788435,    -0.37849825836252277,
+    1.2427208700304149,      -0.8272402101543453,    -1.9303354716712686,
+    -0.08878188587790463,    1.1028071881439185,     -1.7224285440314884,
+    0.1900369620517662,      0.41144567066308446,    0.5368563710028604,
+    0.5570952255785192,      0.6081381838275555,     -1.583940719643806,
+    0.6160586071597323,      1.3775135115211978,     -0.22165393650631907,
+    0.3714197495861215,      -1.0144160269766584,    1.3029798690065921,
+    -0.6183808029464856,     1.6494837224499648,     -0.37994250608081526,
+    0.6777653694968907,      -0.5334184261492718,    1.8777528522227958,
+    -1.9721345401044175,     0.36931847753595676,    -2.0794469459231593,
+    -1.2047763259792028,     1.8919934715405313,     0.9080211524509249,
+    -2.010540974246311,      -0.006030499821496372,  -0.6196689206822431,
+    0.5697964366307742,      1.8504072925141744,     0.653894022312109,
+    0.4346525683709604,      0.5080412009924169,     -1.0925099398822262,
+    0.7011348546655312,      0.9210958788171844,     -0.6123562151173819,
+    -0.6424836977929856,     1.4499804568915609,     0.2091231701259613,
+    -1.1373179661576496,     -0.42408508185318294,   -0.4575182945069182,
+    -0.06451367271947332,    -0.07271365784487632,   -0.24927638948530137,
+    1.6739363208118128,      0.8322807776421753,     1.4829899935884496,
+    -1.694652476973414,      0.11114014849078561,    1.1747767732583583,
+    0.7254120145624685,      -0.679347844232499,     -0.7559639307548784,
+    0.9600188215540831,      -0.21251425432007376,   0.6483017489562967,
+    0.15661452306113938,     -0.11763897623177069,   0.1204796811963724,
+    -0.8296021411243787,     1.7011830057099797,     0.548179876736301,
+    1.3993376460635458,      -0.5291969164119259,    -0.5405357428386488,
+    -0.31924380263444796,    -0.8615909953626328,    0.6781532742677586,
+    0.7125067068177863,      -0.5131339606667499,    -0.31966432622335983,
+    0.3766022374695034,      -0.752589402297283,     -0.4093281656782779,
+    1.5604875246677288,      -0.7465763080467568,    -0.5168223019064929,
+    2.5047301331045295,      -2.126371995695057,     -1.1843745762782687,
+    1.797302378731623,       -0.4095479481588541,    0.49982994681782444,
+    2.1196571417648,         -0.7170369042082716,    -0.5915064877377698,
+    0.4107863995127024,      -0.0758229727864078,    -0.5249274558529544,
+    -0.13332373199479805,    -1.3281277104319433,    0.46572374205176453,
+    0.834494273969907,       -0.16145128235233253,   -0.22381273999975942,
+    0.5487833437109312,      -0.5382366333556717,    -0.3081306344779737,
+    -0.06833369112227931,    1.472011586594601,      -0.04922043333441095,
+    -0.11372768301674817,    -0.16414777201844993,   -0.38379450495170137,
+    -0.9649187430136589,     -0.9191133044450214,    0.8603511847100213,
+    -0.5691050138505575,     0.09235143758846519,    -0.47626937845098427,
+    -1.3279140236060163,     -0.46475207795866114,   1.396939691015902,
+    -0.41458170058650856,    -0.6763733437904639,    -0.42787745111422565,
+    -0.33463571621299515,    0.2285094263697557,     -0.41164902923638175,
+    -0.09759741730442287,    -0.4909168921566732,    0.35750098597904,
+    0.3112588812186786,      0.21168425743480482,    0.6331275079038285,
+    -0.09924944713686785,    1.2129467538699892,     0.46619238222929277,
+    1.4878354031338807,      -0.07971139539727902,   0.272125626223688,
+    -0.6821810174080184,     0.015627414580563683,   0.8180278174359783,
+    -0.36549729770880623,    1.492175758121735,      0.025672962692859534,
+    1.5831764531487669,      -1.048803143799867,     -0.2768620126538758,
+    -0.49636008988925684,    1.0106316239948958,     0.6421029799468787,
+    -0.07641423501352233,    -0.45579785447728327,   -0.026837296607139842,
+    0.7245862901370012,      0.8357407678535691,     -0.05961730695308698,
+    -0.44707796199944105,    0.10206732619572532,    0.129271592874518,
+    0.2525389651693497,      -0.45349476024282315,   1.7404721726262156,
+    -0.6287931135223388,     1.5124710442741982,     1.3936636292439448,
+    0.9471132433017249,      1.874063479875216,      0.5558370761159371,
+    -0.3166859919961749,     -0.5230716211077664,    -0.6710768037897918,
+    0.8373452603514405,      -1.4806025629133077,    -1.4223555979587112,
+    1.5324765469753387,      1.0128812955963147,     0.4143308905434556,
+    0.9233496388911722,      0.7742930512772597,     -0.18686958815362442,
+    -1.4686370158236446,     1.2830899284853374,     0.4461955659157436,
+    -1.3762169463620204,     0.14229627265673728,    -0.4687215495734493,
+    -0.11536063207555654,    -0.32797072187167814,   0.5512086099290069,
+    -0.20841504417478704,    -1.15495361435408,      0.673009476057394,
+    0.48580061260448343,     -1.4257799842843486,    0.4091299354990213,
+    0.8876263408465551,      -0.15249854600906665,   0.18767880217331948,
+    -0.7643298389552741,     -1.7500719822018675,    0.521830694083875,
+    -0.08788591333173883,    0.4296026504108136,     -0.23477902397946507,
+    -0.26035643862238556,    0.16229517153971734,    -0.06332116258533428,
+    0.8662791524984179,      -0.42388936164345803,   -1.4443973969562847,
+    0.14411300568369675,     -1.3032032817404988,    -2.5339746109444654,
+    -1.0967798415387184,     -0.438588503669468,     -0.7959447594743115,
+    -1.536669032591709,      -0.22464534988574142,   1.2164658574705836,
+    0.8294176477030218,      0.008235958145634596,   0.9211200124459832,
+    -0.44039333671903036,    -0.8819968975924777,    0.6784598928382939,
+    -1.0835779651805897,     0.3340113933550268,     -0.025671544129249647,
+    -0.3627473602318144,     -0.4580597086552385,    1.1372189175712981,
+    -1.5893642454708337,     0.2689974063302714,     -0.28856911118723605,
+    -0.7414211692725878,     0.03894361629338873,    0.3158033123766863,
+    -0.05994446897820392,    0.24503778951177846,    1.4148406061093084,
+    -0.6008967863441754,     0.4179496888976785,     -1.738597584714335,
+    0.45695413307425936,     -1.8669404188323744,    0.6313619321795754,
+    -0.47517477962558596,    0.164130608050496,      -1.4554844273104695,
+    0.02402311890492607,     0.8240130209951826,     0.619847608474694,
+    -0.017250079253558846,   -0.00647259832074705,   1.1454375998352104,
+    0.7359903197100693,      -0.6247620235940049,    -0.579829854456699,
+    -0.6798662566185744,     -0.03564915788753483,   -1.1606685651242366,
+    -2.158371820574295,      -0.21830723570232366,   0.25288199157949504,
+    0.18642526296284181,     1.0849902561320768,     -1.2925036060036283,
+    -0.513155963312859,      -1.4424259508004578,    0.2458297020685367,
+    -0.10458292495592605,    -0.48082408105476865,   0.04144199730122672,
+    -0.7068875919643376,     -1.0220288547792789,    1.5805078673686117,
+    0.8103454298106161,      -0.1841635837528684,    -1.5414429532776193,
+    -0.2142941049409418,     0.5742511706942518,     0.16988423225674995,
+    1.0091431287075248,      1.2268782723372451,     -0.08454828726930437,
+    -0.4680841498568326,     -0.4943932194075188,    -0.4134741939849761,
+    0.9045496358953858,      -0.42414844863306683,   -1.680778526867122,
+    0.46496627239639104,     -0.09893215203023165,   -0.4671889989677235,
+    -1.9635077905685554,     1.1700525102330113,     0.6963505808669911,
+    -1.136882151183256,      0.15177359326020887,    -1.0837317556298667,
+    -1.3606030294382685,     -2.098704465475091,     0.7793342157674334,
+    0.8799162400053264,      -0.30983996980849293,   -0.05984057414779742,
+    1.7549348178922355,      -0.7553956427671997,    -1.1847528511101797,
+    0.12754416118536918,     0.5494994004588707,     -0.29688479017516534,
+    -1.4260853434123049,     -0.7672123271650815,    0.6850057269036804,
+    0.7147527812107975,      -1.6706897366880646,    -1.222606365129559,
+    -0.9851505838387216,     -0.02544681786311449,   2.2068182937388507,
+    -0.2858216528469563,     0.06210504287753598,    -0.7971452335291748,
+    2.5853149206365784,      -0.6019225571921712,    -0.5117483296685542,
+    0.15621836365290645,     -1.3243643331087183,    0.8087644630893838,
+    -0.008329966251811581,   -0.8427203445479392,    -0.5958081935727496,
+    -1.8940358337058851,     -0.5555548437408795,    -2.2746238053764434,
+    -0.4504637213600171,     -0.4955738897494539,    -0.5889803802701736,
+    -0.5828514199280939,     -0.8419790361351315,    1.2340318801276897,
+    1.4392314761364178,      -0.16956035102028588,   1.1436727341242692,
+    -0.3064991788044607,     -0.30243260760374896,   -0.8287797551950773,
+    0.6974673309406298,      0.6180635731505781,     -1.29047188977619,
+    0.159978100377155,       -0.5170244092072149,    -0.9019213838860642,
+    -0.025697109886180118,   -1.9188394155036888,    -0.4339397052005301,
+    1.8895160123114296,      0.43567332808138287,    -1.1355767320625723,
+    0.5533708418242482,      0.08861554772751325,    -0.32081114656212056,
+    -0.5857673334261941,     0.0006886661821822572,  -0.5923973922670087,
+    -0.17319805423994253,    0.7395019665948146,     0.8157143067264816,
+    -1.296463483434427,      -0.4683899324898591,    1.6069100296472492,
+    1.7965441777894895,      0.36976770660302233,    1.609574085417946,
+    1.2081862491481128,      -0.1319885934504899,    -1.9962948235609281,
+    -0.061170991708729285,   -1.2821867291105606,    0.13637470533209314,
+    1.7461964093047098,      0.24870488232202564,    -0.7851661344564748,
+    -1.169333857341222,      -1.9629530857284998,    -1.906023810085262,
+    1.6267665840627947,      0.8559578500221732,     -0.13103836255095874,
+    -0.15296789225128504,    -0.051969836466323666,  -0.011731029921388176,
+    1.3921167031633643,      0.39012349753698694,    -1.9824386357114223,
+    1.060664365021477,       -1.9298157216848861,    -0.40619361881257177,
+    -1.3860618031911651,     0.04035879611773523,    -1.2571392207123036,
+    -1.3777889180178122,     -1.046530842979556,     0.8138118808143006,
+    -0.18572514693691386,    0.667189291574244,      1.360299327924181,
+    0.2383439174223783,      0.5701027983438592,     -0.9694861609381911,
+    -0.08456103316221873,    -1.1488442532096645,    0.5538200281084924,
+    0.9062202564187337,      0.965835314665828,      -0.028231735939146834,
+    0.8954545072989913,      -0.14533170030523887,   -0.5614767725687608,
+    0.5020551631398291,      0.7259586452035081,     2.2036619446684487,
+    0.7291311102093274,      -1.100936537647294,     -0.9781144990724038,
+    -1.3017079198759678,     0.07737357420260266,    -1.0996848263470809,
+    1.3623282412713797,      -0.2915076847194388,    0.6417543099803461,
+    0.15169401199408278,     0.3438205640147206,     -1.0365093602620574,
+    -0.033488590853363566,   -0.42736780090926196,   -0.10128495376261085,
+    0.12468888980519757,     0.6814734627946344,     -0.4655572292083547,
+    0.8236051414158116,      0.3292336957671092,     1.6387657126010564,
+    -3.3125957472915193,     -0.642679611190922,     1.2585766212049312,
+    -2.5212472442065854,     1.4846360078381304,     0.08220688169659991,
+    -2.0422296484971234,     0.7255907657684028,     -1.0525735710876505,
+    -0.9128100132501272,     1.4646461330920473,     -0.3868981580320537,
+    -0.9593544408447006,     2.0079611204929293,     0.9290749642925953,
+    -0.33456887481216974,    -0.7894822997939344,    -0.20395986994108417,
+    1.5772921846886596,      -0.9825063042945066,    -1.2738781924253824,
+    1.274550031697449,       -0.28212216187025774,   0.10045650249750124,
+    0.5248785230643929,      -0.39007392404570945,   -2.424081486413366,
+    -0.21216883799585629,    1.2410461470317984,     2.1724479654200124,
+    -0.11786940799982205,    -0.02867013526906138,   1.3654656748552527,
+    0.5957019719428258,      0.29541651604397196,    -1.9791316661875356,
+    -0.41635037215618775,    0.21475272736774925,    -1.514042357941066,
+    -0.36604812191678526,    1.7085146137502967,     -0.2571499678369111,
+    -1.4343606843082715,     -1.8871014115344522,    -0.011287561937809798,
+    -0.5777233924075198,     -0.8685169077615835,    0.22750956916178425,
+    0.28480515520512145,     0.17458026754262473,    0.3504901803518562,
+    -1.2289949076875741,     -0.6405019031805433,    -0.32616090566015704,
+    -0.05382316522092632,    0.9895734487758668,     -0.7281924330126566,
+    -0.7775706003748463,     1.4873841930289455,     0.1584500635086561,
+    -1.3980410419753422,     -0.310971939724135,     -1.2361892678092892,
+    -1.1369640494309825,     -1.334262463014373,     -0.7959762300838742,
+    2.059716954775251,       1.010480687434103,      1.3816706144928017,
+    1.087611029579423,       -0.13488092512250469,   0.403438191199377,
+    0.10281990531468883,     -1.0680743252156402,    -1.1624316262974201,
+    0.9003501977073616,      -1.2183943022256247,    0.2009269569054152,
+    0.6521022919661779,      0.7527364796777338,     0.3692648962503571,
+    -1.2007273512002243,     0.5403972642139142,     -0.13826460026872545,
+    -0.9775512280816644,     -1.9887538090141748,    0.4512076990700644,
+    -1.5524436748283856,     -1.707328302563486,     1.7479165859844292,
+    -1.20137172331777,       -0.4199779329481971,    0.07179382705895353,
+    0.07021900726212328,     -1.0193077831084225,    -0.7083254888588681,
+    0.8056534796188886,      -0.27878444148672443,   -0.023146919692301732,
+    -2.162602633982621,      -0.5736970133315598,    0.857412278841173,
+    -0.729202694811036,      -0.9515301368914773,    0.37490347520154604,
+    0.5986581314532009,      0.33374024806043634,    -0.5663657395974352,
+    0.7496254220416524,      1.6289692978603219,     1.1699653909980003,
+    -1.5633329910245188,     2.9294949683414666,     -1.3256024235928083,
+    -1.2259156541526515,     0.3043946992060357,     -0.09436019940510461,
+    0.3613503497492989,      1.3116421091286004,     0.9305124642046985,
+    -0.8934781182111482,     0.07206729101725728,    1.0112082017425184,
+    1.0529119122514135,      1.124453891104806,      0.8174500476465054,
+    0.7079021166319962,      -0.5135155148527494,    -1.3181777326083213,
+    0.4223946077568961,      -0.4540284443389545,    1.2445141063552017,
+    -0.8725598870302891,     -0.3811888791615553,    -0.42809893143447153,
+    0.9669741307656176,      0.7514450445015763,     0.022820593341801584,
+    0.29201843003524386,     1.6147629263523806,     -1.7626628404610827,
+    0.7480366611945588,      1.0799757318110055,     1.2142742248358371,
+    0.8025006830940107,      -0.7739136870061023,    -0.539040170646118,
+    0.6621787597881278,      -0.5892980379829562,    -0.198341968473613,
+    -1.5052493657311397,     -1.1924454879421558,    0.3466583626995494,
+    -0.42600192461859676,    -0.7587492143269661,    -0.18780648827418012,
+    0.3013909202296766,      -0.26124891916591364,   0.172578451656906,
+    0.08848009776143743,     -0.2515023180785273,    -0.01135112159165719,
+    -0.8872669971413588,     -0.5015945230034489,    -1.8370719108707187,
+    -1.1664293093777658,     -1.1870512391330497,    -0.39888359358155834,
+    1.1303230476566384,      -0.009032730430251398,  0.15046595058321519,
+    -0.9424439420152598,     0.2871115650217511,     1.695776285535388,
+    -0.08724108006679325,    -0.8247339752431493,    -1.165874713678587,
+    0.26290348151063603,     -0.941307831089716,     0.7133875872310563,
+    -1.0123170274546165,     -1.6561173933233344,    0.4799527084489307,
+    -1.2937030696500185,     0.6061345880109306,     1.0374279356896314,
+    -0.5928129331102888,     0.20830475859708086,    1.3921580774044597,
+    -0.4648301290298568,     1.5984539368254864,     -0.3285573723715871,
+    -0.9377094081391769,     0.09754418185088443,    0.22512696298410884,
+    1.134364045966532,       0.886414597207252,      0.36952377767517425,
+    0.6561837645872346,      0.1808791419483338,     0.7921058099819703,
+    -0.5187069821388236,     -1.081265418462433,     0.20855706694650492,
+    2.6891567255954367,      0.8076802664218423,     -0.7000159404771632,
+    1.393911062628084,       -1.8644876781071298,    -0.2518979437594075,
+    0.39742234005375116,     -0.6732370756294072,    -0.5941866236094229,
+    -0.16999899921783154,    -0.5425016793958625,    -0.7841475883796026,
+    -1.0842211549608542,     -1.560057006382489,     -0.9664115673200809,
+    -0.10155080937546203,    1.0063712137696832,     -0.6633962653832323,
+    -1.2116934213498078,     1.605446695916347,      -1.1432573969068665,
+    0.09459228216510641,     -0.9363788807043509,    -0.7189230987899983,
+    0.3865650485993175,      0.46115742410503735,    1.27101182012592,
+    0.6687615544105718,      0.15403212556710655,    0.6245721870133841,
+    -1.030242417928788,      1.210519619951666,      0.5326658716861924,
+    0.4897921650738416,      0.5985077639597968,     -1.4797117209533097,
+    -1.1339312639885144,     0.13228357906416394,    0.1449368176982603,
+    0.575038765586739,       0.10657727663750632,    -0.18451247526568362,
+    1.2577850231333834,      0.34957031901753494,    0.7466601650963447,
+    1.1952073026365186,      1.2639606373823074,     0.31768927843313227,
+    0.725778161938027,       0.26600396285299693,    1.0725233192737318,
+    2.280624197831893,       -1.0448944450547253,    -0.7527344813629196,
+    1.5836842945513663,      0.1861301776552701,     -0.4299030807300232,
+    -0.6941258928884679,     0.9374295282696908,     0.5603615887413218,
+    2.007747028142317,       -0.09119596057864222,   0.9015786447267636,
+    1.653889827394813,       -1.43391633196515,      -1.053390905470065,
+    0.2714232325469167,      -0.5725662288212182,    -0.4214828526616138,
+    -0.6609220588458988,     -0.14792234526379885,   -0.9040249248536079,
+    -1.279743734790053,      0.3851773614615998,     0.12482385276635362,
+    0.9788705992907167,      0.5219489986938624,     0.4239532442026558,
+    0.7528909524248748,      -0.9148574456341003,    -0.49845324459957757,
+    0.2748636075835232,      0.9348768566453561,     0.6465548874758841,
+    -0.21197769676261435,    -0.1862881973862686,    0.24986205966479497,
+    -1.1563843120293331,     0.848561437151079,      0.7722914143210239,
+    0.9290418140261983,      0.9934344080008723,     0.9978870193450139,
+    -1.8840571412882436,     0.22527497826562073,    -1.4298636855420406,
+    -0.9526972023845158,     -0.13280652701173848,   1.1830476029110701,
+    0.3311539214535722,      0.23143491541344122,    1.7856228494340456,
+    0.24102248365210305,     -0.9497222985691244,    -1.3938765205529655,
+    -0.8729305783206557,     0.11189786283754871,    -1.5406475046921209,
+    0.43824105475878034,     0.3088941130328234,     -0.7200167574986956,
+    0.10413001221469308,     0.5164843788888039,     -0.6319388778257431,
+    0.7328036915543703,      -0.7167161538537666,    0.5875171560298043,
+    1.4576387799469404,      0.32205016351886856,    -1.273468767822946,
+    0.08871208474442308,     0.08105723209561866,    -0.8612118000996496,
+    -1.2594934296509144,     -0.381626452225253,     0.8683554324554691,
+    0.817885987366341,       1.1998885103892343,     -0.044850314255937634,
+    1.96461530315232,        -0.8461520942675396,    0.4408138688666812,
+    -0.24160270313967927,    1.491404017758251,      0.032252162134317135,
+    -1.0320844142539014,     0.24184317583991238,    -1.121997673466952,
+    -0.8722478491979083,     0.9263624151579788,     -0.020311835047454565,
+    0.8555916354174716,      -0.8736486871543374,    1.2967859905769892,
+    -0.17532149721700788,    -1.9573682811842892,    -0.8957104086173412,
+    -1.397455240066104,      -1.4638153685209871,    0.510494907609462,
+    0.365658251284937,       0.5908105540703554,     -0.7372845612280085,
+    0.5317087153928419,      -1.4680741632277372,    -0.4828893968459641,
+    -0.15875902842433887,    -0.5703159494047967,    0.10046007980163459,
+    -0.02274047566330555,    0.47111739739782504,    0.3035200759728224,
+    0.9552814687328702,      -0.4802425524028714,    0.6515158503085438,
+    0.27747804021232964,     0.24308932936671582,    0.13371853662724661,
+    -2.1564791835071166,     1.9174833858302434,     -0.915316484483997,
+    -0.7964472622083916,     -0.3222985721877867,    -1.3100029276245437,
+    1.7458840481961508,      -0.6197006182438103,    -0.6838153166286255,
+    -0.8296780782032334,     0.43703919592522805,    1.3958407618742477,
+    0.27275027382246286,     -0.77419000353817,      1.3227806992449869,
+    0.283564312656144,       -0.7224181907629346,    -0.07201660361396557,
+    0.13133848778812976,     0.237075951205877,      0.0016169010932160824,
+    0.02391676987028547,     1.8628067553674579,     2.8337084584814525,
+    0.17301458161797997,     -0.917212404055666,     -1.0502305789490147,
+    0.813130770785458,       -1.6240637597082928,    -0.18180551015583393,
+    0.39494439215756916,     0.1816723464263562,     -0.4046574259757708,
+    1.8377706423295326,      0.7962541592272341,     -0.470842799571361,
+    0.7832585853049281,      -0.1839487726311758,    -0.5162588650166396,
+    -0.40758249553373227,    1.1825206659026775,     -0.5590511483772289,
+    -0.07130526118485103,    1.0200448138176716,     0.30411034895510863,
+    0.2404079743196821,      -0.6653093837899265,    2.330852597542875,
+    0.8182958964744049,      -2.3685499808754398,    1.3041841798030738,
+    -1.2860690114616444,     -1.3720355020090929,    -0.6979350436264475,
+    1.2578569011127516,      -0.2724187495752431,    0.21062129577401384,
+    -1.6700076315990524,     1.075498317321793,      -0.2672360623300756,
+    -1.289289607711727,      0.3248195579579196,     0.4898720738623198,
+    0.08502289638377544,     1.291422787153203,      0.5836298729087983,
+    1.5022201805642375,      -0.054787455741442705,  0.10955656397318725,
+    0.8641786809602411,      1.1586490941047456,     -0.333103061335895,
+    1.8858379487306038,      0.11535432068166136,    0.004837358754509711,
+    0.44184052777626065,     -0.8557143294873891,    -1.6460032278876175,
+    2.0557647091169384,      1.0642590504533467,     -0.9239512426058418,
+    0.13709702434434398,     0.6235260960792973,     -0.48796126475046675,
+    1.433122938367365,       -0.4945126830914104,    0.9923981627337422,
+    -0.6304297019654619,     0.5071727391778746,     1.5498605005735553,
+    0.4744282405673355,      -0.4880816866059326,    0.22166656001108476,
+    0.7248558958840421,      -0.42805287594151126,   -0.39492505992504506,
+    1.7620082971004747,      1.396958419813615,      -0.6632619985501733,
+    -1.3183120225140688,     -1.2834217646123125,    -1.1147852672992768,
+    -0.283956443630757,      -0.07571750599015233,   -1.3837570433040536,
+    0.15459822772213677,     -2.9032093721075425,    0.13983022760035538,
+    1.6078242214039977,      -1.2151094879578561,    -2.8796785415210566,
+    0.16654919725316253,     0.7006742734355291,     -0.4084170094478251,
+    0.22873349870284176,     1.2910711712931706,     1.689368350917812,
+    0.5980157780075127,      -1.2360006120896183,    0.1694159081918005,
+    -1.0002872120191049,     -0.01555793757899074,   -0.2413931241097132,
+    -0.5709546679504626,     1.5311575378849764,     -0.2276695628191544,
+    -1.48095418636695,       0.37954433638018936,    0.6861081050479167,
+    0.05104916037169898,     -0.7748612136337377,    -0.43239812418894336,
+    -0.5888145577373266,     -0.5046771576403359,    -0.7017837728373448,
+    -0.22104030366688782,    -1.3558016685259913,    0.24677395762008406,
+    -0.7823601120622704,     0.8770935663572036,     0.3812512028450342,
+    1.505772102945165,       -1.364283479731616,     1.411205104097461,
+    -0.11657000448495672,    0.6189048035944547,     0.8897528592807286,
+    0.961185500617246,       0.06158995252081894,    0.4545748182245695,
+    -0.09168582036331764,    0.7276391525817649,     -0.8917747551471092,
+    0.40455041723361107,     1.5393969264463359,     2.006452646179779,
+    1.0680905035549397,      1.4613558368934714,     0.5236074733470238,
+    1.0538128515306049,      1.9450394660563106,     -0.054253861841632875,
+    -1.5877441809877018,     -0.17031186445017096,   0.18598047273207738,
+    -0.8239288909365862,     -1.1978567133328493,    -0.49298347609708065,
+    -1.2300081741902582,     0.9126627466896129,     1.7046769834826283,
+    0.6753801178114957,      -1.39458956322296,      0.20707447317699473,
+    -0.8582831171666704,     0.27973892691053964,    -0.823140603973371,
+    0.9828490986805895,      0.7023241629745979,     -0.320599945190684,
+    0.5044671510107833,      0.06319882454439071,    1.7274289632494741,
+    -1.9015715724136582,     0.41289288732625984,    1.2430065691460797,
+    -0.3667905192228442,     -0.499090010583284,     0.1773007622271467,
+    -0.9197350141240535,     -0.5365844685294664,    -1.0241883770822167,
+    -0.17752805710493394,    -2.0919756242207015,    -0.6027744209364638,
+    0.558457491434279,       -0.37854145486581,      -0.4118971403611574,
+    0.8989659601306448,      1.5777945897788646,     -0.7372288382827994,
+    1.2049453710030325,      -1.7504903518717316,    -0.8458253750186462,
+    0.5357953607937388,      0.2576751223060831,     0.1191095293009187,
+    0.8648567805931103,      -0.2027198612055006,    0.7625045260107743,
+    -0.4889803009625133,     -0.6274887546504008,    -1.8749036459804767,
+    0.6763593436242352,      -0.8678178838550978,    1.0075311530198392,
+    1.0096856843892856,      -0.22219015053759483,   0.08725148714624033,
+    0.19781654867539608,     -0.20504275975885145,   -1.458598524990718,
+    1.4457445642459437,      -0.5678202693150476,    0.5294697824079188,
+    0.29135899644063606,     0.28966025563244063,    0.21893606346316366,
+    0.9120829566517927,      -0.8707301650691583,    0.9920722655575377,
+    0.16586233170522272,     0.039228577532490254,   -0.41509599341076636,
+    -0.04540601684640764,    0.5791589417809767,     -1.1719504982784887,
+    -1.720578970255799,      -0.2747716554660151,    0.7020926500534933,
+    -0.29904405503468395,    1.3711833486438207,     1.2960253742017096,
+    1.4025115636713923,      1.4522904026736154,     0.26355057368037543,
+    0.5669459043936601,      -0.6820953749120031,    -2.6855056829188757,
+    0.4053915577452256,      -0.7717368376527842,    -0.20117051614722412,
+    -2.485408450959582,      0.8975385177474403,     -0.20174919159248747,
+    -0.590749068837105,      -1.1549224834996235,    -0.8126062508178606,
+    -0.8468996600455448,     -0.9710385556289517,    -1.4130338793151611,
+    -0.20980616334738375,    -0.33813898710054396,   0.8593799269414478,
+    -1.7515028677853095,     -0.44581848253957634,   -0.8913511719829851,
+    0.3409139584900146,      -0.05238267915048745,   0.8490232119938326,
+    1.8381805730786318,      0.0010665667361786976,  0.5299956370333662,
+    -0.7496284236416308,     -0.1268302048957909,    0.02485720438383026,
+    2.138860903142798,       -1.1395604786303093,    -0.1340551059157379,
+    0.019451051604810383,    -0.7543299213267128,    0.35244388404476484,
+    0.014173666831190947,    0.1195300320172183,     -0.7221757229114752,
+    0.7345887860494619,      -0.9304522642937739,    -0.3721462375843068,
+    0.8473565193784999,      1.3978862086969388,     -0.7502306191673346,
+    0.6228451182059807,      -0.08533425247548856,   1.043987246844516,
+    0.11146119522911471,     1.6970534389174456,     1.5326117833450599,
+    -0.9732410418287788,     -0.3267867506012752,    -0.75050129473242,
+    -0.08081519160931815,    -1.8172589070708716,    -1.6736840936255635,
+    1.0198018711502475,      0.34073996286791314,    0.7534833895844514,
+    -0.9046809345124541,     -1.051097316071011,     -0.19356505852191427,
+    1.3828401831413721,      0.07540763834512061,    0.18299071016120166,
+    1.1777762992089094,      0.3796747904138769,     0.18196881674431112,
+    0.42739556619511804,     -0.19068628100371987,   1.5733869344891815,
+    -0.1043609703871633,     -0.7205218010630187,    0.6816046598400958,
+    0.9466737305151883,      -0.4717537179797124,    0.7239828201123549,
+    1.0765371658911091,      -3.351724947452281,     -1.7246752954944602,
+    0.4005066361822987,      -0.9305577360402544,    1.6864319166145834,
+    0.32406145816158144,     -0.10160529905974032,   0.06176513359924085,
+    -0.3798769684965894,     -0.6418871849583245,    0.12183313155728566,
+    1.0029205933591536,      -1.547071610341366,     0.24078509438834841,
+    -0.4496135447256289,     0.08608686625097926,    -0.7517899108642881,
+    0.14384133049313852,     -1.07217046733088,      -0.020290433003534697,
+    -0.2603028153617622,     -1.6652573855544825,    0.41826926161967287,
+    -2.8118572873806444,     -0.37568553221520545,   -1.4905871717882186,
+    0.25700841736042945,     -0.3360495340839838,    0.8169610783421904,
+    -0.2021067252961349,     -0.21296958478824618,   1.1205997460966157,
+    -0.4648200456946356,     -0.029691250010778516,  1.4262593116946818,
+    0.66190560399438,        1.9828850533782254,     0.4590622116146859,
+    -0.5296427791742504,     1.0740502538587908,     0.9223377239011725,
+    -0.2731209209472837,     0.5401051979284671,     -0.08241999160257564,
+    0.4980737543016475,      0.03261112172290219,    -0.12990937907692926,
+    1.6887749782267554,      0.4562234338562475,     -1.3305243434849185,
+    0.20841535497305236,     -0.2991630229288727,    0.31301773161125396,
+    0.23992777418384026,     0.36624954799450277,    -1.6984047064843328,
+    -1.567909672182415,      1.4005908322616225,     -0.026640425653040912,
+    1.3381007283894868,      0.5276058225942508,     -0.5330983762272866,
+    -1.688524452858312,      0.5119477692799878,     0.5172989430392664,
+    1.7511801463731236,      -0.2025176101448277,    0.07613167862657853,
+    -1.8080683499650345,     -0.6068676862026446,    0.24594478006388967,
+    -0.35079642293973845,    -0.8739551971383827,    1.4177531440561766,
+    1.6026803366905416,      -1.0681489983692147,    0.09892432410214622,
+    -0.4284938954098787,     1.484818939800811,      0.23745432287524232,
+    0.597281958695183,       -0.9350349308272665,    1.3274982457786433,
+    -0.29895241691926205,    1.862922989671676,      1.0924556048966734,
+    -0.6509592896238032,     0.5269190269992935,     0.24342133489496773,
+    -0.22129928797527612,    0.7498729464755881,     -0.02547220961388136,
+    0.02813080852137866,     -0.6315415213167213,    -0.744408508052111,
+    0.07660944629546644,     0.1786772919304125,     1.0758744969332517,
+    -1.354570209823389,      0.1124849473200512,     1.593881949851953,
+    -0.6780355582313897,     -1.0434527474430422,    -0.9265795619489678,
+    0.7914659390195384,      -1.2661632675663712,    0.019499296578472564,
+    -0.6691900871902942,     -0.5754749536203302,    -0.30629527450471256,
+    -0.37455854979569797,    -0.36756212644246805,   -0.05396352086906558,
+    0.26894939210524715,     -0.4535101966530851,    0.470606290177994,
+    -0.4796052120306986,     -0.4540935828577141,    0.041858787186930285,
+    -1.716229851629171,      -0.8209682709605263,    -0.6679894433651369,
+    -1.022806147752734,      -0.23156859299136665,   -0.7332388702368212,
+    -0.9112094390294475,     1.0160072349436597,     2.082462388128148,
+    0.993936218482339,       0.29810890213160446,    1.123983793562011,
+    0.3141824369976697,      -0.2606889148953744,    0.11151401071747408,
+    -0.33586567297692993,    -2.2048168849951226,    -0.8413716061212286,
+    -0.829006710017962,      0.48359519570697057,    -0.4810246355798725,
+    -1.7997513095213626,     -0.02858275566612428,   0.2866848655460903,
+    0.7693002870244459,      0.36429938186052035,    2.390590762304574,
+    -0.8673995764562495,     1.3171697853027307,     0.9210227634526568,
+    -0.635376182283391,      -0.12809098277846248,   -0.7461328814766642,
+    -0.12391124274672698,    -0.4430605759816179,    -0.4448740710277248,
+    -0.005243284288945138,   -1.0358043169594735,    1.1245388699055014,
+    0.8781153754803712,      -0.6952764881743871,    0.8626876270603471,
+    -1.0514006839892116,     -1.784016068960184,     0.31489465307967657,
+    0.5465442673336901,      -0.7393451122290028,    0.5261911270341959,
+    1.9604846599627415,      3.012376933255444,      -0.8729425549725268,
+    0.32665110361545674,     -1.2285683479975946,    2.8314852742466323,
+    -0.43583563536604186,    0.8599909597773101,     0.09445876529117561,
+    -1.057061898006422,      -0.20683561887197754,   -1.3536306918281464,
+    -0.6399438661090054,     -0.26811559028636794,   0.22494526108052643,
+    -2.2717294797478003,     -0.06560791487122482,   2.5529962215720543,
+    -0.9517334874412265,     0.32585261453072206,    -0.4231539997977312,
+    -2.822217225795356,      -0.9954167677957759,    -0.683481914221545,
+    0.8469876578256735,      -0.035079876368082775,  -0.2203067584915251,
+    0.6732244887757094,      0.12913785493253227,    -0.16493645206447616,
+    0.6682183943610241,      -1.3762409831908937,    -0.20624128895150953,
+    1.2533264664103798,      -2.1401295818133264,    -0.7906522003097647,
+    0.15631529797015334,     0.22912666083484437,    -0.3363267824513846,
+    0.42992048216847145,     -0.8865498241007644,    0.9794499719747619,
+    0.19469567734289125,     1.8151847977026612,     0.8465966075564614,
+    0.5515913701030694,      1.4160989919595208,     -0.8032323691853165,
+    -0.293227135861464,      -1.7501900964106074,    0.8704872260199449,
+    1.6541665030120587,      -0.48548738539058667,   -1.2171452109914107,
+    1.1248369487772936,      -0.7373061300903289,    -0.5044246784427611,
+    1.539505788642072,       -0.35873899736556486,   -0.1864464448715057,
+    1.611851915163453,       0.5908806219791308,     -1.0640318650498968,
+    1.5052985340805691,      -1.741355183254899,     1.0074876363213765,
+    0.4901821903215571,      -0.5233961590580599,    -0.7788982922154702,
+    -1.1124029498247225,     1.7290001121601946,     0.12443302756755235,
+    -0.6306218254508992,     0.5739161501217803,     1.204611127829525,
+    0.3188480968446466,      0.6969836087199982,     0.9540114240191833,
+    0.05875098437150642,     0.3165905173689822,     -0.11537527102984238,
+    -0.9923482674781495,     -1.267016535436748,     0.4506200458898788,
+    -0.708402614064011,      -0.021056635339765203,  -0.24771713418641333,
+    0.9702840458355168,      0.279963343667367,      0.3064706591238982,
+    -0.28651580328025933,    -0.13800539480817092,   -0.33990260104102926,
+    0.2496022974153477,      -1.72409501428731,      -0.019750326024755235,
+    0.36755670760768033,     0.3932617714941952,     -1.0774914795686203,
+    -0.4211067727282637,     -0.3807749658466138,    -0.539971736436136,
+    -1.2168655994764466,     -1.0864322495877135,    0.009094493674724556,
+    0.38548313318803773,     0.14799307417079596,    -0.8714829351817768,
+    0.384983468891442,       -0.1987923608798469,    -0.49552822753152054,
+    -0.9252851005984823,     -0.5093556343616868,    0.7169760349502766,
+    -0.18397272263039247,    -0.1231393520982019,    -1.0010273210431833,
+    2.7904216881875383,      -2.264949596839835,     -2.0279142638442043,
+    -0.5248401949817776,     0.19941381256788718,    1.7735326114487593,
+    0.513779510118961,       0.30082237440516707,    0.9196429969689821,
+    0.09507839919159553,     -1.9550956868684606,    0.2548410408273828,
+    0.21729987645769064,     2.1696576669512395,     -0.7209614049890997,
+    1.2573756412528125,      -1.3601809849640578,    1.5327824266954222,
+    0.13259123566437533,     0.8369866004411592,     0.7038120046976474,
+    0.6778080706007418,      0.09754468827570965,    -0.6559813357941985,
+    -0.1596922736327093,     -0.7654317007125321,    -0.1126976671772263,
+    -1.6088614791390787,     0.172236502872641,      0.9772836216538103,
+    1.2019072538377893,      1.3138162326986818,     0.15247534293859094,
+    -0.15415270857755534,    -0.25524165306179647,   0.3923593527201367,
+    0.7171068169318209,      0.33814141413352417,    -1.3454164100760053,
+    1.378052948631428,       0.47748156544728204,    0.9906862428957741,
+    0.05192492099132242,     -0.2609934917921665,    1.9375473147729616,
+    -1.069832859719185,      -1.688139163209385,     1.9957967459864232,
+    0.2403939818105377,      -0.4283694449741911,    -0.5850357506804287,
+    -2.0060803946689423,     1.8672709303187909,     0.7056302329993192,
+    0.509990780557728,       0.8246726896315857,     -0.9146650846687739,
+    0.45839429767800893,     1.0857135976881704,     -2.204923666647438,
+    0.5959640626123412,      0.747076157172831,      0.10148462387889638,
+    -0.885566779286961,      -0.1655618470477207,    -0.45818614471236335,
+    0.3628423289952963,      -0.5320928248025658,    0.7644201360742342,
+    -0.5183372082346639,     -0.5198438476311308,    1.1685335255050417,
+    -0.16073543695305828,    0.5316156101784504,     -1.2974104053060354,
+    1.5208773638609474,      -1.452172827360705,     0.09693348386447116,
+    -0.22454704951986149,    -0.7630577845056287,    -0.2743892877775697,
+    1.2351220515101868,      1.7389459951157138,     -0.23664221387754844,
+    -0.35746547681613217,    -1.8779352239372182,    1.7151172695400012,
+    -1.0660735295756416,     -0.9099151409403888,    0.10481056769638529,
+    0.7340559630879957,      1.5232610627361176,     2.174609750063118,
+    0.7538359898575543,      -0.48015878947551816,   -0.6568025911595441,
+    -0.178500405534637,      0.804447512925736,      0.9548909155117629,
+    0.6169268606534821,      -1.8944496447549188,    -0.5661655925791436,
+    1.4566884511899842,      -0.5330868093605918,    -0.08033606788900031,
+    2.726798808030312,       -0.07393321708416303,   1.4234327267377684,
+    1.8387111558209006,      0.7581751710148764,     -0.43490781801842254,
+    -2.280026888127863,      -0.8589368229527518,    0.6433147287429034,
+    0.5919608599627805,      1.1722707069070817,     -1.1058621539137552,
+    0.1994474033850918,      -2.050109106823698,     -0.8828085741358389,
+    0.5293035789155914,      -2.1822443400612164,    0.8167059284740097,
+    1.8306435885819057,      -1.4360873672317314,    -0.25887053459490916,
+    1.7184725119208686,      0.5006359909678696,     0.3973360523094999,
+    0.1075078955396326,      -1.3718043140286487,    -0.13683588334296015,
+    1.2866662723846953,      0.08697560639875537,    0.7216936619636506,
+    -0.36174575536678555,    -0.8714397370006153,    -0.4312177838008778,
+    -1.053032897818805,      -1.3623083878668496,    -0.01989903757351391,
+    -0.22877599699475412,    -0.9403944142330962,    0.6960691951295067,
+    -0.9315867323285139,     0.4255876552341913,     0.49837978696106716,
+    1.665958885796101,       0.34205221893252363,    0.7895903244870125,
+    0.07470964180015963,     -1.407186743927608,     0.8557226279263409,
+    1.6793879697439116,      -0.1242804834599012,    2.0937766491868355,
+    0.9238617787154833,      2.000980610930369,      -0.18118975386376956,
+    -0.8846708274216194,     0.05597743582421531,    -0.7262377972247028,
+    0.19845583584001267,     -0.24163650002721668,   0.16451186641161508,
+    -0.09004540382016302,    -0.9742539645685566,    -0.5294061513809323,
+    1.269125068782766,       -0.0635031812569957,    -1.3408263012278976,
+    -2.016802397381654,      -0.3224253751189573,    0.27879935611169043,
+    -1.1802184739493164,     -1.7873242445220847,    0.5608174386651537,
+    3.1941130359027223,      0.8719969174513782,     -0.996610363995452,
+    -0.11765598286415216,    -0.11884710509203313,   -1.2717757069211224,
+    -1.4041477552669448,     -0.1427669307805931,    0.7901634312150544,
+    0.2528779927693628,      -0.6832980549927604,    0.5094192952689579,
+    0.5212585904023529,      -0.9826787323844774,    -1.2178268728133825,
+    0.6451766810405415,      1.1362186776371623,     0.4054117652707486,
+    1.1792307442003183,      1.4669955824633947,     -1.5283475519727343,
+    0.47862374428371607,     1.3159625945810989,     1.1335766309336672,
+    1.4272199968757966,      -0.5875791945233264,    0.6817297440647835,
+    0.7762808911611014,      -0.5981709473036011,    0.1906832203712374,
+    -1.3317167476801013,     -0.848840654102649,     0.32756966378172586,
+    1.051415655679721,       -0.0007932378041793709, 1.5341044042063532,
+    1.489324193581286,       -0.9828309079144225,    -0.10137686966519051,
+    -0.5034488813918381,     0.8232521353212423,     0.7181528722186669,
+    -0.7937074116685169,     0.9240865326722013,     -1.3206632767957929,
+    1.1778488571680608,      -2.439172174991765,     -0.17911829212088395,
+    -0.7079201264672149,     0.6759288054070055,     0.2525500702286925,
+    -2.191531115745344,      -1.3454049703540347,    -0.5871490377453374,
+    1.1837772532087443,      1.6312629534211527,     0.6820065878484136,
+    1.4229498993136642,      -0.7531077025608558,    0.41660583544718954,
+    0.12698133845243562,     -1.0798098882404503,    -0.3503920670407499,
+    -0.3568483068515375,     0.45608670931597434,    0.4953927899031111,
+    -0.5484381483102518,     -0.5318767990671244,    -1.9006258382433345,
+    0.5053140524018953,      -0.10341105735150867,   -0.028990466594635167,
+    0.5458049780649977,      -0.49537371468823177,   -0.9638310237889585,
+    -0.6020448266820955,     -0.3436628645668577,    0.21763688499060538,
+    -0.605840854920324,      -0.4407632601619627,    -1.3295900276575532,
+    -0.4075873101822278,     -1.747057934835341,     -0.6607685180207324,
+    0.5399643421670312,      0.17139847626978819,    -0.15619302578027255,
+    -0.2245622972148196,     0.9002798851682261,     -1.178431560756386,
+    0.4422427252047344,      -0.7164659694250107,    0.2782397267131871,
+    -0.15208894059203298,    -0.5432265992210633,    0.3123124726755989,
+    -0.6462181793734874,     -1.2129367086986664,    -0.48301956889143255,
+    -1.2547013077350737,     0.14516705846978095,    -0.6079011572975985,
+    -1.2638761706184807,     0.36428257086629406,    0.4018101209683796,
+    -0.184533946761765,      -0.29227803941464175,   0.913295192677769,
+    -0.2711676911183993,     0.2580656042905764,     -1.1349926426688104,
+    0.5575857706024162,      -0.14293885938751286,   0.5182374972412448,
+    -0.2731224644439433,     -0.7529727687985162,    -1.2020108059385561,
+    -0.20630531146778944,    -0.45939813297651044,   -1.297200943970485,
+    1.250897190245364,       1.0256280539262181,     -2.0346262279964247,
+    -2.138980947526366,      -1.519605001250113,     0.15653535592075898,
+    2.679708455633599,       -1.1818362219539853,    -0.31723608852072177,
+    1.33291485496942,        -0.49532500144855807,   1.1158772495807519,
+    0.9341328283065662,      -0.02921333299459492,   0.8820625829339739,
+    0.9359150364791454,      -1.4028858495924854,    -0.17459167225487218,
+    -0.6291235491437993,     0.029651069206806022,   -1.2137115260123008,
+    -0.9964599053182054,     0.05577537586317621,    -0.007310529085468122,
+    1.385582920430734,       0.21042167233544076,    1.4323501401119016,
+    1.3103591392909377,      1.137846918706311,      -3.534826277379163,
+    -0.7729923147853984,     0.4634547900200788,     -1.3231846384903294,
+    -0.5278859467387327,     0.6685785992778752,     0.04753746681904918,
+    -0.348874129499413,      1.7324679325747716,     -0.4221128626166703,
+    1.1113299321018764,      -0.04968120944850837,   0.09915668936893607,
+    -0.358532751253049,      -0.8406042064580421,    -0.221612658834853,
+    -1.3656788094717542,     0.6111336477938548,     0.11307118984876603,
+    -0.4400905493473418,     0.7944236867042395,     -1.0422284824712515,
+    -1.9676185458085593,     0.4214309286631138,     -1.377442853113186,
+    -1.3953035973566086,     0.16296281785848823,    0.9663054387575775,
+    -0.7785692385580758,     -0.892202513025462,     1.5062625523325406,
+    -1.4124919691794113,     0.8479357928456366,     0.42985370525067496,
+    -0.7257420676274848,     -0.13640325052426217,   -0.8599626294185463,
+    -0.6661125673624853,     -0.1527898403502717,    -0.7069148613393527,
+    -1.6475757730896143,     0.7123571813975604,     -0.6043235817891589,
+    0.796605542609552,       -0.1539675589322236,    2.8127881504830197,
+    0.5580868261776278,      -1.3463480441721767,    -1.3721553973224714,
+    -0.8963780282911795,     -0.4285761618854014,    -1.6525879109046808,
+    -1.1260123613938908,     0.01512679265147408,    -1.5630535747999068,
+    -0.09995726382581116,    0.232995551922873,      -1.0048787371967522,
+    0.60395810447414,        0.08506419701248488,    1.0933353707542282,
+    0.6647099484873848,      -0.21262659368200942,   -0.1575259861911943,
+    0.46181553349813237,     0.37775971605594366,    -1.6927982504855759,
+    0.9265394154721454,      -0.5609690106651314,    1.1340336275631684,
+    0.17913690051786987,     -0.6495881348999478,    -0.00022165892178913267,
+    1.4404775624570878,      -0.749570039085251,     -1.7095849183856633,
+    -0.25568422447175687,    1.2593846775831197,     1.588163050548988,
+    1.0327358932903847,      -2.120251815112098,     -0.23712665145737535,
+    -0.47807028462047596,    -0.17645121408373998,   -1.0949426445571375,
+    -0.2750288309881863,     -1.1840995482162118,    2.3200971263106402,
+    0.059925351086009014,    -0.5175139346781814,    -1.2395163259365143,
+    0.9578853663287419,      0.5834875594915241,     1.161979075975805,
+    0.3466288514571874,      -0.46848758018195413,   -0.7279082582265999,
+    -0.7643680329235157,     -0.40508003888862415,   0.685302866247508,
+    -0.5516121316745625,     0.28426500952419215,    0.7529384361492727,
+    -0.45407375430146674,    0.9784898350044681,     0.4202785960607124,
+    0.38315284116671094,     -0.025946876766112608,  0.1734224810454438,
+    -0.8604104339899908,     -0.8384729265269991,    0.250256501213611,
+    0.8943805908773941,      -0.2304785091158027,    0.5021446498784435,
+    -0.23088021825515836,    -0.7828154650580105,    0.012498797758136589,
+    0.3842652660222784,      -0.6887594656763455,    -0.5939893896101557,
+    -0.4951676714919682,     0.18303889941980495,    -1.4750138349086932,
+    0.27431484876155293,     0.2615897541919916,     0.2053610707602549,
+    -0.5621817592610813,     0.2799546029066166,     -1.1032874024107011,
+    -0.7612118866693169,     0.7990401272480795,     -1.3286289739208967,
+    -0.6445220339587393,     -0.5777591218485375,    0.6495948328312584,
+    -1.4400926270296857,     -0.5889822134157939,    -1.0853708385557916,
+    1.65610456629696,        -0.27637980490674907,   -0.5193513543416097,
+    0.11370862235168662,     0.864011375022602,      -2.0729647258800843,
+    -1.080927007768464,      0.21835903486536046,    -0.6298152689525771,
+    -1.442418446010746,      -0.7089476125619234,    0.15661485942357647,
+    0.32568269295902585,     1.9600712325225358,     -1.6391867091786296,
+    -1.4810747506261717,     -1.2078094277616565,    0.9729205778757861,
+    -0.8959375639932967,     -1.5188790937587153,    0.8123563845794051,
+    -0.7400846626509303,     1.1153040140235724,     0.2146745327514036,
+    -0.6618502667043751,     0.893829193567074,      0.8158830776007263,
+    1.5019542265975248,      -0.4136278587230614,    -0.3185188906119637,
+    1.4720940202210941,      1.1115435809642757,     0.257166359472406,
+    -0.8500172199047867,     -1.047256620402961,     -1.43102617635514,
+    -0.9907672263375985,     -0.20677279027149512,   -1.1918082224646498,
+    0.7206739462001694,      -2.5785690214647743,    -0.8012416665598425,
+    -0.6801904106857742,     0.6087176525478228,     0.5226683043064148,
+    -1.2307527651424344,     0.22873118818596752,    -1.0444106448614665,
+    0.29144288689701503,     -1.2197943255774317,    0.128079786524802,
+    1.4685504562353426,      2.0401959824735902,     1.0867098596213884,
+    -1.0315773838242093,     -0.5190049977562072,    -0.9331994313098884,
+    -0.6101739036123783,     -1.7478191339413012,    -0.6303417834373195,
+    1.1177839368154103,      2.2343678017298756,     0.4346765956829567,
+    0.20323589698602262,     0.6729906378057614,     -1.5805541259467113,
+    -0.8457524930491467,     0.8051750559700522,     -0.23305339717185686,
+    -0.3680750676188135,     0.8542120000797297,     -1.9067488325640451,
+    1.1672360669466908,      -0.8120915590239152,    0.5633357683579404,
+    0.00065248126384967,     0.7284664451987422,     0.9923370789992507,
+    -1.0119464386290076,     0.837340619917006,      0.5064551533270403,
+    1.4254382510144508,      -0.5281221365560721,    1.1875660742800382,
+    0.7286573413595869,      -0.4420986126840764,    1.0011351449252246,
+    -0.3723190795691385,     0.9131952362293707,     -0.1003513391680753,
+    0.1081176572405829,      0.06793642826442316,    1.0139879613953573,
+    -0.08671918896385013,    0.5807016025548204,     0.5996573392054209,
+    -0.8592404779633885,     0.9239980372250954,     1.4729304761938344,
+    0.5107917302934212,      0.40576404739131944,    -0.851804323495171,
+    1.289310461660658,       -1.533862333571959,     0.1441348965445673,
+    1.5498510941265145,      -0.689002661267145,     0.5395367938193318,
+    -0.7263120241420367,     0.6584811012172835,     -1.4150450056249375,
+    -0.41225411348707197,    -0.6377757337724699,    0.10154202865889997,
+    -1.7012120233038754,     1.5075301874727873,     0.31006563993145697,
+    -0.4888385529956092,     1.4890128341121585,     -0.023802636396910958,
+    0.2564953580753622,      0.28828783763211424,    1.5908200385208897,
+    0.1575177835857322,      -1.0677143121504258,    0.08942424944727093,
+    0.4198325337775451,      -0.025837286178669382,  -0.6496362278584938,
+    -0.808199509094676,      -1.6969452911985783,    0.48113682491216164,
+    -0.834496362124338,      -0.6425239989032807,    0.5095189251352411,
+    1.0792143257684104,      -1.0355841380076172,    -0.35129179912772573,
+    -0.39394407757550776,    0.5058502988623536,     -1.0400012344250096,
+    -0.8022505331976021,     0.4200390728526473,     -0.6032465385458752,
+    -1.0285828628697804,     -0.011173319701762222,  -0.9163317787297659,
+    -0.27351614260273677,    1.2837976550999366,     -0.1766792899812326,
+    -0.13707890945350865,    -0.47053227250789537,   -1.5212293013201557,
+    0.1773079582041505,      1.016915400670118,      1.2625972654680406,
+    2.853421085553372,       -0.29545247326125085,   0.20175438102167767,
+    -1.1000155541386585,     1.8519849699141144,     0.9915469376669718,
+    0.9607556863021718,      0.5966386971873616,     -0.1326934209517018,
+    -2.5378736734624305,     1.2500651335766682,     0.6677387418351378,
+    0.2576504306414169,      -0.826439558668826,     0.867519657802819,
+    0.29868959940515394,     0.200557922554825,      -1.1069186840960306,
+    -1.1219888590608116,     -0.08945952768349046,   -0.10613490864320459,
+    -1.0400464521256378,     1.7345890167872844,     -0.43861993449982734,
+    -0.06540553854788668,    0.26010138518009485,    1.4721262296749305,
+    -0.7751390829736917,     -0.18570877984766065,   -1.2745161449648552,
+    1.0488737500942702,      0.4261251453279377,     0.15849541034899162,
+    0.2843923140011772,      1.8159726563895895,     -0.11007269640040258,
+    -0.5838804778635551,     -0.578890553566384,     1.0309680334441211,
+    0.5881410721139667,      0.4801751878765151,     -0.6484391011657318,
+    0.5464913895812652,      0.6008801283226481,     0.10605299326379677,
+    -0.13176660765986492,    0.473483162930109,      0.3995266847714059,
+    -0.47990347380676557,    -0.3120966725804329,    -1.7151981253199593,
+    0.5974583060799449,      -0.10973866876091745,   1.549540426484091,
+    -1.7843331106894198,     0.16959091335224635,    0.5929868954424211,
+    -0.6986031726827636,     0.4829855311086351,     0.2831906341192635,
+    0.5295122646230613,      -0.23333226861522938,   -3.176770124120848,
+    0.08089084900917821,     0.09408691964672265,    -0.7311820209813213,
+    -1.3252951194818134,     0.5229401984540413,     0.3964365695363116,
+    1.5792634204648566,      -0.806503040613035,     1.1855195515181252,
+    0.017106773806503498,    -0.4962771814482373,    0.4992153529544045,
+    0.8765019443259039,      -0.5252122865264248,    1.5704075350728013,
+    0.018811421593415714,    -1.233064116482986,     -1.138670268661717,
+    1.0719677348138625,      -0.5529289673643482,    0.08903757420631536,
+    0.10595376750041019,     -0.11243546622597023,   0.9793657062045151,
+    -0.4819053487911348,     -1.1096897520829108,    -2.301407709862728,
+    -0.11847732217156706,    -0.2640611082928566,    1.238257316228797,
+    -0.7041036827930911,     1.023216176089566,      -0.2890373177524929,
+    1.720685930139235,       -0.9737105003396421,    -0.40115190331348405,
+    0.6786279727073633,      1.1884359251750403,     0.8439421373083638,
+    -1.3351190218007778,     1.0883008291525538,     -0.009299899704625162,
+    -1.628124581295868,      -0.5588125823098358,    -0.34838179493618804,
+    -0.7992134614280395,     1.305917410490158,      0.5368813778236036,
+    1.1393818333468928,      -0.8802044532107655,    -1.6700687712625377,
+    0.4521664397793463,      0.03404704112165527,    0.8632344124666179,
+    0.6601506587754395,      0.1558804506772594,     0.8011796544199185,
+    0.07667306035539237,     0.20516563062215581,    1.97846363411031,
+    1.2896882092452597,      -1.0519342433526988,    -1.5819693465406723,
+    1.3572882963285913,      -0.4364041664017586,    -0.13164683129226573,
+    -0.4881432497483233,     0.32710064573876463,    -0.41390349426685163,
+    -1.190347269388929,      -1.7849898942405564,    -2.3919070921406353,
+    -1.0541973107216351,     1.22470671683055,       -0.9376946113303034,
+    -0.02350890467305724,    1.121493806771789,      1.3138765916120874,
+    -0.5570164179025274,     0.7113232010339565,     -0.3755088835213291,
+    -1.9384241603576855,     0.9574386282024657,     0.11012948159046153,
+    -0.8770597152699721,     0.20600111295157794,    0.3336454410593975,
+    0.16650751674542458,     -0.9681923008020853,    -0.17467861272664378,
+    0.30555355700411696,     0.7538209321973763,     -0.21589766897183368,
+    -1.0832229659674864,     0.42435909265851823,    1.236966732380208,
+    -0.5955494187343696,     0.5058693174922756,     1.0482697543542812,
+    1.0583467379662184,      1.3446356107688293,     0.28335459597610546,
+    1.4077089748985576,      1.3523035976758295,     -0.8274167023522605,
+    0.3100297802679346,      0.2351835421043822,     -0.6845278106391637,
+    -0.32920619876143403,    -2.007979047616517,     0.7103710068573074,
+    0.8488945103287826,      1.1508883874499722,     1.348682230549347,
+    -0.6049412398783404,     -0.1599826821048986,    1.5436059016242587,
+    1.0796651205148486,      -0.73753862996842,      -2.360399214704135,
+    -0.22885573965375722,    -1.0684952439911009,    0.06264561870331742,
+    0.9708803859929719,      -1.4471293833539927,    0.27481945901102384,
+    -1.2157678896374926,     2.4824043706260785,     0.05159367046182593,
+    0.47517311634142373,     -1.0440434592070242,    -2.1327555754799965,
+    -0.9588473142601711,     -0.9567290916972264,    1.172622869840111,
+    -1.147562305479048,      0.8269988562241019,     0.4214803564207606,
+    -0.11154409122936744,    -2.486452132979182,     -0.5496610899313858,
+    0.9707426261697962,      0.5373041518508939,     0.14957747073504613,
+    -1.4369052038510794,     0.12603613518464032,    0.25370454710111884,
+    -0.48612186042199373,    0.4331351695013205,     -0.7102899480556413,
+    -2.007759000620982,      -0.6432255958575042,    -0.6903096222847622,
+    1.2190053333869801,      0.7194968271896238,     -0.05056146242845004,
+    -0.5467692859659345,     0.558236642072146,      1.4941352126422554,
+    -0.9670602996408557,     -0.6391213809436531,    1.1507617236624983,
+    0.48083955853129556,     -0.4384548540799162,    1.1552659162176098,
+    0.5515996017948747,      -0.9428120041026924,    0.2746646197301277,
+    -0.007191837311539971,   1.6526703791919777,     0.607396407114989,
+    0.4835097126218719,      0.13330090614749435,    0.5209648422456008,
+    -1.3891445298816683,     -1.4544076535330133,    0.3893446777441642,
+    0.3997242866199824,      -0.40348211836213455,   -1.9980871708022585,
+    -1.0877850539074074,     0.5378153945243043,     0.1268959335741531,
+    -0.641360851360408,      -0.9289889698746102,    0.26648125166798625,
+    -0.15084848001612608,    -0.15934235436441688,   -0.5043517621880432,
+    0.15025531246101365,     0.2827039180001233,     -0.6263353195998013,
+    1.6626856935276135,      -0.5887789473285605,    0.1663140807190742,
+    -1.5515672381969565,     -0.9989702923374817,    0.920462044784,
+    0.7263955437937439,      0.21467386296657767,    -0.6725372860020958,
+    0.35363421434863473,     -0.9929408601065878,    1.070043780094098,
+    -2.6289362534760246,     -0.3850026255821543,    -0.7972406140807622,
+    1.2948718294953938,      -0.19797724025709085,   1.2373789328365488,
+    1.4456439102366918,      0.4547624906712715,     -1.637977461531174,
+    -0.753848504738567,      -0.4991637537541222,    0.4004980546405399,
+    0.37963856903469984,     -1.3295982465275558,    0.7845830508658425,
+    -1.0147037825462781,     -0.3538891704905972,    0.2574050999453003,
+    -0.12978121492155628,    1.5688542737638407,     1.1393552276240555,
+    -1.3190353486111486,     -1.1257244576442127,    1.1497822139284224,
+    0.11328251572792235,     0.6283639171781359,     0.025082250954925948,
+    1.2305522393942927,      0.7716500383431164,     0.7864630283479346,
+    -0.6767168873987941,     0.6074298182660839,     -1.6102144133031624,
+    -0.2407588994719667,     -0.6354387474745965,    -0.7767066341392865,
+    -0.9367863278433692,     -2.0076051169402374,    1.2384087503206325,
+    -0.21278598862650472,    -0.17724681545893212,   0.501232414683224,
+    1.0651812135505694,      1.3368272644903991,     -0.4315952772228518,
+    0.18797902491800886,     -0.9053376106634182,    0.7327941026602555,
+    0.021047539886101942,    0.9091017268159558,     0.82730060787003,
+    0.7816975664413318,      0.5361655899369155,     0.08703173877188675,
+    -1.2426899515590974,     0.3290740539529005,     1.68343250725152,
+    -0.4339023105057046,     -0.6773738362665028,    0.6180544117106092,
+    1.6743051953205184,      -1.0410514618717768,    -2.4158727073970985,
+    -0.614828728992287,      0.09970582288992386,    -0.14279601277258236,
+    -0.26029729060689655,    -0.5026732293867113,    -0.64687369767142,
+    -0.8271816824695805,     0.3599814568459466,     0.572483797706326,
+    -1.585330352302301,      1.581906673943496,      0.4415064560956599,
+    0.5539689464727188,      -0.28286945310263745,   0.2548052491884241,
+    -1.1236055744784486,     1.5834005386202137,     1.4148997329024293,
+    -0.23953363116382628,    -1.3187368512167583,    -0.3058434415138337,
+    0.5912933402331186,      -0.39379983421112014,   -0.7956364780032414,
+    0.16086666386112794,     -0.8738218635801231,    1.335250351904024,
+    0.9455179991625683,      0.6637914958972536,     -0.7078788566452506,
+    0.20684064537321362,     1.109375417604563,      -2.093116615271457,
+    0.20571956660641072,     1.4062242658058606,     1.8115127477724486,
+    -0.9505578432860161,     0.27622169843778055,    1.0443217002131233,
+    1.2058386782317003,      -1.8396567773982435,    -2.0095758340884933,
+    0.15429326294530646,     0.4983153987470132,     -0.12456993712717936,
+    -0.327860112532882,      1.278027624870522,      1.4775065745626677,
+    -0.5921887334663587,     0.1576974835478257,     -1.1568771588169278,
+    1.7354932290451561,      -1.4042401559994988,    -1.0700911686731678,
+    -0.8898115507143028,     -1.0484771039304368,    1.277560503655242,
+    2.321644168914038,       0.2606832809314061,     -0.3360533257894568,
+    0.7217490487092411,      -0.9070198906930218,    1.3377570672472545,
+    -0.03645189000981901,    0.4205569589470778,     -0.6912584086795868,
+    -0.20442243163980808,    -1.6196231887849155,    0.018718020822124367,
+    0.8902523320201344,      -1.851540529547109,     -1.0098335512983168,
+    -0.4761541833871693,     -0.30966480195625806,   -0.09027447992910427,
+    -0.045072721145223975,   0.283734439359295,      -0.035510706980202374,
+    -1.6819219828735092,     0.31370146476599997,    1.2034226364065832,
+    0.2580661451937386,      -1.77346476561737,      0.2323172537905211,
+    0.47534737030440344,     -0.9892503947765449,    0.07618895753221275,
+    1.2764367275034616,      1.6173865203687405,     0.12650367579201538,
+    0.507450331516569,       -0.16511365791210564,   -0.409849910933669,
+    1.3850010738112473,      0.9624590911147314,     0.6170014623829175,
+    -0.5265446845793827,     1.4672588220571539,     1.040465451304835,
+    -1.291677547456279,      1.088589918262395,      0.16830571898276894,
+    0.2784776309434025,      -2.017066876628202,     -1.4631482493813845,
+    0.9895188511737478,      -0.7669895066382142,    0.8124489654586325,
+    -1.3271593737379657,     -1.4752449411488193,    1.9107548907264003,
+    0.9093984525425448,      -0.12835977008439498,   0.22371022876179467,
+    -0.7085952227539319,     0.3560018871457242,     1.179430081190623,
+    -0.41547298899645624,    0.4856300592537666,     -1.6922164265324677,
+    1.8015299981444772,      1.0045833079344084,     -0.03000057463878832,
+    -0.33442807481761466,    1.4110048539804345,     -0.5047683077415264,
+    0.3697534832950222,      -0.31388402752682953,   -0.9227325633490079,
+    1.0388344786199157,      -0.4122105929886102,    0.4641923820487851,
+    -0.3473195093747445,     -0.13446929924508583,   -0.17105052841249319,
+    -0.6548626877553424,     0.7333123684804332,     -0.08678565909833101,
+    0.8627411719816076,      0.7468230159489005,     1.2222831252234154,
+    -0.49152179983070104,    0.6637073714601067,     -0.17440091557380402,
+    -0.022376811277469526,   -0.714431537592622,     -0.47444630389774506,
+    0.6301559347224986,      -0.34199607592207854,   -0.7294743782512296,
+    0.8483002808629213,      0.35681745004056503,    -1.2185248214888367,
+    0.10571383465683429,     1.128220248078468,      1.096204014499732,
+    -0.537157730383757,      -1.1107181094305467,    -0.3655601160967291,
+    1.3440784218392559,      0.7437348984840652,     -2.2936938226700163,
+    0.858749799402837,       -2.2178326471626466,    1.9325688340196359,
+    0.845360433009544,       -0.3945827399554642,    0.10694931316701613,
+    0.6610165564815244,      -0.4934156430418483,    0.4635291156131296,
+    -0.12954441592476396,    -0.25080793644048377,   1.5250188147147468,
+    -2.038764537309031,      0.047037010708902996,   -1.3930803551320048,
+    -0.1821053040717097,     -0.7081082909741181,    2.546279246038802,
+    -0.5142233651630882,     -0.13698365634269724,   -0.6184236923005789,
+    0.8893946029518446,      -0.5101446216846947,    -0.654988794834094,
+    1.8703917320505907,      0.7809378772699695,     0.2689676689121048,
+    2.4123821705069384,      -0.6330023712343874,    -0.8125985454386807,
+    -0.7934923824203926,     1.2031525284424789,     -0.6188221942041587,
+    1.1902519074045548,      -0.6294151297319022,    -1.8146600862409288,
+    -0.8016210036948958,     0.2871439045937797,     1.1923122356894893,
+    1.3013414659860392,      0.36641312686097355,    0.6840846160401179,
+    -2.644425141393175,      0.26266594556574535,    0.03853899331452026,
+    -0.30897401227250176,    -0.6659000321926163,    0.8797267449290495,
+    1.1392573134057336,      1.9645874576107112,     -0.1947584810475465,
+    -0.7960555671628818,     1.8852478939575747,     -0.32041639436236974,
+    -0.5206048129065011,     -1.3872028944357861,    0.4201170685057737,
+    0.605698454948352,       0.8435906403898425,     0.2231150530700421,
+    0.5441233001673473,      0.5542931136086084,     0.5143854382435239,
+    1.178433896234668,       0.8524727556975388,     0.1888024746308227,
+    -0.5372250764119196,     0.8029541555302393,     -0.5771436395802362,
+    -0.14766975772028385,    -0.716214409420587,     2.1329259577214255,
+    -0.9711718339058864,     0.6639191610363492,     0.6762879796722764,
+    0.8762211175925845,      -0.03961636454431041,   0.08389069866538225,
+    -0.19682438810299632,    -2.718030424094055,     -0.7642360357257791,
+    1.364025481798582,       -0.8162505266030664,    0.13501461235242795,
+    2.6375896338257605,      -0.9681747706911432,    -0.5046309988873626,
+    -0.25206100012481414,    -1.9984650335588983,    -0.8682666770777586,
+    -1.4286532653332555,     0.5438933930558608,     -0.24709505348461527,
+    -2.1325118168743438,     0.8101365057331286,     0.9720933162863399,
+    -0.36169652909301103,    0.9467139665275466,     0.5873707582417537,
+    -0.9143731138807764,     0.28124579167513514,    0.18469622772543162,
+    -0.8351331964040619,     -1.0266260243068188,    0.40790665684964694,
+    2.3067114013653036,      -0.03728400513693235,   0.21029363250546848,
+    -1.054447066863845,      -0.25955180791989424,   -0.20233316868603432,
+    -0.3767306294440099,     -0.6558141846262745,    -0.048660692754472094,
+    -0.5629607789115402,     1.241454092208404,      2.049887515075823,
+    -0.761337354180956,      -0.3636092540907537,    0.43358841480835164,
+    0.5830840130649374,      -0.7634851604064377,    -0.570837235187906,
+    0.5866110842918041,      -1.6383256841638285,    2.215055367629362,
+    0.3014479723706601,      -0.30410474512900987,   -0.15033536278198584,
+    -1.0733899920123358,     1.8025080452459195,     -0.08390125513169662,
+    -0.43508713272073757,    1.7570210354474904,     1.0319443544975944,
+    -0.19443128955707595,    0.43624710473006406,    -0.3321582700336816,
+    -0.3622096345695599,     -0.2209620444707769,    0.2974296524558407,
+    1.0948864721585936,      1.9775359771444458,     -2.1725754968391278,
+    2.3223319285832797,      1.0243518240258673,     0.0165287135822475,
+    -0.43004730943682384,    -1.868084777055348,     1.1944222507961446,
+    -1.0945821076331412,     0.6518535742720505,     -0.41472721288008324,
+    -1.6257263743102441,     0.418416672435905,      0.48634667014759664,
+    -0.9357976277460405,     0.8593944383874843,     1.8054136343213438,
+    0.4906502735194068,      0.43139215334145015,    -0.7338024433895142,
+    -1.039368056878255,      -0.40609349737008893,   0.06900236090186339,
+    0.011748195886694903,    -0.1988933158943963,    2.4917427675577604,
+    0.5711358731091932,      -0.9763056589889721,    -1.2005802138816628,
+    -1.738565291116909,      -1.0095446545642126,    0.5787231339380876,
+    -0.2852419341811529,     -0.6928568747950874,    0.5896251635987264,
+    0.549212838028023,       0.37139647741209947,    -0.013229943146604006,
+    -0.036749046101142546,   -1.318609945649261,     -1.845221215430422,
+    -0.8064201406105633,     -0.7886777881808258,    -0.8189444035182915,
+    -0.1732110169392386,     -0.4740450797740032,    -1.3046024612891727,
+    -0.10288780966158341,    0.33600162751982965,    -0.49254474029310985,
+    0.8190690460111887,      0.3154570839100395,     0.3894466836269326,
+    -0.37354142897132825,    0.4134733178990085,     0.682488649218257,
+    -1.929239761478748,      1.0682930500242194,     -0.5111472926695974,
+    0.6506181883315434,      -2.3063390715552923,    -0.43413818407710253,
+    -1.6990085202145837,     -0.14840307811085648,   0.18145942701168055,
+    0.40697369752874235,     0.020687934565065902,   -1.2525316996340714,
+    1.3027302858338292,      -1.3452748368263383,    -0.336311694698229,
+    -0.7767305972978515,     -0.6025351860558535,    -1.4030961589176056,
+    1.085603539676998,       0.7461154097079574,     0.07162761240271186,
+    -0.1443350507694001,     -0.9599715678223594,    -0.11007881552339607,
+    -0.9080266028863009,     0.08641506206427763,    0.39372856963276753,
+    -0.24714184794344227,    0.3989990797887056,     0.5835920025485567,
+    0.8046745490186472,      1.9747540004329518,     -1.4276882563459858,
+    -1.2338357566707139,     -1.216495370627702,     -0.1977923089087978,
+    -1.5944702299405475,     -0.530428757792224,     0.8380822517097158,
+    0.7292537921581808,      1.6395420651950126,     0.8536413250790362,
+    1.0130110417562717,      -0.5289701881067234,    -0.35805951401732133,
+    0.8788688799364998,      0.8585883507995817,     -1.9163525865441207,
+    -1.3885868312056497,     -0.9778538523582492,    -0.8599725740998281,
+    1.3173727907437596,      1.8059195180513956,     0.32993129642299845,
+    0.3407114272447163,      1.9419459834113688,     0.4486897637195822,
+    0.5590430884707062,      0.37270572429347476,    0.3743212127868262,
+    1.349099602578271,       0.7263480596264982,     0.08536407024250056,
+    -0.39313989475094563,    0.2600489771341998,     -1.6626825753116647,
+    0.4607269735329119,      0.12609334982165568,    0.3207892336347089,
+    -1.1567391601281425,     0.46872159310637096,    0.18308141746793039,
+    -0.007007702639297405,   0.37018687856285243,    -0.8296497895456619,
+    -1.4563679052912988,     0.45409716839341063,    -2.2017507408057657,
+    0.5950300966926592,      2.067545848368871,      0.37081491153686463,
+    0.8536900393438983,      1.6277170867549666,     1.0441957848030075,
+    2.2770196274367875,      -0.871140178494644,     -0.34121710045253834,
+    0.4833271103581227,      -1.6149127929865823,    -0.0064373169822983635,
+    0.06674634367996339,     1.2979137300019687,     1.0672285305689975,
+    0.7662615999719294,      0.6967587908515047,     0.06137946274682246,
+    0.2921869210433012,      0.7594730760515107,     1.011716182816632,
+    -0.719050261598623,      0.4495871149747897,     -0.07532570787425391,
+    0.26554714990911016,     1.154396360473183,      -0.2506327946965199,
+    -0.9219853760606168,     -0.9109965316408667,    -0.5731746667690821,
+    0.6095143930730289,      -0.16572494576706848,   -0.5980424463769455,
+    0.7727712901927323,      0.15995525144783973,    0.7005720655582562,
+    2.1930121598627696,      1.8812575006348025,     0.34485186754972147,
+    0.33890326469273335,     1.1136641514978642,     1.277897694797838,
+    -0.35815085930684626,    -1.225028799724463,     0.8629444722903092,
+    0.2250871350319941,      0.6101875446429338,     0.5428962358103508,
+    -0.6984262910057434,     -0.5100526323306185,    1.0713149515241247,
+    -0.16155342766811848,    -0.7815436800837624,    -0.27537402533234867,
+    0.3976461337784692,      -0.5102174314333264,    1.7373903422760493,
+    0.8123485131710989,      -1.4902209670060247,    0.22953610191810717,
+    1.5689257913819599,      3.296280541716217,      -0.47078215550683616,
+    0.024726907508832458,    -1.3563488735074807,    0.5562513891452909,
+    0.4788380676753551,      0.28320804464563143,    -1.0842284134359808,
+    0.781258626448559,       1.8281696335217885,     1.3587078023572567,
+    0.3622486371575519,      -0.0507353801643818,    0.8983234620950805,
+    -0.14108016022684575,    -2.529069439813298,     -1.7178440570553652,
+    1.3682216542852341,      1.3302763422555834,     -0.12539670945567785,
+    -0.7982307213879462,     -0.30027862122277454,   -1.286075861516884,
+    -0.2539311599448198,     1.7469943237114371,     -0.6255954676044329,
+    -0.794397135549141,      -1.3439324267269683,    0.2057114859858721,
+    -0.949903758112519,      0.6504200876723305,     -0.30859698895854853,
+    1.681308978686971,       0.5913189361720995,     0.47701837995504476,
+    -1.406818327865394,      0.024100215494608314,   0.3037801863543509,
+    0.34286654661817284,     0.35540687246360453,    0.12256287683794967,
+    -1.1677145456703626,     -2.4068097517840665,    -1.1161715505145098,
+    1.0139344510569923,      0.800335934063959,      1.1423697747003454,
+    0.3281198181280124,      0.2270324237659295,     0.01727820736675193,
+    -1.708230650902818,      0.1781738285684825,     -0.647592785411391,
+    -0.6090924078040748,     -0.9882699991774144,    -0.06719646842616296,
+    0.9151514400309757,      0.7997519089081052,     -0.9707967549601806,
+    0.24224597335681244,     -0.07439049825829834,   -2.0112000885913934,
+    0.9401336060686659,      -0.6469716382491031,    0.5803567704435916,
+    -0.7911307590690018,     0.7779534796134991,     1.2483976946676831,
+    0.261475361516236,       0.5431307360358216,     -0.6535110096219312,
+    -0.3170187892388608,     -1.1189276178015142,    1.052706099947102,
+    1.186348822803622,       -0.479836298639709,     0.037900671967995805,
+    -0.6667285291932337,     -1.3090281640920438,    -0.5147372677364135,
+    -1.1972018846388608,     -1.940495008398035,     0.29596772259611265,
+    -0.9956842110833687,     -0.04184673507860722,   -2.657848683042919,
+    0.08868972136962076,     -0.6921226755403341,    -0.6253431643828201,
+    0.870508419076588,       -0.12231316220442784,   0.2991286708794664,
+    0.05346024519381741,     0.48120210357882837,    -0.7915537333311605,
+    -0.011649856043324549,   -0.23323981602805777,   0.7089046821663387,
+    -0.576451488518175,      0.7533189936724132,     0.528381825462766,
+    -0.5810578219912276,     0.7265307113660736,     -0.39921496152340474,
+    -0.6400303185615388,     -0.8006300622184283,    -1.074511806335401,
+    0.31126702669001305,     -0.19647047489119593,   -0.3069718033925784,
+    0.8541207900845547,      0.8816743370748369,     0.10976078242154068,
+    -1.935348108905972,      0.4851427962031771,     -1.958791972092192,
+    -0.892581511585056,      -0.1608379569871672,    1.5347029494605235,
+    -2.4817518146216946,     -1.5313328670158404,    -0.7154073971312489,
+    0.6912100556111742,      -1.6321236251461286,    -0.8000605828600567,
+    1.2128191242209372,      0.8818247994044733,     -0.6079201665670362,
+    1.0138206424514957,      0.08517038387205025,    -0.9068526330369571,
+    -0.713490461688927,      -0.6276563612174909,    -1.0787037225570049,
+    0.4588425696282074,      1.0099744013432095,     -1.4402372045081135,
+    0.6663678602531244,      -1.0444998995419206,    -0.07257904218059405,
+    0.3035267332354893,      1.0138258643617515,     -0.024034304603849446,
+    0.24876568530236642,     1.629295189909316,      1.6152529086982939,
+    1.053163790416582,       0.7504769355055728,     0.5081894363719308,
+    1.6392551883534265,      0.7372992960694381,     -0.6778698540453537,
+    0.10619265124083993,     0.410815381777343,      -1.392722549335341,
+    -0.5778856899155411,     1.7107374918270144,     -1.1370420039588982,
+    0.5098677833531753,      0.3130500932411119,     0.9650572436274102,
+    -0.7771734356041753,     -0.7768207194121501,    0.053244703496035925,
+    -0.6289140689655471,     1.5482981817685373,     0.181806416011042,
+    0.8530633393905638,      -0.9961467538558483,    0.5902160730862438,
+    2.4896093184703068,      -0.05492459986095672,   -1.120963613519466,
+    1.1386510671852539,      -0.47447250663708584,   -1.2884589354945188,
+    -1.1276438744213915,     -1.1818343406325345,    0.5227100109088307,
+    -0.8499331312688279,     -0.8689252311528364,    -0.37200319320859376,
+    0.4258515581816727,      0.8901460165327378,     1.2328638195971626,
+    -0.3321686605875295,     1.016316770265613,      -0.7873789473214456,
+    1.7106933661475958,      0.6201565669310576,     0.2657214301289176,
+    -1.588203456852215,      0.9740983510513462,     -0.46783569900656957,
+    -0.6113585191640996,     -0.8208857089605894,    -0.6061742653640552,
+    0.4935799897058209,      0.42726730873375335,    0.05195740768042257,
+    1.8731991120617244,      -1.248734509848332,     0.2860559027718018,
+    -1.328328672557554,      0.5636273540849269,     0.5733657048276259,
+    0.1357634618950346,      0.5061108419402472,     0.5845800571166782,
+    0.483974258511525,       -1.3840462955466404,    0.8774524443400998,
+    1.7487756911042969,      1.1237216037198936,     -0.2601902358529778,
+    1.96600470499546,        0.2472189495277368,     1.1723749503548788,
+    0.6827394658414638,      1.4427885523142168,     -1.5921878831554972,
+    -0.7927636053870845,     0.5242718617557084,     -0.2390274079708394,
+    -0.3635389122480098,     1.503846878847051,      -0.5611176788112657,
+    0.3092629897732559,      0.3765250952542864,     -0.2263275344665739,
+    -2.3136497467663433,     -1.861495732765391,     -0.258460221579675,
+    2.2010989384673225,      -0.7201605965802347,    -0.023606357816909274,
+    2.0778680686194746,      0.03822594150591722,    0.5093003511165053,
+    0.3116515237926383,      -0.8376741532299825,    -0.8578833810900612,
+    -0.5024609568521764,     -0.007493913362948272,  -0.7335916650703235,
+    -0.4939475878595457,     0.26006732004741245,    1.1995472232337367,
+    2.359895579348444,       -0.7113504458362336,    0.2843593344786115,
+    -0.9823520462055988,     -0.6189347745130979,    -1.7202514982437282,
+    1.726640791260249,       -0.42601509129335396,   0.9597120428013034,
+    -1.0545515934902403,     -2.344933714350539,     1.7082457111204612,
+    -1.61562936639227,       -1.0337628804834156,    1.202739556101094,
+    0.08947756530962483,     -0.18599099048948486,   1.3349317246899843,
+    -0.2825346147672668,     0.8009359785673268,     -1.2366255939825999,
+    1.4273271055220977,      -0.5563372068647813,    0.17870200881053594,
+    -0.7183915257764578,     -0.8134580647687023,    -0.2798109679758409,
+    0.9173609573428837,      -0.2448779746821345,    0.19451869689082393,
+    -0.4717015275186252,     1.3238766835621296,     -1.4650062331091849,
+    -1.6765702898323906,     1.4143274360865745,     -2.161284442424959,
+    1.7209374525924994,      -0.01511942112608886,   0.43467575101630235,
+    0.3232361869987553,      -0.65763319863853,      0.5178377982843189,
+    2.0373720423448014,      1.2200093554728881,     -0.7123250832002772,
+    1.239869334707748,       -1.1721496876416209,    -0.218346523173463,
+    0.14581746787663097,     1.2437026568111769,     -1.3851537281176993,
+    1.0506920242718296,      -0.41221973623045344,   -1.638492281141948,
+    0.9975482126722698,      -0.4163945812025546,    -2.0034666654578306,
+    0.7967365998847945,      -1.6865093673951352,    -0.3779306930031855,
+    -1.1264824370528022,     -0.8107577793592635,    1.0889724875547564,
+    0.6349546245073286,      -1.5079846145569353,    -0.22542528826254318,
+    0.0681705493254966,      1.3564699887374563,     0.46060674861205536,
+    -1.2100184458873287,     -1.2910779537481538,    0.6639298550438099,
+    0.7635808924985965,      -0.6007348447185392,    -0.6261485784366018,
+    0.5096046727181108,      0.28953737659799006,    -2.630060392149292,
+    -0.2714062068739808,     0.8234722001345812,     -1.4841352048815546,
+    0.8706814017555528,      -1.2478254127895634,    0.23223768974354728,
+    -0.845945701855423,      -1.6151004664217579,    0.22090890829718723,
+    -0.10226651709614215,    1.521719806377969,      0.8316193022132284,
+    -1.5882623793296398,     0.3279849272784642,     0.9813214896718415,
+    0.8486140717569205,      1.8604037273084284,     1.9532007029343554,
+    -0.7065639405121728,     0.3882725567705721,     2.401348083890222,
+    1.278147629603492,       -0.6704607702019343,    -1.5247799033464655,
+    -1.5562848540859464,     0.656033978477034,      -0.10759516055126381,
+    -0.1832943784421615,     -0.579712753017261,     -0.8603610832922257,
+    0.6165813070553764,      -0.027548135346670846,  0.4310456750035062,
+    -1.6372732728108843,     1.7898248890632766,     1.1788180068747127,
+    1.070619711492506,       -2.063527877769313,     0.8905258151961505,
+    -1.4335825425103315,     0.4291455964117942,     1.1627783775281375,
+    1.0716458092714134,      0.7262361480582938,     1.85274591235393,
+    0.1652126730991436,      -0.8074358753520721,    -0.527833311349687,
+    0.019349817129332196,    0.8387658511781951,     -1.0627639841341485,
+    0.8152695600319355,      -0.024557211208632246,  -0.4598102070776732,
+    -0.9339603771369495,     -0.47145317560353334,   0.30536247687467993,
+    -0.19468232647483208,    0.7544390737915734,     -1.6115774161601042,
+    -1.4697622617666977,     -1.0369344271870253,    1.1092719494831613,
+    -0.13909293901816122,    0.03742839494154261,    0.591828629020857,
+    0.6562268613456093,      -0.5339553872222805,    -1.427253736140895,
+    -0.3585009603027504,     -1.528589646414586,     -0.06709469092347026,
+    -0.7665072198026737,     0.2874729589420678,     0.19610510888236188,
+    -0.36396018959803184,    0.6347262219313484,     2.8368553757192525,
+    -1.844982984219537,      2.4267148652989117,     -0.9727840677657442,
+    -1.354453704607672,      -0.9612636655285555,    0.7338809471996391,
+    0.21577404661578112,     -0.6200242105481393,    -0.5797383896763131,
+    -0.7596152920167564,     0.591539152983105,      1.2549057185782544,
+    -0.2552949386552367,     -0.6793306129124437,    -0.37617616667666126,
+    -2.307581199282122,      -0.05433360867527129,   0.3829092613571713,
+    -0.36921840222511776,    -0.5047007390848399,    1.121216550955329,
+    0.31340206531150494,     0.38766169597312894,    0.5030940471871214,
+    0.14329471273823283,     1.3135874801256529,     -1.3695742595514988,
+    -0.03122687057876298,    -2.2831605485301965,    -0.4204580647983766,
+    2.00332791832787,        -1.2846183356172995,    -1.1032061225415857,
+    -0.07481268449406754,    0.8632931527644925,     0.6801709228188083,
+    -0.543715175462687,      1.6975673782915475,     -0.057992260028003034,
+    1.1384582309788087,      1.593429091486762,      -0.9830557684124864,
+    -1.4949106129003213,     0.5358465968560941,     0.18618204438390182,
+    0.03410788984294679,     0.2681023103798088,     -0.10044188608395857,
+    1.5614127677249185,      -3.0106458101232314,    1.2708332145939933,
+    0.2589424265785443,      -0.12744756588010026,   -0.9748911190492969,
+    1.2323358430817961,      -1.160486751063505,     0.1082306993811531,
+    1.1375276352981538,      -1.6550011999249885,    0.3160880120528333,
+    0.31078721874456755,     0.4268225038513061,     -0.465104869267663,
+    0.5855495832588998,      1.0385981425482258,     -0.3004093408501889,
+    2.0834189654424082,      -1.1364157711312417,    -0.6786194887900858,
+    1.2025839830311698,      -0.21668568512603045,   -0.9368808484858168,
+    -0.44654035097742395,    1.5145985643581137,     0.7938595045579668,
+    -0.9263519562042325,     -1.8732660020996976,    1.4922354165419605,
+    0.24560343674359994,     -0.4226282139338982,    -0.9075772486744944,
+    -2.072397725480991,      -1.3213747738573276,    0.30031946299737566,
+    -0.49370975525021754,    1.6454872761727475,     0.9189822931258026,
+    -0.5922117589345369,     -0.9272330891231403,    1.2902056622221343,
+    -0.3730684184253278,     2.6435900437015274,     0.09647079528370066,
+    -1.3649837583667803,     -2.0406978261378708,    -0.735501652677906,
+    1.445400599053364,       -0.2471248796864023,    -2.5001723591700706,
+    -0.62509145497192,       -0.29011850117197513,   1.3698603567538565,
+    0.43258856233826115,     -0.14999678756857227,   0.3029427557366194,
+    2.224268616999443,       1.0590482363551657,     -0.7414534164619617,
+    0.6841759156454819,      1.1319324400389956,     2.329455532183603,
+    0.28689934876691786,     -0.3233063231428434,    0.357642409024211,
+    -0.47729717599159294,    0.15090002735435235,    -0.8049815717705231,
+    0.023422503616317456,    -1.4568651613027417,    0.8439724220690917,
+    0.798571546232936,       -1.6508225782150414,    0.7471436064983915,
+    -0.5604152737249938,     1.4128193008764427,     1.0043650905472616,
+    1.0870183622950094,      0.5911179729218488,     -1.0431386466226902,
+    -2.077125247120733,      0.13562160812920027,    -1.272745918658528,
+    0.18979787415990704,     -1.4882726434689302,    0.7811813892533063,
+    0.515849085662436,       -1.2794727809860835,    -0.964683969624375,
+    0.42390586541930203,     0.885147898506209,      0.22986627325950898,
+    -0.6939677804408019,     0.16188778853795677,    -0.2264056447965043,
+    -0.534549124497632,      -1.408690924750476,     0.04141496726291841,
+    -0.8188882042730552,     -0.1280002286491719,    -2.0138040197480285,
+    0.836287535365337,       -0.5616373256479325,    0.07953191463663221,
+    1.5001043869687782,      1.5536374003601825,     0.6619496792376736,
+    -1.0211200805473761,     -0.08816164819125694,   0.30006206277402925,
+    0.2693358003994466,      0.1405164211731423,     0.8203794138059589,
+    0.6583671624496558,      1.2189741640348433,     0.8226533618759667,
+    -0.6947844554461983,     -0.31886250456340587,   -0.012611709778796212,
+    0.412861647423341,       -0.4917496695914453,    -0.010644529131924967,
+    -0.3318227134845715,     -0.5345125416408528,    0.4128362476042102,
+    0.9098783683573577,      1.7723854147979206,     1.0226522597372283,
+    -0.39233205499881646,    1.2711020136366156,     -1.4304462732822179,
+    0.415601103421689,       -0.5590974111366647,    -0.5508013032783379,
+    1.9810371591942952,      -0.42039350642162093,   0.24598672415008313,
+    0.5906262189742368,      -0.02540635630606832,   -1.3609936471952255,
+    0.3280853492089046,      -0.34234321495563,      -0.10578166517229272,
+    -0.023209923679588726,   0.45616967240874473,    0.41079719206087006,
+    -1.5184650991546327,     0.21981101760077626,    1.7641093928924834,
+    -1.9076687333940698,     -0.9262467459006413,    -0.6898871145845785,
+    -1.9860062466592714,     -1.8300539288590865,    -0.9593883046134065,
+    1.1489484447106622,      -0.3673331818436951,    -0.9327973218918815,
+    -0.16793987464503365,    0.4889412465991486,     0.4853558292036485,
+    0.0424232746409659,      2.6416151268604406,     0.26453849753743125,
+    0.43347529264560913,     -0.5306544126671487,    -0.8615134018944338,
+    -1.1644538424920434,     -1.2899958336631598,    0.5506596530373628,
+    0.16192376233455058,     -0.6304616889741089,    -0.3509281488119059,
+    1.0592211138917633,      -0.20724086054491733,   0.03417446826592635,
+    0.28930666609805145,     0.4970382643333782,     -0.7562326734819981,
+    -2.4635751249741626,     -1.9505303155441431,    0.353201628773439,
+    -0.5766838415800206,     -0.3421574223794581,    -1.7171805372816866,
+    -0.8005507736817493,     0.11936000714840024,    0.03954848138946202,
+    -1.0787859334596515,     -1.1547354383659079,    1.9270434858921395,
+    -0.24975607994865098,    -0.10916598991764957,   -1.341629398270781,
+    -0.7811658063863793,     -0.2773870433912565,    -1.1503287020012247,
+    0.0905581905807892,      -1.1561992284152736,    -0.7443811738951007,
+    -0.7982288366952747,     -1.660113110520083,     -1.578324260513323,
+    0.12021134455424821,     -1.030561050785953,     -0.18526326326270806,
+    -0.14564563681734885,    0.3316947903706103,     0.8124371850406783,
+    -0.6477295852291955,     -1.1522117408663581,    0.19484748963983975,
+    0.8558065829816636,      -0.34529560069192855,   -0.06640748868371171,
+    -0.19401784338890707,    -0.15456297968668192,   0.6348189107532749,
+    -0.40414339000921745,    0.6040428410433755,     0.41435450254848255,
+    2.1502661080933225,      -0.7213342117118317,    1.1501246652590718,
+    0.8028621684242807,      -1.2227910348216389,    0.5660675574774319,
+    0.6116630973328852,      -0.6091167998046463,    -2.461081240815044,
+    0.7456479712610296,      -1.296246757765336,     -0.17242488256307956,
+    -1.7746189013960092,     0.593395609611801,      -1.835893012167861,
+    -0.5874435186791938,     -0.5645843763705455,    -0.006948798557263854,
+    -1.4830766582110453,     0.45940190338685954,    0.4836816786739872,
+    -0.36310639411664064,    -0.28440124102342934,   -2.753017335391907,
+    1.6052308625967482,      -0.22675735631564356,   0.6469858513701833,
+    0.1829973671942233,      0.05573061559509108,    0.6887883327348311,
+    -0.6394749533795184,     1.0191306313515265,     1.5752135738383746,
+    0.20089287136943582,     -0.1569282357746692,    0.9775379991143565,
+    0.41332256645214993,     -0.3749907672127625,    -0.3414864420410521,
+    0.1251347319138118,      0.7620197002995609,     -0.5036195481903825,
+    0.7900155877442463,      1.9625341815735136,     0.5926544072257971,
+    -0.06279693756433216,    0.5690948704013233,     -0.4421453535379466,
+    -1.119517129372137,      -0.758661968407474,     -1.369503369536334,
+    0.9612292766332282,      -0.4774186087671977,    -1.8504906438252007,
+    0.5107932761032629,      0.3627869700465244,     0.3037148519927796,
+    -1.3411801973119808,     -1.117671768557983,     1.7619495981884479,
+    -0.6046915342351815,     0.4556816764588298,     0.12302912294501367,
+    -1.385749055268931,      -1.4743007398857795,    0.49544989757978175,
+    -0.31013426184311843,    -0.2823527596648185,    1.0417976662680597,
+    -1.622972729815256,      -0.06015791391476812,   1.171400851772292,
+    0.8431614942896954,      -0.2760126978671166,    0.4693497113846442,
+    0.624391814570347,       -0.8755514354563337,    -1.4776844555062205,
+    0.8645293171778212,      0.05355561619587868,    1.81923518530562,
+    -0.6437492801984152,     0.9960289807066988,     0.8301586103486324,
+    0.49260233756137284,     0.028789666065523495,   -0.9453872311571466,
+    -0.29191903278941306,    -0.49357454142247276,   0.02306154499436212,
+    -1.0463603601904043,     0.24585604842757328,    1.7821885659173529,
+    -0.8779617697623902,     0.5311390534938357,     -1.8907866165622569,
+    0.5012940287184174,      0.2621525827706458,     -0.910715561800515,
+    0.5511787357536019,      0.1042923104253784,     1.8081847185695301,
+    0.11317637083995528,     0.3948098421652232,     -0.14595512222901202,
+    -1.1221200009529098,     2.6018269689100113,     0.1826190680506481,
+    0.3058228721497902,      0.08481219375088078,    -1.4667865525060229,
+    -1.3600536161515842,     -1.6751979931228382,    1.321020604175881,
+    0.5021131018107398,      -0.3352609729506816,    -1.430855611380154,
+    -0.8309021232640711,     -0.10379198658943314,   -1.2338272595674602,
+    0.872919174398434,       -0.8040286009963807,    -0.2815629387501529,
+    -0.10047742321437876,    -2.1883272094427277,    0.8091862153938151,
+    0.04021011252680073,     -2.215838739348068,     -0.3909125278815379,
+    -0.3340259563182243,     -1.0345484304589707,    0.34883023579486166,
+    1.2044536468215974,      0.3466712296452705,     -1.4110768279116226,
+    -0.6777058973768294,     -1.9782392479108288,    0.20060470254611734,
+    -0.9982408007764164,     0.27544782118443495,    0.8011608094885971,
+    0.8782095541390086,      0.2077498457770288,     -0.2557831329722226,
+    -1.6214573800287169,     2.1812746311751026,     2.2090157531921157,
+    -0.09338293365861866,    0.43140173759247374,    -1.1501898034635567,
+    -0.38804075893824125,    0.02613793850353695,    -0.589990406111069,
+    1.7573635837043602,      0.3111623937630956,     -0.6211944517110153,
+    -0.4080686100459814,     0.24348221091223776,    -1.5917573130681721,
+    0.48217416267365815,     -0.03961065156698984,   0.8984749248889776,
+    0.3553770963289686,      -0.6532588862464626,    -0.669798762536591,
+    1.3861477242595674,      0.4286558641991673,     0.595716992267574,
+    0.5938469735025503,      -0.09061614041831821,   -1.0949610973837518,
+    1.7989075071576726,      -0.19344811425951464,   1.288259781023858,
+    -0.08917952899914351,    1.1072323769241905,     -0.8662478469630587,
+    -1.3162046816037019,     -0.2793817961194447,    -0.48239734819251473,
+    0.6610139015686474,      0.3435228841031316,     -1.5464485799449248,
+    -0.7413286043970752,     -1.398718964454947,     -0.7486106349139925,
+    -0.0929789348979632,     -0.6209052964191186,    1.166529406141346,
+    0.41838978450015996,     -0.8494051807996263,    1.287479360692734,
+    0.9107639501504668,      0.1956490438371244,     -0.36431047108032993,
+    1.9367588468713184,      0.797867978941757,      -1.0750158254617792,
+    0.16160018321588998,     -0.8328062991119528,    0.8947672143922006,
+    -1.028551887735621,      -0.6368895920118663,    -0.6175958086305514,
+    0.4804098248504021,      -1.0493951522305978,    0.007732351584382505,
+    -2.1506709679109566,     0.8502613181679594,     -2.6856813751444193,
+    0.17674516823842581,     0.24977417977851576,    -0.4993912927913129,
+    1.0994124919550101,      1.129155266805427,      1.0733221894863958,
+    1.134160235672858,       0.3273844181737374,     -0.379575776151276,
+    0.26338057184427627,     1.1014036367641316,     -0.05286362775736914,
+    -2.4009370006443302,     -1.6783963634077896,    1.8024097679936724,
+    -0.8231302792962779,     -0.6107774122702994,    0.9445187064994207,
+    0.8966881305585921,      0.5585327655427963,     0.14446273318320632,
+    -2.1221742859021395,     2.2185377198844294,     -0.37887646207797865,
+    1.0895994442828114,      0.1417620321010237,     -0.535286651510283,
+    -0.2670630383870763,     -0.16860022159038712,   1.6509173495461915,
+    -1.2930402426292418,     0.3968154397807439,     1.8062215977821166,
+    -0.5095809836367576,     0.035939792523557716,   -1.1743615457355847,
+    1.6455666188856775,      -1.1336010783774524,    0.6458853786022798,
+    -1.966583968414614,      -0.8622480557958428,    0.22223923632650158,
+    -1.1136385381825444,     -0.25536373722565514,   -1.3401959153239709,
+    0.08893867127032015,     -1.1821721859407783,    -1.0605827886537522,
+    0.2656716162292382,      -1.9044102939803582,    0.6310440179478448,
+    -0.8164473681096343,     1.5969992543928437,     -0.5253670764640568,
+    -0.882040479602822,      0.1080637315243558,     0.9973410282845956,
+    -2.4356302421816056,     -0.6416116961660933,    1.2576482073370707,
+    -1.0398426800467007,     -1.2196004428565015,    -1.5911357272279794,
+    -0.34606891263465434,    -1.2559761724924055,    0.4483424504921729,
+    -1.5022911704516722,     -0.4767288408812974,    -0.19237839350272085,
+    -0.6088533677823553,     -0.23820278572556855,   -0.9633352793131869,
+    -0.8899823785676019,     1.228581425449902,      0.42386886053913125,
+    0.4224253657227928,      1.055204704712377,      0.4036398247068039,
+    -0.30559011979787215,    0.5795713056811256,     -0.24570963920798466,
+    1.7455455785171023,      0.20908587219902916,    0.04630716553795043,
+    1.5632043034939445,      0.8248789393106167,     -0.7031175609981208,
+    0.47834830452319316,     -1.2799748226221266,    -0.2474573450438268,
+    0.17555194736688445,     0.14036540748182438,    -0.16545020423262807,
+    -0.9553863355524918,     0.39913214544736686,    0.5555340717277312,
+    -0.67455386509758,       -0.022248558519345325,  0.49298815554954456,
+    0.49241020552501386,     0.35461652999634385,    0.47454998650637126,
+    0.6041801423292669,      0.7238728187464714,     0.4570173996938301,
+    -0.5084198284510081,     0.33499268913354935,    -0.6673536128870676,
+    -0.5844534533535676,     0.34217782400761604,    0.05899139359474827,
+    -0.6765454565856421,     0.5601188829056601,     -0.7557851626853048,
+    0.4610397477795232,      -1.3304509671918014,    1.3218990483889441,
+    0.48766437292873127,     0.4635509298764834,     0.017805225457597936,
+    -1.3280067985738497,     -1.6692428539340816,    0.07368055832202638,
+    -0.3710215217468515,     0.3268978404105394,     1.03801101869383,
+    0.41575306278291674,     -0.9600250435308338,    0.6342821301105864,
+    -0.6098767682603403,     0.4006482242535444,     0.5978078905583857,
+    -0.5193712091682712,     1.4601719853897994,     -0.34111232675701064,
+    0.02944049097220856,     1.271684257955627,      0.18706300582012664,
+    -0.8316131823456205,     -0.34882767348516763,   0.23151024999107297,
+    -0.44350820792220397,    -0.508181626400622,     0.9471601570178454,
+    -0.1935947847463612,     1.7380594374661913,     -0.16089414120806664,
+    -1.0209038353443045,     -0.24533906039268694,   0.9311615848985298,
+    -0.5787544444426757,     1.1178673061231035,     0.007031295609744382,
+    0.39523957055585557,     -0.7257087602551684,    0.032451164342021,
+    -0.005751541398499963,   1.048611594589342,      -0.4655030360391405,
+    -1.5624038941114426,     -1.1034780236806998,    -0.6789598403852457,
+    0.6363544331247825,      -0.8945862836104358,    -0.9795080975129792,
+    -0.3044860106281671,     -0.019787523053906828,  -0.08739507149837185,
+    -1.2838923858820874,     -0.3137757814129013,    0.9526838891405391,
+    0.39273376536460786,     0.382874398197855,      -0.7591855909532355,
+    -0.28132047820305844,    -1.2495647786634045,    0.5692889307492235,
+    0.8442629353439765,      -0.23143651813874405,   -0.3790336282791145,
+    -0.8338860874651945,     -0.11921830866502969,   1.667346601419877,
+    -0.7184427203546214,     0.21994468184663216,    0.909119669487018,
+    -0.09735103875774645,    -1.3099039595826625,    0.3380871099465667,
+    1.5267483243489923,      0.1527897173692773,     -0.03878111130010231,
+    -0.05094360048919114,    -2.129371229137899,     0.3163211476539077,
+    -0.48194475262946557,    -0.9130967795872705,    1.233354492005315,
+    -0.9533635245936892,     0.09725090825706506,    -1.2391497816085133,
+    0.3361282028679963,      -1.4076612870121703,    0.22158270784262318,
+    0.11736321373543492,     0.7360086337200114,     -1.298236012135405,
+    -0.43797297854011374,    -0.8240032498668488,    0.7204589006327718,
+    -1.7306850013216428,     -0.39191447713698985,   0.4862661856564895,
+    0.17407808920667203,     -1.5355587525337628,    1.1130526407750112,
+    0.05902018528888303,     0.9986141461256912,     -0.4228743770771842,
+    0.03557953014622508,     0.19670787778501433,    -0.4383969514288015,
+    2.212361166384741,       -0.2721763929563681,    0.33833088456937405,
+    -0.643042633518277,      -0.5558311451113628,    -0.14677071988735638,
+    -0.7157361037013368,     -0.9490017913649584,    0.0369360026781602,
+    -0.41623429320935795,    2.1270087065551273,     -0.18294260498127127,
+    -0.6600491621096674,     0.6165242040316332,     1.749861962699697,
+    -1.6042801915577474,     1.2269630835474794,     -1.0589496636645208,
+    -0.49102706494128806,    -1.3915057677457228,    -0.46944731679029195,
+    -1.3872873326515476,     -0.607664128232281,     -0.3373117955856021,
+    -0.14632084991265276,    0.2540045321784443,     0.26458401339095916,
+    -0.07850785274274344,    1.296659900457594,      0.1679388746063717,
+    1.2052424647024127,      0.1313662954361237,     -0.6393449107858453,
+    -1.3578627292742265,     -2.7929753875918086,    -0.4326404149873381,
+    -1.1556054121383519,     -0.0235206290476079,    1.2813801633238135,
+    -2.2593830927360976,     0.6729758272819066,     -1.5148685166856586,
+    -1.8539653285452489,     2.239070884230781,      0.756603654009953,
+    -2.9732697087298763,     1.341399509563597,      -0.2271672056799562,
+    1.4927652670390543,      -0.9263978183990678,    0.1973983130988488,
+    0.11754908185645202,     -2.071499241648851,     0.12850727574416854,
+    0.7967186820772195,      -0.9567603955221031,    0.5254976833832712,
+    0.6575697467488437,      0.02132373612521345,    1.1341557580261354,
+    0.6403999916324083,      1.614678316027734,      0.2596094598325418,
+    1.040151986573596,       -0.14406620240240967,   0.6770349044725051,
+    0.34197316789784754,     0.4416297451055278,     0.7412339140718534,
+    -0.31695094509175764,    -0.32093767492975506,   -1.8025277507078494,
+    0.228098602347549,       -1.1725422140666115,    -0.7705408266046434,
+    -0.38362068545303357,    0.6552034302753278,     0.5749246001730537,
+    0.4626253215529952,      -0.18069568720060833,   0.2815845090161365,
+    -0.8914041295226098,     1.5382574619597218,     1.6215173132190974,
+    -0.6005534514600969,     -1.2421281463282303,    -1.160086261198731,
+    -0.9279956878412666,     -0.9320716754841883,    0.3039704694168523,
+    0.18114878197386874,     0.8480234305722057,     0.1803105415246834,
+    0.21122352069521308,     -0.29977072182458114,   1.5603257289667027,
+    1.6108559434649257,      -0.7913035583819855,    0.30231780893676385,
+    -0.258922292491497,      -0.26280763765437026,   -0.5626894287980071,
+    -1.149770437257318,      -0.27297199033037095,   0.9414130463608535,
+    1.3761752053195153,      0.9457797784838078,     0.14329252944901932,
+    1.3453360563845695,      -0.07846346206183161,   -0.12316605462273245,
+    -1.3277442771715233,     1.186673076958446,      1.0126403694946307,
+    -0.9516732184448091,     -1.2572887581927814,    1.9917629225746998,
+    0.2260212780560464,      -1.0767860477442004,    -0.30849257765376875,
+    0.5765505226961561,      1.074486943239311,      0.8087515989320616,
+    1.6085580881557588,      0.7268330019004512,     0.4527128624374773,
+    1.2239229709493185,      -0.5002795682514862,    -0.5847376178593573,
+    -1.412213647043072,      0.7647753281923031,     -0.7017212199095386,
+    0.2545078956414745,      0.10286721496905371,    -0.3379563382692408,
+    -0.40428440203543764,    0.9906652800367762,     1.6223514361327989,
+    -0.4193605801955719,     -0.7803965063009678,    1.9288573372747244,
+    0.09008427300184679,     -0.5575263508783358,    -0.33025096255012426,
+    0.8548528484440743,      -0.08652248063173845,   0.09350516176075631,
+    -1.28935642582176,       -0.7783534055229732,    1.1131994015929634,
+    0.4191860519756974,      1.0089205348694825,     -1.7017198802433529,
+    -0.5819217005636932,     0.3101691403808485,     0.6709487705689926,
+    2.0815054971023472,      0.20090241953917132,    -0.8918393591430077,
+    -0.7602746372439191,     -1.339939442633827,     1.3445702691119925,
+    -0.1533757633394178,     -0.6414530669230175,    1.1471641199103475,
+    1.3466544515691592,      -0.3182522369946064,    -0.5191214199741396,
+    0.29095643285344325,     -1.6923037226426048,    0.4997172387174323,
+    0.6792583541007142,      0.18441259717836372,    0.710226830123193,
+    0.016501104222097083,    0.17289414155466284,    1.3878092425951942,
+    0.11228932453350035,     1.624906539213676,      0.8579579966895817,
+    -0.26342180201130616,    -0.04222310870327103,   -0.6766384345458664,
+    1.2168888293690645,      2.775838287939738,      -0.2547761837176644,
+    0.2971037099181931,      0.4859620056538132,     0.09275787107717841,
+    -0.16582551686831565,    0.6362753526816379,     -1.462260126993388,
+    -0.8733120346237733,     0.23621775902099224,    0.06686843660970944,
+    0.1991824411458863,      0.5856640533642131,     1.197451181378135,
+    -1.0505949561489591,     -0.6801618458372181,    1.074485073469601,
+    0.09047980257955619,     0.1877926928140657,     1.2110461498789704,
+    -1.8340479271583698,     1.4912616438563233,     0.19785775903704905,
+    -1.2746398302032098,     1.213305977142817,      1.7980933362835922,
+    1.5060457107789378,      -0.2513646905553829,    0.6971973055481718,
+    0.5369986846167689,      -1.3691618878378347,    2.5626632008655164,
+    -0.9930535170754015,     2.065806310375166,      -0.029921745767009626,
+    0.2654998756072961,      -0.2544307502534346,    1.3983990314851107,
+    1.7895863933853866,      0.18160672407474393,    -0.6265913448331817,
+    -0.6983076020560802,     0.6708145318839401,     -2.226478352797918,
+    -1.6080148390422973,     0.010530488621903158,   0.30737855170383116,
+    -0.48290381024829376,    -0.4313123255578142,    -1.7219461242238285,
+    -0.3902243898648281,     -0.15514462246379654,   0.2922148701840729,
+    0.5741142031750626,      -1.9481252329127206,    1.564909816238187,
+    -2.1116961510639403,     0.5163533360006084,     -0.4504382716681551,
+    0.9835872194136631,      0.5521162941467002,     -0.1893997554122214,
+    -0.31348633200633363,    -1.6658139869337472,    -0.09024554332869272,
+    -0.730779077909176,      -0.9429899454797558,    -1.1172025382783843,
+    0.0099134936428507,      -0.42202473966466797,   0.870814274480434,
+    -0.5418009784610183,     -1.490486368519308,     -0.7900616698331752,
+    0.025862158683986683,    -1.831510525089218,     1.3141075917108,
+    -0.23595072491327204,    -0.13751269724757767,   0.1281981680792711,
+    0.6613377930750296,      0.6552505353230563,     -0.7607086947822357,
+    -0.7221949211366581,     1.9671418359601645,     -2.10989827284158,
+    -1.0151233900701466,     -0.8892493319865225,    0.899280679875049,
+    0.27839248260800314,     0.31310847428793914,    -0.8748022652805998,
+    0.31802313487860584,     -0.9667723368688871,    -0.5632714677045796,
+    -0.7631042931193825,     -0.7268288882477599,    -1.004292254965232,
+    0.20764340461937456,     0.2932462038077632,     -0.8225492784707487,
+    -0.4650031337231652,     0.42381015887952384,    0.14639611945987482,
+    1.432425678662643,       -0.2625537947494635,    0.3210814199043507,
+    0.6590490986786779,      -1.0018874298245815,    -1.087752239292299,
+    -1.378103694981086,      0.4076328078957191,     -0.20254464791123655,
+    0.25179536720271184,     0.12110258326603114,    0.20328092302529138,
+    0.6297597167562136,      -0.40554836237717373,   0.7460926955029807,
+    0.6073867710811606,      -1.3900337874115545,    -0.2394566152886515,
+    1.5455037989311302,      3.5888498021953374,     -0.04519804587230893,
+    0.02457267158799467,     -1.6407824584762414,    0.11158023751619307,
+    -0.0684897910723798,     -0.5685797556005794,    1.7697835527489867,
+    0.2101750218810304,      -0.9950990055566364,    -1.0928726023996012,
+    0.7351261996257052,      -0.6334487893157318,    -0.9359891825949506,
+    -1.6869740150047217,     -0.1343353492079931,    0.5953688830713546,
+    0.8117195723405581,      0.24025750984730107,    1.645592155010484,
+    -1.1889157435189706,     0.1926098058634969,     0.37732082180552606,
+    -1.6407732296242512,     -0.1911930603906182,    -1.0959076758206845,
+    0.22560748158687674,     -0.8367562999590148,    0.6527691053143572,
+    1.5856810727712476,      -0.22035967254827146,   -0.6494884918086927,
+    -1.2159867441220573,     0.3953351140259006,     -0.9264661603693216,
+    0.9299635003043761,      1.6583932166460096,     1.72962417495174,
+    1.8202751850411605,      0.11086134807444735,    0.46043631592461887,
+    -0.7864417959252131,     -1.3294268457031495,    0.7401612174771113,
+    -1.4262708456721354,     0.9908138689873046,     -0.8637350895149013,
+    -0.20796151890721226,    1.7356299245097913,     0.25525381905698635,
+    0.5099494205393734,      -0.2714657070720724,    0.8560239729444074,
+    -0.26253776150870883,    -0.9314936624077172,    -0.9899351437172169,
+    -1.5648121841068128,     -1.2591046655488696,    0.6706509457939126,
+    -0.08398617879017221,    -0.9559804011851019,    0.7844407996313543,
+    0.18119514091051267,     0.44404776522676526,    -0.9931280423735944,
+    -0.463639413291422,      0.3491637596559579,     -0.27174056920910955,
+    1.0059336416830373,      0.7733523181842309,     1.4975212870395296,
+    0.305798317346657,       -0.6412325447026317,    0.045955164599777595,
+    2.3268611774566192,      1.0858625816318026,     -0.1536207577239582,
+    0.7120677119381846,      -0.20497351699946195,   -0.321065433501936,
+    1.1311350282077361,      0.42704008869237936,    0.934816871207801,
+    1.7476174472353425,      -0.49521207033725384,   0.31052498360815445,
+    0.9517607759557869,      0.7948877290312084,     -0.37395018631353477,
+    0.051421557010736155,    1.9246087107499246,     -0.5578818199798132,
+    0.46476037181764795,     0.49449773327543745,    -1.4321731702480973,
+    0.6498963556336096,      -1.3435470781752334,    0.21470093476895397,
+    1.2347154866793024,      -0.49646429872418196,   -1.5194622085973029,
+    -0.023631086969651303,   -0.019456792121765785,  0.1206802804008217,
+    0.2270048904889655,      0.2840499514755559,     -1.4636286327284171,
+    1.074147832860676,       -2.167130563767497,     -0.35520522211812633,
+    0.8058512463006765,      -0.7640247515410123,    -1.4515272601780367,
+    -0.7526506882339549,     -0.4868546662808269,    2.005027805824883,
+    -1.4942998166495496,     0.42086226432280377,    -0.20053141097849228,
+    -0.8160030283854343,     -1.381866737306798,     -1.1881693356450946,
+    0.3431382900497814,      0.6747699129094424,     1.3149917856364228,
+    -0.9558441520303662,     -2.122009984684354,     0.5758161963077861,
+    0.5266015748980851,      1.184989724171562,      -1.8936605253316319,
+    1.4966784766409849,      0.130830607592426,      2.017831434758366,
+    -0.20933360195430506,    1.390808999089311,      -0.5794851626596764,
+    2.1506143174341097,      -0.5134130496827438,    -1.5164507204921513,
+    0.23828332286526838,     1.1417678905208277,     1.2672521886173442,
+    -0.06064215415663978,    0.3988783520545769,     -0.011741598866499614,
+    1.3463068870842219,      1.0473485247780263,     -0.5033318562922068,
+    0.9724903697774625,      -0.020645466727353987,  1.1875498850829236,
+    -0.3789400726999207,     0.09181321321989037,    -0.568878580477992,
+    -1.564242987873337,      -1.2149655154531156,    1.1244401752578461,
+    0.6199971878914409,      -0.7913278524623752,    0.49245428618946896,
+    0.03327384268321537,     0.7721950400135805,     -0.4427896992293402,
+    -0.009579990932710619,   -1.1515859491311302,    1.1468356665636454,
+    0.5242244251503546,      0.11848255145367993,    2.4450283292820028,
+    1.1789768099362175,      1.4298101840442161,     0.3327765023336117,
+    -0.5131656335287278,     0.4573268512394741,     0.052136586166275936,
+    -0.3386984779557287,     1.1896347135703507,     -0.3110294825137788,
+    0.25452191969620097,     0.1282752897928946,     -1.4987078316195046,
+    0.5365893466625747,      0.7737421003189003,     0.05503976906315169,
+    0.25898789640622577,     -0.31668472936816816,   -0.6219550533268747,
+    -0.6250206422290641,     -1.7975671706971947,    0.5395553310410831,
+    -1.3258256799506374,     -0.4466648870424973,    -2.084882470623503,
+    -0.663721081471345,      0.5447479543009813,     0.09151492242851607,
+    0.03127813098364629,     0.23958271626431177,    -1.6902705703390688,
+    0.8736538194884134,      -0.41904610291941785,   0.0314959614148964,
+    0.4366678211277806,      -2.6547945987167663,    1.4231434003538324,
+    -0.3399902177116428,     0.5578251693764744,     -0.34417478249632605,
+    -0.6163789407488517,     1.31906541519673,       -1.2035024007045705,
+    0.29357635062421916,     -0.5304499052142134,    0.516169437698265,
+    0.8989895148025685,      0.694088934120386,      0.5573875662729886,
+    -0.5996668334778529,     -0.2464241632122124,    0.33250852147118515,
+    1.2041230159607017,      0.47053063846074095,    -0.1899886350489643,
+    0.21187698885641124,     0.914883533979347,      0.468290545471127,
+    0.899721951729498,       -0.4014327009666172,    0.9081737259224067,
+    -0.3572556459803993,     0.09466231953623339,    0.5761393368239173,
+    -1.3294334985071274,     -0.2538444911254484,    0.27381265755740514,
+    0.1662667884294689,      0.8307187378721534,     -2.323054846015768,
+    -1.6627069910389394,     0.9944626259085296,     0.7399784797107943,
+    1.9460252390123762,      -0.11591298369925847,   1.1974449680741606,
+    2.226249219280814,       -2.285464137837159,     -1.6575738072110784,
+    -0.49816435358635913,    -1.4204302044555581,    1.5152196178424255,
+    -0.2657545744015105,     -0.7002517404328261,    1.2358402043523702,
+    0.6524624398314102,      -0.5827925548946193,    0.6833371411080276,
+    -0.9214737555484862,     -0.6979447666631903,    1.1783814599542048,
+    -0.8448749810957679,     -0.4999222051877279,    -0.4615432911817878,
+    -0.5621540741511387,     -2.5454360407931427,    -1.5591533581541266,
+    0.15097997764063967,     1.3759532468774152,     0.6850098409407578,
+    -0.5191862418385803,     -0.12766508317943828,   -1.6778298192252175,
+    -0.256621724442736,      -0.24027548799924894,   -0.5913917859753587,
+    0.594942650304101,       0.39171098268593524,    0.5512196411609094,
+    2.20284569332418,        0.534813893566527,      -1.970926579072908,
+    -1.395858852299137,      -0.060224458948122624,  -0.8907418686563789,
+    -0.25253699262659957,    1.4140862276857418,     0.07992691720946979,
+    -1.2104504384109533,     1.4308372455448781,     -0.20301916113393934,
+    -0.05239938545981458,    0.21262965647805956,    0.5132156282005318,
+    -0.7357719142365079,     0.060609698458739064,   1.2435408709599414,
+    1.231668706362211,       -0.8187048474642277,    0.015923309097887136,
+    1.52482368376453,        -0.2606704163180084,    -1.3436369582461278,
+    -0.6478173982185488,     0.5970578401124444,     -0.10295820939195867,
+    0.03900753962146277,     0.2605330905965604,     -0.27790549559373046,
+    0.501705581477727,       1.3268540419092059,     0.42581321668374833,
+    0.5249268168772704,      1.1235401936535983,     0.7305665346886234,
+    1.132029475930964,       -2.0222519318951,       0.034660921559008705,
+    0.4019647070231557,      -0.1352065972897785,    -0.8532827976964044,
+    -0.13270699415004356,    -0.737743273029563,     0.33744628586367736,
+    0.6773092721412994,      -0.2402652352704677,    1.063799748367136,
+    -0.5245116033757363,     -0.5995111480209293,    0.0797746153160447,
+    -0.400542070742052,      0.9929251577364367,     -0.17293833199579547,
+    0.5331049409376174,      0.9382732540560479,     -1.6286721278848832,
+    -0.054179997398989065,   0.11997360208316332,    -1.8468367263829286,
+    0.054070003582386617,    -0.19260407481027167,   -1.442050273771737,
+    1.330175413026437,       0.12550817757029906,    -2.252640490266522,
+    -0.4759231559301069,     -0.32423921905167097,   -0.11276222196366588,
+    -0.7630128169346472,     -1.0709135146019655,    0.2489247962745072,
+    -0.9660165850307637,     0.9642351450497029,     0.48766778886862944,
+    0.23678059978605903,     -0.5690323380194121,    0.1112988413993026,
+    0.05952048460487505,     0.14930505021973312,    -1.607616807152151,
+    -0.007068781000307177,   -2.276855610763374,     0.12237995768215015,
+    2.469813065334616,       -0.9727560387374659,    -0.8104256651374947,
+    0.8295419134495967,      -0.8424433384716219,    -1.03211126818178,
+    -0.23646159235045477,    0.1526022059128431,     0.8685579546733633,
+    -0.4661623808548576,     -0.6021441784259515,    -0.26330931517180384,
+    -0.7070668198069945,     0.29915295513242984,    1.367836103116689,
+    -0.8312991073228648,     -1.1560316711632221,    -0.06987584807192679,
+    -0.5820473018550527,     -1.4302707687223997,    -1.3325691293190527,
+    -1.8562622935834534,     -0.06701778366452432,   -0.7420132569040266,
+    1.7886867297999296,      0.39401211328382896,    -1.0217639530452087,
+    -1.1012042637712758,     -0.46663561300187617,   -1.3621329410424967,
+    -0.07842905703647632,    1.0997800667528332,     -0.3215160022862116,
+    -0.6953122876714012,     -1.9724737731035769,    -1.4741903727206904,
+    0.08569345456232519,     -0.1322304108568941,    0.18894219607515206,
+    -1.4255468150562884,     0.8727020159847677,     -0.5022754140960968,
+    -1.843101129405356,      -1.1082243489212928,    -0.6425624473250973,
+    -0.07518059455303948,    -1.6654774925108702,    0.8758734383646525,
+    -0.015303872485194412,   0.8482142251404946,     1.435741192821573,
+    -0.29560241668219894,    -0.6356985983787523,    0.5763374534136374,
+    -1.7375136324294362,     1.0781759842339214,     -0.060383300850118095,
+    -0.4272011116311004,     -1.1354564499066098,    -1.3073397845018042,
+    -0.3101731569265755,     0.4601725666563265,     -0.018402180334962794,
+    -2.3062227506720308,     -0.6878654623134194,    0.5132930757387072,
+    1.8350470356684911,      -0.14992756529550885,   0.3805079488671758,
+    0.003774190137792517,    -0.40379325271781147,   -1.1513782688603624,
+    -0.9175471091335018,     -1.3414309309524677,    0.46341463362762453,
+    0.8509635072930317,      -0.18916018924468883,   -0.6368382525874214,
+    1.0094332321497348,      2.216470956012646,      -1.7477302179350531,
+    0.5598603883462263,      0.1371982965757692,     0.3205663541893007,
+    0.6921676960867618,      1.5388917176754373,     -0.12665175629117847,
+    2.1529328946631665,      -1.1797737878734864,    0.7613250020855492,
+    -1.4291400000383985,     -1.4187874518068497,    0.4189221598194711,
+    0.7199366252856817,      -0.5788997088980372,    0.5593831800215376,
+    -0.7263612711430945,     1.111067248717613,      -1.4803978115709717,
+    0.20692447468313682,     0.2861079555254878,     0.21010024088921317,
+    0.0013611289325312153,   -0.12043231129998863,   -2.5748136003771256,
+    -1.467478314042966,      0.9974267640322305,     0.6948591226877405,
+    1.3578357601589812,      0.06199866295141521,    1.6870837843238173,
+    -0.13921155244021782,    1.0308452953544707,     -0.4683452401968923,
+    -0.5508632448671206,     0.9049150909764224,     -1.446281760636267,
+    1.5249878734917528,      1.842505808509055,      -0.006423587159099665,
+    1.3785899709168483,      -0.5359166130054689,    -0.24797035477305773,
+    0.23748905194424585,     -0.5533525496853585,    0.7039305259422087,
+    0.8932282799057574,      0.6504904249250131,     -0.5129187800471788,
+    -1.52331372051813,       0.4168472674281366,     -0.3538951240493075,
+    -1.6168336913707868,     -1.2045934436042804,    -0.28537818988972985,
+    1.523682503702961,       0.38102909748756525,    -0.8797212553261298,
+    -1.079471424384434,      -0.9928547343065823,    -1.0199113579547918,
+    0.16022829958813536,     1.112470307865605,      2.7066381624293805,
+    1.7653681908668672,      -0.4823880845045114,    0.9399466819634914,
+    0.09857525793185155,     1.740961092342329,      0.5147557268431597,
+    -0.4953143765618745,     0.9642298654849496,     -0.7919651345733216,
+    -0.6284848328312055,     -0.31313013133128165,   -0.26775276962154865,
+    -2.0820052550598724,     1.0132199170325409,     2.670239410480571,
+    -1.2392560705198534,     1.3529654057421288,     -1.697502465995718,
+    -0.08227333075432931,    -0.8301343516601897,    0.18804744511989602,
+    0.5231153622052891,      -1.2922710710863494,    -0.16370081287399385,
+    0.7370373425820186,      -0.9282797573647026,    1.2395062975536613,
+    1.2848959530571964,      -0.474109171476776,     1.4181646353252808,
+    -1.9436236621179885,     -0.614642585626472,     0.5354271247584008,
+    0.9463267224891162,      1.101635569438485,      0.9796024309833279,
+    0.03940305989359209,     0.6885131541529695,     0.030005870191358114,
+    -1.4680668017743208,     0.9041192385818643,     0.5692540846585208,
+    -0.12614578099201224,    -0.5773684091488678,    1.9470091985073288,
+    -0.9316704601107592,     0.07217846745790435,    -0.701909831924142,
+    -0.05449652501914742,    1.136094862342252,      0.4099094199118477,
+    -0.3077248666731944,     0.8134382728697722,     0.9315527888512741,
+    -0.06699501701671626,    -0.430237319651357,     -0.725168207032609,
+    -1.893318066622731,      1.5509468333272902,     -0.7087439419663611,
+    -1.1591107202560487,     -0.8497269098512361,    -1.138331764096493,
+    1.1099319215739607,      -0.08612384549138662,   -0.9767218610179937,
+    -0.8057922102244572,     -1.0006571993807505,    1.1245454883773405,
+    -1.4284901011230031,     0.08202871646116622,    0.4890464285719896,
+    0.3681899382115186,      0.22620135372497668,    -0.13916073552767388,
+    -2.3487387939628617,     -0.016798314071275498,  -0.496542635876804,
+    -1.3208396907902613,     1.4472480619506298,     1.2573869226858956,
+    -0.37329771186947686,    0.35742289695031426,    0.003769619172482887,
+    -1.8897971961110782,     -0.4299443648159835,    0.8706282716410878,
+    -0.110822460714351,      -0.9975259554059988,    1.1311294568581693,
+    0.349324533915717,       -1.1596874930208516,    -0.5691807798023251,
+    -0.4224389695214868,     -0.9838471895968288,    0.7600618649134102,
+    -0.5420705793823779,     0.13699385057313632,    1.7840694736438558,
+    -0.6691534771553213,     -1.1030950588538777,    0.0011597908765670472,
+    -0.45125015557940773,    -0.3342434394288359,    -0.9117073868285097,
+    -1.5493950149753146,     -0.39365226651182766,   -1.2930694951427446,
+    -1.101577203116066,      2.839901260722455,      2.423031062995561,
+    2.376707858635963,       -0.3077609197148242,    -1.098427154375542,
+    0.5546883682273747,      -1.0289876607318518,    -0.2763183398759479,
+    -0.932271702811627,      0.893890900778938,      -0.10640955772489213,
+    0.32328601385249833,     -0.6070284495244476,    -0.198321438401408,
+    -1.8128824418797984,     -0.1007513698792091,    -0.31280314348618515,
+    0.4166491091308414,      -0.4700182408183432,    -0.9941887461535667,
+    0.0782151142874076,      1.4603307510267942,     -0.14369529992065191,
+    1.7822686232259402,      -2.5017348586142663};
+
+static double gemm_B_dram[32 * 8] __attribute__((section(".data"))) = {
+    -0.8664478084669189,    -0.26919584595197615,  -1.3329176007900554,
+    -2.738163632801639,     0.04825846215484467,   -0.9948629863343593,
+    -0.8033108243953533,    -0.14199229769492655,  -0.21780143179345035,
+    -0.6217857853549179,    0.6194143003204537,    -0.7857007533187877,
+    1.1366737185729123,     1.2242451186413323,    -1.5825929860790227,
+    -0.8750127359541845,    0.9227986457231762,    -1.2733219477446966,
+    -0.5767718329776693,    0.15766033154737966,   1.0017148276000363,
+    1.173767433652572,      -0.14278797789710299,  0.5408372635981081,
+    0.33036862989682686,    1.6280500951222587,    -0.012477512743507073,
+    -0.13488237472940393,   -0.19705190872905992,  -1.294494191536039,
+    -1.3007274684742007,    -2.690014217679281,    1.4703374404350635,
+    1.9610105264659896,     -1.7220554148793472,   0.8488507622344862,
+    0.40167086712696803,    -0.2015389689982727,   0.6210139748716096,
+    -0.10172661750384879,   2.6512102358764262,    0.9071932286090391,
+    -0.7878886483354843,    -1.0858382949069059,   1.379024301565361,
+    -0.2655155297710126,    -0.21658194229583566,  0.14919886943134472,
+    0.06650722160136745,    1.1562372120233078,    -0.9445381067499885,
+    -2.3000801560083266,    -0.5563610856079166,   -0.7947699069556227,
+    -0.6369847352231287,    -1.6634050450515812,   -0.9428613128599567,
+    -1.455590836388065,     0.9579441110417066,    -1.0880096040297595,
+    -0.22961487210462267,   1.4371029805425724,    -0.3398832634691107,
+    0.37436210630304523,    1.0063786896931528,    0.5751768841953641,
+    -0.5831451235599439,    -1.0419286272825181,   1.290922608517992,
+    0.18808672448607996,    -0.7179381374705412,   -0.35244488265096996,
+    -0.05185117847963711,   -1.7777540593042975,   0.48274581650837967,
+    1.044507444420849,      -0.6557086154531798,   -0.8409251602073349,
+    -0.41237089959553114,   -0.198569892869982,    2.0169615802808827,
+    0.8503137006877224,     0.17926105131041656,   -0.6137829542869749,
+    0.07685573557540452,    -0.18433964009166845,  -1.1638451761216513,
+    -0.4277887030842558,    0.4411210785041726,    -1.0707357082403015,
+    -1.316411556984231,     -0.1570751465395589,   -0.39897802879433747,
+    -1.7212660524573893,    1.189252251227011,     1.1757199286179199,
+    2.085454803644193,      -0.4567934792779909,   0.5705740267177913,
+    1.2257833423692706,     0.5420642067584286,    1.1507729149262078,
+    0.15992421407646182,    -0.48685124597683244,  0.46892464585998334,
+    0.49196797616451565,    0.6807027210685583,    1.0908637056398875,
+    0.15887380903994716,    -0.21453300473108736,  1.1784382829719777,
+    -0.14940975640057805,   -0.8207079482469287,   0.948070538916406,
+    -2.133965418607312,     1.1204292125539161,    0.8456149468358246,
+    0.00045461656193978846, 1.1421526481676492,    -0.4013807281214085,
+    0.300253188800929,      -1.4361469464088634,   -1.2341268332309472,
+    0.44501135242641326,    -0.41123438987980065,  -1.1445370298329478,
+    0.9281215124646743,     -0.0817383338431424,   -0.6666383689246952,
+    -0.1631921520215719,    1.5044034941371514,    1.0787671958533638,
+    0.052262384119041064,   0.6433971834111883,    -0.5809986048380289,
+    1.7993085019676671,     1.3093999081854253,    -0.3588929120674885,
+    0.19973684974030312,    0.9218243648217431,    0.9648698929164248,
+    1.0081684702040952,     0.6850101660515783,    0.3455656249062615,
+    -1.5934411323776443,    1.4631087906742515,    -0.3374135018733958,
+    0.24495298609757343,    -0.027637976744933263, 1.0522363256522282,
+    -0.4232727451183818,    -1.1645468061884534,   1.4673402943903258,
+    0.69677253637035,       1.5442525423441513,    -0.04504096559505132,
+    0.3403179565013391,     0.9028106227686468,    -1.019352895244877,
+    -1.5479571297501333,    -0.8245524872180285,   -0.6391296501997838,
+    1.7815250312245223,     2.568718911403891,     -0.20949697334290565,
+    0.09281105245080006,    -0.3195735919565766,   -0.24343757504810626,
+    0.34216568615235715,    0.3405408957145234,    -0.35249022832024257,
+    -0.11054997524311237,   -0.6043689831974162,   -0.7322176535676368,
+    -0.40028495513621554,   0.6914663377429318,    0.4859445259577236,
+    -0.524994091698092,     0.971229210381635,     0.060267305771780334,
+    0.9568165094889532,     -0.19017586111747398,  1.801384404935202,
+    1.3973464561932007,     0.7263083097504957,    1.4418015042317407,
+    -0.6456546492490395,    1.7400310019945346,    -1.2244296993687511,
+    0.0799808821726645,     -0.6134190871091123,   -1.9064596041961541,
+    -1.2964876886774521,    -0.4351881513003847,   0.4871980388649271,
+    -0.3702688787311026,    0.9379731114437074,    -0.32767040749978116,
+    -0.925783697177226,     1.3590713013597555,    1.2069400730593571,
+    -0.24599126352752312,   -1.6126366185562198,   -1.0902825604564315,
+    -0.5169354832247943,    0.07568666615226953,   1.198406971048843,
+    0.0715991739612104,     0.29084294547686296,   0.43081700754795466,
+    -1.1802965203121036,    1.1252294466737736,    1.5199186413646926,
+    0.524277855398378,      1.5479085711378855,    -0.2501535469865248,
+    0.007646379133240851,   1.3698606927977426,    -0.17056908846848967,
+    -0.6126944163091785,    1.7831876449521953,    -0.1544828295146864,
+    -0.8033132589180776,    -0.011252554752164927, -2.1426532931566165,
+    1.0452534113784546,     1.3479666476823082,    -1.2438863086619185,
+    -0.6713781804156431,    1.8579564289726747,    0.9663428443219099,
+    -0.33116077519206116,   -0.16693523409864475,  0.4013265586992219,
+    1.420535463776831,      0.7748533673053261,    0.5650775219384153,
+    -0.20397421464062152,   1.5432529196256664,    0.5821664630576966,
+    -1.0984668345257775,    -0.3889339769931354,   1.8022017104354366,
+    -1.8169151683751765,    -1.0587754366235997,   0.5480177509051181,
+    -0.13757710568278658,   -1.1347257966615762,   -3.503470740278014,
+    -0.33143061570844495,   1.1801690821708763,    -1.0005377775454445,
+    -1.1470575346219,       0.7745823179412247,    1.4025783214984866,
+    -0.8791841055970029};
+
+static double gemm_C_dram[256 * 8] __attribute__((section(".data"))) = {
+    -0.34773857342465253,  -1.5180173420573069,   -0.0015612914138427802,
+    -0.7483475092950316,   -0.169794308622397,    -2.449015152114231,
+    0.9165631885722562,    -1.8455292614274832,   -1.3494701178275825,
+    -0.2408659566199033,   -2.0190798733960604,   -1.614955796298003,
+    -0.9439760588238513,   -1.8389872214505196,   -0.7063346060706717,
+    -0.10513280494133308,  1.7034126035726809,    0.8695825042090402,
+    -2.459354373833163,    -0.2119832239834745,   -0.8634538909746305,
+    0.45563252694173845,   -0.3429022084973278,   0.35037872738958387,
+    0.650214392357114,     -0.389819722669471,    -1.6541481555498583,
+    -0.4149735426847722,   0.6223596138229658,    0.5689210712549816,
+    -0.1870487453981799,   0.6665091295856984,    -0.09750004531683902,
+    -1.293466202720337,    0.17311827694809503,   0.8349840917342849,
+    1.3103346648219298,    -0.5855889048882456,   0.12303263120642917,
+    -0.23876119283879746,  -1.3496563624416913,   0.3190324832728446,
+    -0.9351725976259453,   0.06906984644858236,   -0.667537765283611,
+    -0.5924779735874447,   -0.06174995377824941,  0.08076153200502859,
+    0.4950616664213433,    -0.40852331015629423,  -0.2822556644596731,
+    0.366098107899854,     -0.4203100080018399,   0.021022794546593573,
+    -0.5754073063095951,   -0.05190745325309034,  0.823408859438189,
+    0.8115196884173588,    0.8170596623277114,    1.2125703987524425,
+    0.15010013333898356,   0.9918216298959872,    -0.3222809956359779,
+    1.007254606403882,     0.7551449671795064,    1.6635912876488497,
+    0.8335022364895643,    0.6780986280020843,    0.31636260671979444,
+    -0.5029847246349145,   -0.6471775393842819,   0.8481408154914218,
+    -1.2813665006143202,   1.5641182821960566,    0.20629416001645026,
+    0.6146674726601791,    0.9699000486819949,    0.2506936204313651,
+    -0.08208420115300402,  -2.1490669616758464,   0.3558410447798085,
+    0.5631568612153901,    -1.4669241339848622,   0.19192114773334576,
+    -0.10362623033699943,  1.0404309208702738,    -1.7054040494098741,
+    -0.5555848419989111,   -0.19705713829419402,  -0.8642458811185029,
+    0.18661812972552305,   -2.0579994626608094,   -2.2675603148493075,
+    -0.026481361608373635, 0.5477702483951933,    -0.8275074442425587,
+    0.3686745572019048,    0.30395294545244184,   0.5763534464782991,
+    0.07705344422942864,   -1.707846798634213,    -9.994851067429766e-06,
+    0.12755221109491033,   1.5006885998969877,    -1.4980227859422888,
+    2.2917706073300854,    -0.0842100503101317,   -1.0641391996143383,
+    -0.2831420347040503,   1.1183109221284222,    0.05163669775364736,
+    -0.7527945256358407,   0.6880572013131692,    0.9789504735924909,
+    0.005716215686347598,  1.7061841006805951,    2.111759919666818,
+    -2.4207515787773324,   0.030813384463453393,  1.853491346651707,
+    0.49866413910989477,   1.4841910008845924,    0.5717141676427112,
+    -1.4452460513942498,   -0.6322311107151302,   -0.00927208120981319,
+    1.3360854925019234,    -0.06257348475137328,  -0.4791731359831256,
+    -0.539929414445979,    0.18852073758751872,   0.20664836125402217,
+    2.296450248890529,     -0.1387042908389778,   -1.2386450866891667,
+    0.6184007128266562,    0.2720471956311861,    0.17489774103306607,
+    -0.7144204057942461,   0.47059078014819544,   -0.48557530091292694,
+    -0.5391268645530839,   -0.588718412528195,    0.9788619505770805,
+    -1.4342299125268196,   -0.08900096435751804,  -0.26497309485874243,
+    0.7464223371872424,    -0.1774361771998253,   0.9128182032765721,
+    -0.7642095753970823,   0.4322508018523881,    0.27615469792756403,
+    0.0850634020344228,    1.5647312560534945,    0.5316733964367721,
+    0.267465558029808,     1.0981805392653445,    0.3867644328467991,
+    -0.250654519097939,    0.969011832991225,     2.2330924114487427,
+    -0.5576923705940404,   0.6440618802555158,    0.13606940602070375,
+    0.09485061856636698,   -1.885779974869319,    -0.6359750089554627,
+    -0.8031526913681826,   1.4349414905161917,    -1.1188622832892654,
+    1.3287581889567297,    -0.9481086415984541,   -0.17384531840378614,
+    -0.40275284510999515,  -0.5561646547230115,   -1.5587465452599274,
+    1.3908548299786019,    1.1241013429496676,    1.2043863683409952,
+    0.966840293211474,     0.9119828106133251,    1.2412853764203529,
+    -0.7641319400279216,   0.5709829951621734,    1.4536969670667164,
+    0.35210050064765785,   -0.17801127918352874,  -0.8774557700981405,
+    -0.2643923584751809,   -0.46637201691965025,  -2.987138156019846,
+    0.4744792863315763,    1.5252227741814424,    0.6278634917644356,
+    0.17733608349841298,   -0.7248816638753329,   -0.2380268256415137,
+    1.40370360106282,      -1.3675648722554687,   2.2653334847231292,
+    -1.5020456873792585,   0.8616506513553119,    -0.669119240714314,
+    -0.44825010764116574,  -2.1526549434174522,   0.9492330228446778,
+    0.43009305566991674,   1.0754886823617889,    -0.4951326757496067,
+    1.339414797014939,     0.18526264377854446,   -0.1726727175178307,
+    -0.4962456405705552,   1.2400437844205696,    0.3640308350339138,
+    0.42357221316694416,   -1.4790679327029534,   -0.05869192848212812,
+    -1.0049228811570965,   -0.8061912041210746,   -1.8532229837018117,
+    0.5919783775381482,    -0.10700626033675559,  0.004502568416635188,
+    -0.9846241889921361,   0.1857377918216853,    -0.9949796927303677,
+    -0.08588041644483388,  0.6320356062947422,    0.37556820312028144,
+    0.5918259056673477,    -0.6754264697003683,   -1.9417240937816695,
+    0.2785245191868363,    -1.0667623993128017,   -0.3201313666044171,
+    -1.177584435343945,    -0.23234989729376318,  0.6661822636901923,
+    -0.32866222489801944,  -1.224164655053373,    0.14533826828666327,
+    0.26878937334474795,   0.020888815547868353,  0.28162762088334886,
+    1.2385992841527385,    1.6635383311718903,    0.7125799605274027,
+    -0.35048969938905733,  0.36207584688760275,   -1.3876797022010494,
+    0.011606104639177989,  1.8621808596762959,    -0.05168725928978887,
+    -0.011415423911721501, -0.7836292024544526,   1.1155591605019877,
+    -0.2837060790006533,   0.30552155251352986,   -0.3486955885700405,
+    -1.2133455694328756,   -0.1788114224262723,   -1.0088025004547774,
+    -0.6773898740583413,   -0.5710931286506443,   1.7219766233809022,
+    0.6477573622583815,    0.31522030570865567,   -0.6290568589564827,
+    0.6088364600258124,    -0.13517773768618543,  1.2219572122398092,
+    -0.22035596943155994,  1.7200349980727407,    -0.23089329647335974,
+    0.09040271108929115,   -0.465743551611575,    -0.02607262961195901,
+    -0.9807101002063628,   -1.1477763348142467,   -1.6623621527595869,
+    -0.8408746211265967,   -0.9454366311105781,   0.28792316268968743,
+    -0.6447186985936608,   -0.1555317421087816,   1.3110109083758432,
+    0.5933328166895551,    -1.5632855995507353,   0.40570070963281274,
+    0.6021770280241983,    -0.14236758174963446,  -0.9484142582050443,
+    0.3623701346863455,    -0.2558084549227233,   0.26685005755807917,
+    0.5813726401116365,    0.41974577890097914,   -0.49238451866001437,
+    -1.6141713114116516,   0.09627778883381505,   -0.12377711089695145,
+    -0.16499436123548156,  0.3254741734296358,    0.534275105285834,
+    -1.076878239536878,    0.8440453604836708,    0.3504770261484331,
+    0.1634560608125362,    0.06530229899375412,   2.1891572713203273,
+    0.45167555366195733,   -0.08502849876527951,  -1.5881041971855507,
+    -0.26975620475015966,  0.4845988268276035,    -1.27054366040003,
+    -0.14727410494904183,  0.1420469590945852,    0.7856826342154858,
+    -1.505276808600619,    -0.18407842554952356,  -0.23572461682172569,
+    0.00435035711778272,   0.41782294190400265,   0.8776182062140807,
+    1.0973614106496443,    2.595274954879836,     0.22061764830607825,
+    0.45747716709749586,   -0.12478805354682113,  -0.07910260647114052,
+    -0.9054836100720062,   -0.17760419045987708,  -0.6485031980339019,
+    -1.2767361802263582,   0.15782319418701815,   -0.5606861442092855,
+    0.20454494869325626,   -0.28470603951550644,  0.5046069848673681,
+    1.4411720975744013,    0.527827163052238,     -0.3566965379304601,
+    -0.36801681073369796,  0.2112814090279463,    -0.4151472647494571,
+    -0.346511892696469,    1.1458336659273254,    0.2859749013421969,
+    -0.47343024621525326,  0.18770177069068336,   -0.11556475665262822,
+    -0.5065365234224046,   0.24959006153773725,   -0.40086398982102556,
+    -0.5927699104906345,   0.71418533566216,      -0.6792439586666326,
+    1.3894292253975182,    -1.237040076349818,    0.4637610833984914,
+    0.39562936383224917,   0.3566739347810464,    0.2955787640589749,
+    0.9043584680218593,    -0.25751662281882054,  -0.3750380839465705,
+    -0.3335699196412441,   1.9910698165301737,    -1.0411248008598626,
+    1.0793173813685462,    -0.830852121057188,    0.5370376792473369,
+    1.106201620616372,     -1.2224978644021336,   -0.8836452164129537,
+    0.8703382873488948,    1.201407287223087,     -0.58723455451124,
+    1.7486713047278428,    -0.2714969541740963,   0.38176732774494543,
+    1.2730932421616783,    -0.739638769836486,    1.6647141195225839,
+    -0.7468443444908901,   -0.09595606397085749,  -0.386883413973615,
+    2.3254995178573656,    0.03183710749503594,   0.8685687610143468,
+    1.1742945125253426,    -0.42521271973827734,  0.8998630847898532,
+    -0.3142547811392696,   -1.7264312441728682,   -0.3699036449734651,
+    0.05043686356548501,   -2.236200001642429,    -1.1901821982437137,
+    -0.07749348769202634,  0.4284843262742979,    0.6332777246971583,
+    -0.020810968024724326, -0.6579897341468981,   0.5799681638907245,
+    -1.3649517477886466,   0.7081421209957501,    -1.522828568073674,
+    0.9142856717130949,    -0.9013464295915706,   1.5581961161385456,
+    -0.4263786020860245,   -0.6186141085519314,   -1.022668943563943,
+    0.573485159528479,     -1.2054713120154232,   -0.2596948196306716,
+    0.42742210278796333,   -0.8878989535212926,   -0.9142557208553931,
+    -0.5098513249844246,   -1.3574176966851919,   -0.7228315228879881,
+    -0.016807380455665297, -1.5583299598136113,   0.007038674746535084,
+    0.07543804656272345,   0.18589316992452878,   -0.007122084568454833,
+    -2.3471153491909176,   -0.9016692537714925,   0.30810172440307454,
+    -0.16710824778568148,  -1.135975874254707,    1.5770925782939509,
+    1.2381054064293109,    -1.3732177534140284,   -0.15464106781515494,
+    0.5360817489919205,    1.615056207373931,     -2.128344592781782,
+    0.6365718942295442,    -0.38759884463530836,  0.15927012432143534,
+    -0.2993437275505302,   1.6575661705143132,    1.948217281212589,
+    -0.27771259326866726,  -0.9331521971860169,   2.5530230039400132,
+    0.42653686051812795,   -1.0762479141695902,   1.1220530408656464,
+    -0.2040350749680114,   -0.3341193150436785,   1.05572248658127,
+    -1.7243095123484127,   0.9363335936923173,    0.17974788136198763,
+    0.3521668997029616,    0.19071459408391295,   -1.662785508430058,
+    -0.7720487211061781,   0.3739697419711484,    0.5128067002080944,
+    -0.06719610784819272,  -1.6592128976841631,   -0.26796861289982327,
+    -0.8000853840634611,   -0.7705731265963779,   0.4787425773706831,
+    0.30214527695193344,   -1.5116929995171924,   -0.13330696743783207,
+    0.566716739373098,     0.18753575672448064,   -0.1735592922273245,
+    0.008421092716510238,  -1.1829829958875724,   1.8865442924964884,
+    0.12901947860090485,   -0.8710623384309801,   -1.848193456972566,
+    -1.7731742925916671,   -0.6277792237737273,   1.0315094535515665,
+    -0.5742703348792204,   -0.26521573999703135,  -1.0157811035727655,
+    1.4864098861574555,    2.2413175786633723,    -2.736491742541911,
+    -0.37195203428035667,  0.48753045160816194,   0.48834814109466096,
+    -0.5153009728064245,   -0.47810618125838644,  0.6699413725033236,
+    1.5139309819473863,    -1.7883578442680907,   -0.6989041165036696,
+    0.4565642844606747,    -1.02733283957039,     -0.5541637399372089,
+    1.3216419194607467,    0.28002491598190404,   -0.530860154076818,
+    0.47441468383964763,   -1.3621700550426006,   0.16303103301566707,
+    0.45044224472678523,   1.2003593063704623,    0.6385403529377072,
+    0.13606516488490028,   -0.1959228345731111,   -0.2510195426575827,
+    1.2234686078002708,    1.2364255029101434,    0.5379954851673818,
+    0.035228489727472154,  -0.8592656997031094,   -1.3517449076017924,
+    -0.4551460758494535,   0.7756040288236692,    0.15994299057187863,
+    1.2760745161707945,    -0.18846312833089415,  -1.6274816970356987,
+    -0.6890207051410148,   0.8336090669262715,    0.24605640820631522,
+    0.12236371070194905,   -0.04535285741118887,  -0.5059619960221533,
+    0.6385095695398875,    -0.5281172031513115,   0.3932293425611461,
+    0.018617445310154322,  -1.6083011439585453,   1.5365030615408448,
+    -0.2547448062528955,   0.8372347752341472,    0.5874745990105207,
+    -0.024774718149270333, -0.46080051711190423,  0.20164051932230287,
+    -0.5336836175866589,   -0.83771574758704,     -0.5110064514193728,
+    -1.6740713576535466,   -1.0094242405463425,   -0.1429874806535065,
+    0.5551703297471298,    -2.0250180985370356,   0.47801334977531906,
+    1.326380840144046,     0.8807352556262709,    1.3571065086380423,
+    -1.2055418663580546,   -0.9689193965796327,   -1.4108018816505432,
+    1.3653649093708031,    2.1830840930665776,    -1.6068407177087785,
+    -0.16515201025398155,  -1.3399595611582609,   -1.8787044825699521,
+    -0.9531262423989393,   1.4727731160981108,    -0.5015883355482462,
+    0.8012316786573992,    0.6557897809564622,    -0.8350706980626185,
+    1.3339024177207273,    -1.0939351804603996,   -0.5208287864362048,
+    0.4440704333041488,    -0.30363640870846437,  -0.2524367541846503,
+    0.8091199365434522,    1.1497465649921745,    -1.8071846596116674,
+    0.028130295461987753,  1.262872271351314,     1.5788115317757885,
+    -2.5204435360234703,   -0.7690849938397684,   0.08383571539638901,
+    -0.41878124193108657,  0.7203771254155533,    0.483727352656991,
+    0.543259274303029,     -0.23892494270050907,  -0.17874980599055695,
+    0.9333009595926393,    0.5322213440277492,    0.3341534868450049,
+    0.1061485616410554,    -0.7651103743704749,   -0.7582611368162552,
+    0.12860500090674384,   1.0356370837401792,    -1.014282910548148,
+    0.3268337907382906,    0.3973423426909158,    -0.258147985182714,
+    -0.11897530364059877,  0.6403771613543322,    -0.7840290211298692,
+    1.3899869745813829,    -1.7461800321473127,   0.6587849732743524,
+    0.6926227906737444,    1.3832879743256457,    -2.039974772932109,
+    -1.0617750866845201,   1.0794931028519947,    -0.7803952356304829,
+    -0.029151468018072845, 1.0747966456287827,    -1.067575418020097,
+    -1.043709649779667,    -0.9877099807087995,   -0.042154511436880614,
+    -0.7482063743157606,   0.05465703777703852,   -0.11385045687177484,
+    0.4999319208963726,    -0.6609919849553803,   0.5505355806952128,
+    0.8462651240873857,    0.8889439159876387,    0.43880929189673323,
+    -0.4307103378331353,   0.10403838927909911,   -1.401439772244394,
+    0.30515502608139744,   0.9051853857787521,    -0.6565569381583112,
+    1.3921015583640746,    0.8330274526396997,    1.9641950565234692,
+    -1.1210056811798583,   0.07618380474175596,   -0.6626922869652763,
+    -0.41474110604315556,  0.768989582443825,     1.153925984678248,
+    -0.025828307518319986, -0.33582914065170405,  -1.086546740717179,
+    -0.049550959426929435, 0.2749789597326725,    0.6289980408615587,
+    0.9348772872044964,    -0.5590966155655815,   -0.6777056082753872,
+    1.329548011441506,     0.2650997624116521,    -1.714345385135347,
+    1.6041136821165938,    -0.683611035816926,    0.8107397083617613,
+    -0.3288075992556972,   0.05545150072977048,   1.668207484093743,
+    -1.8213319097957212,   -0.32104235019435656,  -0.7252152823997304,
+    -0.2749628326785006,   -0.3146125776614634,   0.9241429770983198,
+    0.42962507278677686,   -0.47200840906082286,  1.506065605341199,
+    0.8421951003940317,    -0.8824135110063928,   -0.3749041976353263,
+    -0.6783535962789917,   0.2135175255405966,    -0.38523271108235013,
+    0.745729458313899,     -0.5301381626153798,   0.011964808217803193,
+    -0.5994884276329193,   -0.6087986642038777,   0.8460030766273362,
+    -1.5099468960178484,   0.23429751671295412,   0.8220195859351428,
+    1.3077783277281938,    -0.939451104610598,    1.215978898711938,
+    -0.10837491730138378,  0.09064870625392005,   0.27819229318519756,
+    -1.3194260074098607,   1.3109791129565636,    0.6973868543528213,
+    -0.6578821577803282,   -0.59120591157354,     2.356229676921831,
+    -0.2023124583802315,   -0.07351020362553724,  -1.6320738875284753,
+    -0.231817344278271,    0.5220059184460156,    -0.5459672630894421,
+    0.14509451408285662,   0.32315689052594776,   -0.3698094979236686,
+    1.0031814731951443,    -0.19152307148555803,  -0.08510880434529972,
+    -0.0111277429067997,   -1.7999331509980765,   0.5778527494180197,
+    0.7689213699174157,    0.7758828180873433,    0.4445158400205626,
+    -0.08636725225276692,  0.5445698082789714,    2.726345225715578,
+    -1.1020637866763199,   0.6042776396476542,    0.48987312366707086,
+    0.8415636565515608,    -1.4262804427230003,   2.013603235707255,
+    1.2908712293884588,    -0.2316126812433252,   1.8260098146802866,
+    0.1653305350904989,    2.1195623506557215,    0.21637586917420903,
+    -2.0113555454369507,   -0.02635368204754571,  -0.4530074754211338,
+    -1.374124862692617,    -0.9888632144228949,   0.2805827516389419,
+    -0.7490247257969906,   1.0013863202019033,    -1.6840618071789317,
+    -0.24691300297514468,  0.4706305044429235,    0.4064782255992699,
+    -0.5618611621630184,   0.2713953455489018,    -1.0351903850566193,
+    -0.7024864286723632,   -1.4207605106251908,   1.3081598876325893,
+    -0.403956863988553,    -0.9937427441033627,   -0.28864785238790047,
+    1.3615553518942063,    1.758052768854154,     -0.893886759086688,
+    1.8100803405989192,    -0.05274933545778498,  1.1509553636933993,
+    0.8790915355631607,    -0.7667288076758166,   -0.6868296553602743,
+    -1.6688406760724903,   0.03770301492728748,   0.41124177554941527,
+    -0.2023345782796551,   -1.2388845508999888,   0.45392625851564433,
+    0.8101372078902861,    0.1684909831244163,    -0.6236856513747707,
+    0.33961093904550455,   -0.9400370785584761,   0.2754782311005343,
+    0.37772814970976376,   1.0608826525779147,    1.8585498993509835,
+    1.845529784354194,     0.8851544532233577,    -0.5307920318770276,
+    0.6679309224497456,    -1.4098032082421088,   -0.006865089944621166,
+    -0.12337452543892656,  -0.5023806032687841,   0.5046343711921749,
+    -0.43124049330732034,  2.0119697023794703,    -0.17371831122744655,
+    1.9016114883446382,    0.28963135210743485,   -0.9936959448801446,
+    0.11386861870058002,   2.1438173196228325,    -0.1520386766296652,
+    0.09048801040934967,   0.552559783493722,     0.7954773518149092,
+    0.7537133625060775,    -1.6917136796047982,   -0.7310809431926265,
+    -0.5307802182060947,   3.0396313945064994,    -0.7975563526703294,
+    0.13824041949870988,   2.6909813222624233,    0.5069710984396698,
+    1.345760419128417,     0.8517269455848258,    -1.5832870956268985,
+    -0.46368564319269995,  -0.24682951523719382,  -1.8036145138223494,
+    -2.079101522450251,    0.9987413635978624,    1.9216928243695188,
+    -1.0662435359090652,   -0.11620296753003047,  1.4569200388633798,
+    1.0526224588833946,    -1.4124027063689524,   -0.03778769480096601,
+    0.41131503268849573,   -1.8799548801686847,   -0.5409584184558666,
+    -0.5569526238995621,   -2.3038185355902883,   -0.7953370674569838,
+    0.12675514569761775,   0.4239624014279386,    -1.300578439106951,
+    0.5394733446716398,    -0.19788927296111564,  -0.13139642975330676,
+    -0.5929057704623811,   -2.17136716488981,     0.8639412355426154,
+    0.46631513512647244,   -0.025449189635790025, -0.5283338671860652,
+    -1.3536693767207568,   0.4052383006112545,    -0.46516071212474297,
+    0.5759925811681487,    0.6725413608219173,    -0.5022593342982383,
+    -0.7316681360882582,   -0.16556227186035294,  0.32938062973504706,
+    -1.724968822338692,    0.18749512843224111,   -1.4553704552237026,
+    -0.36522506902755886,  2.3092433960884073,    -0.992985968433516,
+    -1.0238837271604306,   -0.41037432938736007,  -0.2234428352466449,
+    -1.3020176874085216,   0.34191848039336337,   0.6372296066402828,
+    0.5077401550042168,    0.3480125112977436,    -0.2713329873879926,
+    -0.9464530360810764,   0.03423810669617126,   0.5245440536490458,
+    -0.8462101018940086,   -0.21038665058936434,  0.011860772427816819,
+    2.2640949779269897,    1.1282120011681434,    1.3529208640331598,
+    0.7034629044173082,    -0.6143903797606617,   0.6124296125553719,
+    1.5247696670914084,    -0.9906183897841768,   0.06094682601151266,
+    0.129110780420336,     0.5608317387757118,    1.1665592987470135,
+    -0.19813475036562694,  -0.15701573561698962,  3.1490354582707827,
+    -0.4801988804003396,   -1.3727606815843847,   0.1392473284446283,
+    -0.5623901241959236,   -0.16908679143225883,  -0.11917779241994936,
+    -2.282323610246956,    0.086087173030743,     0.22932640182832043,
+    1.1849047475045955,    0.17272675967307505,   1.1563225260751944,
+    1.6419015051821453,    0.5252296268235441,    0.461812927685268,
+    -0.3298086465888062,   0.6225243242676698,    -0.3304828432384983,
+    -2.3478811102409227,   -0.12643247465621943,  1.1392691322285013,
+    0.8861186301191449,    -0.2681667614276473,   -0.7916496302646907,
+    -0.26548098544803445,  -0.03533041609632876,  -1.169753416282866,
+    -1.0074782162030342,   -0.08028743850678004,  0.21583121461716778,
+    0.5772522412813503,    -0.8050098823821137,   -1.9282829370296577,
+    -0.1938537688964573,   0.9799490877808611,    -1.4753105675990126,
+    -0.8556676999627589,   -0.6708981092384301,   1.6463962020759197,
+    1.108331370300924,     -0.3313697589650228,   0.778156122123936,
+    -0.704880427365185,    -0.03375919388640042,  -1.839382493894296,
+    -0.9794042919723208,   -0.9540250070449342,   -1.1685460411081725,
+    0.5560498259070742,    -0.9942278816896791,   1.0073009614914916,
+    0.5563557835948522,    0.23771741886004574,   1.1699411321155897,
+    0.2519587371340558,    -0.7124303201431025,   -0.4327034865264519,
+    0.6670193152868803,    -1.2755046982370593,   0.9096805272252295,
+    -0.2024661869122557,   0.6187048093513549,    0.11778233805744767,
+    -0.7801211869566622,   1.5878480978066458,    -0.243287908024849,
+    0.30271865928638947,   -0.532307930087134,    -0.8043411911484267,
+    0.09418214702001886,   -0.5020346571350188,   -0.061850813081033344,
+    0.13452222346772708,   -0.5321505862854292,   0.9844802007473505,
+    0.600171438632899,     -2.0542639460442556,   -0.9139045274992471,
+    -0.37278282165794174,  -0.9821111526085611,   -0.7306757992012559,
+    0.6442348578885793,    0.48637022353967957,   -1.614533707235306,
+    -1.3002342291006015,   0.2512264268441221,    -0.30402020418469033,
+    0.8175197576778445,    -0.6535747000468268,   0.03406625498962022,
+    -0.8738737518262515,   -0.2826009498372971,   0.5993703664463306,
+    0.3822143066009761,    -1.1112235261730925,   1.0438553071415444,
+    -0.0639638289701236,   0.4357106721929758,    0.43077092387705723,
+    -0.45632744190094626,  0.8701011295573475,    -0.726558412340342,
+    -0.3783670244043,      -1.219861857501173,    -1.5457208690284705,
+    2.1965883290999906,    -0.16656129728261077,  -0.41133218221658546,
+    1.8752628396925854,    -1.7424592350472532,   1.2195445437916312,
+    0.2458659269712413,    -0.13914722549438086,  -0.2329782137246976,
+    -0.299481109645185,    1.4889396825804937,    1.0135218388647422,
+    -0.134046575215799,    -0.7901255624937628,   0.023460144993446286,
+    -1.0110633052616331,   -0.8128506932797162,   -0.3010386415719278,
+    -0.7609593446828943,   -0.6484390433353062,   -0.36348254451076695,
+    -1.039367645468605,    1.5186384947302358,    -2.1273218129269744,
+    0.6995390738063699,    0.6686963944766938,    -0.1798489210447776,
+    -0.1646379437128953,   0.13809074501334456,   0.042799914462309185,
+    0.6972732064010639,    0.5418133504987768,    -0.4087454562629232,
+    -0.9885360407116296,   0.3131221361842731,    0.5711935596347494,
+    0.784186575368569,     -0.5527824665146726,   2.475606746017028,
+    -1.731056447131967,    1.8424791488079946,    -0.8095694238772101,
+    -0.10665068690474841,  1.74995417077716,      1.860630599586012,
+    1.5551380750305726,    0.7963112689403228,    0.4060066952611825,
+    -1.3894410275760738,   -1.190483984935601,    -0.07625938544938765,
+    0.6063495734290469,    0.7203195806976002,    0.8462169483102044,
+    1.3955934365423186,    1.4183791903258378,    0.03988158050847075,
+    -2.091249801950745,    1.008995846416715,     -0.21997721328336003,
+    -0.4826465287563311,   0.16769091307850742,   -1.2936915044274908,
+    -0.22653025456987813,  -1.4478510491563867,   -2.3221682514405493,
+    -0.7074077695752963,   1.4576197940138735,    0.11839782747846084,
+    0.7736417529146844,    -0.11908263389371763,  0.3983293820454239,
+    -1.895306846311264,    -0.7300265984270734,   -0.8780772462572493,
+    -1.3737019426068633,   0.11028064358681212,   0.38767844759796233,
+    0.34705488392517764,   -0.06222321545941159,  0.6955083272271694,
+    0.05750039791610055,   0.2692482997010145,    -0.5863547274167191,
+    0.5418067133073632,    0.4177371256439237,    -1.0319400918227448,
+    -0.6596567511738602,   1.0649973146078238,    -1.3130437503360273,
+    -0.41670138996537714,  1.018191052287477,     0.6722674235735073,
+    0.9759500057898725,    0.6028817656628916,    -0.3610303331324133,
+    -1.7794549296378745,   2.0534070311496553,    0.809863661802363,
+    -0.886007781325864,    0.12099859331831718,   -0.6338411646082769,
+    -0.10422875005731219,  0.5897960932614903,    -0.7096018529380808,
+    1.8905857282004568,    -0.33643323351283355,  -0.45330297516484314,
+    1.1777673839481122,    -1.1601945249379815,   0.1255829288823232,
+    2.1153515631127036,    0.09282383297894103,   0.22223708947208862,
+    -0.5772411158267966,   -0.933859281081315,    -0.2235513683426172,
+    2.276540611822877,     0.9179009089681901,    0.5356053661337663,
+    0.690524582206789,     0.9582541300644859,    -0.3301111280127115,
+    -0.016455025971896717, -0.06418120010379717,  0.4491625874634159,
+    -0.9652038318326874,   -1.3045804581035207,   -0.7376696167758816,
+    0.39005168640421867,   -1.0995226621226157,   0.7707764670122131,
+    -1.1465179414505038,   -0.21544724581215996,  -1.3821730494746793,
+    0.6129703846493498,    -1.5320396732726036,   -2.009935744091955,
+    0.0627787782871467,    0.3244413364603018,    0.7670551440614054,
+    0.17494183578047354,   0.4225950486589193,    0.1855507615951929,
+    0.20502156907258753,   1.3763343853949863,    -0.21254335501616434,
+    -0.9745172152485813,   1.3085921906436464,    0.9672310340820119,
+    0.5745440987272306,    -0.5427505068024996,   0.48223274701974184,
+    1.6877400304242294,    -0.4744929837344148,   0.6739363589504397,
+    -1.3381949011427452,   -0.9256713027064007,   0.9815224769233302,
+    0.6602353937069274,    -0.3485063899056002,   -1.0834975624560765,
+    -0.7419043673611557,   2.0476223795997828,    0.062161279598084644,
+    0.8678348621683097,    0.5837572049940002,    0.2722559567633772,
+    0.4471963816794998,    -0.3254689582665373,   1.1309154787631925,
+    0.09068413872045898,   -0.3150389627263073,   0.5400005979235141,
+    -0.03474228653400476,  0.3987422386597323,    -0.8427688147652975,
+    -1.7679384755488983,   -2.1947982464373323,   -1.4716123943336097,
+    -1.003154075138314,    -0.5777059118880186,   0.007529024388404664,
+    0.48128124926677307,   0.5431829384251765,    -1.1748275560882124,
+    1.8960223798317413,    -0.11434762772394322,  -0.5975129712054643,
+    -0.09567298195187723,  0.2686943963505679,    0.35360545774170654,
+    -0.5491463200949519,   1.5373560947352767,    -1.5576341503577822,
+    0.4779446111031502,    0.7697977849810881,    -0.04943625609883008,
+    -0.9484270620761559,   0.08068206048787449,   0.92917421933281,
+    0.07936394711776068,   -0.521986621752424,    -2.0413695861095884,
+    0.30270677276467656,   -1.9487372480722402,   1.0995145380079465,
+    -0.7761954549943517,   1.155432068398304,     0.9901146402454876,
+    -0.02792710586747316,  -0.2027567089605478,   1.9519472902832153,
+    -0.263584853186392,    -0.29799080243602594,  -0.46545551760382164,
+    -0.7485299682878634,   0.010195976574008468,  -0.15192347070748408,
+    -2.687451916960786,    -1.0481680456695828,   1.2764614942087509,
+    0.8600526964029782,    2.335436431594014,     -1.6695798184587018,
+    -1.9857935089002916,   1.0799495911556256,    -1.0512378296664069,
+    0.8805006578732671,    -0.6463261061635852,   1.1817457640779059,
+    -0.3168643602081093,   -0.14480044960900776,  1.5006913934453991,
+    0.759350724506489,     -0.644473915975492,    -2.7739477920182414,
+    1.5869873383977682,    -0.10550626876979508,  0.2698246646142606,
+    -0.9097611552512724,   -0.11538101740047647,  -0.811189796952035,
+    -0.6916537911981865,   -2.5214471952785305,   0.7320727163461681,
+    0.21687823396210304,   -0.7959060637447568,   1.1540249396465743,
+    -0.22412825423445484,  -0.44166685999734123,  -1.029970219891818,
+    1.5300376562764346,    2.1122660092054137,    -1.0526751365775517,
+    -1.0368562472817306,   -0.2727348541556929,   0.7782678041279242,
+    0.054556767643889933,  -0.16868324898129958,  0.7888684178398139,
+    0.20759034147349212,   -0.2756948182805641,   -0.18251843598892417,
+    -0.36449216420403535,  0.9962511486205227,    -0.01915084204825428,
+    -0.03028332998063675,  -0.00836322731728594,  0.9285297493041572,
+    -0.4107216880099047,   1.9363491507658797,    -0.8682718616769529,
+    -1.4750549010606349,   0.23829544983134576,   0.35081658510052527,
+    -0.42951858603605564,  3.2887713048280878,    0.43581731073762503,
+    1.2530365645001407,    0.6143771960677363,    0.3413747433002824,
+    -0.9226201992041536,   0.15697729078615497,   0.538287137973988,
+    -1.3180280194797,      -2.307918965492392,    1.2208054185704809,
+    0.634896754646262,     0.4500300783106005,    -0.2769962105681884,
+    0.8170277569515222,    -1.3874677134225393,   -0.589137740611878,
+    -0.5778804321684657,   1.1799778556603941,    -0.27139021235124183,
+    -0.6094271876237561,   0.8365640161572605,    0.9572388492008735,
+    -0.13341156043055555,  0.40146127416878,      -1.285295531782828,
+    -0.5722351839019619,   -0.93114676527383,     -0.2758013256703506,
+    0.762191026702149,     -0.7534158315848779,   0.6956715693421464,
+    0.826123526479732,     -0.9047593488083159,   2.1550990568876203,
+    -0.26174430214306704,  -1.0932238318595384,   -0.9385716962690559,
+    0.45856510404345624,   -0.20023529478004543,  0.1266172287145817,
+    -2.342989623670424,    -0.9091281582886634,   -1.476213512349219,
+    0.8004945498717749,    -0.6358384270136953,   -0.5620494601230113,
+    0.055348426521188175,  1.196939430615166,     0.8725036399547034,
+    0.8978090994898994,    -0.7635823988423065,   -0.3337097652852661,
+    0.033470845045937676,  -0.9981034500164754,   -0.08957842977540664,
+    0.0625857373544639,    0.7205023167326782,    -1.9074417328239086,
+    -0.3239138892628886,   0.08268822445409303,   1.7721516961666792,
+    0.6341520168820607,    -0.5300069510959926,   -0.7283359543160217,
+    0.6782349443441792,    0.47602917680975504,   -0.8910660989588283,
+    0.10422776648228824,   1.5238450259098015,    0.6129314332265161,
+    -0.749880891675391,    -1.4584015832470802,   0.6402396284424149,
+    0.22154387987353996,   1.013527353320392,     1.2923523959347156,
+    -0.7110479843529456,   0.02098323926619486,   -0.8803825547408208,
+    -1.7462734332367986,   -0.27126803346085493,  0.8192220687923065,
+    0.11350518942745501,   -0.007743765792089041, -1.5189862239310092,
+    0.14401841811085517,   0.006349642256998488,  0.005577352810969444,
+    -0.4037178326364597,   -0.30827096230883744,  0.5546639647816305,
+    0.38652041738118914,   -1.8654190383077707,   0.3105823680528627,
+    -0.31754484121786053,  0.11699917797574047,   0.73431489925723,
+    0.7054657912377197,    1.8417909466870932,    -0.20103698653693772,
+    0.6854981010453816,    -1.0547888505529293,   0.6583818478228021,
+    -1.3614961538154804,   0.8786912077495075,    -1.071527080125548,
+    -1.2955418447429645,   0.5863938675322329,    0.7358090355836138,
+    1.694737874023961,     -0.3361064063990199,   -0.5114305118828726,
+    -0.06584888870738577,  -1.2561777147575512,   -0.8184275699729854,
+    0.12352681203332506,   -1.2522297408136491,   -2.196531656896956,
+    -1.4829459738830244,   0.0656002745354057,    -1.1991055503154229,
+    0.9769870762735982,    0.8112586423880641,    0.6485680102004585,
+    -0.21212289748379598,  0.1083626024528789,    -1.2422920361167105,
+    0.343359723674608,     0.8472328721080261,    0.05875502363611432,
+    -1.2952640892310137,   -1.6722076556747705,   -0.21533768812410295,
+    -0.20190123444361263,  2.140496628762602,     -1.4145601469886648,
+    -1.5700125037615373,   0.3209479518542231,    -0.47607762904690304,
+    2.789432639213638,     -1.2329668175286084,   1.5340957781909752,
+    -0.9260850855390517,   -0.018655277363170936, -0.27031998816644015,
+    -0.957897575821386,    1.348611319089495,     0.5612533448273711,
+    -0.9518902313940976,   1.278356398196089,     -0.8432467610179187,
+    1.3419191621265023,    0.18459152670952683,   -0.7863387937535972,
+    0.06722758089862255,   -0.8468878369899602,   -1.7501235493449419,
+    1.3765021756496796,    -0.5951308857266258,   -0.7685734729171771,
+    -1.4437838690685287,   0.25897570068769016,   -2.0339272948739966,
+    -1.053118152355443,    0.19401303751674231,   -1.205432579812094,
+    0.6082121929446078,    0.6429844558168175,    0.8886325055599771,
+    -0.25699379767471836,  -0.7523054899068551,   -0.684329549546072,
+    1.877489707912844,     0.544554735606472,     0.24340579292944814,
+    0.3792116570692543,    1.8324821581923936,    1.444060578343912,
+    -1.6707068986769453,   0.24942999869745686,   1.80582862724735,
+    -0.2128319823742326,   -0.07996237567693024,  -0.7304774610563113,
+    0.49975894171443863,   -0.3640838764871046,   1.3103048551654548,
+    -1.050119161527242,    -0.3197279879368109,   0.1756250690118645,
+    -0.37615262737533134,  -0.3188348016841613,   0.2222987947685801,
+    -0.31926704347995344,  0.11444971078290658,   -1.3610359837533936,
+    1.223231858120276,     -1.909440397962445,    -0.6697324211859017,
+    1.396755857048363,     -2.1556356954186087,   2.0855723960735104,
+    -0.5970978435287911,   -0.29849195850194105,  -0.0168158549880216,
+    1.0726128527938918,    -0.15069013518030192,  0.653118416715466,
+    0.9621081379169298,    1.560968026353874,     0.23550756942665416,
+    -0.6096351116952142,   -1.2251389185853043,   -0.6948126950924414,
+    -0.32998873912247234,  -0.5884413261500314,   0.7788733076039072,
+    -1.966889965724287,    -0.6505476342943584,   0.7908081513185888,
+    -0.3700513669683881,   -0.11150739073632247,  0.639814473164597,
+    1.486315771817431,     1.2153340627098466,    -0.7607274938194054,
+    -1.889529679495732,    0.045414583344011876,  -1.0241258193171876,
+    -0.48482882896848645,  -0.8307699678515095,   1.1122047085534457,
+    -0.5080808128835017,   -0.19636829331724925,  0.9635509693612453,
+    0.4325455594831634,    -0.27301446639151083,  0.2692047568911448,
+    1.5401315078438307,    0.8234514369077611,    -0.1494883433932768,
+    0.4781373007093681,    0.16516171613489247,   1.3463895794578173,
+    -0.3467167990824188,   0.6221315638727652,    2.104818846594858,
+    -0.8239243136595897,   -0.013534042209018871, 1.5587509279043839,
+    1.8438003902855318,    0.8388312749126101,    0.3863747243695906,
+    -0.07845901350244479,  -1.7434029416162908,   -0.8932241272062486,
+    1.0710543953889566,    -0.4892084261691176,   -0.27530331621383125,
+    0.2020892974035583,    -0.15698444307172965,  -0.45868244616717385,
+    -2.196197517354306,    0.40496657033440864,   -0.020212423041654777,
+    0.24589545296427076,   -0.40854064387610173,  0.6615795581577246,
+    -0.8617586845968945,   1.4667873843767325,    0.8065980398054645,
+    0.9661840337770368,    -0.22975569308806168,  -2.259612204235393,
+    -1.0631118819010743,   -1.7554759123370376,   0.03511673059736942,
+    0.3875308755411491,    2.0518453066271847,    -0.6953442445638764,
+    -0.494791959458436,    -1.629850738573803,    2.7472418888587584,
+    0.6206468690737024,    1.2839805060030336,    -0.4180132141619201,
+    -0.3118362599375178,   -0.26610519177701925,  -2.295456182041507,
+    -0.7686321105552041,   -0.03752479923766698,  0.2895966277953803,
+    1.1607001068136287,    0.26404612552563617,   -0.6228815144282305,
+    -0.8611511498053585,   -0.6413880044916335,   1.8386524035876946,
+    0.20487645021537393,   -0.037130295400311285, 1.6204511149320022,
+    0.5875023723840336,    0.46486480455230195,   -1.1453549011091815,
+    0.9669723323794378,    -1.1644752579097715,   -0.09613099953331564,
+    -1.2644754872034938,   1.6129645122818421,    0.5481729381178769,
+    -0.35624490356336846,  -0.9981685483126372,   -0.4879581537143261,
+    0.2415870092331684,    -1.9727793596220387,   0.8105833165068173,
+    0.9517423805873287,    -0.10486417419428291,  0.3713863206347805,
+    1.004657265981934,     0.679054806662088,     0.2586555755644755,
+    -0.6094011677359275,   -0.3793526224690475,   -0.03320970363250453,
+    -2.093658782436711,    0.34724828752630443,   -1.2483201010822373,
+    0.1729858654378041,    -0.00985936278505826,  -0.3448814647733071,
+    -1.7973063861526655,   0.46141051701537705,   0.24101662777436314,
+    0.12630312488553616,   0.2710265082966996,    -0.8553018702919982,
+    1.182409454020811,     0.030072303008533592,  0.831194470211034,
+    -0.8969448307690459,   -0.7059421955872761,   0.28731129663999794,
+    0.27799153006753563,   -0.001565039432798688, 1.2525858523392925,
+    -1.6294185218849646,   0.05193158059973185,   -1.382720276089048,
+    1.7380067212775263,    0.2933238503632991,    1.5528812825060383,
+    1.6241728574387537,    -0.626269500873893,    -0.3858755557686265,
+    1.4041636553570687,    -0.7779030253196345,   -0.13246511041014658,
+    -0.38136961896416227,  -1.1201253892191372,   2.0255090639327658,
+    0.7148488759009656,    -0.3848710009802199,   -1.3404917695823129,
+    -0.125522387997039,    0.6629014824020403,    1.7779592076869577,
+    2.0719888259394947,    0.20078239854471328,   1.6335757924568226,
+    0.2355196521525233,    0.9360572070736488,    0.22416169062493824,
+    -0.5059283836760532,   1.5333107985113992,    -0.21419686982580208,
+    -0.6469183873177807,   -0.889326267304353,    0.8855055297289217,
+    0.7731811215275672,    0.7889897058662657,    0.169897114921275,
+    -1.3991029078159254,   1.2463976603715434,    0.6976520493864593,
+    0.4095979203592784,    -0.9023220528598666,   -0.7440597758419899,
+    0.6413017434326976,    -0.7482668465156754,   0.6524636982488251,
+    0.18696276815348467,   0.4253171057075962,    0.9732182269049086,
+    0.8077067564445735,    0.2751777907631067,    -0.8932384220243365,
+    -0.238635852380302,    1.351721224934499,     0.22273766886125976,
+    1.7718622090737544,    -1.4073353821279662,   1.5235201546152897,
+    -1.0014566997654513,   -1.4152904325941722,   -0.9101744871458441,
+    -1.0168397288944053,   1.5814623033799986,    -0.9669235357156377,
+    0.4251068225375029,    -0.21224491908372764,  -1.616828272443836,
+    0.45028912950493194,   0.16891802320093846,   -1.2194861884030688,
+    1.0334750976916982,    -0.8648037626130921,   -1.7785456916629891,
+    1.0322937933246525,    -0.42397690420609274,  -1.1636308830392132,
+    -0.5709869273632102,   -0.591437451789734,    -0.07061499840903289,
+    -1.2153572803230068,   1.1228837294810872,    0.4733410862442205,
+    -0.2424501555374098,   1.7848248323938978,    0.1707910977386614,
+    0.40297937890253516,   -0.12823366400577116,  0.0005297106699584303,
+    1.2511148408474664,    -0.5236472529797509,   0.8541248714782598,
+    -0.7086194436829434,   -0.6290756504403529,   -0.9429720474619352,
+    -1.4701152589298156,   0.5058781017831551,    -1.2716406803120839,
+    0.9206929578183578,    0.9127030834032266,    -0.3381596925209518,
+    0.7071811710317378,    0.4822926165747212,    1.004928620242764,
+    -1.0419298653344624,   0.413216388426698,     1.1177843925146844,
+    -0.2433326943202022,   0.39155809624781934,   -0.5814469548762605,
+    2.205611057267234,     0.8506561581942539,    -0.22707983829039144,
+    1.3540078525434105,    -0.14244943870807764,  0.334784538865844,
+    0.727559052149009,     1.5412099552546685,    -0.32974958364934165,
+    1.9892779272207781,    0.9835531397725182,    1.0114131673550129,
+    0.8370840670765748,    1.1062071239274072,    0.4693062765133864,
+    0.15111774364976568,   1.474596289386272,     0.36385084365265724,
+    0.8431160731751012,    -1.011749024059197,    1.53478289447663,
+    0.4142314823796769,    1.4692757804748788,    0.5904256240932885,
+    -0.04387287746376242,  0.7703194440435817,    -0.858539310951479,
+    -1.7775265902612705,   -0.9624401157676467,   1.2679397625937954,
+    -0.7485833931069906,   -0.5480484140911283,   0.9573523893075357,
+    0.5067313758877637,    -0.7337180255545572,   -0.05095637657706339,
+    -0.4416845622138237,   0.8563327413048208,    0.45739566521233344,
+    -0.9308028425978403,   -1.2833069225774512,   -1.5892461840756742,
+    0.5534278036690137,    0.6959688406148518,    0.21452885495235552,
+    -0.8774229855804526,   -1.2175480083638905,   0.7928160149808031,
+    -2.649100688358328,    0.49353542623365054,   -0.4260220677977231,
+    -0.4098254731999043,   2.2180287842580446,    0.6385159097141853,
+    0.19346387894740052,   -0.11960630477377357,  -1.4068659625656572,
+    -1.149610543645727,    -1.7384662286739547,   -0.11810861649901966,
+    -1.3181395423814615,   -0.06782627384891939,  -0.3875338394620264,
+    0.5776038448455785,    0.12506107531842514,   -0.22504486213009825,
+    -0.14557809622357298,  -0.9687088081352573,   0.40417192939239643,
+    -0.005534265221796043, 2.0706550091278633,    1.0932164120795116,
+    0.1881936800693558,    1.16829369658843,      -1.125235329782772,
+    -0.5683511450426341,   -1.414647060641593,    0.8000806166661009,
+    0.7049555335085402,    -1.001777590486997,    1.0722081323338584,
+    0.3590750850165114,    -1.0658517083241752,   -0.16502742996070022,
+    -0.2286364470816398,   1.887753191035384,     -0.19993856852946956,
+    0.7207836591499108,    0.07433285938467056,   1.7068798392702156,
+    -0.7136189173163097,   0.8412507139271256,    -0.00563755426871498,
+    -0.49522307967131135,  0.09134942755738207,   1.6220846026134361,
+    0.6918928714421496,    -0.6478778748552334,   -0.7096281266523867,
+    0.9515379209036241,    1.251193581896816,     -0.743826674621404,
+    -0.8617343824126706,   -0.6703273250240974,   -1.1329256335864961,
+    0.6335319285474694,    0.24004844887702004,   -0.45834758446989055,
+    -1.6828394002782985,   -0.40531030256703426,  -1.1086593928377886,
+    0.727082604074589,     0.501922401419279,     0.5924847333530051,
+    -0.19935245693735404,  0.8447248839528715,    0.911335718870351,
+    0.5122995646414823,    1.3027495111950946,    -0.1376328001227298,
+    -1.1573420953504465,   -1.2739875486127057,   1.6533725738124971,
+    -1.2032708698572587,   0.5049973456823627,    0.049376702297597934,
+    -0.10676202324836312,  1.2673088144771734,    1.4917938082181488,
+    -0.7005524241427364,   0.18455557706598627,   0.187826512073725,
+    -1.3906663066726814,   0.6393071471021452,    0.5318487497730024,
+    -0.03368425014501363,  1.5010413103809104,    -1.6625884239299136,
+    0.7712335871947478,    -0.5293857186897826,   -1.0430938904245737,
+    0.7348869413705563,    -0.11911626175125037,  -0.48915633379814705,
+    1.7094065230985758,    -1.2846966164747675,   -1.1622346165695596,
+    -0.7528067313307537,   0.304072400089667,     -0.011212125875852888,
+    -0.06614563102567494,  -0.9340788572797535,   -0.9729949646237971,
+    0.323628528628951,     -1.8039073510768726,   0.5892127547140146,
+    -0.2782804690431076,   1.1042251521227215,    0.4222132601718167,
+    0.47652086341634065,   0.2229452258560243,    -2.2163772728306914,
+    0.3856170605785442,    -0.16222742685871044,  1.0633710225139696,
+    -0.8184417871963996,   -0.9902794063442989,   1.056216106953737,
+    -0.7803961526117941,   0.7386331355930568,    -1.329887630452043,
+    -0.07249412499995311,  0.4245725341121461,    -0.1535547040893799,
+    -0.2677646641330477,   0.873339183366424,     -1.9626455590185263,
+    -0.8366244033025744,   -1.6903966059541546,   -0.9269287161453792,
+    -0.7909133044423332,   0.3924711678926547,    -0.2618561500277142,
+    0.5696253936131568,    1.1404745896415744,    1.4363833325949138,
+    -0.29026876889321834,  -2.995522932048717,    0.2959235450184166,
+    1.1733569620086768,    -1.2313368577838277,   -0.6287411841783697,
+    0.6639966052374737,    0.479029570922123,     0.5881331597448531,
+    0.5423030544819128,    -1.9298659758237033,   0.7793235894198671,
+    -0.5350726662556196,   2.169861072767437,     1.669341604101683,
+    -0.1176099110601549,   1.3182696129138616,    -0.6767510370840949,
+    0.4306340429460329,    0.5272786671201045,    0.8877214941645761,
+    -1.4226175930556606,   2.1261434242940296,    0.3690086046963096,
+    1.206497999141888,     -0.3109341991002522,   0.0350403765401628,
+    -0.11021346377247308,  0.1132379395036281,    -0.19851421520372067,
+    0.6920833281245469,    2.2823157714318714,    -1.4634567789255133,
+    -0.7017822075237974,   -1.8695516437683715,   -0.24685491288191702,
+    -0.13426864798844618,  0.4627896978470005,    -0.5230697444017466,
+    -1.857891134675864,    -0.9997907248357242,   0.3641742502843732,
+    -0.16384023630480912,  1.9926776621251774,    1.6204415761281943,
+    -0.07052870047729294,  0.6951736104731298,    0.6243253275296756,
+    1.5610600502100997,    0.846322125309128,     -0.12618932799607105,
+    -0.8811583637643932,   -0.8030911423521596,   -0.03564880960627127,
+    -0.8175498512409246,   -0.8774704907699183,   0.26491672108062814,
+    -1.5439192365127277,   -0.9008189576645445,   2.0885095057470533,
+    -2.120662081017691,    0.9434725365483188,    0.239632336752677,
+    -0.8406197427049803,   0.7994177720318353,    -1.23499441232294,
+    0.19354575618206973,   -0.1873855678301588,   -0.08396266688363385,
+    -0.09463253649208844,  0.6338591689030034,    0.7362761314242496,
+    1.4015194237792028,    -0.5229348293880094,   -0.05495625494058006,
+    0.5704318801656789,    0.635301495454871,     -1.4972005727204496,
+    -0.13533743356108371,  0.6514648726881106,    1.7450596322213299,
+    -1.7262161711216624,   1.0374633249822591,    -1.30070415036169,
+    0.37310063557902856,   0.007497274992806121,  -0.6394236051257446,
+    -0.2427075321137302,   0.4542425370088338,    0.9363658708808015,
+    -0.08026966142454116,  0.9749691420041553,    -1.2315526518452855,
+    -0.7168850499069581,   -1.4556011160567957,   0.14467503430508238,
+    0.35937679138523204,   0.764516564031685,     0.0943635536389543,
+    0.8258603791011073,    -1.77724567692212,     0.16732376915606395,
+    -0.7325404866800168,   0.5890698762119478,    -0.4473697642164219,
+    0.05377916412404927,   1.569747070654585,     1.338430780684259,
+    0.02564962810121152,   -0.8225880616545757,   0.8708883773613894,
+    -0.1697509643683071,   -0.25946696884539855,  -0.42292348149979003,
+    -0.8549933275057985,   0.19260367717214585,   1.1684678443959766,
+    1.0111975408598604,    -0.48282056221709185,  -1.6548446302417554,
+    -1.7979633635440089,   0.18434441400262302,   -1.028183041331075,
+    0.07004443956334078,   0.07876226128460585,   0.8254690939020776,
+    -2.097940392345195,    -0.09876993785016687,  0.07254253282246786,
+    -0.34669609922757766,  0.1063372557130609,    -0.7715217478672646,
+    -0.41077103351756955,  0.9079560779488484};
+
+static const double gemm_checksum[256] = {
+    3.8486988005691156,   10.74002679176704,      -12.757774074227523,
+    -22.747042830874275,  -13.753040394913885,    -5.684397610861183,
+    9.805495641013126,    -10.489695187064331,    -20.7490901646844,
+    15.986616507747906,   27.303448207226936,     -5.430186474031249,
+    0.9166627114042916,   -14.506798659684293,    -9.557932603541442,
+    -8.338667704348692,   -18.007694640906863,    22.419551233661018,
+    26.030591037895274,   4.520971993623884,      5.838298809162554,
+    -8.603941128199915,   30.19007739912815,      -23.675256075107182,
+    18.5566598745638,     3.641976621008049,      40.435129917232565,
+    16.857190335313753,   0.051590934618441664,   21.904522950031406,
+    28.629030546773155,   0.22225478746127925,    -8.902108504008456,
+    0.9232125711038108,   -3.392817117171404,     -20.083722863242542,
+    -7.480458818432146,   -9.984369829771987,     -26.538987983497027,
+    -11.155211172800223,  -5.197738548363471,     -18.859551041247,
+    30.207151672418185,   14.384487804398411,     -11.840438308243076,
+    -26.344646523035692,  11.67710966093783,      -1.9353703711203996,
+    19.989892662303106,   11.99462625736393,      -13.894543075698095,
+    0.8322842308427267,   35.89703170124824,      -7.805023321805882,
+    26.285104396266057,   19.911030497043157,     13.04595941651133,
+    40.237803836198125,   18.72807437728411,      3.5660285681241177,
+    -0.14546913955288043, 40.66260291624576,      -13.516421423653167,
+    -17.540003213062043,  -27.00579944316812,     12.640953739845292,
+    -14.188023737306345,  18.850048947877713,     33.06988351573273,
+    2.3363167027186,      -26.86355599559524,     13.278201739657932,
+    -21.118243052592756,  -0.7528088852037937,    14.860908117034803,
+    -30.22771666133763,   27.238109956403314,     37.1674730190154,
+    5.532364255934375,    8.59387789138893,       1.4549545049488462,
+    -17.62974975598253,   -3.2834393050267616,    9.343051868381519,
+    19.02407190719773,    -12.903330628274112,    -13.776131414450205,
+    8.600335414378847,    10.833842308861922,     9.868181498388557,
+    30.983547303048805,   4.177240590522335,      -14.942696678424843,
+    -5.389411642995417,   -1.955711895520404,     15.871698740453446,
+    -23.691972659583854,  -30.43671097497496,     21.414378349200764,
+    -6.06739159324214,    -0.0034432081738982045, -17.988345576106404,
+    1.258280994392912,    -3.220343333917019,     19.38185277626549,
+    -3.3166491898521473,  -1.5822741025185028,    -20.52723814202179,
+    -2.0035988064905905,  -17.971785150352005,    -10.713217976422243,
+    -16.87083240388046,   -4.12161400929457,      33.141321143794016,
+    -5.795405244456007,   -5.597496960021477,     -36.84119947771889,
+    6.515220995128404,    -40.563026550709445,    18.610366369982476,
+    -6.025110739954553,   -9.476274583235181,     -18.773290865034536,
+    1.4460464040387508,   14.814490597376484,     -2.403580077282073,
+    -14.997094862480289,  12.057407182855812,     -16.19507571241684,
+    -16.80787046196498,   11.189197561924221,     14.12746494128304,
+    15.885093891887436,   -17.508038793716477,    -0.6377054607009391,
+    -26.90530964239176,   1.271957451018459,      12.865849353861085,
+    -14.454711584197662,  -1.450150220082282,     12.175755978750843,
+    -5.7871028711141,     -5.368373816959291,     14.866383520977475,
+    -31.871583171981204,  -8.181451370107906,     16.93025000768901,
+    14.956559426609044,   -39.14104436058157,     44.20161978319764,
+    12.418704005822853,   5.379067303820342,      16.131864829807405,
+    -4.25981470213057,    -3.904762913464403,     -3.5562886885041305,
+    -32.24648051329322,   -21.322912592311962,    23.69649089708632,
+    -10.030712314114304,  -8.594917603341383,     0.9051650036907173,
+    -27.895600880966796,  18.602484551787335,     -10.778088373552942,
+    -3.721874959770677,   12.786656778860923,     -4.418681706588146,
+    -10.923763231705388,  5.13445784327247,       -30.963987803806287,
+    -6.024349144992444,   -1.9983839001311579,    -6.027613214840664,
+    23.07427434413996,    5.292482072549401,      5.439823828727562,
+    -25.1590399755948,    -36.20718345555945,     7.225163694752823,
+    -14.207023806751835,  11.317109969574425,     4.360420611813229,
+    8.564392049313156,    -9.789502315866903,     31.805113325669932,
+    25.515027423600255,   4.852446676188754,      9.411252852763907,
+    -13.417569528469844,  7.098560880105406,      24.537049845699986,
+    12.3203743641861,     -19.366904584635968,    -7.496789705314439,
+    -17.043940386359502,  31.428221648870604,     -2.175887529628885,
+    -8.588724779886345,   -14.659042473346094,    -6.319212113747356,
+    -9.033750707126405,   34.11937953664175,      3.600119891698507,
+    18.385168653241468,   18.76605649811179,      35.79078722192205,
+    12.034289504561913,   -1.408682642487502,     6.8437954082131975,
+    -14.14514384359741,   -10.52191920694514,     12.554750098450146,
+    -4.640744652911975,   -16.782245493419886,    11.121411344211026,
+    -17.347625900509726,  -12.127551453566774,    15.43341688750956,
+    -11.527756395146069,  -21.827958050538633,    -17.442680034910072,
+    -15.459110445526075,  0.11150799301642245,    -10.842575965228876,
+    8.789501901336502,    -5.886912515595121,     -13.006866284148236,
+    -6.546922863683516,   -0.21707466040338996,   0.33649364211945176,
+    -3.27890796815273,    -3.109706917952094,     -38.8112781380547,
+    -24.719716928125244,  -1.9281026480888999,    -3.3717667194449383,
+    9.33067956344207,     32.71546478224317,      -7.3707052856662,
+    -3.941814383046289,   -18.025455969920046,    -8.43930160772537,
+    15.862378968659305,   18.29593669474238,      -15.036031004887583,
+    -0.18876093569981744, 0.3997393525023831,     -28.631627334941342,
+    -5.832466467982235,   -16.740000089103,       -7.932486675582153,
+    14.244567291736917,   -26.430133434772962,    -3.4100481011746,
+    4.9500088343026585};
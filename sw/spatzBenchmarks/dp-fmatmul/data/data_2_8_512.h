@@ -0,0 +1,1739 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// This file was generated automatically.
+
+#include "layer.h"
+
+const gemm_layer gemm_l = {.M = 2,
+                           .N = 8,
+                           .K = 512,
+                           .TA = 0,
+                           .TB = 0,
+                           .ALPHA = 0,
+                           .dtype = FP64,
+                           .expand = 0};
+
+static double gemm_A_dram[2 * 512] __attribute__((section(".data"))) = {
+    -0.14409032957792836,   -0.1729036003315193,    -0.11131586156766246,
+    0.7019837250988631,     -0.12758828378288709,   -1.4973534143409575,
+    0.33231834406771527,    -0.2673374784971682,    -0.216958684145195,
+    0.11588478670085507,    0.23229773690672087,    1.163558686599143,
+    0.6566365067986689,     0.11050717744383194,    -0.7383216023448206,
+    -1.014662367487717,     0.24634219521120196,    1.3110808272040482,
+    0.04165686390338389,    -0.10632329377078427,   0.5317762204008692,
+    -1.453545298008678,     -0.3122773171445598,    0.49036253259352475,
+    0.8734043853794468,     -0.2406296726551354,    0.3765998586879102,
+    0.24821344932841446,    0.7823268087036421,     -1.1132222142481727,
+    0.5682506875853858,     -1.5145203917251397,    -2.619945422218852,
+    -0.6068907281995026,    -0.9158100463459947,    0.8760122430564063,
+    0.664265899612895,      -1.2190747412956953,    0.8473614233480004,
+    -1.0022028242423497,    -0.08624384633628418,   -0.29389977795653216,
+    0.11441985746092122,    0.8186363115437669,     0.6384137907924435,
+    0.3498851018692087,     0.6499480978062986,     0.4784920376501184,
+    -0.6269854652195999,    -0.7173710938165775,    -0.4699682741360139,
+    0.4993264004767815,     -0.2501155709973842,    2.335754222480548,
+    -0.8192925421864935,    -1.0988745999021583,    0.7684735154696964,
+    1.4218499813434655,     0.5056926908392599,     0.8358173459676733,
+    1.4263449774421624,     -0.0940274760163039,    -1.4229589331389771,
+    -0.5320765483187126,    0.9528957573165765,     -1.4436784060782881,
+    0.03353132078726135,    0.2532373593420619,     -0.3155921648136706,
+    0.7236319863680966,     0.5807797415265663,     2.321408516900731,
+    0.6199677677731354,     -0.6094034586430621,    -0.5617975923340306,
+    -0.8315811012420066,    0.9522735598158206,     -0.566832834813701,
+    -0.07026077370059765,   0.7493026192896751,     -0.7234629906514067,
+    -0.29365796361771856,   -1.841286265603916,     -1.0824786190387132,
+    -0.5677364121918498,    0.41576098851667154,    1.1934932724432972,
+    -0.018466813163711633,  0.2613642791998029,     0.16796936854723213,
+    1.0847411134536038,     0.8933551987382066,     0.27369331540754227,
+    -1.0109443034453118,    0.9033853143445947,     0.3810471279557522,
+    1.2269415497142202,     -0.02990659268121346,   1.953100924483846,
+    -0.3588763403218226,    1.5930604142630431,     0.11511897260723283,
+    -0.5162690092455027,    -1.1284478727923954,    -0.15103055153883657,
+    1.423321026167184,      0.8163744966147283,     0.688883864266003,
+    -2.375872573091198,     0.7109642045700387,     0.5558524109198417,
+    -0.5499262844053271,    -0.6273843661803962,    -0.002310451813581064,
+    1.7248762631487318,     -1.0551006994223244,    -0.42780503473628484,
+    1.361784750350584,      -0.4461507994277505,    -0.36425147586094014,
+    0.0977763472886767,     -1.2412893766356956,    0.21994543015001286,
+    -1.2096175969736347,    0.8851983103581446,     0.0031808227579895546,
+    2.2834314668477504,     0.28084051353103473,    1.3656894904327486,
+    -1.303263971717364,     -0.12213934352186545,   0.32314565401410306,
+    1.7457209183710487,     -1.680915938020964,     0.9906196798088226,
+    0.5913540138159165,     1.53354619573813,       0.7123855180787204,
+    0.05207118510394829,    -0.5216496504181594,    -1.24817971784272,
+    0.19542276490297042,    -0.19169676899531105,   2.0202673380796417,
+    -0.6110248279848474,    0.3203918452051127,     -1.5690014196757296,
+    -0.39546257832617854,   0.26114788009109907,    0.8239600125195051,
+    1.4481016868281007,     -0.04414817632926931,   -1.1172448790608862,
+    0.4578503994915399,     0.5169870984137933,     0.49165834283826976,
+    -0.7002876991747331,    1.1333843975868878,     0.08789591090451496,
+    0.6998246217159857,     1.2740732400944477,     0.6092723205658512,
+    0.28651602798177056,    2.152795235100524,      0.2437030409721501,
+    -0.2959642327720814,    0.11196703758302992,    1.482768668437135,
+    0.11871248688680022,    0.5193776551392121,     1.1957314403321633,
+    -0.5128586102268294,    -1.7265697692536455,    0.29942315221644095,
+    0.229734794523969,      -0.6080101785608144,    0.8710863810424168,
+    0.6075673769845699,     -0.9949924215994163,    0.5182184440212028,
+    -0.1961049589025753,    -1.483025270207281,     0.45295023306596854,
+    -0.04521462667939092,   -0.7452828991898676,    0.5229455868967482,
+    0.4880932721923791,     -0.5775371839442981,    0.4003521905346774,
+    1.015064936192444,      -0.7126666356857019,    0.3808900274015926,
+    0.0027557504813070922,  2.266010310650884,      -1.862302970778187,
+    0.6952839314064626,     -0.3062450197812156,    -0.10019754882983263,
+    1.9015889763832696,     -0.008573151260794101,  2.2409437037755677,
+    -0.44214796541354673,   0.35051204134810954,    -0.49084750167489155,
+    -0.6906880126178839,    0.06248312645153182,    -0.28257152534910235,
+    0.20249158398642758,    -2.105027867724164,     2.0024676886095993,
+    -0.16699690878127882,   1.7429055062339929,     -1.0071121261064784,
+    0.29253570472426854,    3.1649421014768855,     -0.8697291831062892,
+    -1.4952997731082656,    -0.5465095353366406,    0.4724884273226057,
+    0.6933400400612962,     1.2903666880214264,     -0.2570123983933152,
+    -1.602250759500302,     -0.43502980447508566,   1.2402226948017574,
+    0.46566265317129135,    -1.9569387853750035,    -0.0350515116881563,
+    1.39816809132213,       2.126548136950435,      0.5616866387847775,
+    0.3093023127995021,     -1.240205667985729,     -0.8432428739675053,
+    0.046915857506165795,   0.5031977408135291,     0.5801841911197648,
+    -0.47820855513413607,   -1.1519422284235155,    -0.7777818410999131,
+    -1.1569743942597612,    0.6434091827639932,     -2.3122811060456603,
+    -0.3332780256094936,    0.44987833210121114,    1.5220127246649402,
+    0.07129967505097183,    1.00128393951411,       -0.3990040717810922,
+    -0.7444039865320907,    -0.6743930384374659,    1.5273357819018323,
+    0.9942211438977457,     0.4873979264626153,     3.3302688635617717,
+    -0.032341372526149416,  0.6203496510288014,     0.3075915525585113,
+    -0.22188569012415993,   2.316171347771517,      1.5066048030371135,
+    -1.3994796346205545,    -0.3998463222852154,    0.4283365383682873,
+    0.7831832150420476,     -1.3484470698133797,    -2.255561587021803,
+    -1.9063669687617821,    -0.07111146334121905,   -0.10320317903967742,
+    0.34521937611451436,    -0.7696747778790584,    -1.2242376759060625,
+    -2.0230450575793495,    0.32918735874743676,    0.37005395848777656,
+    0.9929936703557113,     0.7907956879792326,     -0.19071558093694238,
+    1.3492609627534853,     -0.13636691152654942,   -0.6608363863180724,
+    -0.5205784433035681,    -0.5848116447053936,    -2.1657367195003414,
+    0.1563260529857667,     0.24988559176216588,    -0.3622658108820982,
+    -0.7138414700864147,    0.37180382435527626,    1.7168705875476908,
+    0.038255152504981314,   -0.5076336072097064,    -0.5914472024229306,
+    -0.06975643814516222,   -1.2647655710414423,    -0.12526068819807962,
+    0.06118226433678073,    1.84467868776619,       0.9434737641133749,
+    1.0340292356498797,     -0.71294854109924,      0.669921543236243,
+    -1.1393824745499168,    0.3119606966908699,     0.4187372604188587,
+    -0.7664094160622363,    1.9993798051614897,     0.567373662750663,
+    -1.9027283028945088,    0.5528598865958085,     -0.4074118188900081,
+    0.0013762158163019207,  0.4657647909141831,     0.3905326673115421,
+    -2.0391513430346153,    -1.1583197436135844,    0.7726241585745918,
+    1.3012042492292906,     1.9031528866625007,     1.8031682386531052,
+    -2.0555366046304795,    0.7694821209364507,     -1.9162902011151035,
+    1.6136007285419953,     0.2533494028220485,     -1.1411687879770391,
+    2.00990094709114,       0.6439708702908716,     -1.8911488889514725,
+    0.29346811746062057,    -0.7311399076653804,    0.11129547997023954,
+    -0.4651946145553634,    1.3734938862686545,     -1.4232863881835744,
+    0.3174051682614164,     1.8141883405999772,     -0.8269602989702713,
+    0.21064867605821866,    0.20200164095007708,    -0.689702188878588,
+    0.6478936227652526,     0.09705028180989633,    -0.9437675047831234,
+    1.762016104898851,      0.7916149965898025,     -0.1671069450225316,
+    -0.6366747674434632,    -0.7843626222105263,    1.2309409725605525,
+    -0.14647823454054879,   0.4594382038647557,     -0.1844567008929351,
+    0.6164094698173579,     -0.11597913012588339,   0.7638538724770693,
+    -0.18321090982152893,   0.8295872971185219,     0.6723841093496378,
+    -0.11660980066118065,   -0.8597772404265872,    -0.9401199905438056,
+    -0.7407368201407702,    -0.9844876432848098,    0.8657964212540513,
+    -0.04660231251040279,   1.5701009775725303,     2.2793298277051397,
+    0.024222471072236084,   -1.5480172023433727,    -0.3814535315402815,
+    -0.07534841691644348,   -1.488442345152801,     -0.2504932773030516,
+    0.2869463091418843,     -0.45942784619737587,   -0.7684259229128562,
+    -0.758756759562809,     1.7866837303594123,     -0.15964608029769015,
+    -0.8299301146835644,    -0.3728983906951256,    0.9543437080453698,
+    -0.6846880440425576,    0.4818473093318288,     0.7278849488997008,
+    0.7491178322009753,     1.3996946711966503,     -0.5504819796364079,
+    1.1327328621819972,     -0.7928535998113694,    -0.3965398769992254,
+    1.1960871730603653,     0.8223754031111766,     0.002097550598407143,
+    -1.1914138260298779,    0.5616598270933244,     -0.6303726994832307,
+    -0.923884828209913,     -0.6481342544285978,    0.24649403990044358,
+    -2.121032105431511,     0.36076315321198915,    0.17390961970994287,
+    -0.584526402437006,     1.036927293450356,      0.6114404236927575,
+    -0.6062841454651516,    -0.6700166217709237,    0.6951514754619285,
+    -1.516073559416074,     -0.332622429754111,     -0.6310465274746756,
+    0.06987748465396224,    0.21112652239076496,    0.0367879149642805,
+    1.1348480762194146,     0.22806303463200753,    -0.3149922512172181,
+    -1.2108549075575812,    0.7218497968577305,     0.5281465458516884,
+    1.450809544896753,      -0.7474548334518082,    0.02641804008568619,
+    -0.05869269759393822,   -0.08761085924956588,   0.010390211327113649,
+    -1.714539490281463,     0.8249855340256519,     0.6532058713319675,
+    1.130473400858816,      2.2495743664943504,     -0.31896719363576814,
+    -0.0361431764313115,    0.009783565123339721,   1.9421854507084564,
+    -1.731219722734932,     0.48576797020739826,    -1.4708313674484383,
+    -2.581570782123187,     -2.0208327914879374,    -1.3817685557083725,
+    1.0690254394207013,     -0.8683604129657693,    -0.22745765928141864,
+    -1.163512760179894,     0.6109504782247451,     -1.1019615245008139,
+    1.317652176005165,      -0.9931054142672816,    -0.764827437978625,
+    0.12274104540243151,    0.024711220827863332,   1.424690088752885,
+    0.12040728809317063,    -1.2078342883608746,    -0.5603352740963154,
+    -0.5727839433678338,    0.7250422211312412,     0.3837930088122099,
+    -0.11939102301213707,   0.8696072200033855,     -0.5284964171782691,
+    -0.13623374831210014,   0.18076040433328708,    1.5281812827647787,
+    -0.09853318032359196,   -0.35079890881473486,   -1.0458370377122912,
+    0.6860521833164603,     -0.5876453742470404,    0.3436850178678997,
+    -1.901609890389712,     1.0431869588150116,     -1.3319377679886037,
+    -0.7773423635754164,    1.0585811348526395,     -1.334470735974386,
+    -0.07945503537323442,   0.07425608108048992,    -0.9985568133328433,
+    1.342933001549973,      1.4987783023244174,     -1.9716175035949517,
+    -1.4489902973985052,    0.808232202493007,      -1.3030241353673144,
+    -0.3886373535670217,    0.12955208833383267,    0.6918500823133606,
+    -0.22325259441131012,   0.09522091980203824,    -0.7767329173504803,
+    1.292361598433893,      -0.49531385690178353,   0.33973288757600323,
+    -0.5116380865832342,    0.10632349073443405,    -0.16816310439996543,
+    -0.16246417156510376,   -1.0137808582104966,    0.7964127942380366,
+    1.4140424167382613,     0.2431480977794328,     0.7323352737477155,
+    0.8380678807185794,     0.9279857809906793,     0.30335675135911666,
+    0.21225727998240002,    0.8640072720207901,     0.06883232560278287,
+    -0.9739183937649534,    0.023848354455931614,   -1.8884153915394422,
+    -0.0059002387550951925, 0.41337233629749925,    1.2359807763139525,
+    0.15127727739709215,    0.9281398211815497,     -0.000537514191408415,
+    -1.02347634604681,      -1.4113797177192944,    -0.9697343781372793,
+    -1.3661477186468038,    0.6337078105192584,     -0.20761468569829772,
+    0.5703148900153162,     0.07343142983148367,    1.044049544722134,
+    1.0601927908888367,     -0.6453380077771519,    -0.27431596094510047,
+    -0.5328285867746178,    -1.621312075740941,     0.6752171454008716,
+    1.188794788193607,      -0.006428391274197309,  -0.4931922184490016,
+    1.0909050288895557,     -2.344962289015491,     0.17747519593537467,
+    0.14328397410029256,    -0.5708570545254728,    1.3915745307593748,
+    0.9707354190544935,     -0.2611572476979568,    -0.08669599005183458,
+    -0.3880239635487064,    -0.5121199086543016,    -1.308199926863865,
+    1.3799484536963857,     1.0280001502907028,     0.7981663311394539,
+    -1.094335919776077,     2.0808451646333332,     1.9801652655572652,
+    0.18805716900128577,    -0.9042206521399764,    -0.8664300835441683,
+    0.4185486310884882,     -0.9130141402775723,    -0.034210884256722016,
+    1.088644709786763,      -1.5068237436831335,    2.005728695595723,
+    1.5667084089962464,     -1.2370858496374595,    -1.4136412942470413,
+    -0.28342185355946525,   -1.0311432003003655,    -0.2637208269105223,
+    -2.581185965408421,     -0.2287020552019795,    1.8028564715788176,
+    -1.1165947007376287,    -0.27306883682938937,   -1.4896092009408795,
+    0.6382375252419706,     -0.22531918924715497,   1.940733059659233,
+    0.20683944343940006,    -0.37217996823866906,   0.5502724957557836,
+    -0.5062279591880949,    -1.339308177819252,     0.30194776978860705,
+    -0.17486879820850382,   0.16631505033886193,    0.3754573325600648,
+    -0.5103196715944552,    0.4215763724924534,     1.737696573143212,
+    -1.1077995297251657,    1.7374255072341147,     -0.24280325098961422,
+    -0.7666266458493499,    2.4272205711517914,     0.15502163312524783,
+    1.3704030045911841,     0.8175942409178665,     -1.6805948250397251,
+    0.12081959865251861,    -0.5253197596706631,    -1.3417925949959038,
+    -1.7717113663197739,    0.10229024372388522,    0.5902530107990708,
+    0.39066818523619623,    -0.3058285551611547,    -0.7985169796081666,
+    -0.9868611816170736,    -0.5551605944594507,    -1.0330552031207325,
+    -0.2032746512998686,    -0.022887083968737617,  -0.8959881649439605,
+    -0.23205013443001374,   -0.7603200384884009,    -0.004472405252050842,
+    0.5070877079547295,     0.17812523394876037,    0.47215087449102583,
+    -1.6520145776078716,    -0.3786964985785043,    0.27673937673079096,
+    0.6411624595913326,     -1.5980033627401076,    0.1591782538180058,
+    1.2064206485316313,     -0.17861069581218178,   -0.09475811147673502,
+    0.450456882026013,      0.24711818395745414,    0.6746373502585463,
+    0.07241386408490774,    0.1524960703527199,     -0.7824444371410331,
+    -0.17043786136210154,   1.2531220372686513,     -0.20416975565930381,
+    -0.16856427948129626,   -0.4915033719195106,    0.7871858824407155,
+    -0.8546790776627818,    0.9105021950520499,     -0.9369733942604651,
+    -1.0577811251432885,    0.2059394620941099,     0.13017946960180968,
+    0.29755730301390676,    1.0625371208893997,     -0.4124959652003135,
+    0.4429935928939486,     -0.9098172653491918,    1.259169029698878,
+    0.6324586664200144,     0.5365187653532374,     0.18787849130978576,
+    -0.7855994441390646,    -0.32737156166738923,   0.5017794618250152,
+    -0.019184119536144097,  0.12374466247159174,    -1.3598195068017078,
+    0.18109397987624676,    -0.6919273901409018,    -1.0833365537522737,
+    -0.1546853895195475,    -1.8565042526126185,    0.6985699904060957,
+    0.852012897691245,      -0.053436099246713865,  -0.9937821745519041,
+    -0.9453688204139012,    -0.15112305346823743,   -2.4237337311695524,
+    0.18047678307435738,    0.6644320239800762,     -0.3118948485158634,
+    -0.4944023694095982,    0.18196725856866128,    0.3506440670398949,
+    1.094151751865899,      0.0183966792131484,     -0.689757651533845,
+    -0.46126504597235024,   0.18194574186008516,    1.5562003749969304,
+    -0.32027330478769567,   -1.0525266594013305,    -0.8701066201327001,
+    -2.096334606223154,     0.32979399768104145,    -1.3613242892821982,
+    -1.2335095276125785,    -1.9760146141547035,    -1.1179883795830254,
+    0.5684144769378178,     -1.3113541166252445,    -1.7496423367360299,
+    0.17826313396986762,    -0.34117128893601334,   0.43219001352027936,
+    0.7405598049078377,     -0.008498930533113933,  -1.2977608263818279,
+    -0.12379996122706427,   0.500259480149979,      -0.5829889570612002,
+    -1.4374612477128943,    1.1026120608754852,     -0.4152476431845003,
+    -0.40923001241477897,   0.015962241731200106,   1.0304723575092511,
+    0.2636197519566236,     -0.33322598635705175,   0.6821333452657441,
+    2.1470244928075615,     1.3877862581055116,     0.6728714206779861,
+    -1.1222804798570638,    3.7520587430653305,     -1.1986571186719208,
+    -0.37180290351912026,   -0.6998891942285705,    1.62689186152306,
+    0.4202400754758032,     -1.427124962853585,     0.2675871772612252,
+    0.5469056678489389,     -0.31848302355871344,   -1.220189789314534,
+    -0.7250334179615152,    -0.43684901912440166,   0.022731528940041008,
+    -0.5199099496967408,    0.7352204042444506,     -0.9499474980528454,
+    -1.73138686850914,      -0.7393934438692396,    1.3488906463814507,
+    -0.5731563071506868,    2.340808887791223,      0.49148423438486033,
+    -1.1644260642443258,    -0.8342861967831583,    0.24337247139381338,
+    -1.17764392228478,      2.3745786530316004,     -0.9908907808932206,
+    0.6809434559506826,     1.4601298902601427,     -0.10920040700467308,
+    -0.9958611253815084,    -0.2730663422746166,    0.36221639746740714,
+    0.8757520928615222,     0.05671693599624948,    -1.4002224259808547,
+    0.042323906609705614,   -0.673358171552496,     -2.1832358374254084,
+    -0.697560188163781,     -1.4324506747879238,    0.5868544072685127,
+    1.9441647540410785,     1.8587536567603968,     -0.5732087444487923,
+    -0.467394370223271,     0.6887819993238358,     1.061285612072863,
+    -0.4187385865596868,    -0.14263593827157645,   2.2069293491528925,
+    -0.1074515188872195,    -0.48532144229114593,   0.11991398387495637,
+    0.5797023621298565,     -1.0216418572185815,    -0.24840280567022194,
+    -1.1663606187184874,    -0.27826355350057475,   1.8769245287801024,
+    0.7417221786678901,     -0.0925432507186592,    -0.9331120255863701,
+    -0.31140795947916294,   1.0507333277452064,     -0.561686810300669,
+    1.4504206575201288,     -1.3736363552618314,    -0.2900462932852064,
+    1.742764333284221,      -2.00783876905368,      1.1884131573498202,
+    -1.8513770746404312,    -0.09007984706598965,   -0.1725347384110806,
+    0.8242934907117544,     -3.1545431461243822,    -1.9178098128512968,
+    -0.5660162936337811,    0.036895040275987105,   -0.8932168544591137,
+    -0.2208669765531758,    -1.18617316681054,      -0.4012729672717883,
+    -0.8467661486901819,    0.24402130101373667,    0.5814198502426856,
+    1.4329300628070527,     -0.6564185452162635,    -0.3179918232523262,
+    0.04774542744237301,    -0.29491926709078753,   -0.051990547101837564,
+    -1.562178729028218,     0.37175482357017836,    -0.9151915603012377,
+    -0.9569615679966009,    -1.5881262039021504,    1.161001630661401,
+    -0.1406091012972051,    1.14949198238,          0.27230168184814785,
+    -1.7033609262959155,    -1.0836964308948651,    0.7579319739406098,
+    -0.7656827141910405,    -1.0903440488749823,    -0.1793791282722899,
+    -0.1769671627562583,    -1.011867399093296,     -0.3261452556134624,
+    -0.4784926733363041,    -2.589989637458934,     0.502663526953067,
+    -0.8113749663534245,    1.3044394247585775,     -1.1501242352594518,
+    -1.5795983797213584,    1.1876239439866794,     -1.5850551157963375,
+    -0.6361742693791664,    0.597336718485879,      -0.32964610005481576,
+    -1.6554719689092348,    0.18803523461163435,    -0.19432291117124376,
+    1.2838550640677127,     0.588647904010331,      3.035714298111556,
+    -1.6458940359794758,    -0.021674753294791394,  -1.066654491033784,
+    1.1547505008320107,     0.8218379777534848,     0.7540378265510653,
+    -0.7773319565853868,    -0.7451515753835625,    -2.029679887663501,
+    1.7095001419088596,     0.508219294296325,      -0.26085995051958866,
+    0.9335153435389998,     0.7509155366343595,     0.9752641947374724,
+    -1.623537444586506,     -0.7138359429967399,    0.19544198106754554,
+    0.35542114521006973,    0.9572348634493512,     -1.0086355502545346,
+    0.12720913577777657,    2.205353791976543,      0.6919219776107886,
+    0.8705628841074635,     -0.01918727026696566,   0.7676270130194687,
+    1.803989786697739,      0.10664198726433499,    1.2239784048273419,
+    -0.8751393783314361,    0.5900987666308313,     0.9042166751969641,
+    -0.7520033792581955,    1.0981241985488952,     -0.6752465960330831,
+    -0.8052392575398221,    -0.0011923511051287392, 1.9319897429765716,
+    0.3091529530728036,     0.9357847820544649,     -0.7317977213101007,
+    0.07749745574279869,    -1.1765563699870865,    -0.571106373339119,
+    0.835640668792203,      -0.03839730591109033,   1.45129634214403,
+    -0.20241644121068042,   -0.19793592747244393,   1.2766815477335414,
+    -0.6486165056131792,    -1.5197646058401793,    1.3012769207885426,
+    0.4141878759428833,     -2.165194947578218,     0.04452932136918665,
+    -0.4037869991833171,    1.7448396601192766,     -0.7289914132183756,
+    -0.5807680557235481,    -0.9104008234735304,    -1.0540560866599389,
+    -0.700495920687974,     -1.4359244744861313,    -1.0311973812721096,
+    -1.6065852366477575,    -1.4972787191167518,    -1.5596750312674383,
+    -0.5211589342606382,    -0.6836885455877433,    -1.2264703976417448,
+    0.47827087501953874,    -0.04807588156959902,   -0.431975952508788,
+    -0.46397327906010694,   1.5928795615958418,     0.23981410787750204,
+    0.47537832699466753,    -2.586039943876386,     -0.6537344894045286,
+    -2.1710067840058747,    -0.426204327182512,     0.3733101463429235,
+    -0.674297767097434,     0.5186088302423606,     -1.0227499750553697,
+    0.5758031475475504,     -1.5536093306337848,    -0.2616882513082929,
+    0.419807198023843,      0.5359207882174326,     -0.12726336289101695,
+    1.9397142696305496,     -0.4144198369822065,    -0.4509957424693251,
+    -2.759507465661304,     1.7689338244500405,     -0.36899829117537003,
+    -1.1760154957169364,    1.3209044470554892,     1.2355061234756644,
+    0.10832562456606155,    -1.4349215686287293,    0.41897605092846396,
+    -0.6213919884429843,    -1.1707717953642571,    1.0433723671435184,
+    -2.1325920863862113,    0.5671632573670581,     0.45935509657016216,
+    2.0510108031226757,     0.3251738318299273,     -2.0584314911637356,
+    -0.8361209875707278,    0.06466692130559458,    0.3555636436097853,
+    0.9808160763437178,     -1.9596757620790584,    -0.32994968720006074,
+    0.969860946102532,      1.5439697955424616,     1.8610238233126282,
+    -0.3902191773644836,    1.09760525660642,       1.7117123424087934,
+    1.1980695233928118,     0.7236852620320248,     0.8277969278090205,
+    -0.7898843116016183,    -1.4472497710144514,    0.9828479286400185,
+    -0.3470668083827981,    -0.028133580718402725,  -0.5787200519143751,
+    -0.39290684184968,      0.2327493946858871,     -1.021859374191638,
+    0.06850001191677457,    0.24605487522907746,    -0.0773554207887332,
+    -0.7436298076544051,    0.7866198535183534,     1.8726369639932994,
+    -0.6012429598064242,    1.2344628506279733,     0.8892640592794231,
+    -2.6532517180506723,    -0.7611940999464197,    -0.6358403045852818,
+    0.7817715507811523,     0.18848788103748826,    0.4743980894695074,
+    0.6362788678712624,     -0.8989167148423329,    -0.7465499515010231,
+    -1.2228889627133084,    -0.1702705994069669,    -0.11910320666188712,
+    0.17120532699964489,    -0.7273076260918008,    0.9065245981430602,
+    0.9171108159418699,     1.5465188086681005,     0.7113078953970193,
+    0.18551123846931586,    0.6724239728526512,     0.6097517892531971,
+    -0.6518148999055419};
+
+static double gemm_B_dram[512 * 8] __attribute__((section(".data"))) = {
+    1.289385341711685,      1.7185181521648585,      1.976953180409848,
+    0.03522570904641089,    0.32427044329810384,     0.41635889052149266,
+    -0.002545563200592299,  0.6192887662137895,      -0.12117985080724364,
+    -0.19378340374814312,   1.7589821689866296,      0.1647154399018857,
+    0.06701020107735467,    0.8820192770324551,      0.1503329624493145,
+    0.2916222572092636,     -0.063564176479005,      -1.2204164921552978,
+    -0.030971715777287946,  -1.136884761914945,      0.2101512256908466,
+    -1.18143821319941,      0.9167091315499266,      0.7492347655988371,
+    0.2804282522536182,     -0.1001338776894076,     0.41630127953499063,
+    -1.964998337258153,     -1.0968198966983351,     -0.14873326311395055,
+    0.3452594335425641,     -0.07939577220284907,    -1.0046101383842825,
+    0.13344603462109247,    -0.4537004224688771,     -1.0685970433971257,
+    0.32950201508388843,    -0.20997820637102263,    1.1964831756964511,
+    0.6655320669543341,     0.7346713338464687,      0.3216666235060605,
+    -0.8451779772276554,    -0.9356271421283485,     -1.471158097691097,
+    2.8790124975636022,     -1.0794447891526988,     -0.20983183445547335,
+    -0.3603891654367212,    -0.2810976214280731,     -0.584050506346426,
+    -1.868344849270662,     -0.9981937374931927,     -1.3906695302272547,
+    -0.12677959099357683,   -0.6841994053517984,     -0.6871802588935974,
+    0.2158792456483957,     -0.5827850788582554,     0.9320941366718141,
+    -0.3861797863089442,    0.22515672822400776,     -1.32529671809268,
+    0.6568730209019389,     -0.40518339271927395,    0.4087580832902805,
+    0.33000516778113,       -0.17344315574593555,    0.2174391162949263,
+    -0.38529643595278734,   1.3461097503412538,      0.9342888546843545,
+    0.48249426079874763,    -1.1801404150533439,     -1.0993056555807936,
+    -0.6638615693816969,    -0.2450025435542981,     0.4480156689893388,
+    -0.8965378486453056,    1.1770740713435708,      0.0035948260408600282,
+    -2.0127817747014047,    -0.4753171130592551,     -2.5851852844817746,
+    -0.7517287068932562,    -0.5491278494530036,     -0.6104101345698859,
+    -0.32525354225734127,   -0.3941018148821879,     -0.5937343536013119,
+    1.5024969120468332,     1.2149022476324396,      -1.141840656789839,
+    1.2538998985134067,     -1.6213674818805632,     -0.8146121697170767,
+    1.52519274590198,       -2.2395533380839603,     0.5747856629329532,
+    -1.2534941165597333,    -0.14400012480290983,    -0.18020321070289202,
+    1.6972042117047923,     -0.8106034414835802,     -0.06901518324670536,
+    0.6270198155852067,     -0.2517774914632372,     -0.8220673267654407,
+    -0.05919977985202037,   0.09351148585756956,     0.884055433909044,
+    -0.9430523456034778,    -0.4491305134880514,     0.3229426895242536,
+    -0.16716743733737296,   -0.18528023098144103,    -0.017003103324145882,
+    -0.6958394882368929,    -0.7996904016326981,     0.44073017860946173,
+    -1.0951000927916446,    1.1653838512075743,      0.21730491319659,
+    -1.276541091568623,     0.2830269957152605,      0.16727859908564113,
+    0.7621613837839641,     1.1588495718450047,      -0.3664191156646492,
+    -0.707762707706492,     -0.6059815438875954,     -0.9810884288009163,
+    -0.7464415668311316,    0.28450243761134175,     0.015265812818831473,
+    -0.49135700723292003,   -0.738255810782413,      0.347886269511483,
+    -0.5015990127218578,    -1.0401567427730807,     -0.15167485760614444,
+    -0.264493598094959,     -1.0700412930966852,     0.8271763562614096,
+    0.8460124298546868,     0.04089368451052054,     0.13104036890904666,
+    0.5273080997465787,     -0.030922472263587825,   0.8912922446426618,
+    1.656008484699485,      0.0804930425261346,      0.44025342397696143,
+    0.8734516679613615,     -0.3380428067986851,     -1.1283045171918837,
+    0.9060008153461884,     -1.5687643567462615,     1.7888366900220696,
+    0.8704334283821108,     0.1876911695103255,      0.0510959339084936,
+    1.7513579481129395,     -0.9462259567737072,     -1.1601934603236257,
+    -0.5981359247121436,    -0.2617974840702203,     -1.006469240395529,
+    0.15386107357095694,    0.1359449473427494,      -0.8138571479878205,
+    1.603052652443563,      -1.392073939878003,      -1.2767228586553112,
+    0.37612003170845065,    -0.20748288424464334,    0.41772685492077233,
+    -0.6189706209377593,    -1.0333397780175095,     -0.6455434737566845,
+    -0.6835953070360038,    0.5249960083345708,      -0.4799583539738183,
+    0.7614303774911797,     0.5880753458049396,      1.040596332300466,
+    0.90071902882521,       0.7843528239572451,      0.7698529690098654,
+    -0.5166922695242262,    -0.2618841417402872,     -1.8301271358594364,
+    0.2917505618925979,     -0.673765913490036,      0.40154546435054106,
+    0.5274840785806093,     -1.352093704595329,      -1.0138393659935512,
+    -0.3493463357508016,    -0.5176006556319437,     0.16702018413550748,
+    -1.155423766612398,     0.04717833215527393,     -1.6884855418139904,
+    -2.155110359495152,     0.7166636395955764,      -1.3053134891160654,
+    -0.5599177076003232,    -1.417362936850548,      -1.4088707900688275,
+    -0.3988565596959592,    -0.4101283732824781,     0.9825871324379862,
+    0.44951201091392656,    -0.26111853733096213,    0.7576835306606204,
+    1.1165542180070642,     0.411297981876631,       -0.40631613782556647,
+    1.0186033766185785,     1.7685216261060954,      0.6605343187117255,
+    1.770676590400743,      0.9265989166637347,      0.8488585831285513,
+    -1.090186484917704,     -1.1135493459717551,     -0.04948348466500732,
+    -1.6694576939036156,    -0.5929538129904747,     0.8673373942012389,
+    -0.6651554180197803,    0.5331910186557777,      -1.3512508965598733,
+    -0.49364101718611164,   1.0234404294173223,      0.20851243688529744,
+    0.29028252717784747,    1.7047238315946285,      1.2968035024879467,
+    -0.8768569031977257,    1.3178986165036368,      -0.6152441226468611,
+    -0.017589832719863276,  0.015213084468816439,    1.0730402468735136,
+    -1.1292666384327423,    0.45186088404208596,     0.5240148795796721,
+    0.8115132728378954,     -0.21038579732682744,    1.0034122333710784,
+    -0.7115439859527487,    1.1470587467683069,      0.35224016801023095,
+    -1.400082899212773,     0.40792033834150976,     0.17930459377802474,
+    -0.35565634445261957,   -0.7362536060315219,     -0.240192956823039,
+    -1.442157013194299,     1.690719464084124,       -1.1282788050680386,
+    -0.6612831040067043,    1.1448990480585721,      0.585030845605586,
+    0.7202453713222604,     1.5167084512000626,      -0.3121427356736696,
+    -1.0464949240388077,    0.8442679692407903,      0.7962782902357136,
+    -0.3268894213447173,    -1.2655799233356313,     1.2391505515789194,
+    0.575847388165508,      -1.3734739216837852,     0.7799538165262154,
+    -1.440977405082379,     -0.48263044132040345,    -1.1233094506905685,
+    -0.6378305722889597,    -0.8333110049758257,     -0.6133108128398762,
+    0.7242639620470163,     0.2945909670570727,      0.6287316020446637,
+    1.0923421235429414,     -0.37270250458264037,    0.07989468325418829,
+    0.5381529978376386,     1.706738572598845,       0.899078253382037,
+    1.3815511554204174,     1.0189647244587277,      1.0572654174733929,
+    -1.7846701659189486,    0.8808591942234584,      0.2129248467187966,
+    0.054214374395357916,   -0.527255138315271,      -0.4252740782806449,
+    0.41618073882703194,    0.8399757635785043,      -1.4977856049331646,
+    0.21810382065939288,    -0.5606867786472959,     -0.9508027663214393,
+    0.3926222752782189,     -0.32871783189517306,    -0.6590366806742368,
+    -0.7691650364151525,    0.2812988486575179,      -0.010038274251463825,
+    -1.0916403769587453,    -0.8409976297559635,     -0.18250647964381972,
+    0.4051478101302095,     -1.049714506095244,      0.48810659292943503,
+    -0.8240027246128723,    2.7277445986992355,      -0.9410028621366266,
+    -0.7901255402876283,    0.19400337485364944,     -0.9023809671624451,
+    0.8276312306042161,     1.8014163467567794,      -0.3876198041095915,
+    0.1727710412144404,     -0.5177596662834922,     -2.8890981522643574e-05,
+    1.4317344185030516,     0.8942461977066967,      -0.9042249335038824,
+    1.5459043652157056,     1.162061328999815,       0.48636831873409325,
+    -0.659217416319285,     0.06570753973556404,     -0.7954659408712335,
+    0.4676057696719486,     -0.3164710983237507,     -2.23496202878047,
+    0.926203056277368,      0.19145303768298497,     1.078483069134095,
+    -0.1361797331462486,    0.18846661891450603,     1.1153261444867018,
+    0.387797071428739,      0.2880017302178219,      3.214390971909234,
+    -0.16900019082095039,   0.16918574977841397,     1.7340287011737314,
+    -0.805007701528497,     -1.040997301485229,      -1.4320658005825042,
+    0.5336624593453383,     0.6256307447469265,      0.7414876465549203,
+    -1.3535600800467034,    1.0058591594818873,      1.1972658813934152,
+    -0.09731132465768487,   0.0325664659560403,      0.6755957782622037,
+    0.367143500143,         0.6419696650433121,      -1.0860860579650238,
+    -0.1746223857264095,    -1.2124733597387285,     0.6312769520562472,
+    0.5302164622767119,     -0.09881499080804336,    0.2967992294103342,
+    -1.556516358130969,     0.8579252643871412,      -0.4672710699218704,
+    0.1290510134157261,     1.1153697189785832,      -0.7565006082748553,
+    1.1972335181812708,     0.12407530951196799,     0.02819015551787851,
+    0.556045568363087,      -1.2470255824667826,     0.594106177561087,
+    0.06150945870525086,    1.0362769626049344,      -0.21680703129531062,
+    -0.36331744678200245,   0.36963815265672956,     -0.05936779252416777,
+    -1.1739686745612512,    -0.19395772977111753,    1.2676300198541905,
+    -0.09310372586669181,   -0.8704599607677304,     0.7159370052169773,
+    -1.85344367027448,      -2.1202672506254667,     -0.004150296173177208,
+    0.18092523086431334,    0.22039921162634282,     -0.8927828911915724,
+    -0.1504996201351866,    -1.3987332518431757,     0.219562310680947,
+    -1.615318854579781,     -0.1492427416792045,     0.2615793111329703,
+    -1.7566256994238636,    -0.5225029255109357,     0.7881462464150731,
+    1.5489678835906378,     -1.5039602882516212,     0.3399184584315507,
+    -1.2359493747154482,    -1.3452580019083729,     1.596073831064355,
+    0.6681822358497356,     -0.8041942973288516,     0.219027668829904,
+    0.6419463362638245,     0.18129265639183836,     2.2472787436994395,
+    0.605779141138385,      -2.9929816204288446,     -0.29019976256709457,
+    -0.7365762178923174,    -0.2041467778064034,     0.013465896299126338,
+    -0.6511429259683605,    -1.0849176059960057,     1.3634054909427085,
+    0.5973419939485671,     -0.6707393502626668,     0.6796496534340393,
+    0.675180566507227,      1.2673074611463526,      -1.055313326575193,
+    0.7798816293547256,     -0.6077883445070497,     1.1550445713591535,
+    -0.19244915469604434,   -2.2717792326401027,     0.03535397368653716,
+    -1.7841625220166666,    -0.21714942594408118,    -0.05819163020514709,
+    -0.4013050158100976,    -1.4869198852985548,     -1.1157289072186787,
+    -0.8445905993324864,    -0.24810861102245482,    1.2884997799132312,
+    0.7090854303742485,     -0.4721952334895974,     1.2738777053993517,
+    -1.3680624871013929,    0.6850213170639883,      -0.17523470020174475,
+    0.2363247906446195,     0.6384621945457168,      -0.6795750166152891,
+    0.8011581338869036,     -0.009309986232615973,   2.4117989020868333,
+    -0.30426108521026884,   1.26917483653135,        0.6470904259956914,
+    -1.1741264164507175,    1.3606222392346448,      -1.060410803627005,
+    -2.231995170382012,     0.853315686011954,       1.0689533852881405,
+    0.052025631062613036,   -0.2610193119246841,     1.5836817994910326,
+    0.7118680737856397,     -0.6558659237277387,     0.7315329796359693,
+    -1.2432916297202024,    -0.5589679376978514,     -1.0511300322009207,
+    -2.200017380038361,     -1.1772925474554745,     1.2223279030800633,
+    -1.0978218788619438,    -0.5500320300032019,     -1.1609736833209554,
+    0.8656072166240774,     0.0011974481672618685,   0.4907452935681658,
+    -0.10568678053148799,   -1.1710269672218692,     -0.973942795593724,
+    0.8372659403012491,     -0.05740669551710561,    0.7744016887233798,
+    -3.1625958705076944,    1.1101087356885349,      -0.49396718934480277,
+    2.1728572463956386,     -0.5107550832081783,     0.028268871679493147,
+    0.6603776289974964,     -0.8757951603101223,     0.8727379309639394,
+    -0.645215908855314,     1.2891030882261105,      0.7932062567348767,
+    0.49563664662603807,    -0.724194178723068,      -0.21057116858873387,
+    0.2999116083596886,     -2.0333427405438136,     -0.5517492964661896,
+    0.938073503891436,      -1.2681807724163756,     1.278978307558204,
+    -0.6283151880367162,    0.32325734304049125,     -1.1476638497082268,
+    0.4843782644284401,     0.46272803082578123,     1.1363739576155818,
+    1.3540701033107998,     1.2535236917029877,      0.20891898377787882,
+    -1.226164118362896,     1.3237650837810244,      -1.3041347358059512,
+    -0.4387098303357449,    0.7371086090410185,      0.44355769183504495,
+    1.5930653836247564,     -0.0040534266147775125,  -1.690068973099096,
+    -0.2752584046412137,    0.17406048941303162,     -0.3506090274352232,
+    1.4124535516900458,     -0.24761261147971436,    -1.4358472999438883,
+    0.46678946561837587,    -1.1476852168989529,     1.699892339660947,
+    0.270094204767006,      -1.4032843996500628,     1.0793918268290181,
+    2.3692465481582556,     -2.0040560530375524,     0.9030735089709537,
+    0.4840275803395181,     0.17568029694849005,     0.3433284201270193,
+    0.49188566484212837,    -0.6930048353471445,     1.4109898381177775,
+    -1.3495241610180455,    1.958563370279812,       1.527687216214651,
+    -1.1861350466098093,    -0.005400131000477191,   1.4198589871443197,
+    -0.49099443350484123,   -0.16240854473728508,    -0.40237739797281896,
+    1.1674728080056607,     -0.6076827531242488,     -0.009825594514960836,
+    0.5402154018682239,     -0.20760171202737612,    -0.8664315256792297,
+    -1.3415486022819862,    -1.5182564386057238,     -1.1798042502785644,
+    -1.7205495539871147,    -0.7268767879223045,     0.3002148052585635,
+    0.05409536881569749,    -0.8266330811652837,     -1.0180189553829169,
+    -0.9933885629183765,    -1.3878980226910025,     -1.2358775777497444,
+    0.7143615737723078,     -1.4046115068751779,     0.01731584864875917,
+    -0.6180538501501635,    2.4279444867778137,      -1.7969280332746063,
+    0.19330085492571836,    -0.33375059399774476,    -0.7711303644799203,
+    0.3152129542921461,     0.15558461727451872,     -1.0689051640762384,
+    0.4262773588426122,     0.38916857866901455,     1.3094697232444557,
+    -0.6099712132874227,    1.470444438145549,       -0.196817358297354,
+    -1.9760123510226113,    0.523095800724527,       -0.08159020676334972,
+    -0.8823509559363621,    0.9332403438508771,      -0.47162828426325093,
+    1.0168856077002486,     -0.08270112761350111,    0.7503217358086836,
+    0.6794777611506858,     0.4731679155145285,      -1.032043429172452,
+    0.919712977160328,      0.0217617250277118,      2.0022607736457996,
+    0.47866988329506416,    0.7511262340245196,      -0.7648929555202142,
+    -0.40614158559758673,   0.09671799432932998,     -1.1704760418537006,
+    -1.1702773699142448,    -0.1085827579001268,     -0.07787119892940478,
+    0.20207488682861602,    1.1171041340040986,      -0.4003373621477374,
+    0.6808757090562668,     -0.14463533644795523,    -0.19401191453756295,
+    0.25706805218789175,    -2.067728271529583,      0.06635686450734092,
+    -0.6382574745409534,    -0.9298385392262319,     -1.8869914173722033,
+    -0.4428910909670608,    -1.8774360718730723,     0.8701231593616141,
+    -0.2393073192830462,    -1.6820717761241684,     -0.6735248747306768,
+    0.7549537519938414,     -0.5948834668152313,     -0.28121780617759695,
+    -0.3691832141706423,    -0.12827610461057184,    -1.6997670434500198,
+    -0.045459677942810556,  -0.5580926962117219,     2.9537792641399316,
+    -0.21300837995416544,   -0.45562459224058205,    0.9884770070036552,
+    -0.15603216950516802,   0.2533421907477552,      -0.8741159665377922,
+    1.555228070446301,      -0.627674675419191,      0.37535028261937037,
+    1.1323575308822444,     -0.3045049241513605,     -0.0001490498648908829,
+    0.5865133672130857,     0.6826819134624046,      -1.0900979849886712,
+    0.1814832299213445,     -0.945369035582733,      -0.7453702060845657,
+    -0.648391176584059,     1.2159778500722835,      1.5965773341210034,
+    2.605452593879662,      -0.056550418380157286,   -0.8414068818360764,
+    -0.9694817709901686,    1.6074807889844713,      -1.538378199155153,
+    -0.316968558483206,     -0.5660630458678035,     1.749995274006127,
+    -1.0133440989579459,    1.1016633372597648,      1.31335307429686,
+    -0.16677002654309434,   0.4654952947644866,      -1.5387143314075462,
+    -0.08820781182612655,   -0.21502705543829606,    -2.579582644851874,
+    0.4153769684854302,     0.3551664168161738,      -1.6933760502015254,
+    -1.4122758293094115,    -0.7492891453695645,     -0.5291817822923829,
+    -0.30636589590490504,   -0.9581242311464521,     -1.0078571307469861,
+    0.3065132438008009,     -0.4752480390629452,     -0.10680060337740549,
+    -0.22967986894639247,   0.4572003101059361,      -0.15427488198311298,
+    0.8615394691474236,     0.10299852806451576,     0.8890342984703947,
+    1.2470822250051201,     -1.4604754563615618,     0.9219951214159728,
+    1.7828221484006088,     -0.9725291279578072,     -0.03187070750064483,
+    -0.3572040941264915,    0.4408339320696138,      0.5199918729810443,
+    -0.6692956022405149,    1.3125565223689,         -0.85668081168761,
+    -0.13831895369896985,   1.023592283566227,       1.9534378919694737,
+    -0.5126552424803987,    0.7822946119676119,      0.22004170471554488,
+    -1.5824436598466647,    -0.9551882591441155,     -1.2047707675356991,
+    -0.5033170552041598,    -0.4167881641539713,     0.02794879375551491,
+    1.2776939313762004,     0.4224761804725617,      2.6530626560608734,
+    -0.2434279416564429,    0.7892529213620024,      0.41441169469434314,
+    1.5065666925786185,     -0.3787160550962224,     0.8452578464582505,
+    1.6290727571493573,     -0.7208128462835177,     -0.07487166161865964,
+    0.50430630616938,       -0.43477945054773337,    -0.875244066355259,
+    1.8327329958645378,     -0.229650104410584,      1.7340930915713035,
+    -0.5084253162339523,    -0.2070889175460573,     0.7971391463071966,
+    -0.20601914651240552,   -0.8988681434364175,     -0.719911183404855,
+    0.2726723583426293,     -0.666114018184255,      0.08806775356544921,
+    -2.257285851068713,     -0.5581222757399072,     -0.18031175679170344,
+    -0.5126417054614768,    -0.9935866181667308,     -0.883504579768057,
+    0.07052089074637315,    1.4870595256068533,      -1.3984263405326625,
+    -0.27626020994059186,   0.9770496026857499,      0.3344578549171757,
+    -0.09375738175076066,   -0.4507126034465222,     0.013261885283804235,
+    -0.10106411678041247,   -2.1864617615483044,     -0.715783231287305,
+    -1.9495889195944887,    1.2910565269664827,      0.8226485065399656,
+    -0.7882340919654517,    0.8048777645556339,      2.448647492101617,
+    -0.6230764610587125,    1.2992751069068902,      0.3625051167411656,
+    -0.23669921987108264,   -1.1059105499737532,     -0.5559250524055706,
+    -0.3949125162879612,    -2.315775631107071,      0.5304618712530338,
+    -0.3217312948341934,    0.45924421697025325,     -0.4192272263185087,
+    2.998272743459456,      -1.657284635810097,      -0.9330594546872397,
+    0.7052054431518636,     2.3584677409501467,      -0.9924186997796605,
+    1.829214895003395,      -0.9170294093756378,     1.2933671239448539,
+    0.07539454890509299,    2.229998540520781,       1.7819852673818741,
+    -0.6477226709721486,    2.93570146505725,        -1.1241588614917153,
+    -0.313620692582917,     1.8079031374875643,      -0.734783105706167,
+    -0.64135135526143,      0.13063039730524645,     0.45248667149970156,
+    0.3871823101979803,     -0.7456973521885583,     0.19689351577592681,
+    0.6374254086910659,     1.5039905960636601,      0.32816048821162896,
+    -1.25297943824901,      0.02841749723550984,     -0.6205935725480949,
+    1.3190309085105703,     -1.675422496628599,      0.5597331386976768,
+    -1.0653963023523108,    1.2720571237057474,      0.7711621237366315,
+    0.21933114193041292,    0.5049387118143887,      -0.3368800787803611,
+    0.6757772924750197,     -0.04962668226204786,    0.7312040068446839,
+    0.05857627564784104,    -2.4811914853053376,     -0.5136576840557472,
+    1.5174924509227699,     1.4525402156357885,      0.10454912052202897,
+    -0.12603357810633276,   -0.3352481386980251,     0.6305609042005433,
+    0.5790377243486634,     -0.9790918389714247,     0.6616501445291856,
+    1.2328966110014508,     -0.9548648213862446,     -0.1868413340423335,
+    0.46356484022827815,    0.7227529674460641,      -0.42053510001203787,
+    -0.5286775889912143,    -0.4638853479879945,     0.38523261923320196,
+    0.42911911519047446,    -0.019417543876177737,   -1.3642239554257414,
+    -1.0899868119191238,    0.6368240335314885,      -1.2210882131087215,
+    0.22635703799711782,    -0.36079762170112517,    -0.6022285061187317,
+    0.02669846136539646,    1.6763520911914194,      0.288816582066866,
+    -0.2956657266256853,    -1.4733715929359021,     0.5122384083312601,
+    1.136703353702554,      0.6073760467131242,      1.1659541072399475,
+    0.4765981778375144,     -1.3032748090829964,     -0.044949760849622884,
+    0.5248679834358566,     0.7210115254683419,      -0.49307644032833137,
+    -0.06336534569112102,   0.36586964228224156,     1.271293016796746,
+    1.0052388017895395,     0.6463183205729617,      0.3962225626846912,
+    -1.0252813667917564,    -1.1009598156427736,     -0.0918546545866658,
+    1.0415833830758026,     0.39535342348163693,     0.5610959353166028,
+    -1.5015559120508,       -1.4616537565063707,     1.1198838265349822,
+    -0.034638428394259076,  -1.3136878789643385,     0.8821674262169477,
+    0.25803616134093266,    2.9514642745077437,      1.2500004473316089,
+    0.3466973246304833,     -0.15110956038353035,    0.23229550813689703,
+    -0.10265217081063333,   -1.4387967148215497,     0.9275221197205532,
+    0.27485751749402,       -2.754706785130989,      -0.6355232251350402,
+    -0.8287418391076249,    0.9808901826693291,      -0.04405519010159131,
+    1.4874068545664905,     -1.5915195936984605,     -1.0757861164901155,
+    1.0670945267244607,     -0.6552213513174084,     -1.0586323916206477,
+    -0.5266714026610139,    -0.7598242721785887,     0.539327847291872,
+    1.1181676111568415,     -1.5869192311313465,     -0.2907764941934657,
+    0.01424387974271123,    0.08219363457393836,     0.8332555696612187,
+    0.119847106147557,      -0.5798033569867375,     -1.1118935209405625,
+    -1.824709271360341,     -0.3711119224385391,     0.01440987496422436,
+    0.9217248810889792,     -0.37776911154063514,    2.3237042742558933,
+    -0.07647958605993008,   -0.4833437594075619,     0.3805952618816213,
+    -0.9705589546398407,    0.2089080413409449,      -2.0640968549849434,
+    0.6760940759111317,     0.06667865592621124,     0.2105707825451485,
+    0.15480875799999516,    -1.2737560690934626,     -0.8986213938188805,
+    1.5664249130887766,     0.494597580478903,       -0.5972632802216176,
+    0.4210805545678483,     0.4077109007023292,      1.9544844633557323,
+    1.1103508858669717,     0.41116869397762196,     -0.4491852420964507,
+    1.783689915136641,      -0.10154865211136925,    -0.8705119223017634,
+    -1.2202464859202824,    -0.8623965380480931,     -0.36408524416704513,
+    0.7654014831163175,     0.9131854237589454,      1.1510697836854031,
+    0.1529766949851929,     0.8314925300419136,      2.259315575836879,
+    0.910289420520676,      1.6028825745362827,      -1.5106385510916758,
+    -0.7417989506465258,    -0.7511149556782155,     -2.6770342430781464,
+    0.0736782726815642,     1.3924489928118085,      -0.535316878876664,
+    0.1954422308839413,     -0.8540541967696919,     -0.49172764486353404,
+    0.2853098425182686,     -1.195775771879837,      1.174033031094316,
+    -1.918759193167171,     0.32223408808630233,     -0.49148177270312765,
+    1.4891447450457527,     0.7618450919294047,      -2.0841591413219676,
+    -2.4223966069821965,    -1.0013564105870518,     -0.5022263776157665,
+    -0.1890069406592009,    0.03024540836426785,     0.6735960181141722,
+    -1.3659907130774356,    -1.800546652302095,      0.2524614630050099,
+    -0.3609810112184397,    -0.10337333232262819,    -0.6418298464426032,
+    -0.17320876420470538,   1.486506903619689,       -1.623270295133161,
+    -1.2255304483995895,    0.6416016025185526,      1.5674077665995356,
+    -0.20564890732406377,   -1.262715857498158,      -2.00111994520767,
+    0.26054244674376786,    -1.2493542213517603,     2.1755789256379185,
+    2.3416035359052696,     0.22630129321375733,     0.4854617015970859,
+    -0.11791274245121647,   1.141795661244427,       -0.0030704777281344614,
+    0.06335675260431281,    1.360403262304348,       0.6261825197612685,
+    2.130981283917076,      -1.6368295559072694,     -0.5555824180790634,
+    -0.9039060151078754,    0.8417791693258407,      -0.4935903527028892,
+    0.6023319877887804,     -1.1689879541233021,     -0.09434109370116912,
+    2.2969954397531405,     1.638368221459261,       -1.8785319339207485,
+    0.36458646424691954,    0.8263529209141244,      -0.4934074057272609,
+    -1.102380304666846,     0.6619878044822564,      0.10082543006853853,
+    0.5525408685957296,     -0.15805143515754672,    2.331165182486843,
+    -0.9138410809898123,    -0.49599873735205025,    0.5148854567040885,
+    0.7317417636581219,     -1.378713630770589,      1.2973127137701748,
+    -1.4581184448190483,    0.006399600046154475,    -0.30702663057136353,
+    -0.7076248109417969,    1.133250429620587,       -2.3470527842730435,
+    -0.7307828123056779,    -0.9027638509435852,     0.8748974068133323,
+    1.5504213160135774,     0.7754687735448101,      1.3952850221761692,
+    -2.2245542177124547,    0.16360011702392324,     -1.3830333961679573,
+    -0.37496538762347165,   0.24467164863886215,     0.09462460132282483,
+    1.3757537967745386,     -1.9786353403291244,     -0.8357364497674116,
+    -1.4806299853682712,    -1.638790797076638,      1.0057794381356229,
+    0.1824188380472171,     1.556613784443566,       1.1852063376633004,
+    0.06815024693528814,    -0.9696163810925837,     0.9917917931011433,
+    -0.691603065594482,     -1.1994238154262575,     -1.1504101096608723,
+    0.12185711246740445,    1.265529846451242,       0.05260881697827562,
+    1.2244285322908544,     0.09134206751589977,     -0.4264487668592376,
+    2.721173739044832,      1.8210445299157296,      0.1969069797714716,
+    -0.8321947285442037,    -1.609029451692822,      0.4013576309743979,
+    -0.255511727709156,     0.4670008118381855,      0.32304122103894983,
+    0.4362761814423121,     1.1422276144175765,      0.3142198753896684,
+    -0.7234440328459119,    -0.7705485599851617,     0.5831268650353936,
+    -1.071826954371577,     0.7183421955712772,      0.7141934107186635,
+    -0.04388348915623074,   -0.7814232766358062,     -1.7763387305154212,
+    -1.1239649623130736,    -1.6259299915699765,     0.02667109233694199,
+    -0.4422875371588646,    -0.9206615370302526,     0.8726054709082737,
+    0.12932788545356033,    0.0475869285655146,      0.5581167804822794,
+    1.0364524461402245,     -1.602823987514767,      0.7066798465574406,
+    -1.8089367993045458,    -0.7943835410373827,     1.01214557856611,
+    0.6912224994756002,     0.6647408959923149,      0.18208490561077104,
+    1.4129765562660128,     -1.5408007845310363,     -0.305155313314902,
+    0.04734905160179651,    2.0352851581382057,      1.0265499061752679,
+    1.0384276626818627,     -0.7613455151170644,     2.2496615540466074,
+    0.4718083593354464,     -1.00592442912077,       2.345359297086998,
+    -1.426908208722563,     -0.8686997520872302,     -0.23400107574901624,
+    -0.980419737782284,     0.527211196283874,       0.276762685967314,
+    0.11350831680232691,    1.8938068316904375,      -1.6339691673702201,
+    1.3663857682669938,     -0.824651829575122,      1.4621639029858144,
+    1.905213993186392,      2.3015530387572984,      -0.19051428322037997,
+    -1.1632594691967817,    0.3279260980839228,      -0.053368568328445165,
+    -1.7628493853946647,    0.7355449884640639,      -0.9226779694002419,
+    1.442008824241391,      0.9651635963398251,      -0.28133739204335284,
+    0.036164361969480724,   -0.24256723925782622,    -0.4573933017078719,
+    3.0983106569913765,     -0.9361968812479787,     0.05533758850272923,
+    0.9914715704968188,     -0.38433906450452543,    -0.6285427878650274,
+    -1.3291010474101146,    1.1920353327508753,      0.7120029949357032,
+    0.46993361389369576,    -1.5087958752945372,     0.5035828386788038,
+    0.2853044072125119,     -0.3380637758950518,     -1.376740795973979,
+    -0.056682608259968535,  -0.8708420713804792,     0.08003477556166226,
+    0.06334006332975936,    -0.3381582638110928,     0.8820234632358825,
+    -0.06605055615863155,   0.5290869560935834,      0.4184023317712546,
+    1.0081731465237387,     -0.9640596957234715,     -0.34530484646468196,
+    0.92199450763843,       0.15353283567518972,     1.1258052528212672,
+    0.7452427958666733,     -0.4446800773703152,     0.8805109402769709,
+    -0.2574857377902735,    0.9566044952368202,      1.8537644298144036,
+    1.0915945069114532,     2.289500917464586,       -1.5515819351090716,
+    -0.5483748403923906,    -0.26634458762537405,    -0.4002905414328943,
+    0.37244803952713856,    -0.368108542880197,      1.106107424765034,
+    0.9847604849094568,     0.41347341110958546,     -1.012213287592923,
+    0.5473737791257619,     0.6742900156589524,      0.35388543026848024,
+    0.030007091808962966,   1.4003348730343157,      -0.5483807806982125,
+    -0.3666974718827937,    0.6670558611612393,      0.5307912980750714,
+    0.852597525301646,      -0.28401077751565246,    -1.3147060769008603,
+    -1.2375821375347569,    -0.43267271509082084,    0.7924251658823569,
+    0.7922641831578515,     -1.815911224773823,      0.5338957718343611,
+    -0.08722657039841221,   -1.0421058704108108,     2.1907750313906424,
+    0.2639578863553554,     0.8274152256554287,      2.5675254359375583,
+    -0.5811194038804803,    -0.3967901932906783,     1.4890156591290105,
+    -1.3076709746803026,    0.07396569629135018,     0.04621508676410812,
+    0.9701810376804344,     0.40539089281124296,     -0.9131798676764139,
+    0.9722463264132091,     0.8451494124356657,      -1.0510040962124318,
+    -0.6878031941924819,    -0.5258074968078036,     -1.149340078072441,
+    1.0646668027850454,     -0.3238427912437991,     -0.2778301838497915,
+    -1.0377557310307788,    -0.39453885605867073,    1.4849516297738241,
+    0.7482882570363897,     -1.6173972079315573,     -0.9897072859524271,
+    0.6356010152932335,     -0.4981221024798703,     -0.5532395591916419,
+    -0.8604921533184503,    -1.3310691289984613,     0.095289372865937,
+    -0.3802719084945578,    1.1403778702663592,      -0.06670794013480881,
+    -0.9651711380260342,    0.6938055010962784,      1.346147316118024,
+    -0.7357369142984359,    -1.7025759043782354,     -0.47896604798920384,
+    -1.3499098134896834,    1.6416177730920019,      -1.387744560587586,
+    -0.3276948581097786,    1.4735216504512167,      0.8712125278212387,
+    -0.5136613406111515,    -0.783064045176607,      -0.18149656923346952,
+    -0.24015520254893147,   1.4963985538770754,      -0.1546653543189482,
+    -1.349969833075344,     0.985772986611277,       1.0365328921808046,
+    -0.2267960282057418,    0.7721250344909129,      0.05124656438664501,
+    -1.2067983307836017,    -0.08107463852694614,    -1.1446779564621028,
+    -0.6341550753296669,    -0.9388977479580628,     0.3328448731734556,
+    0.18648370088106528,    -1.319679357898455,      -0.9198550223813338,
+    -0.0026920482464905175, 0.4643679239664105,      0.0722411574384575,
+    -2.2067945233703887,    1.2869049513116337,      1.7723116893364887,
+    1.5837926864531295,     0.5441039499176215,      0.6719858863417023,
+    -0.6541923388313116,    0.18857866835902992,     -1.130629051300598,
+    0.12176034671322958,    -1.429692919193387,      0.5852017686785785,
+    -0.3545559707975283,    0.7670688477499573,      0.18257375944692528,
+    -0.4595593462194918,    0.8433259737174407,      -1.1734047006751551,
+    -0.2648523985038314,    -0.5375442589546039,     0.7439724211177066,
+    -0.07551526569496889,   0.27001874618560334,     0.5254710258843971,
+    -2.3461154771154575,    -0.9263181527157239,     0.11592996031713133,
+    1.0124758995708458,     0.5725877615354216,      1.3107661680598732,
+    -0.221623872010695,     0.1006804529856824,      -0.49979899960401775,
+    -0.4356722536299252,    -0.8304368517851731,     -0.5432805934319569,
+    -0.1904682215580429,    -0.6515540595996824,     0.02657489683448823,
+    -1.8186341132448633,    0.4279337998879703,      0.1774568412105237,
+    0.44622878505572994,    -0.4634969334998664,     -0.5082197082736116,
+    0.9823609378503485,     -0.15450372868881837,    1.98654938354224,
+    -1.4061176897476757,    -0.24736482573051818,    -1.127373573562985,
+    -0.7867445825106574,    -0.7899916145469906,     -0.4807322777896102,
+    0.7828421108878142,     -1.1438940480509263,     0.6100117416593372,
+    -1.4408877550502122,    -0.4055256717738244,     1.319809368650454,
+    0.4620427891633347,     0.27228033549216907,     0.630105928122933,
+    0.5759750148379863,     0.628005643302478,       1.40366303600116,
+    -1.0384543624201212,    -0.0707392347503584,     0.6372688737983749,
+    0.7496422852980515,     0.5580579106569885,      1.3065365794206547,
+    -0.5009952454598233,    -1.3497201948887083,     1.272386918252629,
+    -0.0008030414838557247, -0.5486864004053322,     0.035759598795011616,
+    -0.43227620895673813,   1.0062079757863194,      0.8901665586471822,
+    0.31173284682148955,    0.5408695884672243,      0.03260762524033265,
+    1.0265089552451092,     -2.3633195893018804,     -1.1681951212278803,
+    -0.039930531266928235,  -0.41347738842926557,    -0.9505155491785762,
+    0.619968559122598,      -0.9783836826097586,     0.21736126979302767,
+    0.12428970989642983,    0.057696966014573324,    -0.8291847976306961,
+    -0.19316558314823537,   1.2269369409446935,      0.5435233447378405,
+    0.9628387139793324,     -0.08008198185377954,    -1.7022831013102921,
+    -0.46646817538216817,   -0.15067794022659223,    1.301508162131204,
+    1.1359538731928351,     0.42484515444013393,     -0.8565276511003889,
+    0.12844721483935073,    -0.26173149286135133,    -0.24350825707543972,
+    -1.233522100628583,     0.4639046527933113,      -0.029842761173669113,
+    0.8043818191113484,     -1.4616263678929025,     -1.1269817427096593,
+    3.6462723591105863,     -0.8800501288066617,     0.2875827811631826,
+    0.4377551156407507,     -0.9821855380220564,     1.727607106829543,
+    -0.06562011500223983,   0.14948004067102627,     1.818386334980022,
+    -0.7910209232827563,    -0.4876409777936645,     -0.34551279853133976,
+    -1.3726464186558747,    0.2758394684840067,      0.47305391760552573,
+    0.18331995909350843,    0.6558303518022676,      0.865654077373947,
+    0.33870280751079174,    -0.2414410867603152,     1.2204166448235072,
+    -0.6966638711552233,    1.3963575430520505,      -0.19295637243760086,
+    0.7648027670148331,     1.826551977023387,       -2.264797629743517,
+    -0.19226037889365327,   -0.4039483615184071,     1.7073865242058321,
+    -0.40682240351132803,   2.7290195018569747,      -1.5279029036062397,
+    0.3495055479493255,     -0.38630186958968893,    0.5050903334063788,
+    -0.565143695869421,     -0.45103189309874464,    -1.8228280374162729,
+    0.10817367141345895,    -1.497922017285047,      -1.3096689509570159,
+    0.08687007729730782,    -0.12134915963300655,    1.0270899332263699,
+    -1.3531296008020126,    0.4210120285829481,      0.322500143639209,
+    -0.30237118185260453,   -0.8036354538106663,     -0.07909241046296576,
+    0.8839859058325767,     -0.3737557427776634,     0.8472950159292573,
+    -0.27380816834534455,   1.724795567821819,       0.026803500773852018,
+    -0.1755423789338502,    -1.6108279532522898,     -1.427151790392062,
+    0.3812902632740631,     -0.22744983567638466,    0.2812766082757891,
+    -0.6846418980253619,    -0.1504381827194402,     -0.6236948005171222,
+    0.2951986124107851,     -0.21816408319046576,    1.864651597657007,
+    -0.6880771570816544,    1.11880976014106,        -1.0544929590114476,
+    -0.4653321773704069,    -0.8415438703090004,     1.259637231862847,
+    0.43698942638709626,    0.13717316709901906,     0.23445496194829551,
+    -1.084368351664796,     1.4029130031627675,      1.3895288823913179,
+    -0.03429977525862107,   0.013260676106867762,    0.6491355508756196,
+    -0.17525429657991645,   -0.20017650608820767,    -0.4928044699425399,
+    -0.34589072903532786,   -0.4760601289338892,     0.7298529681182292,
+    -0.3282967826986917,    -0.42836452002759823,    -0.6268224058773053,
+    -1.4994967085559583,    1.5601817370926783,      0.5085960400447783,
+    0.8665007596057925,     -0.5298975006331764,     1.457200576700915,
+    0.1452028054382397,     1.4526364883699292,      -0.013373475508112846,
+    -0.04466473382085757,   -0.527954524498501,      0.07748692204363035,
+    0.22498409716055148,    1.4926964719344709,      1.539712916648304,
+    0.08994684204626592,    1.2190384290220666,      -2.717651358181704,
+    -0.4702924181212981,    0.2497114029648015,      0.8871216387294311,
+    0.4231009153278338,     -0.05605316905276165,    -0.4614976400807611,
+    -0.7997656981946477,    1.9019604228189215,      1.1222257801376632,
+    1.3077771471889748,     0.010605824024726667,    -0.534469340741795,
+    0.5546941798955465,     -0.02462144895322172,    -0.128077627084407,
+    -0.024856286369587668,  -0.6329512669598814,     -0.8714153945717722,
+    -0.2424045605163555,    -1.385421682528003,      0.5982497666025951,
+    0.83855075480801,       -0.769538984575906,      -1.827429936489406,
+    0.3935795273051473,     0.23843245888763168,     0.020507037263192668,
+    -1.33442809071426,      -1.9177404614444131,     1.7115593639849593,
+    -0.21640796052680086,   0.5043991507993695,      -0.07074978270633413,
+    0.4135401052282568,     -1.278265976698565,      -0.44570942673369196,
+    -1.3553630887139845,    -1.0871529026066995,     -0.709019940363552,
+    -1.8065494916138836,    -0.4611993194121158,     -0.7108888926347918,
+    -1.186214899347432,     -0.13283910319029893,    -0.011340683485682682,
+    -0.8369735161386705,    2.011971489356334,       0.7182074136829244,
+    1.121656573919517,      -0.3283833210304316,     0.8935994230605493,
+    0.7655751393663242,     -1.0185070207997227,     -0.6822099317533046,
+    2.9152223158608535,     -0.41121768135359393,    0.48686120031480806,
+    -0.21460162008759756,   0.8313971814009989,      -0.9945853121559562,
+    -1.0052923963461624,    1.134340610239355,       0.19853242993776873,
+    -2.477620876439257,     0.023414350590219842,    -0.18196770659554123,
+    0.7106682338791255,     0.3210541064788131,      0.3421967162658897,
+    0.08746449151496341,    0.2904687531589333,      -1.1526235457290563,
+    -0.8148997212980255,    -0.8523104333848104,     -1.3411595411169084,
+    0.788253888107948,      1.0775839283249449,      0.613995411968149,
+    -0.6012319089477326,    -0.5371281027862845,     -0.43987459031473214,
+    1.1128982532234954,     0.5266278326595085,      1.7389102567877968,
+    -0.9695776571266128,    -0.2256360343878611,     -1.2606798948133977,
+    -1.4172417810759343,    -0.1552598388632569,     -0.33570598872111135,
+    -0.512816985743646,     -1.5347237821642539,     0.19676979167529196,
+    -0.283869641994323,     0.9148655091683352,      0.5505025211231368,
+    -1.31174170271937,      0.3956918759066964,      -0.5988682318276521,
+    1.5325057064680434,     -0.02958840588968089,    -0.5035134321128524,
+    -0.40654116424555536,   -1.5008971880876139,     1.2744567043516994,
+    2.119354859032629,      -1.7297968892877658,     -0.25179296345517693,
+    -0.11040466733842463,   -0.5942769888879725,     1.2175365846396569,
+    1.247439105076407,      -0.24534357630852416,    2.071282198645538,
+    0.03277080289936971,    -0.24190413912377645,    0.27980361952050375,
+    -0.7460328990089631,    1.4531329512332039,      0.6166362490192825,
+    -0.354945984261932,     -0.18551870544883436,    -0.9077721403129143,
+    0.26250934748061183,    -1.2936379539857008,     0.003169944639415076,
+    -0.5172054145801547,    0.5670558451907819,      1.042568287591463,
+    0.7869380920960765,     -0.12257057645196298,    -0.7096237838522766,
+    -0.2996621201807654,    -0.016632830776802082,   0.487918719669315,
+    -0.5681747304381429,    -0.9672792597618267,     0.17342667395663303,
+    1.3588022074943762,     1.872324602686571,       0.7931997819986738,
+    -0.9902639006250883,    1.4085930707925551,      -0.8456602041156787,
+    -0.7705719432063498,    0.4276107103151994,      -1.3803252772326713,
+    0.8016801858570082,     -0.05362922040087924,    0.39912286959972,
+    -0.8234291504865576,    0.846427358226088,       0.5131236157951996,
+    -0.3633283991924872,    0.9452812793881263,      -2.6602860751466295,
+    0.3623115116648414,     -0.10753766667097661,    -0.7949988756930338,
+    0.17720943273504358,    0.49980077409784035,     -0.7369623833630637,
+    -0.11952650502194903,   -0.04141990912145558,    0.39289158385046086,
+    1.2267746170514917,     -0.46394990244678835,    1.3169178733796865,
+    -1.3042219504056056,    0.30077709717856665,     -1.7196087076014055,
+    0.07177701662830722,    0.7222542762282802,      2.022969253473468,
+    0.04935669838375325,    -0.7483148368816033,     1.0264959693424798,
+    0.04115723682228777,    0.09833786013320965,     0.9170178035099407,
+    1.092750141981459,      -1.732129061205441,      0.05154998891241537,
+    -0.016395711712792128,  -1.069569983022332,      -1.623899703077323,
+    -0.06684619108957385,   -0.46373217043701576,    -0.7246980923449928,
+    -0.13736830258665825,   -0.35102418380112477,    0.017595425266469764,
+    1.576791021638059,      -0.030128998562307465,   1.8803702713941155,
+    1.2440986693492615,     0.9675829707767721,      -0.7285043171366192,
+    -0.29343513784914554,   -0.9197246627937408,     0.41587491263089815,
+    -0.06706117195840944,   0.44169814270282637,     0.3025244765414159,
+    0.16784696765274312,    -0.3569089402096321,     -0.972991604042695,
+    -0.4416852134069257,    0.7166162029289872,      -0.16388247735637274,
+    -0.060024834240342655,  0.8678109997442384,      0.48757632913140797,
+    -1.4748078406694363,    -0.08041295009333033,    -0.8712945951901971,
+    -0.05418315824336455,   0.39027114673859925,     0.5094148386522042,
+    1.663784596276787,      -0.5008168854177154,     -0.2949435637059992,
+    0.5740279926141961,     0.9619860539592223,      -1.0314241710934378,
+    0.6867171468628693,     0.6654789549406667,      -0.15035665456683686,
+    -0.28110187570445544,   0.7326478451249915,      0.4271700552528818,
+    0.4007029926343052,     -0.7317930836771686,     -1.722303247782847,
+    -0.09400320606811419,   -0.2710988833793442,     0.45814820321352767,
+    -0.764512972167171,     0.6346970011436195,      0.4096090798962272,
+    -0.7401292332115676,    0.9450289441779055,      -0.3429164910960217,
+    -0.6964691720754596,    0.2508671269142992,      -0.014712760831985377,
+    -0.9050533851783099,    0.620139245438828,       -0.009154711877947863,
+    -0.7582132835490957,    -1.7539658490188335,     0.4264173789597557,
+    0.09902380238715182,    0.11938279134079255,     1.376824475897778,
+    -2.490614832223641,     1.2692073153447934,      1.3637989611753547,
+    -0.9800758966533455,    1.0146747268851577,      -0.811960110052185,
+    -1.0425058091183637,    -0.10139554713329421,    1.8276512775213283,
+    0.36166741716219963,    0.049851407405626005,    0.8856782882003063,
+    -0.6224977003701693,    1.4975145658781384,      1.570620595630201,
+    0.4292103788753758,     -0.7882673939716752,     1.0720154753847566,
+    0.29469203327758237,    0.6436642845364944,      1.1365670086877253,
+    0.43643476808828435,    -0.9025375331001769,     1.4903212544653002,
+    0.27927288336798406,    0.32415745772594284,     0.6150950323864863,
+    0.31173299002213195,    0.7479483282893075,      0.19745867587461846,
+    -0.17758946211056764,   -0.5501830842433428,     -0.511325336637067,
+    -0.28816770123170904,   0.9894389971659792,      -0.3368930074341903,
+    -0.11107709022961969,   -0.10106213935840815,    0.5338676461567843,
+    0.6489810333627515,     1.9744457032773453,      -1.3930633331594,
+    -0.22794963621828385,   0.5730227298492143,      -1.6851219710847858,
+    1.7413404722394699,     -0.11610839828171284,    -0.7939979349424935,
+    0.9707546485937223,     -2.1980076082042093,     0.21223976403409497,
+    -0.991498891475379,     -0.01491055849360696,    0.3740578220635879,
+    0.7925321169656073,     0.41132777248914776,     2.086389201568732,
+    0.061977159629830594,   -0.34192762474990074,    1.2261183755300331,
+    -0.06530372651108185,   0.41821438071088257,     -3.9372745929484667,
+    0.4532431593823444,     -0.07476776989435119,    -0.4349007930065365,
+    -0.6563461639510355,    0.9031513713838886,      -2.041668271032885,
+    3.1491642630593284,     1.1541207416445949,      0.36980249547513916,
+    1.900374138065587,      0.27465552733290877,     -0.8949684760421813,
+    1.0270806701892,        -1.636037287846117,      0.600065431845032,
+    1.1981009652707955,     0.5349658627619147,      -1.4512051846420955,
+    0.20511816799995095,    -0.12308765966528928,    -0.7422110777829337,
+    -2.311978744242185,     -1.1854991346102983,     -0.5007338495333347,
+    1.125553478594442,      2.753154910386689,       0.8567895485492398,
+    -0.7882589329114236,    -0.4210375202050225,     1.0821869973678317,
+    0.6137905827502084,     0.3909171263749945,      0.23809232553354434,
+    1.1992920077190243,     2.2359448580140033,      0.009602401223141729,
+    0.15877977675500227,    0.504419295957635,       -0.46215720670176097,
+    -2.192628016071932,     0.4937306698021995,      -0.7335790801359362,
+    1.31660311310601,       0.18242778013310376,     1.4974242235626711,
+    -0.8575588837952521,    1.1311908103964154,      -1.63163102797135,
+    0.9376658315988395,     -0.2372459046795907,     0.937431622571106,
+    -0.35811362129496604,   0.6824649303212347,      0.5026342333516453,
+    0.38315502696855025,    0.4426789850524319,      1.680435895492572,
+    -0.5612984855728218,    1.40341216312086,        -0.3541183841038174,
+    1.206949398020405,      2.339720148480521,       -0.7983218437998242,
+    -2.1560328090043934,    0.16372576723074264,     -0.691689535119821,
+    -0.5264807044674746,    -0.32926352845682194,    -0.5337884972152811,
+    1.4310037397396016,     1.125391924310959,       1.159102568442908,
+    2.31213507848428,       -0.7707714920749512,     -2.4967814566751074,
+    2.0235489125550825,     0.2504729178727587,      -0.05568346589416148,
+    -1.802914764115009,     -1.3516955813766447,     0.6919029953839423,
+    -0.1431425718356058,    -2.152870376856211,      -0.9404804131972656,
+    1.049131649273991,      1.2786715113534515,      0.21415714680240683,
+    2.8339969772372413,     1.0267248540137002,      1.8102651102140084,
+    1.3332936479899247,     0.8312383078578685,      -1.3392017148152446,
+    -1.6003595209168955,    -0.7413496518504449,     0.25835712948528516,
+    0.0010809661253421395,  0.3747044468043356,      -0.01999789812703508,
+    0.47776140444601206,    0.9875487946895086,      0.007949692567590873,
+    -0.28798501486449196,   -2.6212937558917324,     0.8722167729005428,
+    -0.7733368759254712,    -0.9091426503738707,     0.8676873805849975,
+    0.918442159332738,      0.6799657912946181,      0.9530074213268969,
+    -1.0940608541768828,    -0.22919750078721615,    -0.550009391307525,
+    1.7298458587664156,     0.8638034563891801,      -0.24394154238483173,
+    0.8414554303793187,     0.3747045701561642,      -0.11743702060351117,
+    0.46688119551192303,    0.8505850773503782,      -0.14215180266527364,
+    -1.2504892701295836,    0.35458260889555515,     -0.2640599994170941,
+    -1.1453511995901673,    -0.7682229469201971,     -0.24945817089277006,
+    0.027164839087782538,   0.5616883530966866,      -0.21247725322076708,
+    0.4499070629879152,     -0.37337180042570683,    0.5456598135228957,
+    0.4030719828054548,     0.5691707628721746,      1.4371459168191554,
+    -0.2828356133845074,    -1.5932602155476132,     -0.07787261023389878,
+    0.8094314246691454,     0.02493910392882621,     0.3181152130160935,
+    -1.7226579397406612,    -0.8341430855210485,     0.5387172191133197,
+    0.7777853308518885,     -0.7504266633918389,     0.3670109323956058,
+    -0.7110065905557449,    -1.152444802337539,      0.07100870472410953,
+    0.2170324002540959,     0.39638887944737794,     0.7300450095267309,
+    1.6771148004404894,     0.948749752790069,       -0.3608486842646083,
+    0.9396888158007097,     -1.4675175308214006,     0.10069242813114829,
+    1.0534784441368312,     0.6791619415204976,      0.8282408220613525,
+    1.9100393763367407,     -0.7407424013052213,     0.7947771682135177,
+    -0.09333763342344513,   1.114666685882962,       0.11761946703880416,
+    0.7820813778012025,     1.5467695081197574,      0.6309154946034399,
+    -0.20981583985195656,   -0.36767699878370436,    -0.6940362973301469,
+    1.0381142357989852,     1.3123159579313566,      -0.2443134918817095,
+    -1.809367909812941,     -0.6335141520043049,     0.43398823010776294,
+    -0.9467825187328601,    -1.9584953295583045,     -0.44442682350523266,
+    -2.040188876682598,     0.32544219758935583,     -0.4010744822297138,
+    0.0602672029971595,     1.2966566562252024,      -0.9079357640620496,
+    -2.147903107808777,     -0.02836240500828142,    0.46896294348040163,
+    -1.42954342343787,      -0.3684583629245182,     -0.34719721323299035,
+    0.02781979150536265,    -0.6154953767706433,     2.6634629951046156,
+    -0.2624466550503729,    0.18652406488799775,     -0.4847517419688619,
+    -2.643106307467044,     1.3809037523000707,      -3.1567997145516626,
+    1.35681852859784,       -1.321427266292238,      -1.3589216387267555,
+    -0.10889934553391577,   2.1959030012287024,      0.31960281738771895,
+    -0.19125851191034623,   -0.7677326066894203,     0.6507231233344869,
+    -0.37009007730262605,   0.7138038497734573,      -1.9634769118783888,
+    0.5284419417404559,     0.31799160785837577,     -1.3602238262437496,
+    -1.0326347492647752,    -0.14737619898910834,    -0.4865092436522922,
+    0.29002619087255,       -1.434678574106994,      -0.8845642073878917,
+    2.1140059231319484,     -0.842376787144116,      -0.42610715425421547,
+    -0.17707603010442233,   -0.2784888638894993,     1.2068994188356792,
+    -0.5721719599394268,    0.8549292871295895,      -0.8554523543752003,
+    0.7730784917563212,     -0.21407796705188714,    -0.17476188630450026,
+    -0.08861898098205116,   0.5502474752349771,      -1.193462636449229,
+    -0.9704506594628253,    2.037225902523249,       0.5064916856952604,
+    -0.3608816214003283,    0.6420887720513995,      -0.060137326136421226,
+    -2.251405131070228,     0.16132999360306263,     -0.12187447281888246,
+    0.34913454379648723,    -0.774727370521462,      -0.22045130754377998,
+    1.1421253369908302,     -0.15084454359530172,    -0.42896330605823857,
+    0.36505345402582906,    -0.3941665427698562,     1.0678600932764142,
+    -0.17450534111294544,   0.36337092481751687,     -0.7041268341144429,
+    -1.2477976842975838,    0.7193080434028587,      0.26199345758510206,
+    0.6374381973303607,     0.7366814854291448,      -1.4692612449267708,
+    0.11978541784311755,    -2.005818396136074,      0.519360398201295,
+    -1.0856288674899002,    0.46730654061812194,     0.7259545129938977,
+    -0.5394658651406258,    -0.02304702649382177,    1.2223161674156855,
+    -1.653897699574569,     0.643633457585459,       0.11837662945795459,
+    0.9481453545022077,     -1.6518911584141045,     0.0035365131491128508,
+    1.1041964270109381,     1.3591642972140703,      -0.7692542295051094,
+    -0.27953618648633116,   1.8414123983672555,      -1.4198132856176007,
+    -0.0457479563526698,    0.17742498342514695,     0.17492955402534782,
+    -0.9342462417020185,    0.9644702982601213,      0.8885333066710396,
+    1.8161388773651226,     -0.7929678754832142,     -0.4816940448830427,
+    1.0965935358701675,     1.8153286494868248,      -0.009974156763514281,
+    -1.528026278505794,     -0.21608072219938515,    0.9647140758588989,
+    0.6781015313735573,     1.1129459718504733,      1.9249263357439317,
+    -0.4313184129440522,    -0.9044386926865237,     -1.2027078331039693,
+    -0.12278223101485262,   1.019078105362384,       1.727181856018015,
+    0.21877109646985998,    0.014732174050744087,    -0.1328855980196604,
+    1.2263875435019738,     -0.7620067379682912,     -0.10492876080106253,
+    -0.07739154245782204,   -0.027160725013466794,   1.8082177858996729,
+    -0.8919718352147691,    2.455272621400682,       -0.6553037364580185,
+    -0.8204885928470205,    -0.6608698660011176,     0.6487288310421995,
+    -0.014081326327965141,  1.1212210293529394,      -0.82366503070868,
+    -1.673216563922596,     -0.37093433514612256,    0.2797737800889335,
+    -1.4697545114408195,    -0.10651206126632945,    0.5355813751932504,
+    -0.8066576774966107,    -0.8239805764596353,     -1.0951747594524912,
+    -0.14345317188879597,   0.45632649224427824,     2.74755565068576,
+    1.1652122447798114,     -1.2617060544388512,     -1.5367974643971205,
+    -0.11027937733269622,   1.5719875037293523,      0.6571375941923049,
+    -0.5273225609356268,    1.0016399388202555,      1.3773519486451749,
+    1.4617404182738218,     -1.0664144097955608,     0.43741955628833157,
+    -1.2811760644751804,    -0.8054628029972019,     -1.2786036390549356,
+    -0.26195256822609736,   -1.4360104709389976,     0.7749247005642236,
+    -0.012323981581817474,  -0.8644620422446895,     0.485437953782753,
+    1.5307463375645818,     0.3453852685538099,      -0.5836602384782551,
+    -0.28385439780768124,   -0.1041196622170162,     -0.7015343784541574,
+    -1.7117290013788435,    -0.37849825836252277,    1.2427208700304149,
+    -0.8272402101543453,    -1.9303354716712686,     -0.08878188587790463,
+    1.1028071881439185,     -1.7224285440314884,     0.1900369620517662,
+    0.41144567066308446,    0.5368563710028604,      0.5570952255785192,
+    0.6081381838275555,     -1.583940719643806,      0.6160586071597323,
+    1.3775135115211978,     -0.22165393650631907,    0.3714197495861215,
+    -1.0144160269766584,    1.3029798690065921,      -0.6183808029464856,
+    1.6494837224499648,     -0.37994250608081526,    0.6777653694968907,
+    -0.5334184261492718,    1.8777528522227958,      -1.9721345401044175,
+    0.36931847753595676,    -2.0794469459231593,     -1.2047763259792028,
+    1.8919934715405313,     0.9080211524509249,      -2.010540974246311,
+    -0.006030499821496372,  -0.6196689206822431,     0.5697964366307742,
+    1.8504072925141744,     0.653894022312109,       0.4346525683709604,
+    0.5080412009924169,     -1.0925099398822262,     0.7011348546655312,
+    0.9210958788171844,     -0.6123562151173819,     -0.6424836977929856,
+    1.4499804568915609,     0.2091231701259613,      -1.1373179661576496,
+    -0.42408508185318294,   -0.4575182945069182,     -0.06451367271947332,
+    -0.07271365784487632,   -0.24927638948530137,    1.6739363208118128,
+    0.8322807776421753,     1.4829899935884496,      -1.694652476973414,
+    0.11114014849078561,    1.1747767732583583,      0.7254120145624685,
+    -0.679347844232499,     -0.7559639307548784,     0.9600188215540831,
+    -0.21251425432007376,   0.6483017489562967,      0.15661452306113938,
+    -0.11763897623177069,   0.1204796811963724,      -0.8296021411243787,
+    1.7011830057099797,     0.548179876736301,       1.3993376460635458,
+    -0.5291969164119259,    -0.5405357428386488,     -0.31924380263444796,
+    -0.8615909953626328,    0.6781532742677586,      0.7125067068177863,
+    -0.5131339606667499,    -0.31966432622335983,    0.3766022374695034,
+    -0.752589402297283,     -0.4093281656782779,     1.5604875246677288,
+    -0.7465763080467568,    -0.5168223019064929,     2.5047301331045295,
+    -2.126371995695057,     -1.1843745762782687,     1.797302378731623,
+    -0.4095479481588541,    0.49982994681782444,     2.1196571417648,
+    -0.7170369042082716,    -0.5915064877377698,     0.4107863995127024,
+    -0.0758229727864078,    -0.5249274558529544,     -0.13332373199479805,
+    -1.3281277104319433,    0.46572374205176453,     0.834494273969907,
+    -0.16145128235233253,   -0.22381273999975942,    0.5487833437109312,
+    -0.5382366333556717,    -0.3081306344779737,     -0.06833369112227931,
+    1.472011586594601,      -0.04922043333441095,    -0.11372768301674817,
+    -0.16414777201844993,   -0.38379450495170137,    -0.9649187430136589,
+    -0.9191133044450214,    0.8603511847100213,      -0.5691050138505575,
+    0.09235143758846519,    -0.47626937845098427,    -1.3279140236060163,
+    -0.46475207795866114,   1.396939691015902,       -0.41458170058650856,
+    -0.6763733437904639,    -0.42787745111422565,    -0.33463571621299515,
+    0.2285094263697557,     -0.41164902923638175,    -0.09759741730442287,
+    -0.4909168921566732,    0.35750098597904,        0.3112588812186786,
+    0.21168425743480482,    0.6331275079038285,      -0.09924944713686785,
+    1.2129467538699892,     0.46619238222929277,     1.4878354031338807,
+    -0.07971139539727902,   0.272125626223688,       -0.6821810174080184,
+    0.015627414580563683,   0.8180278174359783,      -0.36549729770880623,
+    1.492175758121735,      0.025672962692859534,    1.5831764531487669,
+    -1.048803143799867,     -0.2768620126538758,     -0.49636008988925684,
+    1.0106316239948958,     0.6421029799468787,      -0.07641423501352233,
+    -0.45579785447728327,   -0.026837296607139842,   0.7245862901370012,
+    0.8357407678535691,     -0.05961730695308698,    -0.44707796199944105,
+    0.10206732619572532,    0.129271592874518,       0.2525389651693497,
+    -0.45349476024282315,   1.7404721726262156,      -0.6287931135223388,
+    1.5124710442741982,     1.3936636292439448,      0.9471132433017249,
+    1.874063479875216,      0.5558370761159371,      -0.3166859919961749,
+    -0.5230716211077664,    -0.6710768037897918,     0.8373452603514405,
+    -1.4806025629133077,    -1.4223555979587112,     1.5324765469753387,
+    1.0128812955963147,     0.4143308905434556,      0.9233496388911722,
+    0.7742930512772597,     -0.18686958815362442,    -1.4686370158236446,
+    1.2830899284853374,     0.4461955659157436,      -1.3762169463620204,
+    0.14229627265673728,    -0.4687215495734493,     -0.11536063207555654,
+    -0.32797072187167814,   0.5512086099290069,      -0.20841504417478704,
+    -1.15495361435408,      0.673009476057394,       0.48580061260448343,
+    -1.4257799842843486,    0.4091299354990213,      0.8876263408465551,
+    -0.15249854600906665,   0.18767880217331948,     -0.7643298389552741,
+    -1.7500719822018675,    0.521830694083875,       -0.08788591333173883,
+    0.4296026504108136,     -0.23477902397946507,    -0.26035643862238556,
+    0.16229517153971734,    -0.06332116258533428,    0.8662791524984179,
+    -0.42388936164345803,   -1.4443973969562847,     0.14411300568369675,
+    -1.3032032817404988,    -2.5339746109444654,     -1.0967798415387184,
+    -0.438588503669468,     -0.7959447594743115,     -1.536669032591709,
+    -0.22464534988574142,   1.2164658574705836,      0.8294176477030218,
+    0.008235958145634596,   0.9211200124459832,      -0.44039333671903036,
+    -0.8819968975924777,    0.6784598928382939,      -1.0835779651805897,
+    0.3340113933550268,     -0.025671544129249647,   -0.3627473602318144,
+    -0.4580597086552385,    1.1372189175712981,      -1.5893642454708337,
+    0.2689974063302714,     -0.28856911118723605,    -0.7414211692725878,
+    0.03894361629338873,    0.3158033123766863,      -0.05994446897820392,
+    0.24503778951177846,    1.4148406061093084,      -0.6008967863441754,
+    0.4179496888976785,     -1.738597584714335,      0.45695413307425936,
+    -1.8669404188323744,    0.6313619321795754,      -0.47517477962558596,
+    0.164130608050496,      -1.4554844273104695,     0.02402311890492607,
+    0.8240130209951826,     0.619847608474694,       -0.017250079253558846,
+    -0.00647259832074705,   1.1454375998352104,      0.7359903197100693,
+    -0.6247620235940049,    -0.579829854456699,      -0.6798662566185744,
+    -0.03564915788753483,   -1.1606685651242366,     -2.158371820574295,
+    -0.21830723570232366,   0.25288199157949504,     0.18642526296284181,
+    1.0849902561320768,     -1.2925036060036283,     -0.513155963312859,
+    -1.4424259508004578,    0.2458297020685367,      -0.10458292495592605,
+    -0.48082408105476865,   0.04144199730122672,     -0.7068875919643376,
+    -1.0220288547792789,    1.5805078673686117,      0.8103454298106161,
+    -0.1841635837528684,    -1.5414429532776193,     -0.2142941049409418,
+    0.5742511706942518,     0.16988423225674995,     1.0091431287075248,
+    1.2268782723372451,     -0.08454828726930437,    -0.4680841498568326,
+    -0.4943932194075188,    -0.4134741939849761,     0.9045496358953858,
+    -0.42414844863306683,   -1.680778526867122,      0.46496627239639104,
+    -0.09893215203023165,   -0.4671889989677235,     -1.9635077905685554,
+    1.1700525102330113,     0.6963505808669911,      -1.136882151183256,
+    0.15177359326020887,    -1.0837317556298667,     -1.3606030294382685,
+    -2.098704465475091,     0.7793342157674334,      0.8799162400053264,
+    -0.30983996980849293,   -0.05984057414779742,    1.7549348178922355,
+    -0.7553956427671997,    -1.1847528511101797,     0.12754416118536918,
+    0.5494994004588707,     -0.29688479017516534,    -1.4260853434123049,
+    -0.7672123271650815,    0.6850057269036804,      0.7147527812107975,
+    -1.6706897366880646,    -1.222606365129559,      -0.9851505838387216,
+    -0.02544681786311449,   2.2068182937388507,      -0.2858216528469563,
+    0.06210504287753598,    -0.7971452335291748,     2.5853149206365784,
+    -0.6019225571921712,    -0.5117483296685542,     0.15621836365290645,
+    -1.3243643331087183,    0.8087644630893838,      -0.008329966251811581,
+    -0.8427203445479392,    -0.5958081935727496,     -1.8940358337058851,
+    -0.5555548437408795,    -2.2746238053764434,     -0.4504637213600171,
+    -0.4955738897494539,    -0.5889803802701736,     -0.5828514199280939,
+    -0.8419790361351315,    1.2340318801276897,      1.4392314761364178,
+    -0.16956035102028588,   1.1436727341242692,      -0.3064991788044607,
+    -0.30243260760374896,   -0.8287797551950773,     0.6974673309406298,
+    0.6180635731505781,     -1.29047188977619,       0.159978100377155,
+    -0.5170244092072149,    -0.9019213838860642,     -0.025697109886180118,
+    -1.9188394155036888,    -0.4339397052005301,     1.8895160123114296,
+    0.43567332808138287,    -1.1355767320625723,     0.5533708418242482,
+    0.08861554772751325,    -0.32081114656212056,    -0.5857673334261941,
+    0.0006886661821822572,  -0.5923973922670087,     -0.17319805423994253,
+    0.7395019665948146,     0.8157143067264816,      -1.296463483434427,
+    -0.4683899324898591,    1.6069100296472492,      1.7965441777894895,
+    0.36976770660302233,    1.609574085417946,       1.2081862491481128,
+    -0.1319885934504899,    -1.9962948235609281,     -0.061170991708729285,
+    -1.2821867291105606,    0.13637470533209314,     1.7461964093047098,
+    0.24870488232202564,    -0.7851661344564748,     -1.169333857341222,
+    -1.9629530857284998,    -1.906023810085262,      1.6267665840627947,
+    0.8559578500221732,     -0.13103836255095874,    -0.15296789225128504,
+    -0.051969836466323666,  -0.011731029921388176,   1.3921167031633643,
+    0.39012349753698694,    -1.9824386357114223,     1.060664365021477,
+    -1.9298157216848861,    -0.40619361881257177,    -1.3860618031911651,
+    0.04035879611773523,    -1.2571392207123036,     -1.3777889180178122,
+    -1.046530842979556,     0.8138118808143006,      -0.18572514693691386,
+    0.667189291574244,      1.360299327924181,       0.2383439174223783,
+    0.5701027983438592,     -0.9694861609381911,     -0.08456103316221873,
+    -1.1488442532096645,    0.5538200281084924,      0.9062202564187337,
+    0.965835314665828,      -0.028231735939146834,   0.8954545072989913,
+    -0.14533170030523887,   -0.5614767725687608,     0.5020551631398291,
+    0.7259586452035081,     2.2036619446684487,      0.7291311102093274,
+    -1.100936537647294,     -0.9781144990724038,     -1.3017079198759678,
+    0.07737357420260266,    -1.0996848263470809,     1.3623282412713797,
+    -0.2915076847194388,    0.6417543099803461,      0.15169401199408278,
+    0.3438205640147206,     -1.0365093602620574,     -0.033488590853363566,
+    -0.42736780090926196,   -0.10128495376261085,    0.12468888980519757,
+    0.6814734627946344,     -0.4655572292083547,     0.8236051414158116,
+    0.3292336957671092,     1.6387657126010564,      -3.3125957472915193,
+    -0.642679611190922,     1.2585766212049312,      -2.5212472442065854,
+    1.4846360078381304,     0.08220688169659991,     -2.0422296484971234,
+    0.7255907657684028,     -1.0525735710876505,     -0.9128100132501272,
+    1.4646461330920473,     -0.3868981580320537,     -0.9593544408447006,
+    2.0079611204929293,     0.9290749642925953,      -0.33456887481216974,
+    -0.7894822997939344,    -0.20395986994108417,    1.5772921846886596,
+    -0.9825063042945066,    -1.2738781924253824,     1.274550031697449,
+    -0.28212216187025774,   0.10045650249750124,     0.5248785230643929,
+    -0.39007392404570945,   -2.424081486413366,      -0.21216883799585629,
+    1.2410461470317984,     2.1724479654200124,      -0.11786940799982205,
+    -0.02867013526906138,   1.3654656748552527,      0.5957019719428258,
+    0.29541651604397196,    -1.9791316661875356,     -0.41635037215618775,
+    0.21475272736774925,    -1.514042357941066,      -0.36604812191678526,
+    1.7085146137502967,     -0.2571499678369111,     -1.4343606843082715,
+    -1.8871014115344522,    -0.011287561937809798,   -0.5777233924075198,
+    -0.8685169077615835,    0.22750956916178425,     0.28480515520512145,
+    0.17458026754262473,    0.3504901803518562,      -1.2289949076875741,
+    -0.6405019031805433,    -0.32616090566015704,    -0.05382316522092632,
+    0.9895734487758668,     -0.7281924330126566,     -0.7775706003748463,
+    1.4873841930289455,     0.1584500635086561,      -1.3980410419753422,
+    -0.310971939724135,     -1.2361892678092892,     -1.1369640494309825,
+    -1.334262463014373,     -0.7959762300838742,     2.059716954775251,
+    1.010480687434103,      1.3816706144928017,      1.087611029579423,
+    -0.13488092512250469,   0.403438191199377,       0.10281990531468883,
+    -1.0680743252156402,    -1.1624316262974201,     0.9003501977073616,
+    -1.2183943022256247,    0.2009269569054152,      0.6521022919661779,
+    0.7527364796777338,     0.3692648962503571,      -1.2007273512002243,
+    0.5403972642139142,     -0.13826460026872545,    -0.9775512280816644,
+    -1.9887538090141748,    0.4512076990700644,      -1.5524436748283856,
+    -1.707328302563486,     1.7479165859844292,      -1.20137172331777,
+    -0.4199779329481971,    0.07179382705895353,     0.07021900726212328,
+    -1.0193077831084225,    -0.7083254888588681,     0.8056534796188886,
+    -0.27878444148672443,   -0.023146919692301732,   -2.162602633982621,
+    -0.5736970133315598,    0.857412278841173,       -0.729202694811036,
+    -0.9515301368914773,    0.37490347520154604,     0.5986581314532009,
+    0.33374024806043634,    -0.5663657395974352,     0.7496254220416524,
+    1.6289692978603219,     1.1699653909980003,      -1.5633329910245188,
+    2.9294949683414666,     -1.3256024235928083,     -1.2259156541526515,
+    0.3043946992060357,     -0.09436019940510461,    0.3613503497492989,
+    1.3116421091286004,     0.9305124642046985,      -0.8934781182111482,
+    0.07206729101725728,    1.0112082017425184,      1.0529119122514135,
+    1.124453891104806,      0.8174500476465054,      0.7079021166319962,
+    -0.5135155148527494,    -1.3181777326083213,     0.4223946077568961,
+    -0.4540284443389545,    1.2445141063552017,      -0.8725598870302891,
+    -0.3811888791615553,    -0.42809893143447153,    0.9669741307656176,
+    0.7514450445015763,     0.022820593341801584,    0.29201843003524386,
+    1.6147629263523806,     -1.7626628404610827,     0.7480366611945588,
+    1.0799757318110055,     1.2142742248358371,      0.8025006830940107,
+    -0.7739136870061023,    -0.539040170646118,      0.6621787597881278,
+    -0.5892980379829562,    -0.198341968473613,      -1.5052493657311397,
+    -1.1924454879421558,    0.3466583626995494,      -0.42600192461859676,
+    -0.7587492143269661,    -0.18780648827418012,    0.3013909202296766,
+    -0.26124891916591364,   0.172578451656906,       0.08848009776143743,
+    -0.2515023180785273,    -0.01135112159165719,    -0.8872669971413588,
+    -0.5015945230034489,    -1.8370719108707187,     -1.1664293093777658,
+    -1.1870512391330497,    -0.39888359358155834,    1.1303230476566384,
+    -0.009032730430251398,  0.15046595058321519,     -0.9424439420152598,
+    0.2871115650217511,     1.695776285535388,       -0.08724108006679325,
+    -0.8247339752431493,    -1.165874713678587,      0.26290348151063603,
+    -0.941307831089716,     0.7133875872310563,      -1.0123170274546165,
+    -1.6561173933233344,    0.4799527084489307,      -1.2937030696500185,
+    0.6061345880109306,     1.0374279356896314,      -0.5928129331102888,
+    0.20830475859708086,    1.3921580774044597,      -0.4648301290298568,
+    1.5984539368254864,     -0.3285573723715871,     -0.9377094081391769,
+    0.09754418185088443,    0.22512696298410884,     1.134364045966532,
+    0.886414597207252,      0.36952377767517425,     0.6561837645872346,
+    0.1808791419483338,     0.7921058099819703,      -0.5187069821388236,
+    -1.081265418462433,     0.20855706694650492,     2.6891567255954367,
+    0.8076802664218423,     -0.7000159404771632,     1.393911062628084,
+    -1.8644876781071298,    -0.2518979437594075,     0.39742234005375116,
+    -0.6732370756294072,    -0.5941866236094229,     -0.16999899921783154,
+    -0.5425016793958625,    -0.7841475883796026,     -1.0842211549608542,
+    -1.560057006382489,     -0.9664115673200809,     -0.10155080937546203,
+    1.0063712137696832,     -0.6633962653832323,     -1.2116934213498078,
+    1.605446695916347,      -1.1432573969068665,     0.09459228216510641,
+    -0.9363788807043509,    -0.7189230987899983,     0.3865650485993175,
+    0.46115742410503735,    1.27101182012592,        0.6687615544105718,
+    0.15403212556710655,    0.6245721870133841,      -1.030242417928788,
+    1.210519619951666,      0.5326658716861924,      0.4897921650738416,
+    0.5985077639597968,     -1.4797117209533097,     -1.1339312639885144,
+    0.13228357906416394,    0.1449368176982603,      0.575038765586739,
+    0.10657727663750632,    -0.18451247526568362,    1.2577850231333834,
+    0.34957031901753494,    0.7466601650963447,      1.1952073026365186,
+    1.2639606373823074,     0.31768927843313227,     0.725778161938027,
+    0.26600396285299693,    1.0725233192737318,      2.280624197831893,
+    -1.0448944450547253,    -0.7527344813629196,     1.5836842945513663,
+    0.1861301776552701,     -0.4299030807300232,     -0.6941258928884679,
+    0.9374295282696908,     0.5603615887413218,      2.007747028142317,
+    -0.09119596057864222,   0.9015786447267636,      1.653889827394813,
+    -1.43391633196515,      -1.053390905470065,      0.2714232325469167,
+    -0.5725662288212182,    -0.4214828526616138,     -0.6609220588458988,
+    -0.14792234526379885,   -0.9040249248536079,     -1.279743734790053,
+    0.3851773614615998,     0.12482385276635362,     0.9788705992907167,
+    0.5219489986938624,     0.4239532442026558,      0.7528909524248748,
+    -0.9148574456341003,    -0.49845324459957757,    0.2748636075835232,
+    0.9348768566453561,     0.6465548874758841,      -0.21197769676261435,
+    -0.1862881973862686,    0.24986205966479497,     -1.1563843120293331,
+    0.848561437151079,      0.7722914143210239,      0.9290418140261983,
+    0.9934344080008723,     0.9978870193450139,      -1.8840571412882436,
+    0.22527497826562073,    -1.4298636855420406,     -0.9526972023845158,
+    -0.13280652701173848,   1.1830476029110701,      0.3311539214535722,
+    0.23143491541344122,    1.7856228494340456,      0.24102248365210305,
+    -0.9497222985691244,    -1.3938765205529655,     -0.8729305783206557,
+    0.11189786283754871,    -1.5406475046921209,     0.43824105475878034,
+    0.3088941130328234,     -0.7200167574986956,     0.10413001221469308,
+    0.5164843788888039,     -0.6319388778257431,     0.7328036915543703,
+    -0.7167161538537666,    0.5875171560298043,      1.4576387799469404,
+    0.32205016351886856,    -1.273468767822946,      0.08871208474442308,
+    0.08105723209561866,    -0.8612118000996496,     -1.2594934296509144,
+    -0.381626452225253,     0.8683554324554691,      0.817885987366341,
+    1.1998885103892343,     -0.044850314255937634,   1.96461530315232,
+    -0.8461520942675396,    0.4408138688666812,      -0.24160270313967927,
+    1.491404017758251,      0.032252162134317135,    -1.0320844142539014,
+    0.24184317583991238,    -1.121997673466952,      -0.8722478491979083,
+    0.9263624151579788,     -0.020311835047454565,   0.8555916354174716,
+    -0.8736486871543374,    1.2967859905769892,      -0.17532149721700788,
+    -1.9573682811842892,    -0.8957104086173412,     -1.397455240066104,
+    -1.4638153685209871,    0.510494907609462,       0.365658251284937,
+    0.5908105540703554,     -0.7372845612280085,     0.5317087153928419,
+    -1.4680741632277372,    -0.4828893968459641,     -0.15875902842433887,
+    -0.5703159494047967,    0.10046007980163459,     -0.02274047566330555,
+    0.47111739739782504,    0.3035200759728224,      0.9552814687328702,
+    -0.4802425524028714,    0.6515158503085438,      0.27747804021232964,
+    0.24308932936671582,    0.13371853662724661,     -2.1564791835071166,
+    1.9174833858302434,     -0.915316484483997,      -0.7964472622083916,
+    -0.3222985721877867,    -1.3100029276245437,     1.7458840481961508,
+    -0.6197006182438103,    -0.6838153166286255,     -0.8296780782032334,
+    0.43703919592522805,    1.3958407618742477,      0.27275027382246286,
+    -0.77419000353817,      1.3227806992449869,      0.283564312656144,
+    -0.7224181907629346,    -0.07201660361396557,    0.13133848778812976,
+    0.237075951205877,      0.0016169010932160824,   0.02391676987028547,
+    1.8628067553674579,     2.8337084584814525,      0.17301458161797997,
+    -0.917212404055666,     -1.0502305789490147,     0.813130770785458,
+    -1.6240637597082928,    -0.18180551015583393,    0.39494439215756916,
+    0.1816723464263562,     -0.4046574259757708,     1.8377706423295326,
+    0.7962541592272341,     -0.470842799571361,      0.7832585853049281,
+    -0.1839487726311758,    -0.5162588650166396,     -0.40758249553373227,
+    1.1825206659026775,     -0.5590511483772289,     -0.07130526118485103,
+    1.0200448138176716,     0.30411034895510863,     0.2404079743196821,
+    -0.6653093837899265,    2.330852597542875,       0.8182958964744049,
+    -2.3685499808754398,    1.3041841798030738,      -1.2860690114616444,
+    -1.3720355020090929,    -0.6979350436264475,     1.2578569011127516,
+    -0.2724187495752431,    0.21062129577401384,     -1.6700076315990524,
+    1.075498317321793,      -0.2672360623300756,     -1.289289607711727,
+    0.3248195579579196,     0.4898720738623198,      0.08502289638377544,
+    1.291422787153203,      0.5836298729087983,      1.5022201805642375,
+    -0.054787455741442705,  0.10955656397318725,     0.8641786809602411,
+    1.1586490941047456,     -0.333103061335895,      1.8858379487306038,
+    0.11535432068166136,    0.004837358754509711,    0.44184052777626065,
+    -0.8557143294873891,    -1.6460032278876175,     2.0557647091169384,
+    1.0642590504533467,     -0.9239512426058418,     0.13709702434434398,
+    0.6235260960792973,     -0.48796126475046675,    1.433122938367365,
+    -0.4945126830914104,    0.9923981627337422,      -0.6304297019654619,
+    0.5071727391778746,     1.5498605005735553,      0.4744282405673355,
+    -0.4880816866059326,    0.22166656001108476,     0.7248558958840421,
+    -0.42805287594151126,   -0.39492505992504506,    1.7620082971004747,
+    1.396958419813615,      -0.6632619985501733,     -1.3183120225140688,
+    -1.2834217646123125,    -1.1147852672992768,     -0.283956443630757,
+    -0.07571750599015233,   -1.3837570433040536,     0.15459822772213677,
+    -2.9032093721075425,    0.13983022760035538,     1.6078242214039977,
+    -1.2151094879578561,    -2.8796785415210566,     0.16654919725316253,
+    0.7006742734355291,     -0.4084170094478251,     0.22873349870284176,
+    1.2910711712931706,     1.689368350917812,       0.5980157780075127,
+    -1.2360006120896183,    0.1694159081918005,      -1.0002872120191049,
+    -0.01555793757899074,   -0.2413931241097132,     -0.5709546679504626,
+    1.5311575378849764,     -0.2276695628191544,     -1.48095418636695,
+    0.37954433638018936,    0.6861081050479167,      0.05104916037169898,
+    -0.7748612136337377,    -0.43239812418894336,    -0.5888145577373266,
+    -0.5046771576403359,    -0.7017837728373448,     -0.22104030366688782,
+    -1.3558016685259913,    0.24677395762008406,     -0.7823601120622704,
+    0.8770935663572036,     0.3812512028450342,      1.505772102945165,
+    -1.364283479731616,     1.411205104097461,       -0.11657000448495672,
+    0.6189048035944547,     0.8897528592807286,      0.961185500617246,
+    0.06158995252081894,    0.4545748182245695,      -0.09168582036331764,
+    0.7276391525817649,     -0.8917747551471092,     0.40455041723361107,
+    1.5393969264463359,     2.006452646179779,       1.0680905035549397,
+    1.4613558368934714,     0.5236074733470238,      1.0538128515306049,
+    1.9450394660563106,     -0.054253861841632875,   -1.5877441809877018,
+    -0.17031186445017096,   0.18598047273207738,     -0.8239288909365862,
+    -1.1978567133328493,    -0.49298347609708065,    -1.2300081741902582,
+    0.9126627466896129,     1.7046769834826283,      0.6753801178114957,
+    -1.39458956322296,      0.20707447317699473,     -0.8582831171666704,
+    0.27973892691053964,    -0.823140603973371,      0.9828490986805895,
+    0.7023241629745979,     -0.320599945190684,      0.5044671510107833,
+    0.06319882454439071,    1.7274289632494741,      -1.9015715724136582,
+    0.41289288732625984,    1.2430065691460797,      -0.3667905192228442,
+    -0.499090010583284,     0.1773007622271467,      -0.9197350141240535,
+    -0.5365844685294664,    -1.0241883770822167,     -0.17752805710493394,
+    -2.0919756242207015,    -0.6027744209364638,     0.558457491434279,
+    -0.37854145486581,      -0.4118971403611574,     0.8989659601306448,
+    1.5777945897788646,     -0.7372288382827994,     1.2049453710030325,
+    -1.7504903518717316,    -0.8458253750186462,     0.5357953607937388,
+    0.2576751223060831,     0.1191095293009187,      0.8648567805931103,
+    -0.2027198612055006,    0.7625045260107743,      -0.4889803009625133,
+    -0.6274887546504008,    -1.8749036459804767,     0.6763593436242352,
+    -0.8678178838550978,    1.0075311530198392,      1.0096856843892856,
+    -0.22219015053759483,   0.08725148714624033,     0.19781654867539608,
+    -0.20504275975885145,   -1.458598524990718,      1.4457445642459437,
+    -0.5678202693150476,    0.5294697824079188,      0.29135899644063606,
+    0.28966025563244063,    0.21893606346316366,     0.9120829566517927,
+    -0.8707301650691583,    0.9920722655575377,      0.16586233170522272,
+    0.039228577532490254,   -0.41509599341076636,    -0.04540601684640764,
+    0.5791589417809767,     -1.1719504982784887,     -1.720578970255799,
+    -0.2747716554660151,    0.7020926500534933,      -0.29904405503468395,
+    1.3711833486438207,     1.2960253742017096,      1.4025115636713923,
+    1.4522904026736154,     0.26355057368037543,     0.5669459043936601,
+    -0.6820953749120031,    -2.6855056829188757,     0.4053915577452256,
+    -0.7717368376527842,    -0.20117051614722412,    -2.485408450959582,
+    0.8975385177474403,     -0.20174919159248747,    -0.590749068837105,
+    -1.1549224834996235,    -0.8126062508178606,     -0.8468996600455448,
+    -0.9710385556289517,    -1.4130338793151611,     -0.20980616334738375,
+    -0.33813898710054396,   0.8593799269414478,      -1.7515028677853095,
+    -0.44581848253957634,   -0.8913511719829851,     0.3409139584900146,
+    -0.05238267915048745,   0.8490232119938326,      1.8381805730786318,
+    0.0010665667361786976,  0.5299956370333662,      -0.7496284236416308,
+    -0.1268302048957909,    0.02485720438383026,     2.138860903142798,
+    -1.1395604786303093,    -0.1340551059157379,     0.019451051604810383,
+    -0.7543299213267128,    0.35244388404476484,     0.014173666831190947,
+    0.1195300320172183,     -0.7221757229114752,     0.7345887860494619,
+    -0.9304522642937739,    -0.3721462375843068,     0.8473565193784999,
+    1.3978862086969388,     -0.7502306191673346,     0.6228451182059807,
+    -0.08533425247548856,   1.043987246844516,       0.11146119522911471,
+    1.6970534389174456,     1.5326117833450599,      -0.9732410418287788,
+    -0.3267867506012752,    -0.75050129473242,       -0.08081519160931815,
+    -1.8172589070708716,    -1.6736840936255635,     1.0198018711502475,
+    0.34073996286791314,    0.7534833895844514,      -0.9046809345124541,
+    -1.051097316071011,     -0.19356505852191427,    1.3828401831413721,
+    0.07540763834512061,    0.18299071016120166,     1.1777762992089094,
+    0.3796747904138769,     0.18196881674431112,     0.42739556619511804,
+    -0.19068628100371987,   1.5733869344891815,      -0.1043609703871633,
+    -0.7205218010630187,    0.6816046598400958,      0.9466737305151883,
+    -0.4717537179797124,    0.7239828201123549,      1.0765371658911091,
+    -3.351724947452281,     -1.7246752954944602,     0.4005066361822987,
+    -0.9305577360402544,    1.6864319166145834,      0.32406145816158144,
+    -0.10160529905974032,   0.06176513359924085,     -0.3798769684965894,
+    -0.6418871849583245,    0.12183313155728566,     1.0029205933591536,
+    -1.547071610341366,     0.24078509438834841,     -0.4496135447256289,
+    0.08608686625097926,    -0.7517899108642881,     0.14384133049313852,
+    -1.07217046733088,      -0.020290433003534697,   -0.2603028153617622,
+    -1.6652573855544825,    0.41826926161967287,     -2.8118572873806444,
+    -0.37568553221520545,   -1.4905871717882186,     0.25700841736042945,
+    -0.3360495340839838,    0.8169610783421904,      -0.2021067252961349,
+    -0.21296958478824618,   1.1205997460966157,      -0.4648200456946356,
+    -0.029691250010778516,  1.4262593116946818,      0.66190560399438,
+    1.9828850533782254,     0.4590622116146859,      -0.5296427791742504,
+    1.0740502538587908,     0.9223377239011725,      -0.2731209209472837,
+    0.5401051979284671,     -0.08241999160257564,    0.4980737543016475,
+    0.03261112172290219,    -0.12990937907692926,    1.6887749782267554,
+    0.4562234338562475,     -1.3305243434849185,     0.20841535497305236,
+    -0.2991630229288727,    0.31301773161125396,     0.23992777418384026,
+    0.36624954799450277,    -1.6984047064843328,     -1.567909672182415,
+    1.4005908322616225,     -0.026640425653040912,   1.3381007283894868,
+    0.5276058225942508,     -0.5330983762272866,     -1.688524452858312,
+    0.5119477692799878,     0.5172989430392664,      1.7511801463731236,
+    -0.2025176101448277,    0.07613167862657853,     -1.8080683499650345,
+    -0.6068676862026446,    0.24594478006388967,     -0.35079642293973845,
+    -0.8739551971383827,    1.4177531440561766,      1.6026803366905416,
+    -1.0681489983692147,    0.09892432410214622,     -0.4284938954098787,
+    1.484818939800811,      0.23745432287524232,     0.597281958695183,
+    -0.9350349308272665,    1.3274982457786433,      -0.29895241691926205,
+    1.862922989671676,      1.0924556048966734,      -0.6509592896238032,
+    0.5269190269992935,     0.24342133489496773,     -0.22129928797527612,
+    0.7498729464755881,     -0.02547220961388136,    0.02813080852137866,
+    -0.6315415213167213,    -0.744408508052111,      0.07660944629546644,
+    0.1786772919304125,     1.0758744969332517,      -1.354570209823389,
+    0.1124849473200512,     1.593881949851953,       -0.6780355582313897,
+    -1.0434527474430422,    -0.9265795619489678,     0.7914659390195384,
+    -1.2661632675663712,    0.019499296578472564,    -0.6691900871902942,
+    -0.5754749536203302,    -0.30629527450471256,    -0.37455854979569797,
+    -0.36756212644246805,   -0.05396352086906558,    0.26894939210524715,
+    -0.4535101966530851,    0.470606290177994,       -0.4796052120306986,
+    -0.4540935828577141,    0.041858787186930285,    -1.716229851629171,
+    -0.8209682709605263,    -0.6679894433651369,     -1.022806147752734,
+    -0.23156859299136665,   -0.7332388702368212,     -0.9112094390294475,
+    1.0160072349436597,     2.082462388128148,       0.993936218482339,
+    0.29810890213160446,    1.123983793562011,       0.3141824369976697,
+    -0.2606889148953744,    0.11151401071747408,     -0.33586567297692993,
+    -2.2048168849951226,    -0.8413716061212286,     -0.829006710017962,
+    0.48359519570697057,    -0.4810246355798725,     -1.7997513095213626,
+    -0.02858275566612428,   0.2866848655460903,      0.7693002870244459,
+    0.36429938186052035,    2.390590762304574,       -0.8673995764562495,
+    1.3171697853027307,     0.9210227634526568,      -0.635376182283391,
+    -0.12809098277846248,   -0.7461328814766642,     -0.12391124274672698,
+    -0.4430605759816179,    -0.4448740710277248,     -0.005243284288945138,
+    -1.0358043169594735,    1.1245388699055014,      0.8781153754803712,
+    -0.6952764881743871,    0.8626876270603471,      -1.0514006839892116,
+    -1.784016068960184,     0.31489465307967657,     0.5465442673336901,
+    -0.7393451122290028,    0.5261911270341959,      1.9604846599627415,
+    3.012376933255444,      -0.8729425549725268,     0.32665110361545674,
+    -1.2285683479975946,    2.8314852742466323,      -0.43583563536604186,
+    0.8599909597773101,     0.09445876529117561,     -1.057061898006422,
+    -0.20683561887197754,   -1.3536306918281464,     -0.6399438661090054,
+    -0.26811559028636794,   0.22494526108052643,     -2.2717294797478003,
+    -0.06560791487122482,   2.5529962215720543,      -0.9517334874412265,
+    0.32585261453072206,    -0.4231539997977312,     -2.822217225795356,
+    -0.9954167677957759,    -0.683481914221545,      0.8469876578256735,
+    -0.035079876368082775,  -0.2203067584915251,     0.6732244887757094,
+    0.12913785493253227,    -0.16493645206447616,    0.6682183943610241,
+    -1.3762409831908937,    -0.20624128895150953,    1.2533264664103798,
+    -2.1401295818133264,    -0.7906522003097647,     0.15631529797015334,
+    0.22912666083484437,    -0.3363267824513846,     0.42992048216847145,
+    -0.8865498241007644,    0.9794499719747619,      0.19469567734289125,
+    1.8151847977026612,     0.8465966075564614,      0.5515913701030694,
+    1.4160989919595208,     -0.8032323691853165,     -0.293227135861464,
+    -1.7501900964106074,    0.8704872260199449,      1.6541665030120587,
+    -0.48548738539058667,   -1.2171452109914107,     1.1248369487772936,
+    -0.7373061300903289,    -0.5044246784427611,     1.539505788642072,
+    -0.35873899736556486,   -0.1864464448715057,     1.611851915163453,
+    0.5908806219791308,     -1.0640318650498968,     1.5052985340805691,
+    -1.741355183254899,     1.0074876363213765,      0.4901821903215571,
+    -0.5233961590580599,    -0.7788982922154702,     -1.1124029498247225,
+    1.7290001121601946,     0.12443302756755235,     -0.6306218254508992,
+    0.5739161501217803,     1.204611127829525,       0.3188480968446466,
+    0.6969836087199982,     0.9540114240191833,      0.05875098437150642,
+    0.3165905173689822,     -0.11537527102984238,    -0.9923482674781495,
+    -1.267016535436748,     0.4506200458898788,      -0.708402614064011,
+    -0.021056635339765203,  -0.24771713418641333,    0.9702840458355168,
+    0.279963343667367,      0.3064706591238982,      -0.28651580328025933,
+    -0.13800539480817092,   -0.33990260104102926,    0.2496022974153477,
+    -1.72409501428731,      -0.019750326024755235,   0.36755670760768033,
+    0.3932617714941952,     -1.0774914795686203,     -0.4211067727282637,
+    -0.3807749658466138,    -0.539971736436136,      -1.2168655994764466,
+    -1.0864322495877135,    0.009094493674724556,    0.38548313318803773,
+    0.14799307417079596,    -0.8714829351817768,     0.384983468891442,
+    -0.1987923608798469,    -0.49552822753152054,    -0.9252851005984823,
+    -0.5093556343616868,    0.7169760349502766,      -0.18397272263039247,
+    -0.1231393520982019,    -1.0010273210431833,     2.7904216881875383,
+    -2.264949596839835,     -2.0279142638442043,     -0.5248401949817776,
+    0.19941381256788718,    1.7735326114487593,      0.513779510118961,
+    0.30082237440516707,    0.9196429969689821,      0.09507839919159553,
+    -1.9550956868684606,    0.2548410408273828,      0.21729987645769064,
+    2.1696576669512395,     -0.7209614049890997,     1.2573756412528125,
+    -1.3601809849640578,    1.5327824266954222,      0.13259123566437533,
+    0.8369866004411592,     0.7038120046976474,      0.6778080706007418,
+    0.09754468827570965,    -0.6559813357941985,     -0.1596922736327093,
+    -0.7654317007125321,    -0.1126976671772263,     -1.6088614791390787,
+    0.172236502872641,      0.9772836216538103,      1.2019072538377893,
+    1.3138162326986818,     0.15247534293859094,     -0.15415270857755534,
+    -0.25524165306179647,   0.3923593527201367,      0.7171068169318209,
+    0.33814141413352417,    -1.3454164100760053,     1.378052948631428,
+    0.47748156544728204,    0.9906862428957741,      0.05192492099132242,
+    -0.2609934917921665,    1.9375473147729616,      -1.069832859719185,
+    -1.688139163209385,     1.9957967459864232,      0.2403939818105377,
+    -0.4283694449741911,    -0.5850357506804287,     -2.0060803946689423,
+    1.8672709303187909,     0.7056302329993192,      0.509990780557728,
+    0.8246726896315857,     -0.9146650846687739,     0.45839429767800893,
+    1.0857135976881704,     -2.204923666647438,      0.5959640626123412,
+    0.747076157172831,      0.10148462387889638,     -0.885566779286961,
+    -0.1655618470477207,    -0.45818614471236335,    0.3628423289952963,
+    -0.5320928248025658,    0.7644201360742342,      -0.5183372082346639,
+    -0.5198438476311308,    1.1685335255050417,      -0.16073543695305828,
+    0.5316156101784504,     -1.2974104053060354,     1.5208773638609474,
+    -1.452172827360705,     0.09693348386447116,     -0.22454704951986149,
+    -0.7630577845056287,    -0.2743892877775697,     1.2351220515101868,
+    1.7389459951157138,     -0.23664221387754844,    -0.35746547681613217,
+    -1.8779352239372182,    1.7151172695400012,      -1.0660735295756416,
+    -0.9099151409403888,    0.10481056769638529,     0.7340559630879957,
+    1.5232610627361176,     2.174609750063118,       0.7538359898575543,
+    -0.48015878947551816,   -0.6568025911595441,     -0.178500405534637,
+    0.804447512925736,      0.9548909155117629,      0.6169268606534821,
+    -1.8944496447549188,    -0.5661655925791436,     1.4566884511899842,
+    -0.5330868093605918,    -0.08033606788900031,    2.726798808030312,
+    -0.07393321708416303,   1.4234327267377684,      1.8387111558209006,
+    0.7581751710148764,     -0.43490781801842254,    -2.280026888127863,
+    -0.8589368229527518,    0.6433147287429034,      0.5919608599627805,
+    1.1722707069070817,     -1.1058621539137552,     0.1994474033850918,
+    -2.050109106823698,     -0.8828085741358389,     0.5293035789155914,
+    -2.1822443400612164,    0.8167059284740097,      1.8306435885819057,
+    -1.4360873672317314,    -0.25887053459490916,    1.7184725119208686,
+    0.5006359909678696,     0.3973360523094999,      0.1075078955396326,
+    -1.3718043140286487,    -0.13683588334296015,    1.2866662723846953,
+    0.08697560639875537,    0.7216936619636506,      -0.36174575536678555,
+    -0.8714397370006153,    -0.4312177838008778,     -1.053032897818805,
+    -1.3623083878668496,    -0.01989903757351391,    -0.22877599699475412,
+    -0.9403944142330962,    0.6960691951295067,      -0.9315867323285139,
+    0.4255876552341913,     0.49837978696106716,     1.665958885796101,
+    0.34205221893252363,    0.7895903244870125,      0.07470964180015963,
+    -1.407186743927608,     0.8557226279263409,      1.6793879697439116,
+    -0.1242804834599012,    2.0937766491868355,      0.9238617787154833,
+    2.000980610930369,      -0.18118975386376956,    -0.8846708274216194,
+    0.05597743582421531,    -0.7262377972247028,     0.19845583584001267,
+    -0.24163650002721668,   0.16451186641161508,     -0.09004540382016302,
+    -0.9742539645685566,    -0.5294061513809323,     1.269125068782766,
+    -0.0635031812569957,    -1.3408263012278976,     -2.016802397381654,
+    -0.3224253751189573,    0.27879935611169043,     -1.1802184739493164,
+    -1.7873242445220847,    0.5608174386651537,      3.1941130359027223,
+    0.8719969174513782,     -0.996610363995452,      -0.11765598286415216,
+    -0.11884710509203313,   -1.2717757069211224,     -1.4041477552669448,
+    -0.1427669307805931,    0.7901634312150544,      0.2528779927693628,
+    -0.6832980549927604,    0.5094192952689579,      0.5212585904023529,
+    -0.9826787323844774,    -1.2178268728133825,     0.6451766810405415,
+    1.1362186776371623,     0.4054117652707486,      1.1792307442003183,
+    1.4669955824633947,     -1.5283475519727343,     0.47862374428371607,
+    1.3159625945810989,     1.1335766309336672,      1.4272199968757966,
+    -0.5875791945233264,    0.6817297440647835,      0.7762808911611014,
+    -0.5981709473036011,    0.1906832203712374,      -1.3317167476801013,
+    -0.848840654102649,     0.32756966378172586,     1.051415655679721,
+    -0.0007932378041793709, 1.5341044042063532,      1.489324193581286,
+    -0.9828309079144225,    -0.10137686966519051,    -0.5034488813918381,
+    0.8232521353212423,     0.7181528722186669,      -0.7937074116685169,
+    0.9240865326722013,     -1.3206632767957929,     1.1778488571680608,
+    -2.439172174991765,     -0.17911829212088395,    -0.7079201264672149,
+    0.6759288054070055,     0.2525500702286925,      -2.191531115745344,
+    -1.3454049703540347,    -0.5871490377453374,     1.1837772532087443,
+    1.6312629534211527,     0.6820065878484136,      1.4229498993136642,
+    -0.7531077025608558,    0.41660583544718954,     0.12698133845243562,
+    -1.0798098882404503,    -0.3503920670407499,     -0.3568483068515375,
+    0.45608670931597434,    0.4953927899031111,      -0.5484381483102518,
+    -0.5318767990671244,    -1.9006258382433345,     0.5053140524018953,
+    -0.10341105735150867,   -0.028990466594635167,   0.5458049780649977,
+    -0.49537371468823177,   -0.9638310237889585,     -0.6020448266820955,
+    -0.3436628645668577,    0.21763688499060538,     -0.605840854920324,
+    -0.4407632601619627,    -1.3295900276575532,     -0.4075873101822278,
+    -1.747057934835341,     -0.6607685180207324,     0.5399643421670312,
+    0.17139847626978819,    -0.15619302578027255,    -0.2245622972148196,
+    0.9002798851682261,     -1.178431560756386,      0.4422427252047344,
+    -0.7164659694250107,    0.2782397267131871,      -0.15208894059203298,
+    -0.5432265992210633,    0.3123124726755989,      -0.6462181793734874,
+    -1.2129367086986664,    -0.48301956889143255,    -1.2547013077350737,
+    0.14516705846978095,    -0.6079011572975985,     -1.2638761706184807,
+    0.36428257086629406,    0.4018101209683796,      -0.184533946761765,
+    -0.29227803941464175,   0.913295192677769,       -0.2711676911183993,
+    0.2580656042905764,     -1.1349926426688104,     0.5575857706024162,
+    -0.14293885938751286,   0.5182374972412448,      -0.2731224644439433,
+    -0.7529727687985162,    -1.2020108059385561,     -0.20630531146778944,
+    -0.45939813297651044,   -1.297200943970485,      1.250897190245364,
+    1.0256280539262181,     -2.0346262279964247,     -2.138980947526366,
+    -1.519605001250113,     0.15653535592075898,     2.679708455633599,
+    -1.1818362219539853,    -0.31723608852072177,    1.33291485496942,
+    -0.49532500144855807,   1.1158772495807519,      0.9341328283065662,
+    -0.02921333299459492,   0.8820625829339739,      0.9359150364791454,
+    -1.4028858495924854,    -0.17459167225487218,    -0.6291235491437993,
+    0.029651069206806022,   -1.2137115260123008,     -0.9964599053182054,
+    0.05577537586317621,    -0.007310529085468122,   1.385582920430734,
+    0.21042167233544076,    1.4323501401119016,      1.3103591392909377,
+    1.137846918706311,      -3.534826277379163,      -0.7729923147853984,
+    0.4634547900200788,     -1.3231846384903294,     -0.5278859467387327,
+    0.6685785992778752,     0.04753746681904918,     -0.348874129499413,
+    1.7324679325747716,     -0.4221128626166703,     1.1113299321018764,
+    -0.04968120944850837,   0.09915668936893607,     -0.358532751253049,
+    -0.8406042064580421,    -0.221612658834853,      -1.3656788094717542,
+    0.6111336477938548,     0.11307118984876603,     -0.4400905493473418,
+    0.7944236867042395,     -1.0422284824712515,     -1.9676185458085593,
+    0.4214309286631138,     -1.377442853113186,      -1.3953035973566086,
+    0.16296281785848823,    0.9663054387575775,      -0.7785692385580758,
+    -0.892202513025462,     1.5062625523325406,      -1.4124919691794113,
+    0.8479357928456366,     0.42985370525067496,     -0.7257420676274848,
+    -0.13640325052426217,   -0.8599626294185463,     -0.6661125673624853,
+    -0.1527898403502717,    -0.7069148613393527,     -1.6475757730896143,
+    0.7123571813975604,     -0.6043235817891589,     0.796605542609552,
+    -0.1539675589322236,    2.8127881504830197,      0.5580868261776278,
+    -1.3463480441721767,    -1.3721553973224714,     -0.8963780282911795,
+    -0.4285761618854014,    -1.6525879109046808,     -1.1260123613938908,
+    0.01512679265147408,    -1.5630535747999068,     -0.09995726382581116,
+    0.232995551922873,      -1.0048787371967522,     0.60395810447414,
+    0.08506419701248488,    1.0933353707542282,      0.6647099484873848,
+    -0.21262659368200942,   -0.1575259861911943,     0.46181553349813237,
+    0.37775971605594366,    -1.6927982504855759,     0.9265394154721454,
+    -0.5609690106651314,    1.1340336275631684,      0.17913690051786987,
+    -0.6495881348999478,    -0.00022165892178913267, 1.4404775624570878,
+    -0.749570039085251,     -1.7095849183856633,     -0.25568422447175687,
+    1.2593846775831197,     1.588163050548988,       1.0327358932903847,
+    -2.120251815112098,     -0.23712665145737535,    -0.47807028462047596,
+    -0.17645121408373998,   -1.0949426445571375,     -0.2750288309881863,
+    -1.1840995482162118,    2.3200971263106402,      0.059925351086009014,
+    -0.5175139346781814,    -1.2395163259365143,     0.9578853663287419,
+    0.5834875594915241,     1.161979075975805,       0.3466288514571874,
+    -0.46848758018195413,   -0.7279082582265999,     -0.7643680329235157,
+    -0.40508003888862415,   0.685302866247508,       -0.5516121316745625,
+    0.28426500952419215,    0.7529384361492727,      -0.45407375430146674,
+    0.9784898350044681};
+
+static double gemm_C_dram[2 * 8] __attribute__((section(".data"))) = {
+    0.4202785960607124,   0.38315284116671094,  -0.025946876766112608,
+    0.1734224810454438,   -0.8604104339899908,  -0.8384729265269991,
+    0.250256501213611,    0.8943805908773941,   -0.2304785091158027,
+    0.5021446498784435,   -0.23088021825515836, -0.7828154650580105,
+    0.012498797758136589, 0.3842652660222784,   -0.6887594656763455,
+    -0.5939893896101557};
+
+static const double gemm_checksum[2] = {
+    11.238727139722329, -24.732948936655575};
@@ -22,11 +22,13 @@
 #include <stdio.h>
 
 #include DATAHEADER
-#include "kernel/dp-fmatmul.c"
+#include <spatz_gemm.h>
 
 double *a;
 double *b;
 double *c;
+// Partial sums of split K
+double *w;
 
 // Verify the matrices
 int verify_matrix(double *matrix, const double *checksum,
@@ -55,29 +57,26 @@ int main() {
 
   unsigned int timer_start, timer_end, timer;
 
-  unsigned int m_start, m_end;
-  unsigned int p_start, p_end;
-  unsigned int kernel_size;
+  // Partition the GEMM across the cores, in whole vectors of columns
+  spatz_gemm_part part;
+  size_t vl;
+  asm volatile("vsetvli %0, zero, e64, m1, ta, ma" : "=r"(vl));
+  spatz_gemm_partition(gemm_l.M, gemm_l.N, gemm_l.K, num_cores, cid, vl, 1,
+                       &part);
+  const unsigned int plane = gemm_l.M * gemm_l.N;
 
   // Allocate the matrices in the local tile
   if (cid == 0) {
     a = (double *)snrt_l1alloc(gemm_l.M * gemm_l.K * sizeof(double));
     b = (double *)snrt_l1alloc(gemm_l.K * gemm_l.N * sizeof(double));
     c = (double *)snrt_l1alloc(gemm_l.M * gemm_l.N * sizeof(double));
+    if (part.k_parts > 1)
+      w = (double *)snrt_l1alloc((part.k_parts - 1) * plane * sizeof(double));
   }
 
   // Reset timer
   timer = (unsigned int)-1;
 
-  // Set matrix dimension
-  kernel_size = 4;
-
-  // Work over complete P dimension
-  p_start = 0;
-  p_end = gemm_l.N;
-  m_start = (gemm_l.M / num_cores) * cid;
-  m_end = (gemm_l.M / num_cores) * (cid + 1);
-
   // Wait for all cores to finish
   snrt_cluster_hw_barrier();
 
@@ -101,14 +100,18 @@ int main() {
     if (cid == 0)
       start_kernel();
 
-    if (kernel_size == 2) {
-      matmul_2xVL(c, a, b, m_start, m_end, gemm_l.K, gemm_l.N, p_start, p_end);
-    } else if (kernel_size == 4) {
-      matmul_4xVL(c, a, b, m_start, m_end, gemm_l.K, gemm_l.N, p_start, p_end);
-    } else if (kernel_size == 8) {
-      matmul_8xVL(c, a, b, m_start, m_end, gemm_l.K, gemm_l.N, p_start, p_end);
-    } else {
-      return -2;
+    // The first slice of K computes C, the others their partial sums
+    double *c_ = part.k_idx == 0 ? c : w + (part.k_idx - 1) * plane;
+    spatz_dgemm(SPATZ_GEMM_NOTRANS, part.m_end - part.m_start,
+                part.p_end - part.p_start, part.k_end - part.k_start, 1,
+                a + part.m_start * gemm_l.K + part.k_start, gemm_l.K,
+                b + part.k_start * gemm_l.N + part.p_start, gemm_l.N, 0,
+                c_ + part.m_start * gemm_l.N + part.p_start, gemm_l.N);
+
+    // Add up the slices of K
+    if (part.k_parts > 1) {
+      snrt_cluster_hw_barrier();
+      spatz_dgemm_reduce(&part, c, gemm_l.N, w, plane);
     }
 
     // Wait for all cores to finish
@@ -0,0 +1,139 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// Autotuning run of the spatz_gemm micro-kernels. Every core computes the
+// TUNE_M x TUNE_N x TUNE_K GEMM of each variant with each of its micro-kernels
+// into its own C. Core 0 prints one JSON line per variant and kernel with the
+// cycles of the slowest core, which spatz_gemm/script/autotune.py collects
+// into the dispatch table.
+
+#include <benchmark.h>
+#include <snrt.h>
+#include <spatz_gemm.h>
+
+#include "printf.h"
+
+#ifndef SNRT_TOPO_DOUBLE_BW
+#define SNRT_TOPO_DOUBLE_BW 0
+#endif
+
+#define M TUNE_M
+#define N TUNE_N
+#define K TUNE_K
+
+typedef struct {
+  const char *name;
+  const unsigned int *kernels;
+  int (*run)(unsigned int kernel, const void *a, const void *b, void *c);
+  unsigned int size;
+} tune_variant;
+
+static int run_dgemm(unsigned int kernel, const void *a, const void *b,
+                     void *c) {
+  return spatz_dgemm_kernel(kernel, SPATZ_GEMM_NOTRANS, M, N, K, 1, a, K, b, N,
+                            0, c, N);
+}
+
+static int run_sgemm(unsigned int kernel, const void *a, const void *b,
+                     void *c) {
+  return spatz_sgemm_kernel(kernel, SPATZ_GEMM_NOTRANS, M, N, K, 1, a, K, b, N,
+                            0, c, N);
+}
+
+static int run_hgemm(unsigned int kernel, const void *a, const void *b,
+                     void *c) {
+  return spatz_hgemm_kernel(kernel, SPATZ_GEMM_NOTRANS, M, N, K, 1, a, K, b, N,
+                            0, c, N);
+}
+
+static int run_hgemm_widening(unsigned int kernel, const void *a,
+                              const void *b, void *c) {
+  return spatz_hgemm_widening_kernel(kernel, SPATZ_GEMM_NOTRANS, M, N, K, 1, a,
+                                     K, b, N, 0, c, N);
+}
+
+static int run_bgemm_widening(unsigned int kernel, const void *a,
+                              const void *b, void *c) {
+  return spatz_bgemm_widening_kernel(kernel, SPATZ_GEMM_NOTRANS, M, N, K, 0x3c,
+                                     a, K, b, N, 0, c, N);
+}
+
+static int run_hgemm_sdotp(unsigned int kernel, const void *a, const void *b,
+                           void *c) {
+  return spatz_hgemm_sdotp_kernel(kernel, M, N, K, 1, a, K, b, 2 * N, 0, c, N);
+}
+
+static int run_bgemm_sdotp(unsigned int kernel, const void *a, const void *b,
+                           void *c) {
+  return spatz_bgemm_sdotp_kernel(kernel, M, N, K, 0x3c, a, K, b, 2 * N, 0, c,
+                                  N);
+}
+
+static const tune_variant variants[] = {
+    {"dgemm", spatz_dgemm_kernels, run_dgemm, sizeof(double)},
+    {"sgemm", spatz_sgemm_kernels, run_sgemm, sizeof(float)},
+    {"hgemm", spatz_hgemm_kernels, run_hgemm, sizeof(__fp16)},
+    {"hgemm_widening", spatz_hgemm_widening_kernels, run_hgemm_widening,
+     sizeof(__fp16)},
+    {"bgemm_widening", spatz_bgemm_widening_kernels, run_bgemm_widening,
+     sizeof(char)},
+    {"hgemm_sdotp", spatz_hgemm_sdotp_kernels, run_hgemm_sdotp,
+     sizeof(__fp16)},
+    {"bgemm_sdotp", spatz_bgemm_sdotp_kernels, run_bgemm_sdotp, sizeof(char)},
+};
+
+static char *a;
+static char *b;
+static char *c;
+
+int main() {
+  const unsigned int num_cores = snrt_cluster_core_num();
+  const unsigned int cid = snrt_cluster_core_idx();
+
+  // Sized for the widest element, the operands are zero: the cycles of the
+  // kernels do not depend on the values
+  if (cid == 0) {
+    a = (char *)snrt_l1alloc(M * K * sizeof(double));
+    b = (char *)snrt_l1alloc(K * N * sizeof(double));
+    c = (char *)snrt_l1alloc(num_cores * M * N * sizeof(double));
+    if (c) {
+      snrt_memset(a, 0, M * K * sizeof(double));
+      snrt_memset(b, 0, K * N * sizeof(double));
+    }
+  }
+  snrt_cluster_hw_barrier();
+  if (!c) {
+    if (cid == 0)
+      printf("Error: %dx%dx%d does not fit in the TCDM\n", M, N, K);
+    return 1;
+  }
+
+  size_t vlenb;
+  asm volatile("vsetvli %0, zero, e8, m1, ta, ma" : "=r"(vlenb));
+
+  for (unsigned int v = 0; v < sizeof(variants) / sizeof(variants[0]); ++v) {
+    const tune_variant *var = &variants[v];
+    char *c_ = c + cid * M * N * var->size;
+    for (const unsigned int *kernel = var->kernels; *kernel; ++kernel) {
+      unsigned int cycles = 0;
+      // The first round warms up the instruction cache
+      for (unsigned int round = 0; round < 2; ++round) {
+        snrt_cluster_hw_barrier();
+        unsigned int start = benchmark_get_cycle();
+        var->run(*kernel, a, b, c_);
+        snrt_cluster_hw_barrier();
+        cycles = benchmark_get_cycle() - start;
+      }
+      if (cid == 0)
+        printf("{\"gemm_tune\": \"%s\", \"vlen\": %d, \"n_fpu\": %d, "
+               "\"double_bw\": %d, \"cores\": %d, \"M\": %d, \"N\": %d, "
+               "\"K\": %d, \"kernel\": %d, \"cycles\": %d}\n",
+               var->name, 8 * vlenb, SNRT_NFPU_PER_CORE, SNRT_TOPO_DOUBLE_BW,
+               num_cores, M, N, K, *kernel, cycles);
+    }
+  }
+
+  snrt_cluster_hw_barrier();
+  return 0;
+}
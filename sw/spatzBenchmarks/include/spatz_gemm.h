@@ -0,0 +1,164 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// GEMM library of the Spatz vector unit.
+//
+// All matrices are row-major. The entry points compute
+//
+//   C = alpha * op(A) * B + beta * C
+//
+// with C of M x N, op(A) of M x K and B of K x N elements. lda, ldb and ldc
+// are the row strides of A, B and C in elements; op(A) = A^T reads A as a
+// K x M matrix. With beta == 0, C is not read. Each call runs on the calling
+// core only: partition a GEMM across cores by offsetting A and C by whole
+// rows.
+//
+// The micro-kernels keep `rows` rows of C in vector registers and sweep the
+// columns one vector at a time (the RxVL kernels). They are generated by
+// spatz_gemm/script/gen_kernels.py, by default with 8, 6, 4, 3, 2 and 1
+// rows. The widening variants accumulate in twice the element width, the
+// sdotp variants in twice the width with pairwise dot products; both narrow
+// the sums to the element type before applying alpha and beta. The sdotp
+// variants read B packed in pairs of rows: row pair k / 2 starts at
+// b + (k / 2) * ldb and interleaves the elements of rows k and k + 1, so
+// ldb >= 2 * N. They need an even K and do not transpose A.
+//
+// alpha and beta of the fp16 variants are float, fp8 values are passed as
+// their raw bits in a char.
+//
+// The entry points without a kernel argument take the micro-kernel from the
+// dispatch table autotuned for the cluster configuration (see
+// spatz_gemm/script/autotune.py), for the tuned shape closest to M x N x K.
+// Without a table they use 8 rows, or fewer for small M.
+
+#pragma once
+
+// Transposition of the A operand
+typedef enum {
+  SPATZ_GEMM_NOTRANS = 0,
+  SPATZ_GEMM_TRANS = 1
+} spatz_gemm_trans_t;
+
+// C = alpha * op(A) * B + beta * C, with the autotuned micro-kernel
+void spatz_dgemm(spatz_gemm_trans_t transa, unsigned int M, unsigned int N,
+                 unsigned int K, double alpha, const double *a,
+                 unsigned int lda, const double *b, unsigned int ldb,
+                 double beta, double *c, unsigned int ldc);
+void spatz_sgemm(spatz_gemm_trans_t transa, unsigned int M, unsigned int N,
+                 unsigned int K, float alpha, const float *a, unsigned int lda,
+                 const float *b, unsigned int ldb, float beta, float *c,
+                 unsigned int ldc);
+void spatz_hgemm(spatz_gemm_trans_t transa, unsigned int M, unsigned int N,
+                 unsigned int K, float alpha, const __fp16 *a,
+                 unsigned int lda, const __fp16 *b, unsigned int ldb,
+                 float beta, __fp16 *c, unsigned int ldc);
+void spatz_hgemm_widening(spatz_gemm_trans_t transa, unsigned int M,
+                          unsigned int N, unsigned int K, float alpha,
+                          const __fp16 *a, unsigned int lda, const __fp16 *b,
+                          unsigned int ldb, float beta, __fp16 *c,
+                          unsigned int ldc);
+void spatz_bgemm_widening(spatz_gemm_trans_t transa, unsigned int M,
+                          unsigned int N, unsigned int K, char alpha,
+                          const char *a, unsigned int lda, const char *b,
+                          unsigned int ldb, char beta, char *c,
+                          unsigned int ldc);
+void spatz_hgemm_sdotp(unsigned int M, unsigned int N, unsigned int K,
+                       float alpha, const __fp16 *a, unsigned int lda,
+                       const __fp16 *b, unsigned int ldb, float beta,
+                       __fp16 *c, unsigned int ldc);
+void spatz_bgemm_sdotp(unsigned int M, unsigned int N, unsigned int K,
+                       char alpha, const char *a, unsigned int lda,
+                       const char *b, unsigned int ldb, char beta, char *c,
+                       unsigned int ldc);
+
+// The same with the rows x VL micro-kernel, one of spatz_Xgemm_kernels
+// below; smaller kernels take the rows that remain. Return -1 for an unknown
+// kernel.
+int spatz_dgemm_kernel(unsigned int rows, spatz_gemm_trans_t transa,
+                       unsigned int M, unsigned int N, unsigned int K,
+                       double alpha, const double *a, unsigned int lda,
+                       const double *b, unsigned int ldb, double beta,
+                       double *c, unsigned int ldc);
+int spatz_sgemm_kernel(unsigned int rows, spatz_gemm_trans_t transa,
+                       unsigned int M, unsigned int N, unsigned int K,
+                       float alpha, const float *a, unsigned int lda,
+                       const float *b, unsigned int ldb, float beta, float *c,
+                       unsigned int ldc);
+int spatz_hgemm_kernel(unsigned int rows, spatz_gemm_trans_t transa,
+                       unsigned int M, unsigned int N, unsigned int K,
+                       float alpha, const __fp16 *a, unsigned int lda,
+                       const __fp16 *b, unsigned int ldb, float beta,
+                       __fp16 *c, unsigned int ldc);
+int spatz_hgemm_widening_kernel(unsigned int rows, spatz_gemm_trans_t transa,
+                                unsigned int M, unsigned int N, unsigned int K,
+                                float alpha, const __fp16 *a,
+                                unsigned int lda, const __fp16 *b,
+                                unsigned int ldb, float beta, __fp16 *c,
+                                unsigned int ldc);
+int spatz_bgemm_widening_kernel(unsigned int rows, spatz_gemm_trans_t transa,
+                                unsigned int M, unsigned int N, unsigned int K,
+                                char alpha, const char *a, unsigned int lda,
+                                const char *b, unsigned int ldb, char beta,
+                                char *c, unsigned int ldc);
+int spatz_hgemm_sdotp_kernel(unsigned int rows, unsigned int M, unsigned int N,
+                             unsigned int K, float alpha, const __fp16 *a,
+                             unsigned int lda, const __fp16 *b,
+                             unsigned int ldb, float beta, __fp16 *c,
+                             unsigned int ldc);
+int spatz_bgemm_sdotp_kernel(unsigned int rows, unsigned int M, unsigned int N,
+                             unsigned int K, char alpha, const char *a,
+                             unsigned int lda, const char *b, unsigned int ldb,
+                             char beta, char *c, unsigned int ldc);
+
+// Share of one core of a GEMM split across the cores of a cluster: the block
+// of C and the slice of K it computes. The k_parts cores of a block split K;
+// slice k_idx == 0 computes C, the others partial sums to reduce into it.
+typedef struct {
+  unsigned int m_start, m_end;
+  unsigned int p_start, p_end;
+  unsigned int k_start, k_end;
+  unsigned int k_idx, k_parts;
+} spatz_gemm_part;
+
+// Split an M x N x K GEMM across num_cores cores and return the share of
+// core cid. The cores form a grid over the rows and columns of C, picked from
+// the shape, so that small or unevenly divided M keeps every core busy. With
+// split_k, the cores of a block also split K when C has too few rows and
+// columns for all of them. Columns are split at multiples of p_align, e.g.
+// the vector length, and the remainders of all dimensions are spread evenly.
+void spatz_gemm_partition(unsigned int M, unsigned int N, unsigned int K,
+                          unsigned int num_cores, unsigned int cid,
+                          unsigned int p_align, int split_k,
+                          spatz_gemm_part *part);
+
+// Reduce split K: slice j > 0 writes its partial sums of the block to
+// w + (j - 1) * plane with the offsets and row stride of C. After a barrier,
+// every core of the block adds them to its share of the rows of C.
+void spatz_dgemm_reduce(const spatz_gemm_part *part, double *c,
+                        unsigned int ldc, const double *w, unsigned int plane);
+void spatz_sgemm_reduce(const spatz_gemm_part *part, float *c,
+                        unsigned int ldc, const float *w, unsigned int plane);
+void spatz_hgemm_reduce(const spatz_gemm_part *part, __fp16 *c,
+                        unsigned int ldc, const __fp16 *w, unsigned int plane);
+void spatz_hgemm_widening_reduce(const spatz_gemm_part *part, __fp16 *c,
+                                 unsigned int ldc, const __fp16 *w,
+                                 unsigned int plane);
+void spatz_bgemm_widening_reduce(const spatz_gemm_part *part, char *c,
+                                 unsigned int ldc, const char *w,
+                                 unsigned int plane);
+void spatz_hgemm_sdotp_reduce(const spatz_gemm_part *part, __fp16 *c,
+                              unsigned int ldc, const __fp16 *w,
+                              unsigned int plane);
+void spatz_bgemm_sdotp_reduce(const spatz_gemm_part *part, char *c,
+                              unsigned int ldc, const char *w,
+                              unsigned int plane);
+
+// Micro-kernels of each variant, zero-terminated
+extern const unsigned int spatz_dgemm_kernels[];
+extern const unsigned int spatz_sgemm_kernels[];
+extern const unsigned int spatz_hgemm_kernels[];
+extern const unsigned int spatz_hgemm_widening_kernels[];
+extern const unsigned int spatz_bgemm_widening_kernels[];
+extern const unsigned int spatz_hgemm_sdotp_kernels[];
+extern const unsigned int spatz_bgemm_sdotp_kernels[];
@@ -0,0 +1,87 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// This file was generated automatically by spatz_gemm/script/gen_kernels.py.
+
+// fp8 GEMM accumulating in fp16
+
+#define GEMM_T char
+#define GEMM_S char
+#define GEMM_FN(x) spatz_bgemm_widening##x
+#define GEMM_DISPATCH SPATZ_BGEMM_WIDENING_DISPATCH
+#define GEMM_SEW "e8"
+#define GEMM_VLE "vle8.v"
+#define GEMM_VSE "vse8.v"
+#define GEMM_FLA "flb"
+#define GEMM_FLE "flb"
+#define GEMM_MACC "vfwmacc.vf"
+#define GEMM_ONE 0x3c // 1.0 in fp8 (e5m2)
+#define GEMM_WIDEN 1
+#define GEMM_SEW_W "e16"
+
+#include "gemm.h"
+
+// 8xVL: accumulators at m2, B in v16 and v17
+#define GEMM_KERNEL GEMM_FN(_8xVL)
+#define GEMM_R 8
+#define GEMM_ROWS(X)                                                           \
+  X(0, v0) X(1, v2) X(2, v4) X(3, v6) X(4, v8) X(5, v10) X(6, v12) X(7, v14)
+#define GEMM_LMUL "m2"
+#define GEMM_LMUL_B "m1"
+#define GEMM_VB0 "v16"
+#define GEMM_VB1 "v17"
+#include "gemm_kernel.h"
+
+// 6xVL: accumulators at m4, B in v24 and v26
+#define GEMM_KERNEL GEMM_FN(_6xVL)
+#define GEMM_R 6
+#define GEMM_ROWS(X) X(0, v0) X(1, v4) X(2, v8) X(3, v12) X(4, v16) X(5, v20)
+#define GEMM_LMUL "m4"
+#define GEMM_LMUL_B "m2"
+#define GEMM_VB0 "v24"
+#define GEMM_VB1 "v26"
+#include "gemm_kernel.h"
+
+// 4xVL: accumulators at m4, B in v16 and v18
+#define GEMM_KERNEL GEMM_FN(_4xVL)
+#define GEMM_R 4
+#define GEMM_ROWS(X) X(0, v0) X(1, v4) X(2, v8) X(3, v12)
+#define GEMM_LMUL "m4"
+#define GEMM_LMUL_B "m2"
+#define GEMM_VB0 "v16"
+#define GEMM_VB1 "v18"
+#include "gemm_kernel.h"
+
+// 3xVL: accumulators at m8, B in v24 and v28
+#define GEMM_KERNEL GEMM_FN(_3xVL)
+#define GEMM_R 3
+#define GEMM_ROWS(X) X(0, v0) X(1, v8) X(2, v16)
+#define GEMM_LMUL "m8"
+#define GEMM_LMUL_B "m4"
+#define GEMM_VB0 "v24"
+#define GEMM_VB1 "v28"
+#include "gemm_kernel.h"
+
+// 2xVL: accumulators at m8, B in v16 and v20
+#define GEMM_KERNEL GEMM_FN(_2xVL)
+#define GEMM_R 2
+#define GEMM_ROWS(X) X(0, v0) X(1, v8)
+#define GEMM_LMUL "m8"
+#define GEMM_LMUL_B "m4"
+#define GEMM_VB0 "v16"
+#define GEMM_VB1 "v20"
+#include "gemm_kernel.h"
+
+// 1xVL: accumulators at m8, B in v8 and v12
+#define GEMM_KERNEL GEMM_FN(_1xVL)
+#define GEMM_R 1
+#define GEMM_ROWS(X) X(0, v0)
+#define GEMM_LMUL "m8"
+#define GEMM_LMUL_B "m4"
+#define GEMM_VB0 "v8"
+#define GEMM_VB1 "v12"
+#include "gemm_kernel.h"
+
+#define GEMM_KERNELS(X) X(8) X(6) X(4) X(3) X(2) X(1)
+#include "gemm_entry.h"
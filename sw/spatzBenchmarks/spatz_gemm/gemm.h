@@ -0,0 +1,73 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// Common part of one typed GEMM variant. The sources of the variants are
+// generated by script/gen_kernels.py: they define the traits below, include
+// this file, instantiate gemm_kernel.h once per micro-kernel and include
+// gemm_entry.h. The traits are
+//
+//   GEMM_T       element type
+//   GEMM_S       type of alpha and beta in the interface
+//   GEMM_FN(x)   name of the entry point with suffix x
+//   GEMM_DISPATCH  autotuned kernels of the variant, see gemm_dispatch.h
+//   GEMM_SEW     element width, e.g. "e64"
+//   GEMM_VLE     vector load and store of an element
+//   GEMM_VSE
+//   GEMM_FLA     scalar load of the A operand of one multiply-accumulate
+//   GEMM_FLE     scalar load of one element
+//   GEMM_MACC    vector-scalar multiply-accumulate
+//   GEMM_ONE     1.0 in GEMM_T
+//
+// and either GEMM_WIDEN, with the accumulator width GEMM_SEW_W, or
+// GEMM_SDOTP, or neither.
+
+#include <spatz_gemm.h>
+#include <stddef.h>
+
+#include "gemm_dispatch.h"
+
+#ifndef GEMM_WIDEN
+#define GEMM_WIDEN 0
+#endif
+#ifndef GEMM_SDOTP
+#define GEMM_SDOTP 0
+#endif
+
+// Elements of A per multiply-accumulate
+#if GEMM_SDOTP
+#define GEMM_KSTEP 2
+#else
+#define GEMM_KSTEP 1
+#endif
+
+// How the sums land in C
+enum { GEMM_STORE, GEMM_SCALE, GEMM_AXPBY };
+
+typedef struct {
+  int mode;
+  GEMM_T alpha;
+  GEMM_T beta;
+} gemm_scale;
+
+// Statements per row of a micro-kernel block
+#define GEMM_ZERO(i, v) asm volatile("vmv.v.x " #v ", zero");
+#define GEMM_LOAD_A(i, v)                                                      \
+  asm volatile(GEMM_FLA " %[t], 0(%[a])"                                       \
+               : [t] "=f"(t[i])                                                \
+               : [a] "r"(a_k + (i)*a_rs));
+#define GEMM_MACC_B0(i, v)                                                     \
+  asm volatile(GEMM_MACC " " #v ", %0, " GEMM_VB0 ::"f"(t[i]));
+#define GEMM_MACC_B1(i, v)                                                     \
+  asm volatile(GEMM_MACC " " #v ", %0, " GEMM_VB1 ::"f"(t[i]));
+#define GEMM_STEP_B0(i, v) GEMM_MACC_B0(i, v) GEMM_LOAD_A(i, v)
+#define GEMM_STEP_B1(i, v) GEMM_MACC_B1(i, v) GEMM_LOAD_A(i, v)
+#define GEMM_NARROW(i, v) asm volatile("vfncvt.f.f.w " #v ", " #v);
+#define GEMM_SCALE_ROW(i, v)                                                   \
+  asm volatile("vfmul.vf " #v ", " #v ", %0" ::"f"(fa));
+#define GEMM_AXPBY_ROW(i, v)                                                   \
+  asm volatile(GEMM_VLE " " GEMM_VB0 ", (%0);" ::"r"(c_ + (m + (i)) * ldc));   \
+  asm volatile("vfmul.vf " #v ", " #v ", %0" ::"f"(fa));                       \
+  asm volatile("vfmacc.vf " #v ", %0, " GEMM_VB0 ::"f"(fb));
+#define GEMM_STORE_ROW(i, v)                                                   \
+  asm volatile(GEMM_VSE " " #v ", (%0);" ::"r"(c_ + (m + (i)) * ldc));
@@ -0,0 +1,46 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// This file was generated automatically by spatz_gemm/script/autotune.py.
+
+// Autotuned micro-kernels of the spatz_gemm variants: {M, N, K, kernel} per
+// shape, for the cluster configuration of snrt_topology.h. A variant without
+// entries falls back to the default kernel for M.
+
+#pragma once
+
+#if __has_include(<snrt_topology.h>)
+#include <snrt_topology.h>
+#endif
+
+#ifdef SNRT_TOPOLOGY
+#define SPATZ_GEMM_CFG(vlen, n_fpu, double_bw, cores)                          \
+  (SNRT_TOPO_VLEN == (vlen) && SNRT_TOPO_N_FPU == (n_fpu) &&                   \
+   SNRT_TOPO_DOUBLE_BW == (double_bw) &&                                       \
+   SNRT_TOPO_CLUSTER_CORE_NUM == (cores))
+#else
+#define SPATZ_GEMM_CFG(vlen, n_fpu, double_bw, cores) 0
+#endif
+
+#ifndef SPATZ_DGEMM_DISPATCH
+#define SPATZ_DGEMM_DISPATCH
+#endif
+#ifndef SPATZ_SGEMM_DISPATCH
+#define SPATZ_SGEMM_DISPATCH
+#endif
+#ifndef SPATZ_HGEMM_DISPATCH
+#define SPATZ_HGEMM_DISPATCH
+#endif
+#ifndef SPATZ_HGEMM_WIDENING_DISPATCH
+#define SPATZ_HGEMM_WIDENING_DISPATCH
+#endif
+#ifndef SPATZ_BGEMM_WIDENING_DISPATCH
+#define SPATZ_BGEMM_WIDENING_DISPATCH
+#endif
+#ifndef SPATZ_HGEMM_SDOTP_DISPATCH
+#define SPATZ_HGEMM_SDOTP_DISPATCH
+#endif
+#ifndef SPATZ_BGEMM_SDOTP_DISPATCH
+#define SPATZ_BGEMM_SDOTP_DISPATCH
+#endif
@@ -0,0 +1,167 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// Entry points of one typed GEMM variant, included after its micro-kernels
+// with
+//
+//   GEMM_KERNELS(X)  X-macro over the rows of the micro-kernels, descending
+//                    and down to 1
+
+// Run the rows x VL kernel over as many rows as it covers, and the smaller
+// kernels over the rest. Any rows runs the largest kernel not above it.
+#define GEMM_RUN(r)                                                            \
+  if (rows >= r) {                                                             \
+    const unsigned int n = (M - m) / r * r;                                    \
+    if (n)                                                                     \
+      GEMM_FN(_##r##xVL)(n, N, K, a + m * a_rs, a_rs, a_cs, b, ldb,           \
+                         c + m * ldc, ldc, &s);                                \
+    m += n;                                                                    \
+  }
+
+static int GEMM_FN(_run)(const unsigned int rows, const unsigned int M,
+                         const unsigned int N, const unsigned int K,
+                         const GEMM_S alpha, const GEMM_T *a,
+                         const unsigned int a_rs, const unsigned int a_cs,
+                         const GEMM_T *b, const unsigned int ldb,
+                         const GEMM_S beta, GEMM_T *c,
+                         const unsigned int ldc) {
+  if (M == 0 || N == 0 || K < GEMM_KSTEP)
+    return 0;
+
+  gemm_scale s = {.alpha = (GEMM_T)alpha, .beta = (GEMM_T)beta};
+  if (beta != 0)
+    s.mode = GEMM_AXPBY;
+  else if (alpha != GEMM_ONE)
+    s.mode = GEMM_SCALE;
+  else
+    s.mode = GEMM_STORE;
+
+  unsigned int m = 0;
+  GEMM_KERNELS(GEMM_RUN)
+  return 0;
+}
+
+#define GEMM_ID(r) r,
+const unsigned int GEMM_FN(_kernels)[] = {GEMM_KERNELS(GEMM_ID) 0};
+
+static int GEMM_FN(_known)(const unsigned int rows) {
+  for (const unsigned int *k = GEMM_FN(_kernels); *k; ++k)
+    if (*k == rows)
+      return 1;
+  return 0;
+}
+
+// Fastest kernel per tuned shape
+typedef struct {
+  unsigned short M, N, K, kernel;
+} gemm_dispatch_entry;
+
+static const gemm_dispatch_entry GEMM_FN(_dispatch)[] = {GEMM_DISPATCH{0}};
+
+static inline unsigned int gemm_log2_dist(const unsigned int x,
+                                          const unsigned int y) {
+  const int d = __builtin_clz(y) - __builtin_clz(x);
+  return d < 0 ? -d : d;
+}
+
+// Kernel of the tuned shape closest to M x N x K, by the distance of the
+// sizes on a log scale. Without tuned shapes, blocks of 8 rows unless M is
+// small.
+static unsigned int GEMM_FN(_rows)(const unsigned int M, const unsigned int N,
+                                   const unsigned int K) {
+  unsigned int kernel = M <= 4 ? 2 : M <= 8 ? 4 : 8;
+  unsigned int dist = -1u;
+  for (const gemm_dispatch_entry *e = GEMM_FN(_dispatch); e->kernel; ++e) {
+    const unsigned int d = gemm_log2_dist(M, e->M) + gemm_log2_dist(N, e->N) +
+                           gemm_log2_dist(K, e->K);
+    // Kernels with more rows than M would only run the smaller ones
+    if (d < dist && e->kernel <= M) {
+      dist = d;
+      kernel = e->kernel;
+    }
+  }
+  return kernel;
+}
+
+#if GEMM_SDOTP
+
+int GEMM_FN(_kernel)(unsigned int rows, unsigned int M, unsigned int N,
+                     unsigned int K, GEMM_S alpha, const GEMM_T *a,
+                     unsigned int lda, const GEMM_T *b, unsigned int ldb,
+                     GEMM_S beta, GEMM_T *c, unsigned int ldc) {
+  if (!GEMM_FN(_known)(rows))
+    return -1;
+  return GEMM_FN(_run)(rows, M, N, K, alpha, a, lda, 1, b, ldb, beta, c, ldc);
+}
+
+void GEMM_FN()(unsigned int M, unsigned int N, unsigned int K, GEMM_S alpha,
+               const GEMM_T *a, unsigned int lda, const GEMM_T *b,
+               unsigned int ldb, GEMM_S beta, GEMM_T *c, unsigned int ldc) {
+  // The kernel choice takes the log of every size
+  if (M == 0 || N == 0 || K < GEMM_KSTEP)
+    return;
+  GEMM_FN(_run)(GEMM_FN(_rows)(M, N, K), M, N, K, alpha, a, lda, 1, b, ldb,
+                beta, c, ldc);
+}
+
+#else
+
+int GEMM_FN(_kernel)(unsigned int rows, spatz_gemm_trans_t transa,
+                     unsigned int M, unsigned int N, unsigned int K,
+                     GEMM_S alpha, const GEMM_T *a, unsigned int lda,
+                     const GEMM_T *b, unsigned int ldb, GEMM_S beta, GEMM_T *c,
+                     unsigned int ldc) {
+  if (!GEMM_FN(_known)(rows))
+    return -1;
+  // A^T is read with the strides swapped
+  const unsigned int a_rs = transa == SPATZ_GEMM_TRANS ? 1 : lda;
+  const unsigned int a_cs = transa == SPATZ_GEMM_TRANS ? lda : 1;
+  return GEMM_FN(_run)(rows, M, N, K, alpha, a, a_rs, a_cs, b, ldb, beta, c,
+                       ldc);
+}
+
+void GEMM_FN()(spatz_gemm_trans_t transa, unsigned int M, unsigned int N,
+               unsigned int K, GEMM_S alpha, const GEMM_T *a, unsigned int lda,
+               const GEMM_T *b, unsigned int ldb, GEMM_S beta, GEMM_T *c,
+               unsigned int ldc) {
+  // The kernel choice takes the log of every size
+  if (M == 0 || N == 0 || K < GEMM_KSTEP)
+    return;
+  const unsigned int a_rs = transa == SPATZ_GEMM_TRANS ? 1 : lda;
+  const unsigned int a_cs = transa == SPATZ_GEMM_TRANS ? lda : 1;
+  GEMM_FN(_run)(GEMM_FN(_rows)(M, N, K), M, N, K, alpha, a, a_rs, a_cs, b, ldb,
+                beta, c, ldc);
+}
+
+#endif
+
+// Add the partial sums of the other slices of K to this core's share of the
+// rows of its block of C
+void GEMM_FN(_reduce)(const spatz_gemm_part *part, GEMM_T *c,
+                      unsigned int ldc, const GEMM_T *w, unsigned int plane) {
+  const unsigned int rows = part->m_end - part->m_start;
+  const unsigned int m_start =
+      part->m_start + rows * part->k_idx / part->k_parts;
+  const unsigned int m_end =
+      part->m_start + rows * (part->k_idx + 1) / part->k_parts;
+
+  for (unsigned int m = m_start; m < m_end; ++m) {
+    unsigned int p = part->p_start;
+    while (p < part->p_end) {
+      size_t gvl;
+      asm volatile("vsetvli %[gvl], %[vl], " GEMM_SEW ", m8, ta, ma"
+                   : [gvl] "=r"(gvl)
+                   : [vl] "r"(part->p_end - p));
+      GEMM_T *c_ = c + m * ldc + p;
+      asm volatile(GEMM_VLE " v0, (%0);" ::"r"(c_));
+      for (unsigned int j = 1; j < part->k_parts; ++j) {
+        asm volatile(GEMM_VLE " v8, (%0);" ::"r"(w + (j - 1) * plane +
+                                                  m * ldc + p));
+        asm volatile("vfadd.vv v0, v0, v8");
+      }
+      asm volatile(GEMM_VSE " v0, (%0);" ::"r"(c_));
+      p += gvl;
+    }
+  }
+}
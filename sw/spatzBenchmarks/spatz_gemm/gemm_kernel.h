@@ -0,0 +1,122 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// One RxVL micro-kernel, included by the generated variant sources once per
+// number of rows with
+//
+//   GEMM_KERNEL  name of the kernel
+//   GEMM_R       rows of C per block
+//   GEMM_ROWS    X-macro over (row, accumulator register) of the block
+//   GEMM_LMUL    LMUL of the accumulators, at the element width
+//   GEMM_LMUL_B  LMUL of the B vectors
+//   GEMM_VB0     the two register groups B is double-buffered in
+//   GEMM_VB1
+//
+// which it undefines again. M must be a multiple of GEMM_R.
+
+static void GEMM_KERNEL(const unsigned int M, const unsigned int N,
+                        const unsigned int K, const GEMM_T *a,
+                        const unsigned int a_rs, const unsigned int a_cs,
+                        const GEMM_T *b, const unsigned int ldb, GEMM_T *c,
+                        const unsigned int ldc, const gemm_scale *s) {
+  double fa = 0, fb = 0;
+  if (s->mode != GEMM_STORE)
+    asm volatile(GEMM_FLE " %[t], 0(%[a])" : [t] "=f"(fa) : [a] "r"(&s->alpha));
+  if (s->mode == GEMM_AXPBY)
+    asm volatile(GEMM_FLE " %[t], 0(%[a])" : [t] "=f"(fb) : [a] "r"(&s->beta));
+
+  unsigned int p = 0;
+  while (p < N) {
+    // Calculate the vl
+    size_t gvl;
+#if GEMM_SDOTP
+    asm volatile("vsetvli %[gvl], %[vl], " GEMM_SEW ", " GEMM_LMUL ", ta, ma"
+                 : [gvl] "=r"(gvl)
+                 : [vl] "r"(2 * (N - p)));
+    const GEMM_T *b_ = b + 2 * p;
+#else
+    asm volatile("vsetvli %[gvl], %[vl], " GEMM_SEW ", " GEMM_LMUL_B ", ta, ma"
+                 : [gvl] "=r"(gvl)
+                 : [vl] "r"(N - p));
+    const GEMM_T *b_ = b + p;
+#endif
+    GEMM_T *c_ = c + p;
+
+    for (unsigned int m = 0; m < M; m += GEMM_R) {
+      const GEMM_T *a_k = a + m * a_rs;
+      const GEMM_T *b__ = b_;
+
+      double t[GEMM_R];
+
+#if GEMM_WIDEN
+      asm volatile("vsetvli zero, %0, " GEMM_SEW_W ", " GEMM_LMUL
+                   ", ta, ma" ::"r"(gvl));
+      GEMM_ROWS(GEMM_ZERO)
+      asm volatile("vsetvli zero, %0, " GEMM_SEW ", " GEMM_LMUL_B
+                   ", ta, ma" ::"r"(gvl));
+#else
+      GEMM_ROWS(GEMM_ZERO)
+#endif
+
+      asm volatile(GEMM_VLE " " GEMM_VB0 ", (%0);" ::"r"(b__));
+      b__ += ldb;
+      GEMM_ROWS(GEMM_LOAD_A)
+
+      // GEMM_VB0 and t hold the step k on entry
+      unsigned int k = 0;
+      while (1) {
+        k += GEMM_KSTEP;
+        if (k >= K) {
+          GEMM_ROWS(GEMM_MACC_B0)
+          break;
+        }
+
+        asm volatile(GEMM_VLE " " GEMM_VB1 ", (%0);" ::"r"(b__));
+        b__ += ldb;
+        a_k += GEMM_KSTEP * a_cs;
+        GEMM_ROWS(GEMM_STEP_B0)
+
+        k += GEMM_KSTEP;
+        if (k >= K) {
+          GEMM_ROWS(GEMM_MACC_B1)
+          break;
+        }
+
+        asm volatile(GEMM_VLE " " GEMM_VB0 ", (%0);" ::"r"(b__));
+        b__ += ldb;
+        a_k += GEMM_KSTEP * a_cs;
+        GEMM_ROWS(GEMM_STEP_B1)
+      }
+
+#if GEMM_SDOTP
+      asm volatile("vsetvli zero, %0, " GEMM_SEW ", " GEMM_LMUL
+                   ", ta, ma" ::"r"(gvl / 2));
+      GEMM_ROWS(GEMM_NARROW)
+#elif GEMM_WIDEN
+      GEMM_ROWS(GEMM_NARROW)
+#endif
+
+      if (s->mode == GEMM_AXPBY) {
+        GEMM_ROWS(GEMM_AXPBY_ROW)
+      } else if (s->mode == GEMM_SCALE) {
+        GEMM_ROWS(GEMM_SCALE_ROW)
+      }
+      GEMM_ROWS(GEMM_STORE_ROW)
+    }
+
+#if GEMM_SDOTP
+    p += gvl / 2;
+#else
+    p += gvl;
+#endif
+  }
+}
+
+#undef GEMM_KERNEL
+#undef GEMM_R
+#undef GEMM_ROWS
+#undef GEMM_LMUL
+#undef GEMM_LMUL_B
+#undef GEMM_VB0
+#undef GEMM_VB1
@@ -0,0 +1,74 @@
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// Partitioning of a GEMM across the cores of a cluster
+
+#include <spatz_gemm.h>
+
+#define CEIL_DIV(a, b) (((a) + (b)-1) / (b))
+
+// Cycles of one core up to a constant factor: one multiply-accumulate per
+// row and vector of a K step, plus the B vector it loads once per block of
+// up to 8 rows. Split K adds a pass over the block per slice to reduce it.
+static unsigned int partition_cost(const unsigned int rows,
+                                   const unsigned int strips,
+                                   const unsigned int k,
+                                   const unsigned int kc) {
+  unsigned int cost = strips * k * (rows + CEIL_DIV(rows, 8));
+  if (kc > 1)
+    cost += strips * rows * kc;
+  return cost;
+}
+
+void spatz_gemm_partition(unsigned int M, unsigned int N, unsigned int K,
+                          unsigned int num_cores, unsigned int cid,
+                          unsigned int p_align, int split_k,
+                          spatz_gemm_part *part) {
+  const unsigned int strips = CEIL_DIV(N, p_align);
+  // K is split in pairs, the sdotp kernels need an even K
+  const unsigned int pairs = CEIL_DIV(K, 2);
+
+  // Grid of mc x pc blocks of C, each split into kc slices of K. On equal
+  // cost, prefer not to split K, and then to split the rows.
+  unsigned int mc = num_cores, pc = 1, kc = 1;
+  unsigned int best = -1u;
+  for (unsigned int k = 1; k <= (split_k ? num_cores : 1); ++k) {
+    // Every slice gets at least one pair
+    if (num_cores % k || k > pairs)
+      continue;
+    for (unsigned int m = num_cores / k; m >= 1; --m) {
+      if ((num_cores / k) % m)
+        continue;
+      const unsigned int p = num_cores / k / m;
+      const unsigned int cost = partition_cost(
+          CEIL_DIV(M, m), CEIL_DIV(strips, p), 2 * CEIL_DIV(pairs, k), k);
+      if (cost < best) {
+        best = cost;
+        mc = m;
+        pc = p;
+        kc = k;
+      }
+    }
+  }
+
+  const unsigned int pi = cid % pc;
+  const unsigned int mi = cid / pc % mc;
+  const unsigned int ki = cid / (pc * mc);
+
+  // Rows and slices of K as even as possible, columns in whole strips
+  part->m_start = M * mi / mc;
+  part->m_end = M * (mi + 1) / mc;
+  part->p_start = p_align * (strips * pi / pc);
+  part->p_end = p_align * (strips * (pi + 1) / pc);
+  if (part->p_start > N)
+    part->p_start = N;
+  if (part->p_end > N)
+    part->p_end = N;
+  part->k_start = 2 * (pairs * ki / kc);
+  part->k_end = 2 * (pairs * (ki + 1) / kc);
+  if (part->k_end > K)
+    part->k_end = K;
+  part->k_idx = ki;
+  part->k_parts = kc;
+}
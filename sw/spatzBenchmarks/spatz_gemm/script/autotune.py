@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+# Copyright 2023 ETH Zurich and University of Bologna.
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+# This script autotunes the micro-kernels of the spatz_gemm library. The
+# gemm-tune binaries (one per shape of GEMM_TUNE_SHAPES) time every kernel of
+# every GEMM variant and print one JSON line per run. The script runs them on
+# an RTL simulator, or reads the logs of earlier runs, keeps the fastest kernel
+# per cluster configuration, variant and shape and writes the dispatch table
+# the library includes. Pass the logs of every configuration to tune for: the
+# table is written from scratch.
+
+import os
+import sys
+import glob
+import json
+import argparse
+import subprocess
+
+VARIANTS = ('dgemm', 'sgemm', 'hgemm', 'hgemm_widening', 'bgemm_widening',
+            'hgemm_sdotp', 'bgemm_sdotp')
+
+HEADER = '''\
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// This file was generated automatically by spatz_gemm/script/autotune.py.
+
+// Autotuned micro-kernels of the spatz_gemm variants: {M, N, K, kernel} per
+// shape, for the cluster configuration of snrt_topology.h. A variant without
+// entries falls back to the default kernel for M.
+
+#pragma once
+
+#if __has_include(<snrt_topology.h>)
+#include <snrt_topology.h>
+#endif
+
+#ifdef SNRT_TOPOLOGY
+#define SPATZ_GEMM_CFG(vlen, n_fpu, double_bw, cores)                          \\
+  (SNRT_TOPO_VLEN == (vlen) && SNRT_TOPO_N_FPU == (n_fpu) &&                   \\
+   SNRT_TOPO_DOUBLE_BW == (double_bw) &&                                       \\
+   SNRT_TOPO_CLUSTER_CORE_NUM == (cores))
+#else
+#define SPATZ_GEMM_CFG(vlen, n_fpu, double_bw, cores) 0
+#endif
+'''
+
+
+def parse(path):
+    """Return the gemm-tune records of a log."""
+    records = []
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if line.startswith('{"gemm_tune"'):
+                records.append(json.loads(line))
+    return records
+
+
+def run(sim, build_dir, log_dir):
+    """Run every gemm-tune binary of a build on the simulator and return the
+    paths of the logs."""
+    elfs = sorted(p for p in glob.glob(os.path.join(
+        build_dir, '**', 'test-*gemm-tune_*'), recursive=True)
+        if os.path.splitext(p)[1] == '')
+    if not elfs:
+        sys.exit('error: no gemm-tune binaries in {}'.format(build_dir))
+    os.makedirs(log_dir, exist_ok=True)
+    # The binaries run in the log directory
+    if os.sep in sim:
+        sim = os.path.abspath(sim)
+    logs = []
+    for elf in elfs:
+        log = os.path.join(log_dir, os.path.basename(elf) + '.log')
+        print('running {}'.format(elf), file=sys.stderr)
+        with open(log, 'w') as f:
+            subprocess.run([sim, os.path.abspath(elf)], stdout=f,
+                           stderr=subprocess.STDOUT, cwd=log_dir, check=True)
+        logs.append(log)
+    return logs
+
+
+def default_kernel(m):
+    """Kernel the library picks without a table entry."""
+    return 2 if m <= 4 else 4 if m <= 8 else 8
+
+
+def best(records):
+    """Return {(cfg, variant, shape): {kernel: cycles}}, keeping the fastest
+    run of repeated measurements."""
+    cycles = {}
+    for r in records:
+        cfg = (r['vlen'], r['n_fpu'], r['double_bw'], r['cores'])
+        key = (cfg, r['gemm_tune'], (r['M'], r['N'], r['K']))
+        runs = cycles.setdefault(key, {})
+        runs[r['kernel']] = min(runs.get(r['kernel'], r['cycles']),
+                                r['cycles'])
+    return cycles
+
+
+def emit(cycles, out):
+    """Write the dispatch table header."""
+    tables = {}
+    for (cfg, variant, shape), runs in sorted(cycles.items()):
+        kernel = min(runs, key=lambda k: (runs[k], k))
+        tables.setdefault(cfg, {}).setdefault(variant, []).append(
+            shape + (kernel,))
+
+    lines = [HEADER]
+    for cfg, variants in sorted(tables.items()):
+        lines.append('#if SPATZ_GEMM_CFG({}, {}, {}, {})'.format(*cfg))
+        for variant in VARIANTS:
+            if variant not in variants:
+                continue
+            entries = ['{{{}, {}, {}, {}}},'.format(*e)
+                       for e in variants[variant]]
+            lines.append('#define SPATZ_{}_DISPATCH'.format(variant.upper()) +
+                         ''.join(' \\\n  ' + e for e in entries))
+        lines.append('#endif\n')
+
+    for variant in VARIANTS:
+        macro = 'SPATZ_{}_DISPATCH'.format(variant.upper())
+        lines.append('#ifndef {0}\n#define {0}\n#endif'.format(macro))
+
+    with open(out, 'w') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+def report(cycles):
+    """Print the speedup of the tuned over the default kernel per shape."""
+    print('{:<16} {:<22} {:>14} {:>6} {:>8}'.format(
+        'variant', 'config', 'shape', 'kernel', 'speedup'))
+    for (cfg, variant, shape), runs in sorted(cycles.items()):
+        kernel = min(runs, key=lambda k: (runs[k], k))
+        dflt = runs.get(default_kernel(shape[0]))
+        speedup = '{:.2f}'.format(dflt / runs[kernel]) if dflt else '-'
+        print('{:<16} {:<22} {:>14} {:>6} {:>8}'.format(
+            variant, 'vlen{}-fpu{}-bw{}-c{}'.format(*cfg),
+            '{}x{}x{}'.format(*shape), kernel, speedup))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Autotune the spatz_gemm micro-kernels.')
+    parser.add_argument('log', nargs='*',
+                        help='simulation logs of gemm-tune binaries')
+    parser.add_argument('--sim', help='RTL simulator to run the binaries on')
+    parser.add_argument('--build-dir', default='.',
+                        help='build tree with the gemm-tune binaries')
+    parser.add_argument('--log-dir', default='gemm-tune-logs',
+                        help='directory for the logs of --sim runs')
+    parser.add_argument('-o', '--out', default=os.path.join(
+        os.path.dirname(os.path.abspath(__file__)), '..', 'gemm_dispatch.h'),
+        help='dispatch table to write (default: spatz_gemm/gemm_dispatch.h)')
+    args = parser.parse_args()
+
+    logs = list(args.log)
+    if args.sim:
+        logs += run(args.sim, args.build_dir, os.path.abspath(args.log_dir))
+
+    records = []
+    for log in logs:
+        records += parse(log)
+    if logs and not records:
+        sys.exit('error: no gemm-tune results in the logs')
+
+    cycles = best(records)
+    emit(cycles, args.out)
+    if cycles:
+        report(cycles)
+
+
+if __name__ == '__main__':
+    main()
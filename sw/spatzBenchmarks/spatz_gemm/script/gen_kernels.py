@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+# Copyright 2023 ETH Zurich and University of Bologna.
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+# This script generates the sources of the spatz_gemm variants. A variant is
+# an element width (SEW) and an accumulation: plain, widening into twice the
+# width, or pairwise dot products (sdotp) into twice the width. For each
+# variant it emits one RxVL micro-kernel per number of rows R, with the
+# accumulators of the R rows and the two B buffers allocated in the 32 vector
+# registers at the largest LMUL they fit in, or at the LMUL given with --lmul.
+# New variants also need their prototypes in include/spatz_gemm.h and their
+# source in the spatz_gemm library of CMakeLists.txt.
+
+import os
+import sys
+import argparse
+
+# name: (SEW, accumulation)
+VARIANTS = {
+    'dgemm': (64, 'plain'),
+    'sgemm': (32, 'plain'),
+    'hgemm': (16, 'plain'),
+    'hgemm_widening': (16, 'widening'),
+    'bgemm_widening': (8, 'widening'),
+    'hgemm_sdotp': (16, 'sdotp'),
+    'bgemm_sdotp': (8, 'sdotp'),
+}
+
+ROWS = (8, 6, 4, 3, 2, 1)
+
+# SEW: (element type, alpha and beta type, 1.0, name)
+TYPES = {
+    64: ('double', 'double', '1.0', 'fp64'),
+    32: ('float', 'float', '1.0f', 'fp32'),
+    16: ('__fp16', 'float', '1.0f', 'fp16'),
+    8: ('char', 'char', '0x3c // 1.0 in fp8 (e5m2)', 'fp8'),
+}
+
+FLOAD = {8: 'flb', 16: 'flh', 32: 'flw', 64: 'fld'}
+
+VREGS = 32
+# The A operands of a block live in scalar registers, next to alpha and beta
+MAX_ROWS = 16
+
+HEADER = '''\
+// Copyright 2023 ETH Zurich and University of Bologna.
+// Licensed under the Apache License, Version 2.0, see LICENSE for details.
+// SPDX-License-Identifier: Apache-2.0
+
+// This file was generated automatically by spatz_gemm/script/gen_kernels.py.
+
+'''
+
+
+def b_lmul(lmul, acc):
+    """LMUL of the B vectors for accumulators at lmul."""
+    return lmul // 2 if acc == 'widening' else lmul
+
+
+def allocate(rows, lmul, acc):
+    """Return the accumulator registers and the two B buffers of a block, or
+    None if they do not fit."""
+    lb = b_lmul(lmul, acc)
+    if lb < 1 or rows * lmul + 2 * lb > VREGS:
+        return None
+    accs = [i * lmul for i in range(rows)]
+    return accs, rows * lmul, rows * lmul + lb
+
+
+def default_lmul(rows, acc):
+    for lmul in (8, 4, 2, 1):
+        if allocate(rows, lmul, acc):
+            return lmul
+    return None
+
+
+def macro(name, body):
+    """A #define wrapped at 80 columns, with the backslashes aligned."""
+    line = '#define {} {}'.format(name, body)
+    if len(line) <= 80:
+        return line
+    out, cur = ['#define ' + name], ' '
+    for word in body.split(' '):
+        if len(cur) + len(word) + 1 > 77:
+            out.append(cur)
+            cur = ' '
+        cur += ' ' + word
+    out.append(cur)
+    return ' \\\n'.join(l.ljust(78) for l in out[:-1]) + ' \\\n' + out[-1]
+
+
+def kernel(rows, lmul, acc):
+    alloc = allocate(rows, lmul, acc)
+    if alloc is None:
+        sys.exit('error: {} rows do not fit at LMUL {}'.format(rows, lmul))
+    accs, vb0, vb1 = alloc
+    lb = b_lmul(lmul, acc)
+    return '\n'.join([
+        '// {}xVL: accumulators at m{}, B in v{} and v{}'.format(
+            rows, lmul, vb0, vb1),
+        '#define GEMM_KERNEL GEMM_FN(_{}xVL)'.format(rows),
+        '#define GEMM_R {}'.format(rows),
+        macro('GEMM_ROWS(X)', ' '.join(
+            'X({}, v{})'.format(i, v) for i, v in enumerate(accs))),
+        '#define GEMM_LMUL "m{}"'.format(lmul),
+        '#define GEMM_LMUL_B "m{}"'.format(lb),
+        '#define GEMM_VB0 "v{}"'.format(vb0),
+        '#define GEMM_VB1 "v{}"'.format(vb1),
+        '#include "gemm_kernel.h"',
+    ])
+
+
+def variant(name, sew, acc, rows, lmuls):
+    t, s, one, desc = TYPES[sew]
+    wdesc = TYPES[2 * sew][3] if acc != 'plain' else None
+    what = {'plain': '{} GEMM'.format(desc),
+            'widening': '{} GEMM accumulating in {}'.format(desc, wdesc),
+            'sdotp': '{} GEMM with pairwise dot products into {}'.format(
+                desc, wdesc)}[acc]
+    traits = [
+        ('GEMM_T', t),
+        ('GEMM_S', s),
+        ('GEMM_FN(x)', 'spatz_{}##x'.format(name)),
+        ('GEMM_DISPATCH', 'SPATZ_{}_DISPATCH'.format(name.upper())),
+        ('GEMM_SEW', '"e{}"'.format(sew)),
+        ('GEMM_VLE', '"vle{}.v"'.format(sew)),
+        ('GEMM_VSE', '"vse{}.v"'.format(sew)),
+        # sdotp multiplies a pair of A elements per step
+        ('GEMM_FLA', '"{}"'.format(
+            FLOAD[2 * sew] if acc == 'sdotp' else FLOAD[sew])),
+        ('GEMM_FLE', '"{}"'.format(FLOAD[sew])),
+        ('GEMM_MACC', {'plain': '"vfmacc.vf"', 'widening': '"vfwmacc.vf"',
+                       'sdotp': '"vfwdotp.vf"'}[acc]),
+        ('GEMM_ONE', one),
+    ]
+    if acc == 'widening':
+        traits += [('GEMM_WIDEN', '1'),
+                   ('GEMM_SEW_W', '"e{}"'.format(2 * sew))]
+    elif acc == 'sdotp':
+        traits += [('GEMM_SDOTP', '1')]
+
+    parts = [HEADER + '// ' + what + '\n']
+    parts.append('\n'.join('#define {} {}'.format(k, v) for k, v in traits) +
+                 '\n\n#include "gemm.h"\n')
+    for r in rows:
+        parts.append(kernel(r, lmuls.get(r) or default_lmul(r, acc), acc) +
+                     '\n')
+    parts.append('#define GEMM_KERNELS(X) ' +
+                 ' '.join('X({})'.format(r) for r in rows) +
+                 '\n#include "gemm_entry.h"\n')
+    return '\n'.join(parts)
+
+
+def parse_variant(spec):
+    """NAME, or NAME=SEW:ACCUMULATION for a new variant."""
+    if '=' not in spec:
+        if spec not in VARIANTS:
+            sys.exit('error: unknown variant {}'.format(spec))
+        return spec, VARIANTS[spec]
+    name, rest = spec.split('=')
+    sew, acc = rest.split(':')
+    return name, (int(sew), acc)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Generate the sources of the spatz_gemm variants.')
+    parser.add_argument('--variant', action='append', default=[],
+                        help='variant to generate, NAME or NAME=SEW:ACC with '
+                        'ACC plain, widening or sdotp, repeatable '
+                        '(default: all built-in variants)')
+    parser.add_argument('--rows', default=','.join(map(str, ROWS)),
+                        help='rows of the micro-kernels (default: {})'.format(
+                            ','.join(map(str, ROWS))))
+    parser.add_argument('--lmul', action='append', default=[],
+                        metavar='ROWS=LMUL',
+                        help='LMUL of the accumulators of a kernel, '
+                        'repeatable (default: the largest that fits)')
+    parser.add_argument('-o', '--out', default=os.path.join(
+        os.path.dirname(os.path.abspath(__file__)), '..'),
+        help='output directory (default: spatz_gemm)')
+    args = parser.parse_args()
+
+    rows = sorted({int(r) for r in args.rows.split(',')}, reverse=True)
+    # The smaller kernels take the rows the larger ones leave
+    if rows[-1] != 1 or rows[0] > MAX_ROWS:
+        sys.exit('error: the rows must include 1 and stay below {}'.format(
+            MAX_ROWS + 1))
+    lmuls = {int(r): int(l) for r, l in (s.split('=') for s in args.lmul)}
+
+    specs = args.variant or list(VARIANTS)
+    for name, (sew, acc) in map(parse_variant, specs):
+        if sew not in TYPES or acc not in ('plain', 'widening', 'sdotp'):
+            sys.exit('error: no {}-bit {} variant'.format(sew, acc))
+        if acc != 'plain' and 2 * sew not in TYPES:
+            sys.exit('error: no {}-bit accumulation'.format(2 * sew))
+        with open(os.path.join(args.out, name + '.c'), 'w') as f:
+            f.write(variant(name, sew, acc, rows, lmuls))
+
+
+if __name__ == '__main__':
+    main()
@@ -22,7 +22,10 @@
 #include <stdio.h>
 
 #include DATAHEADER
-#include "kernel/widening-fmatmul.c"
+#include <spatz_gemm.h>
+
+// 1.0 in fp8 (e5m2)
+#define FP8_ONE 0x3c
 
 char *a;
 char *b;
@@ -38,7 +41,6 @@ int main() {
 
   unsigned int m_start, m_end;
   unsigned int p_start, p_end;
-  unsigned int kernel_size;
 
   // Allocate the matrices in the local tile
   if (cid == 0) {
@@ -50,17 +52,19 @@ int main() {
   // Reset timer
   timer = (unsigned int)-1;
 
-  // Set matrix dimension
-  kernel_size = 8;
-
   // Wait for all cores to finish
   snrt_cluster_hw_barrier();
 
-  // Work over complete P dimension
-  p_start = 0;
-  p_end = gemm_l.N;
-  m_start = (gemm_l.M / num_cores) * cid;
-  m_end = (gemm_l.M / num_cores) * (cid + 1);
+  // Partition C across the cores, in whole vectors of columns
+  spatz_gemm_part part;
+  size_t vl;
+  asm volatile("vsetvli %0, zero, e8, m1, ta, ma" : "=r"(vl));
+  spatz_gemm_partition(gemm_l.M, gemm_l.N, gemm_l.K, num_cores, cid, vl, 0,
+                       &part);
+  p_start = part.p_start;
+  p_end = part.p_end;
+  m_start = part.m_start;
+  m_end = part.m_end;
 
   // Wait for all cores to finish
   snrt_cluster_hw_barrier();
@@ -85,15 +89,10 @@ int main() {
     if (cid == 0)
       start_kernel();
 
-    if (kernel_size == 2) {
-      matmul_2xVL(c, a, b, m_start, m_end, gemm_l.K, gemm_l.N, p_start, p_end);
-    } else if (kernel_size == 4) {
-      matmul_4xVL(c, a, b, m_start, m_end, gemm_l.K, gemm_l.N, p_start, p_end);
-    } else if (kernel_size == 8) {
-      matmul_8xVL(c, a, b, m_start, m_end, gemm_l.K, gemm_l.N, p_start, p_end);
-    } else {
-      return -2;
-    }
+    spatz_bgemm_widening(SPATZ_GEMM_NOTRANS, m_end - m_start, p_end - p_start,
+                         gemm_l.K, FP8_ONE, a + m_start * gemm_l.K, gemm_l.K,
+                         b + p_start, gemm_l.N, 0,
+                         c + m_start * gemm_l.N + p_start, gemm_l.N);
 
     // Wait for all cores to finish
     snrt_cluster_hw_barrier();
@@ -63,6 +63,9 @@ def main():
     with open(outdir / "bootdata_bootrom.cc", "w") as f:
         f.write(cluster_tb.render_bootdata_bootrom())
 
+    with open(outdir / "snrt_topology.h", "w") as f:
+        f.write(cluster_tb.render_topology())
+
     with open(outdir / "memories.json", "w") as f:
         f.write(cluster_tb.cluster.memory_cfg())
 
@@ -359,6 +359,13 @@ class SnitchCluster(Generator):
             log.error("The TCDM size must be a power of two.")
         elif is_pow2(self.cfg["tcdm"]["banks"]):
             log.error("The amount of banks must be a power of two.")
+        elif self.cfg["nr_clusters"] > 1 and self.cfg["axi_cdc_enable"]:
+            log.error("Multiple clusters are only supported without AXI CDC.")
+        elif self.cfg["nr_clusters"] > 1 and (
+            self.cfg.get("cluster_base_offset", 0)
+            < (self.cfg["tcdm"]["size"] + self.cfg["cluster_periph_size"]) * 1024
+        ):
+            log.error("`cluster_base_offset` must separate the clusters' TCDMs.")
         else:
             failed = False
 
@@ -392,8 +399,12 @@ class SnitchClusterTB(Generator):
             self.cfg["dram"]["length"],
             self.cfg["cluster"]["addr_width"],
         )
+        # Multi-cluster testbenches set the hart IDs and base addresses of each
+        # cluster through the ports.
         if "tie_ports" not in self.cfg["cluster"]:
-            self.cfg["cluster"]["tie_ports"] = True
+            self.cfg["cluster"]["tie_ports"] = (
+                self.cfg["cluster"].get("nr_clusters", 1) == 1
+            )
         # Store Snitch cluster config in separate variable
         self.cluster = SnitchCluster(cfg["cluster"], pma_cfg)
 
@@ -423,6 +434,11 @@ class SnitchClusterTB(Generator):
         cfg_template = self.templates.get_template("test/bootdata_bootrom.cc.tpl")
         return cfg_template.render_unicode(cfg=self.cfg)
 
+    def render_topology(self):
+        """Generate a C header with the cluster topology for the software"""
+        cfg_template = self.templates.get_template("test/snrt_topology.h.tpl")
+        return cfg_template.render_unicode(cfg=self.cfg, disclaimer=self.DISCLAIMER)
+
     def render_deps(self, dep_name):
         return self.cluster.render_deps(dep_name)
 
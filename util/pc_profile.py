@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+# Copyright 2020 ETH Zurich and University of Bologna.
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+# This script symbolizes the PC samples a program printed at exit (see
+# `snrt_profile_start`) against its ELF. It prints a flat profile of the
+# functions and can write folded stacks for flamegraph.pl or speedscope. Each
+# sample carries the interrupted `ra`, which names the caller of leaf
+# functions; in functions that already made calls it points into the function
+# itself and gives no context.
+
+import sys
+import json
+import bisect
+import shutil
+import argparse
+import subprocess
+from collections import defaultdict
+
+
+def parse(path, harts):
+    """Return [(hart, pc, ra, weight)] of the PC sample lines in a log. The
+    weight of a sample is the number of timer ticks it stands for."""
+    samples = []
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line.startswith('{"pc_samples"'):
+                continue
+            rec = json.loads(line)
+            if harts and rec['hart'] not in harts:
+                continue
+            for pc, ra in rec['pc_samples']:
+                samples.append((rec['hart'], pc, ra, rec['period']))
+    return samples
+
+
+class Symbols:
+    """Function symbols of an ELF, looked up by address."""
+
+    def __init__(self, elf, nm):
+        out = subprocess.run([nm, '-n', '-S', '--defined-only', elf],
+                             capture_output=True, text=True,
+                             check=True).stdout
+        self.addrs, self.ends, self.names = [], [], []
+        for line in out.splitlines():
+            fields = line.split()
+            if len(fields) < 3 or fields[-2] not in 'tTwW':
+                continue
+            addr = int(fields[0], 16)
+            size = int(fields[1], 16) if len(fields) == 4 else 0
+            self.addrs.append(addr)
+            self.ends.append(addr + size if size else None)
+            self.names.append(fields[-1])
+
+    def lookup(self, addr):
+        i = bisect.bisect_right(self.addrs, addr) - 1
+        if i < 0 or (self.ends[i] is not None and addr >= self.ends[i]):
+            return '0x{:08x}'.format(addr)
+        return self.names[i]
+
+
+def lines(elf, addr2line, pcs):
+    """Return {pc: 'file:line'} for the sampled PCs."""
+    pcs = sorted(pcs)
+    out = subprocess.run([addr2line, '-e', elf],
+                         input='\n'.join('0x{:x}'.format(pc) for pc in pcs),
+                         capture_output=True, text=True, check=True).stdout
+    return dict(zip(pcs, out.splitlines()))
+
+
+def find_tool(name, override):
+    if override:
+        return override
+    for tool in ('llvm-' + name, 'riscv32-unknown-elf-' + name, name):
+        if shutil.which(tool):
+            return tool
+    sys.exit('error: no {} found, pass --{}'.format(name, name))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Symbolize the PC samples of a simulation log.')
+    parser.add_argument('elf', help='binary that was run')
+    parser.add_argument('log', help='simulation log')
+    parser.add_argument('--hart', type=int, action='append', default=[],
+                        help='only use samples of this hart, repeatable')
+    parser.add_argument('--lines', action='store_true',
+                        help='profile source lines instead of functions')
+    parser.add_argument('--folded', metavar='FILE',
+                        help='write folded stacks for a flame graph')
+    parser.add_argument('--top', type=int, default=30,
+                        help='number of entries to print (default: 30)')
+    parser.add_argument('--nm', help='nm tool to read the symbols with')
+    parser.add_argument('--addr2line', help='addr2line tool for --lines')
+    args = parser.parse_args()
+
+    samples = parse(args.log, args.hart)
+    if not samples:
+        sys.exit('error: no PC samples in {}'.format(args.log))
+    syms = Symbols(args.elf, find_tool('nm', args.nm))
+    where = syms.lookup
+    if args.lines:
+        src = lines(args.elf, find_tool('addr2line', args.addr2line),
+                    {pc for _, pc, _, _ in samples})
+        where = lambda pc: '{} ({})'.format(src[pc], syms.lookup(pc))
+
+    flat = defaultdict(int)
+    stacks = defaultdict(int)
+    for _, pc, ra, weight in samples:
+        func = syms.lookup(pc)
+        # ra points behind the call instruction
+        caller = syms.lookup(ra - 1) if ra else func
+        flat[where(pc)] += weight
+        stack = func if caller == func else caller + ';' + func
+        stacks[stack] += weight
+
+    total = sum(flat.values())
+    print('{} samples, {} timer ticks'.format(len(samples), total))
+    print('{:>7} {:>14}  {}'.format('%', 'ticks', 'location'))
+    ranked = sorted(flat.items(), key=lambda kv: -kv[1])
+    for name, ticks in ranked[:args.top]:
+        print('{:>7.2f} {:>14}  {}'.format(100 * ticks / total, ticks, name))
+
+    if args.folded:
+        with open(args.folded, 'w') as f:
+            for stack, ticks in sorted(stacks.items()):
+                f.write('{} {}\n'.format(stack, ticks))
+
+
+if __name__ == '__main__':
+    main()
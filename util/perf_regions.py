@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+# Copyright 2020 ETH Zurich and University of Bologna.
+# Licensed under the Apache License, Version 2.0, see LICENSE for details.
+# SPDX-License-Identifier: Apache-2.0
+# This script collects the performance regions a program printed at exit (see
+# `snrt_perf_region_begin`) from a simulation log. Events that were only
+# counted in some runs of a region are extrapolated to all of its runs. With
+# two logs, it prints the difference of the second against the first.
+
+import sys
+import json
+import argparse
+from collections import defaultdict
+
+
+def parse(path):
+    """Return {(region, hart): record} of the perf region lines in a log."""
+    regions = {}
+    with open(path) as f:
+        for line in f:
+            line = line.strip()
+            if not line.startswith('{"perf_region"'):
+                continue
+            rec = json.loads(line)
+            regions[(rec['perf_region'], rec['hart'])] = rec
+    return regions
+
+
+def estimate(rec):
+    """Cycles and extrapolated events of a region record."""
+    res = {'runs': rec['runs'], 'cycles': rec['cycles']}
+    for name, (total, samples) in rec['events'].items():
+        res[name] = total * rec['runs'] / samples
+    return res
+
+
+def summarize(regions, per_hart):
+    """Sum the regions over the harts unless `per_hart` is set."""
+    out = defaultdict(lambda: defaultdict(float))
+    for (region, hart), rec in regions.items():
+        key = (region, hart) if per_hart else (region, '*')
+        for name, value in estimate(rec).items():
+            out[key][name] += value
+    return out
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Summarize the performance regions of a simulation log.')
+    parser.add_argument('log', help='simulation log')
+    parser.add_argument('base', nargs='?',
+                        help='log to compare against, printed as deltas')
+    parser.add_argument('--per-hart', action='store_true',
+                        help='do not sum the regions over the harts')
+    parser.add_argument('--json', action='store_true',
+                        help='print JSON instead of a table')
+    args = parser.parse_args()
+
+    cur = summarize(parse(args.log), args.per_hart)
+    base = summarize(parse(args.base), args.per_hart) if args.base else None
+
+    rows = {}
+    for key, values in sorted(cur.items()):
+        row = {}
+        for name, value in values.items():
+            if base is not None:
+                value -= base.get(key, {}).get(name, 0)
+            row[name] = value
+        rows['{}@{}'.format(*key)] = row
+
+    if args.json:
+        json.dump(rows, sys.stdout, indent=2)
+        print()
+        return
+    for key, row in rows.items():
+        print(key)
+        for name, value in sorted(row.items()):
+            print('  {:<20} {:>14.0f}'.format(name, value))
+
+
+if __name__ == '__main__':
+    main()